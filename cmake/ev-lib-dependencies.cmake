@@ -58,14 +58,14 @@ set(EVEREST_LIB_DEPS_io "util")
 set(EVEREST_LIB_DEPS_run_application "log")
 set(EVEREST_LIB_DEPS_evse_security "cbv2g")
 # Tier 2
-set(EVEREST_LIB_DEPS_ocpp "log;timer;evse_security;sqlite")
+set(EVEREST_LIB_DEPS_ocpp "log;timer;evse_security;sqlite;util")
 set(EVEREST_LIB_DEPS_iso15118 "cbv2g")
 set(EVEREST_LIB_DEPS_ieee2030_1_1 "framework")
 # Tier 3 (framework-coupled)
 set(EVEREST_LIB_DEPS_tls "util;evse_security;framework")
 set(EVEREST_LIB_DEPS_helpers "tls;framework")
 set(EVEREST_LIB_DEPS_external_energy_limits "framework")
-set(EVEREST_LIB_DEPS_everest_api_types "")
+set(EVEREST_LIB_DEPS_everest_api_types "util")
 set(EVEREST_LIB_DEPS_conversions "framework;evse_security")
 set(EVEREST_LIB_DEPS_slac "tls")
 
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+// Serialization and parsing of API types through the json codecs compared to the streaming codecs. Each codec
+// parses the text it wrote, the json codecs write indented text unless EVEREST_API_JSON_INDENT is set.
+//
+// usage: everest_api_types_json_stream_benchmark [iterations]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include <everest_api_types/money/codec.hpp>
+#include <everest_api_types/money/json_stream.hpp>
+#include <everest_api_types/powermeter/codec.hpp>
+#include <everest_api_types/powermeter/json_stream.hpp>
+#include <everest_api_types/utilities/codec.hpp>
+
+using namespace everest::lib::API;
+using namespace everest::lib::API::V1_0::types;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+std::atomic<std::uint64_t> allocations{0};
+} // namespace
+
+// count every heap allocation of the process, the benchmark is single threaded
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+powermeter::PowermeterValues create_powermeter_values() {
+    using namespace powermeter;
+    const SignedMeterValue signed_value{"T0NNRnx7IkZWIjoiMS4wIiwiR0kiOiJEWkcgR1NIMjAwIn0=", "ECDSA-secp256r1-SHA256",
+                                        "base64", "MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAE", "2026-01-01T12:00:00.000Z"};
+    PowermeterValues values;
+    values.timestamp = "2026-01-01T12:00:00.000Z";
+    values.meter_id = "DZG-GSH200-0001";
+    values.energy_Wh_import = {123456.7f, 41152.2f, 41152.3f, 41152.2f};
+    values.energy_Wh_export = Energy{12.5f, std::nullopt, std::nullopt, std::nullopt};
+    values.power_W = Power{11040.0f, 3680.1f, 3679.8f, 3680.1f};
+    values.voltage_V = Voltage{std::nullopt, 230.1f, 229.8f, 230.4f};
+    values.current_A = Current{std::nullopt, 16.0f, 15.9f, 16.1f, 0.2f};
+    values.frequency_Hz = Frequency{50.01f, 50.01f, 50.0f};
+    values.VAR = ReactivePower{12.0f, 4.0f, 4.0f, 4.0f};
+    values.energy_Wh_import_signed = SignedEnergy{signed_value, std::nullopt, std::nullopt, std::nullopt};
+    values.temperatures = std::vector<Temperature>{{41.5f, std::string("PT1000"), std::string("plug")}};
+    return values;
+}
+
+money::Price create_price() {
+    return {{money::CurrencyCode::EUR, 2}, {4711}};
+}
+
+struct result {
+    double ns_per_message;
+    double allocations_per_message;
+};
+
+template <class Function> result measure(int iterations, Function&& function) {
+    const auto start_allocations = allocations.load();
+    const auto start = clock_type::now();
+    for (int i = 0; i < iterations; i++) {
+        function();
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+    return {elapsed / iterations, static_cast<double>(allocations.load() - start_allocations) / iterations};
+}
+
+void print(const std::string& type, const std::string& path, std::size_t size, const result& r) {
+    printf("%-18s %-20s %9zu %14.0f %14.1f %10.1f\n", type.c_str(), path.c_str(), size, r.ns_per_message,
+           r.allocations_per_message, size * 1e3 / r.ns_per_message);
+}
+
+template <class T> void report(const std::string& name, T const& value, int iterations) {
+    std::size_t sink = 0;
+
+    std::string text;
+    const auto codec_serialize = measure(iterations, [&] {
+        text = serialize(value);
+        sink += text.size();
+    });
+    print(name, "serialize", text.size(), codec_serialize);
+
+    std::string buffer;
+    const auto stream_serialize = measure(iterations, [&] {
+        buffer.clear();
+        serialize_into(buffer, value);
+        sink += buffer.size();
+    });
+    print(name, "serialize_into", buffer.size(), stream_serialize);
+
+    const auto codec_deserialize = measure(iterations, [&] {
+        T parsed;
+        sink += deserialize(text, parsed) ? 1 : 0;
+    });
+    print(name, "deserialize", text.size(), codec_deserialize);
+
+    const auto stream_deserialize = measure(iterations, [&] {
+        const auto parsed = deserialize_from<T>(buffer);
+        sink += sizeof(parsed);
+    });
+    print(name, "deserialize_from", buffer.size(), stream_deserialize);
+
+    if (sink == 0) {
+        printf("nothing serialized\n");
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int iterations = (argc > 1) ? std::atoi(argv[1]) : 20000;
+
+    printf("%-18s %-20s %9s %14s %14s %10s\n", "type", "path", "bytes", "ns/message", "allocs/message", "MB/s");
+    report("PowermeterValues", create_powermeter_values(), iterations);
+    report("Price", create_price(), iterations);
+
+    return EXIT_SUCCESS;
+}
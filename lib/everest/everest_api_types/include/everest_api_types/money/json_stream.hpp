@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include "API.hpp"
+#include <everest_api_types/utilities/json_stream.hpp>
+
+namespace everest::lib::API::V1_0::types::money {
+
+// Streaming counterparts of the json codecs. Objects are written with sorted keys, which makes the text identical to
+// nlohmann::json(k).dump(). Use serialize_into() and deserialize_from<T>() from utilities/json_stream.hpp.
+
+void write_json(JsonWriter& writer, CurrencyCode k);
+void read_json(JsonReader& reader, CurrencyCode& k);
+
+void write_json(JsonWriter& writer, Currency const& k);
+void read_json(JsonReader& reader, Currency& k);
+
+void write_json(JsonWriter& writer, MoneyAmount const& k);
+void read_json(JsonReader& reader, MoneyAmount& k);
+
+void write_json(JsonWriter& writer, Price const& k);
+void read_json(JsonReader& reader, Price& k);
+
+} // namespace everest::lib::API::V1_0::types::money
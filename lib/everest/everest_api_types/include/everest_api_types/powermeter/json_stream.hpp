@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include "API.hpp"
+#include <everest_api_types/utilities/json_stream.hpp>
+
+namespace everest::lib::API::V1_0::types::powermeter {
+
+// Streaming counterparts of the json codecs. Objects are written with sorted keys, which makes the text identical to
+// nlohmann::json(k).dump(). Use serialize_into() and deserialize_from<T>() from utilities/json_stream.hpp.
+
+void write_json(JsonWriter& writer, OCMFUserIdentificationStatus k);
+void read_json(JsonReader& reader, OCMFUserIdentificationStatus& k);
+
+void write_json(JsonWriter& writer, OCMFIdentificationFlags k);
+void read_json(JsonReader& reader, OCMFIdentificationFlags& k);
+
+void write_json(JsonWriter& writer, OCMFIdentificationType k);
+void read_json(JsonReader& reader, OCMFIdentificationType& k);
+
+void write_json(JsonWriter& writer, OCMFIdentificationLevel k);
+void read_json(JsonReader& reader, OCMFIdentificationLevel& k);
+
+void write_json(JsonWriter& writer, Current const& k);
+void read_json(JsonReader& reader, Current& k);
+
+void write_json(JsonWriter& writer, Voltage const& k);
+void read_json(JsonReader& reader, Voltage& k);
+
+void write_json(JsonWriter& writer, Frequency const& k);
+void read_json(JsonReader& reader, Frequency& k);
+
+void write_json(JsonWriter& writer, Power const& k);
+void read_json(JsonReader& reader, Power& k);
+
+void write_json(JsonWriter& writer, Energy const& k);
+void read_json(JsonReader& reader, Energy& k);
+
+void write_json(JsonWriter& writer, ReactivePower const& k);
+void read_json(JsonReader& reader, ReactivePower& k);
+
+void write_json(JsonWriter& writer, SignedMeterValue const& k);
+void read_json(JsonReader& reader, SignedMeterValue& k);
+
+void write_json(JsonWriter& writer, SignedCurrent const& k);
+void read_json(JsonReader& reader, SignedCurrent& k);
+
+void write_json(JsonWriter& writer, SignedVoltage const& k);
+void read_json(JsonReader& reader, SignedVoltage& k);
+
+void write_json(JsonWriter& writer, SignedFrequency const& k);
+void read_json(JsonReader& reader, SignedFrequency& k);
+
+void write_json(JsonWriter& writer, SignedPower const& k);
+void read_json(JsonReader& reader, SignedPower& k);
+
+void write_json(JsonWriter& writer, SignedEnergy const& k);
+void read_json(JsonReader& reader, SignedEnergy& k);
+
+void write_json(JsonWriter& writer, SignedReactivePower const& k);
+void read_json(JsonReader& reader, SignedReactivePower& k);
+
+void write_json(JsonWriter& writer, Temperature const& k);
+void read_json(JsonReader& reader, Temperature& k);
+
+void write_json(JsonWriter& writer, PowermeterValues const& k);
+void read_json(JsonReader& reader, PowermeterValues& k);
+
+void write_json(JsonWriter& writer, TransactionStatus k);
+void read_json(JsonReader& reader, TransactionStatus& k);
+
+void write_json(JsonWriter& writer, ReplyStartTransaction const& k);
+void read_json(JsonReader& reader, ReplyStartTransaction& k);
+
+void write_json(JsonWriter& writer, ReplyStopTransaction const& k);
+void read_json(JsonReader& reader, ReplyStopTransaction& k);
+
+void write_json(JsonWriter& writer, RequestStartTransaction const& k);
+void read_json(JsonReader& reader, RequestStartTransaction& k);
+
+} // namespace everest::lib::API::V1_0::types::powermeter
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <everest/util/json/json_stream.hpp>
+
+namespace everest::lib::API {
+
+// The writer, the reader and the overloads for the standard types are shared with other libraries, see
+// everest/util/json/json_stream.hpp. The overloads are found by argument dependent lookup on the JsonWriter and
+// JsonReader as well.
+using everest::lib::util::JsonReader;
+using everest::lib::util::JsonStreamException;
+using everest::lib::util::JsonWriter;
+using everest::lib::util::read_json;
+using everest::lib::util::write_json;
+using everest::lib::util::write_member;
+
+/// \brief Appends \p obj as JSON text to \p buffer. The result parses to the same value as serialize(obj).
+template <class T> void serialize_into(std::string& buffer, T const& obj) {
+    JsonWriter writer(buffer);
+    write_json(writer, obj);
+}
+
+/// \brief Reads \p json_data into a T, accepting the same input as deserialize<T>()
+/// \throws JsonStreamException or std::out_of_range for invalid enum values
+template <class T> T deserialize_from(std::string_view json_data) {
+    JsonReader reader(json_data);
+    T obj;
+    read_json(reader, obj);
+    reader.end();
+    return obj;
+}
+
+} // namespace everest::lib::API
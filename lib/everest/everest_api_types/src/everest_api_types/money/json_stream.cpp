@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include "money/json_stream.hpp"
+#include "nlohmann/json.hpp"
+#include "money/json_codec.hpp"
+
+namespace everest::lib::API::V1_0::types::money {
+
+// enum spellings are only defined by the json codec, enums are rare compared to numbers and strings
+using json = nlohmann::json;
+
+void write_json(JsonWriter& writer, CurrencyCode k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, CurrencyCode& k) {
+    k = json(reader.read_string()).get<CurrencyCode>();
+}
+
+void write_json(JsonWriter& writer, Currency const& k) {
+    writer.begin_object();
+    write_member(writer, "code", k.code);
+    write_member(writer, "decimals", k.decimals);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Currency& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "code") {
+            read_json(reader, k.code);
+        } else if (key == "decimals") {
+            read_json(reader, k.decimals);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, MoneyAmount const& k) {
+    writer.begin_object();
+    write_member(writer, "value", k.value);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, MoneyAmount& k) {
+    bool has_value = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "value") {
+            read_json(reader, k.value);
+            has_value = true;
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_value, "value");
+}
+
+void write_json(JsonWriter& writer, Price const& k) {
+    writer.begin_object();
+    write_member(writer, "currency", k.currency);
+    write_member(writer, "value", k.value);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Price& k) {
+    bool has_currency = false;
+    bool has_value = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "currency") {
+            read_json(reader, k.currency);
+            has_currency = true;
+        } else if (key == "value") {
+            read_json(reader, k.value);
+            has_value = true;
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_currency, "currency");
+    reader.require(has_value, "value");
+}
+
+} // namespace everest::lib::API::V1_0::types::money
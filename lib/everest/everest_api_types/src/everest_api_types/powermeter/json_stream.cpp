@@ -0,0 +1,621 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include "powermeter/json_stream.hpp"
+#include "nlohmann/json.hpp"
+#include "powermeter/json_codec.hpp"
+
+namespace everest::lib::API::V1_0::types::powermeter {
+
+// enum spellings are only defined by the json codec, enums are rare compared to numbers and strings
+using json = nlohmann::json;
+
+void write_json(JsonWriter& writer, OCMFUserIdentificationStatus k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, OCMFUserIdentificationStatus& k) {
+    k = json(reader.read_string()).get<OCMFUserIdentificationStatus>();
+}
+
+void write_json(JsonWriter& writer, OCMFIdentificationFlags k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, OCMFIdentificationFlags& k) {
+    k = json(reader.read_string()).get<OCMFIdentificationFlags>();
+}
+
+void write_json(JsonWriter& writer, OCMFIdentificationType k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, OCMFIdentificationType& k) {
+    k = json(reader.read_string()).get<OCMFIdentificationType>();
+}
+
+void write_json(JsonWriter& writer, OCMFIdentificationLevel k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, OCMFIdentificationLevel& k) {
+    k = json(reader.read_string()).get<OCMFIdentificationLevel>();
+}
+
+void write_json(JsonWriter& writer, Current const& k) {
+    writer.begin_object();
+    write_member(writer, "DC", k.DC);
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "N", k.N);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Current& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "DC") {
+            read_json(reader, k.DC);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else if (key == "N") {
+            read_json(reader, k.N);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, Voltage const& k) {
+    writer.begin_object();
+    write_member(writer, "DC", k.DC);
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Voltage& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "DC") {
+            read_json(reader, k.DC);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, Frequency const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Frequency& k) {
+    bool has_L1 = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "L1") {
+            read_json(reader, k.L1);
+            has_L1 = true;
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_L1, "L1");
+}
+
+void write_json(JsonWriter& writer, Power const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Power& k) {
+    bool has_total = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+            has_total = true;
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_total, "total");
+}
+
+void write_json(JsonWriter& writer, Energy const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Energy& k) {
+    bool has_total = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+            has_total = true;
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_total, "total");
+}
+
+void write_json(JsonWriter& writer, ReactivePower const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, ReactivePower& k) {
+    bool has_total = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+            has_total = true;
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_total, "total");
+}
+
+void write_json(JsonWriter& writer, SignedMeterValue const& k) {
+    writer.begin_object();
+    write_member(writer, "encoding_method", k.encoding_method);
+    write_member(writer, "public_key", k.public_key);
+    write_member(writer, "signed_meter_data", k.signed_meter_data);
+    write_member(writer, "signing_method", k.signing_method);
+    write_member(writer, "timestamp", k.timestamp);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedMeterValue& k) {
+    bool has_signed_meter_data = false;
+    bool has_signing_method = false;
+    bool has_encoding_method = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "signed_meter_data") {
+            read_json(reader, k.signed_meter_data);
+            has_signed_meter_data = true;
+        } else if (key == "signing_method") {
+            read_json(reader, k.signing_method);
+            has_signing_method = true;
+        } else if (key == "encoding_method") {
+            read_json(reader, k.encoding_method);
+            has_encoding_method = true;
+        } else if (key == "public_key") {
+            read_json(reader, k.public_key);
+        } else if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_signed_meter_data, "signed_meter_data");
+    reader.require(has_signing_method, "signing_method");
+    reader.require(has_encoding_method, "encoding_method");
+}
+
+void write_json(JsonWriter& writer, SignedCurrent const& k) {
+    writer.begin_object();
+    write_member(writer, "DC", k.DC);
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "N", k.N);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedCurrent& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "DC") {
+            read_json(reader, k.DC);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else if (key == "N") {
+            read_json(reader, k.N);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, SignedVoltage const& k) {
+    writer.begin_object();
+    write_member(writer, "DC", k.DC);
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedVoltage& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "DC") {
+            read_json(reader, k.DC);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, SignedFrequency const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedFrequency& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, SignedPower const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedPower& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, SignedEnergy const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedEnergy& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, SignedReactivePower const& k) {
+    writer.begin_object();
+    write_member(writer, "L1", k.L1);
+    write_member(writer, "L2", k.L2);
+    write_member(writer, "L3", k.L3);
+    write_member(writer, "total", k.total);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, SignedReactivePower& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "total") {
+            read_json(reader, k.total);
+        } else if (key == "L1") {
+            read_json(reader, k.L1);
+        } else if (key == "L2") {
+            read_json(reader, k.L2);
+        } else if (key == "L3") {
+            read_json(reader, k.L3);
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, Temperature const& k) {
+    writer.begin_object();
+    write_member(writer, "identification", k.identification);
+    write_member(writer, "location", k.location);
+    write_member(writer, "temperature", k.temperature);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, Temperature& k) {
+    bool has_temperature = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "temperature") {
+            read_json(reader, k.temperature);
+            has_temperature = true;
+        } else if (key == "identification") {
+            read_json(reader, k.identification);
+        } else if (key == "location") {
+            read_json(reader, k.location);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_temperature, "temperature");
+}
+
+void write_json(JsonWriter& writer, PowermeterValues const& k) {
+    writer.begin_object();
+    write_member(writer, "VAR", k.VAR);
+    write_member(writer, "VAR_signed", k.VAR_signed);
+    write_member(writer, "current_A", k.current_A);
+    write_member(writer, "current_A_signed", k.current_A_signed);
+    write_member(writer, "energy_Wh_export", k.energy_Wh_export);
+    write_member(writer, "energy_Wh_export_signed", k.energy_Wh_export_signed);
+    write_member(writer, "energy_Wh_import", k.energy_Wh_import);
+    write_member(writer, "energy_Wh_import_signed", k.energy_Wh_import_signed);
+    write_member(writer, "frequency_Hz", k.frequency_Hz);
+    write_member(writer, "frequency_Hz_signed", k.frequency_Hz_signed);
+    write_member(writer, "meter_id", k.meter_id);
+    write_member(writer, "phase_seq_error", k.phase_seq_error);
+    write_member(writer, "power_W", k.power_W);
+    write_member(writer, "power_W_signed", k.power_W_signed);
+    write_member(writer, "signed_meter_value", k.signed_meter_value);
+    write_member(writer, "temperatures", k.temperatures);
+    write_member(writer, "timestamp", k.timestamp);
+    write_member(writer, "voltage_V", k.voltage_V);
+    write_member(writer, "voltage_V_signed", k.voltage_V_signed);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, PowermeterValues& k) {
+    bool has_timestamp = false;
+    bool has_energy_Wh_import = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "energy_Wh_import") {
+            read_json(reader, k.energy_Wh_import);
+            has_energy_Wh_import = true;
+        } else if (key == "meter_id") {
+            read_json(reader, k.meter_id);
+        } else if (key == "phase_seq_error") {
+            read_json(reader, k.phase_seq_error);
+        } else if (key == "energy_Wh_export") {
+            read_json(reader, k.energy_Wh_export);
+        } else if (key == "power_W") {
+            read_json(reader, k.power_W);
+        } else if (key == "voltage_V") {
+            read_json(reader, k.voltage_V);
+        } else if (key == "VAR") {
+            read_json(reader, k.VAR);
+        } else if (key == "current_A") {
+            read_json(reader, k.current_A);
+        } else if (key == "frequency_Hz") {
+            read_json(reader, k.frequency_Hz);
+        } else if (key == "energy_Wh_import_signed") {
+            read_json(reader, k.energy_Wh_import_signed);
+        } else if (key == "energy_Wh_export_signed") {
+            read_json(reader, k.energy_Wh_export_signed);
+        } else if (key == "power_W_signed") {
+            read_json(reader, k.power_W_signed);
+        } else if (key == "voltage_V_signed") {
+            read_json(reader, k.voltage_V_signed);
+        } else if (key == "VAR_signed") {
+            read_json(reader, k.VAR_signed);
+        } else if (key == "current_A_signed") {
+            read_json(reader, k.current_A_signed);
+        } else if (key == "frequency_Hz_signed") {
+            read_json(reader, k.frequency_Hz_signed);
+        } else if (key == "signed_meter_value") {
+            read_json(reader, k.signed_meter_value);
+        } else if (key == "temperatures") {
+            read_json(reader, k.temperatures);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_timestamp, "timestamp");
+    reader.require(has_energy_Wh_import, "energy_Wh_import");
+}
+
+void write_json(JsonWriter& writer, TransactionStatus k) {
+    writer.value(json(k).get_ref<std::string const&>());
+}
+void read_json(JsonReader& reader, TransactionStatus& k) {
+    k = json(reader.read_string()).get<TransactionStatus>();
+}
+
+void write_json(JsonWriter& writer, ReplyStartTransaction const& k) {
+    writer.begin_object();
+    write_member(writer, "error", k.error);
+    write_member(writer, "status", k.status);
+    write_member(writer, "transaction_max_stop_time", k.transaction_max_stop_time);
+    write_member(writer, "transaction_min_stop_time", k.transaction_min_stop_time);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, ReplyStartTransaction& k) {
+    bool has_status = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "status") {
+            read_json(reader, k.status);
+            has_status = true;
+        } else if (key == "error") {
+            read_json(reader, k.error);
+        } else if (key == "transaction_min_stop_time") {
+            read_json(reader, k.transaction_min_stop_time);
+        } else if (key == "transaction_max_stop_time") {
+            read_json(reader, k.transaction_max_stop_time);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_status, "status");
+}
+
+void write_json(JsonWriter& writer, ReplyStopTransaction const& k) {
+    writer.begin_object();
+    write_member(writer, "error", k.error);
+    write_member(writer, "signed_meter_value", k.signed_meter_value);
+    write_member(writer, "start_signed_meter_value", k.start_signed_meter_value);
+    write_member(writer, "status", k.status);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, ReplyStopTransaction& k) {
+    bool has_status = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "status") {
+            read_json(reader, k.status);
+            has_status = true;
+        } else if (key == "start_signed_meter_value") {
+            read_json(reader, k.start_signed_meter_value);
+        } else if (key == "signed_meter_value") {
+            read_json(reader, k.signed_meter_value);
+        } else if (key == "error") {
+            read_json(reader, k.error);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_status, "status");
+}
+
+void write_json(JsonWriter& writer, RequestStartTransaction const& k) {
+    writer.begin_object();
+    write_member(writer, "evse_id", k.evse_id);
+    write_member(writer, "identification_data", k.identification_data);
+    write_member(writer, "identification_flags", k.identification_flags);
+    write_member(writer, "identification_level", k.identification_level);
+    write_member(writer, "identification_status", k.identification_status);
+    write_member(writer, "identification_type", k.identification_type);
+    write_member(writer, "tariff_text", k.tariff_text);
+    write_member(writer, "transaction_id", k.transaction_id);
+    writer.end_object();
+}
+void read_json(JsonReader& reader, RequestStartTransaction& k) {
+    bool has_evse_id = false;
+    bool has_transaction_id = false;
+    bool has_identification_status = false;
+    bool has_identification_type = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        auto const& key = reader.key();
+        if (key == "evse_id") {
+            read_json(reader, k.evse_id);
+            has_evse_id = true;
+        } else if (key == "transaction_id") {
+            read_json(reader, k.transaction_id);
+            has_transaction_id = true;
+        } else if (key == "identification_status") {
+            read_json(reader, k.identification_status);
+            has_identification_status = true;
+        } else if (key == "identification_flags") {
+            read_json(reader, k.identification_flags);
+        } else if (key == "identification_type") {
+            read_json(reader, k.identification_type);
+            has_identification_type = true;
+        } else if (key == "identification_level") {
+            read_json(reader, k.identification_level);
+        } else if (key == "identification_data") {
+            read_json(reader, k.identification_data);
+        } else if (key == "tariff_text") {
+            read_json(reader, k.tariff_text);
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_evse_id, "evse_id");
+    reader.require(has_transaction_id, "transaction_id");
+    reader.require(has_identification_status, "identification_status");
+    reader.require(has_identification_type, "identification_type");
+}
+
+} // namespace everest::lib::API::V1_0::types::powermeter
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include "everest_api_types/money/codec.hpp"
+#include "everest_api_types/money/json_stream.hpp"
+#include "everest_api_types/powermeter/codec.hpp"
+#include "everest_api_types/powermeter/json_stream.hpp"
+#include "everest_api_types/utilities/codec.hpp"
+#include "nlohmann/json.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace everest::lib::API;
+using namespace everest::lib::API::V1_0::types;
+
+namespace {
+
+// Random values for property tests comparing the streaming codec with the json codec. The seed is fixed so failures
+// are reproducible.
+class RandomValues {
+public:
+    bool coin() {
+        return std::uniform_int_distribution<int>(0, 1)(engine) == 1;
+    }
+
+    template <class T> std::optional<T> maybe(T value) {
+        if (coin()) {
+            return value;
+        }
+        return std::nullopt;
+    }
+
+    float number() {
+        switch (std::uniform_int_distribution<int>(0, 3)(engine)) {
+        case 0:
+            return static_cast<float>(std::uniform_int_distribution<int>(-1000, 100000)(engine));
+        case 1:
+            return std::uniform_real_distribution<float>(-1.0f, 1.0f)(engine);
+        case 2:
+            return std::uniform_real_distribution<float>(-1e9f, 1e9f)(engine);
+        default:
+            return std::uniform_real_distribution<float>(0.0f, 1e-6f)(engine);
+        }
+    }
+
+    std::int32_t integer() {
+        return std::uniform_int_distribution<std::int32_t>(std::numeric_limits<std::int32_t>::min(),
+                                                           std::numeric_limits<std::int32_t>::max())(engine);
+    }
+
+    std::string text() {
+        static const std::vector<std::string> pieces = {"a", "Z", "0", " ", "\"", "\\", "/", "\n", "\t", "\x01",
+                                                        "\x1f", "\xc3\xa4", "\xe2\x82\xac", "\xf0\x9f\x98\x80"};
+        std::string result;
+        const auto length = std::uniform_int_distribution<int>(0, 12)(engine);
+        for (int i = 0; i < length; i++) {
+            result += pieces[std::uniform_int_distribution<std::size_t>(0, pieces.size() - 1)(engine)];
+        }
+        return result;
+    }
+
+    template <class T> T pick(std::initializer_list<T> values) {
+        return *(values.begin() + std::uniform_int_distribution<std::size_t>(0, values.size() - 1)(engine));
+    }
+
+private:
+    std::mt19937 engine{20260101};
+};
+
+powermeter::SignedMeterValue signed_meter_value(RandomValues& r) {
+    return {r.text(), r.text(), r.text(), r.maybe(r.text()), r.maybe(r.text())};
+}
+
+powermeter::PowermeterValues powermeter_values(RandomValues& r) {
+    using namespace powermeter;
+    PowermeterValues v;
+    v.timestamp = r.text();
+    v.energy_Wh_import = {r.number(), r.maybe(r.number()), r.maybe(r.number()), r.maybe(r.number())};
+    v.meter_id = r.maybe(r.text());
+    v.phase_seq_error = r.maybe(r.coin());
+    v.energy_Wh_export = r.maybe(Energy{r.number(), r.maybe(r.number()), std::nullopt, r.maybe(r.number())});
+    v.power_W = r.maybe(Power{r.number(), r.maybe(r.number()), r.maybe(r.number()), r.maybe(r.number())});
+    v.voltage_V = r.maybe(Voltage{r.maybe(r.number()), r.maybe(r.number()), r.maybe(r.number()), std::nullopt});
+    v.VAR = r.maybe(ReactivePower{r.number(), std::nullopt, r.maybe(r.number()), r.maybe(r.number())});
+    v.current_A = r.maybe(Current{r.maybe(r.number()), r.maybe(r.number()), r.maybe(r.number()), r.maybe(r.number()),
+                                  r.maybe(r.number())});
+    v.frequency_Hz = r.maybe(Frequency{r.number(), r.maybe(r.number()), r.maybe(r.number())});
+    v.energy_Wh_import_signed = r.maybe(SignedEnergy{r.maybe(signed_meter_value(r)), std::nullopt, std::nullopt,
+                                                     r.maybe(signed_meter_value(r))});
+    v.power_W_signed = r.maybe(SignedPower{r.maybe(signed_meter_value(r)), std::nullopt, std::nullopt, std::nullopt});
+    v.current_A_signed =
+        r.maybe(SignedCurrent{std::nullopt, r.maybe(signed_meter_value(r)), std::nullopt, std::nullopt, std::nullopt});
+    v.frequency_Hz_signed = r.maybe(SignedFrequency{r.maybe(signed_meter_value(r)), std::nullopt, std::nullopt});
+    v.signed_meter_value = r.maybe(signed_meter_value(r));
+    if (r.coin()) {
+        v.temperatures.emplace();
+        const auto count = r.pick({0, 1, 3});
+        for (int i = 0; i < count; i++) {
+            v.temperatures->push_back({r.number(), r.maybe(r.text()), r.maybe(r.text())});
+        }
+    }
+    return v;
+}
+
+powermeter::RequestStartTransaction request_start_transaction(RandomValues& r) {
+    using namespace powermeter;
+    RequestStartTransaction v;
+    v.evse_id = r.text();
+    v.transaction_id = r.text();
+    v.identification_status =
+        r.pick({OCMFUserIdentificationStatus::ASSIGNED, OCMFUserIdentificationStatus::NOT_ASSIGNED});
+    const auto flags = r.pick({0, 1, 2});
+    for (int i = 0; i < flags; i++) {
+        v.identification_flags.push_back(
+            r.pick({OCMFIdentificationFlags::RFID_PLAIN, OCMFIdentificationFlags::OCPP_AUTH,
+                    OCMFIdentificationFlags::ISO15118_PNC}));
+    }
+    v.identification_type = r.pick({OCMFIdentificationType::NONE, OCMFIdentificationType::ISO14443,
+                                    OCMFIdentificationType::EMAID});
+    v.identification_level = r.maybe(r.pick({OCMFIdentificationLevel::NONE, OCMFIdentificationLevel::HEARSAY}));
+    v.identification_data = r.maybe(r.text());
+    v.tariff_text = r.maybe(r.text());
+    return v;
+}
+
+money::Price price(RandomValues& r) {
+    using namespace money;
+    Price v;
+    v.currency.code = r.maybe(r.pick({CurrencyCode::EUR, CurrencyCode::USD, CurrencyCode::JPY}));
+    v.currency.decimals = r.maybe(r.pick({0, 2, 3}));
+    v.value.value = r.integer();
+    return v;
+}
+
+// The properties every streamed type has to fulfill with respect to the json codec. Values are compared after reading
+// them back, since not every value survives a round trip, e.g. a missing Currency::decimals is read back as 2.
+template <class T> void expect_compatible(T const& original) {
+    const auto expected = serialize(original);
+    T reference;
+    ASSERT_TRUE(deserialize(expected, reference));
+
+    std::string buffer = "reused";
+    buffer.clear();
+    serialize_into(buffer, original);
+    EXPECT_EQ(buffer, nlohmann::json::parse(expected).dump());
+
+    EXPECT_EQ(serialize(deserialize_from<T>(buffer)), serialize(reference));
+    EXPECT_EQ(serialize(deserialize_from<T>(expected)), serialize(reference));
+
+    T parsed;
+    ASSERT_TRUE(deserialize(buffer, parsed));
+    EXPECT_EQ(serialize(parsed), serialize(reference));
+}
+
+constexpr int iterations = 500;
+
+} // namespace
+
+TEST(JsonStream, PowermeterValuesAreCompatibleWithJsonCodec) {
+    RandomValues r;
+    for (int i = 0; i < iterations; i++) {
+        SCOPED_TRACE(i);
+        expect_compatible(powermeter_values(r));
+    }
+}
+
+TEST(JsonStream, PowermeterTransactionsAreCompatibleWithJsonCodec) {
+    RandomValues r;
+    for (int i = 0; i < iterations; i++) {
+        SCOPED_TRACE(i);
+        expect_compatible(request_start_transaction(r));
+        expect_compatible(powermeter::ReplyStartTransaction{
+            r.pick({powermeter::TransactionStatus::OK, powermeter::TransactionStatus::NOT_SUPPORTED}),
+            r.maybe(r.text()), r.maybe(r.text()), r.maybe(r.text())});
+        expect_compatible(powermeter::ReplyStopTransaction{powermeter::TransactionStatus::UNEXPECTED_ERROR,
+                                                           r.maybe(signed_meter_value(r)),
+                                                           r.maybe(signed_meter_value(r)), r.maybe(r.text())});
+    }
+}
+
+TEST(JsonStream, MoneyIsCompatibleWithJsonCodec) {
+    RandomValues r;
+    for (int i = 0; i < iterations; i++) {
+        SCOPED_TRACE(i);
+        expect_compatible(price(r));
+    }
+}
+
+TEST(JsonStream, ReaderAcceptsWhatTheJsonCodecAccepts) {
+    const std::string text = R"({"timestamp": "2026-01-01T00:00:00Z", "unknown": {"nested": [1, "}", null]},
+        "energy_Wh_import": {"total": 12, "L1": 1.5e2}, "phase_seq_error": false, "temperatures": []})";
+    const auto streamed = deserialize_from<powermeter::PowermeterValues>(text);
+    EXPECT_EQ(streamed.energy_Wh_import.total, 12.0f);
+    EXPECT_EQ(streamed.energy_Wh_import.L1, 150.0f);
+    EXPECT_EQ(serialize(streamed), serialize(powermeter::deserialize<powermeter::PowermeterValues>(text)));
+
+    // decimals keeps its default like with the json codec
+    EXPECT_EQ(deserialize_from<money::Currency>("{}").decimals, 2);
+}
+
+TEST(JsonStream, ReaderRejectsWhatTheJsonCodecRejects) {
+    const auto both_reject = [](std::string const& text) {
+        EXPECT_FALSE(powermeter::try_deserialize<powermeter::PowermeterValues>(text).has_value()) << text;
+        EXPECT_ANY_THROW(deserialize_from<powermeter::PowermeterValues>(text)) << text;
+    };
+    both_reject(R"({"timestamp": "now"})");
+    both_reject(R"({"timestamp": 1, "energy_Wh_import": {"total": 1}})");
+    both_reject(R"({"timestamp": "now", "energy_Wh_import": {"total": "1"}})");
+    both_reject(R"({"timestamp": "now", "energy_Wh_import": {"total": 1}, "phase_seq_error": null})");
+    both_reject(R"({"timestamp": "now", "energy_Wh_import": {"total": 1})");
+    both_reject(R"({"timestamp": "now", "energy_Wh_import": {"total": 1}} trailing)");
+
+    EXPECT_THROW(deserialize_from<powermeter::TransactionStatus>(R"("NO_SUCH_STATUS")"), std::out_of_range);
+}
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+// Round trip latency and CPU cost of var messages between two module processes, once through the raw shared memory
+// transport, once through the MQTT broker and once through MQTTAbstractionImpl with the shared memory transport.
+// The CPU time covers both module processes, the broker's own CPU time is additional on the MQTT path.
+//
+// usage: everest_framework_shm_transport_benchmark [round trips] [payload bytes] [broker host] [broker port]
+//
+// The MQTT runs are skipped if no broker is reachable.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+
+#include <utils/config/mqtt_settings.hpp>
+#include <utils/mqtt_abstraction_impl.hpp>
+#include <utils/shm_transport.hpp>
+#include <utils/types.hpp>
+
+using namespace Everest;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+const std::string ping_topic = "everest/modules/ping/impl/main/var/value";
+const std::string pong_topic = "everest/modules/pong/impl/main/var/value";
+
+struct result {
+    double p50_us;
+    double p99_us;
+    double cpu_us_per_round_trip;
+};
+
+double cpu_seconds(const rusage& usage) {
+    const auto to_seconds = [](const timeval& time) { return time.tv_sec + time.tv_usec / 1e6; };
+    return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+}
+
+void stop(pid_t pid, rusage* usage) {
+    kill(pid, SIGKILL);
+    int status = 0;
+    wait4(pid, &status, 0, usage);
+}
+
+template <class Serve> pid_t spawn(Serve serve) {
+    // fork before this process starts any threads
+    const pid_t pid = fork();
+    if (pid == 0) {
+        serve();
+        _exit(EXIT_SUCCESS);
+    }
+    return pid;
+}
+
+/**
+ * @brief Runs \p round_trip \p count times after a warm up against the already spawned \p pong process, then stops
+ * it and collects the latencies and the CPU time of both processes
+ */
+template <class RoundTrip> result measure(int count, pid_t pong, RoundTrip round_trip) {
+    // the pong process subscribes asynchronously, wait for the first answer
+    for (int i = 0; i < 100 and not round_trip(std::chrono::milliseconds(100)); ++i) {
+    }
+    for (int i = 0; i < count / 10; ++i) {
+        round_trip(std::chrono::milliseconds(1000));
+    }
+
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(count);
+    rusage start_usage{};
+    getrusage(RUSAGE_SELF, &start_usage);
+    for (int i = 0; i < count; ++i) {
+        const auto start = clock_type::now();
+        if (not round_trip(std::chrono::milliseconds(1000))) {
+            fprintf(stderr, "round trip timed out\n");
+            continue;
+        }
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count());
+    }
+    rusage end_usage{};
+    getrusage(RUSAGE_SELF, &end_usage);
+
+    // apart from answering the pong process is idle, all of its CPU time is attributed to the measured round trips
+    rusage pong_usage{};
+    stop(pong, &pong_usage);
+
+    if (latencies.empty()) {
+        return {0, 0, 0};
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+        return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))] / 1e3;
+    };
+    const auto cpu = cpu_seconds(end_usage) - cpu_seconds(start_usage) + cpu_seconds(pong_usage);
+    return {percentile(0.5), percentile(0.99), cpu * 1e6 / latencies.size()};
+}
+
+bool wait_readable(int fd, std::chrono::milliseconds timeout) {
+    pollfd poll_fd{fd, POLLIN, 0};
+    return poll(&poll_fd, 1, static_cast<int>(timeout.count())) > 0;
+}
+
+result run_shm(int count, const std::string& payload) {
+    const auto segment = ShmTransport::create({"ping", "pong"});
+    const auto settings_of = [&segment](const std::string& module_id) {
+        return ShmTransportSettings{segment->get_fd(), segment->find_slot(module_id).value()};
+    };
+
+    const auto pong = spawn([&settings_of] {
+        auto transport = ShmTransport::attach(settings_of("pong"));
+        transport->subscribe(ping_topic);
+        while (wait_readable(transport->get_notify_fd(), std::chrono::milliseconds(-1))) {
+            transport->receive([&transport](std::string_view, std::string_view message) {
+                transport->publish(pong_topic, message);
+            });
+        }
+    });
+
+    auto transport = ShmTransport::attach(settings_of("ping"));
+    transport->subscribe(pong_topic);
+    const auto round_trip = [&transport, &payload](std::chrono::milliseconds timeout) {
+        transport->publish(ping_topic, payload);
+        // a notification might still be pending from the previous answer
+        const auto deadline = clock_type::now() + timeout;
+        while (clock_type::now() < deadline) {
+            if (wait_readable(transport->get_notify_fd(), timeout) and
+                transport->receive([](std::string_view, std::string_view) {}) > 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+    return measure(count, pong, round_trip);
+}
+
+std::optional<result> run_mqtt(int count, const std::string& payload, const MQTTSettings& settings, bool with_shm) {
+    std::unique_ptr<ShmTransport> segment;
+    if (with_shm) {
+        segment = ShmTransport::create({"ping", "pong"});
+    }
+    const auto settings_of = [&segment, &settings](const std::string& module_id) {
+        auto module_settings = settings;
+        if (segment != nullptr) {
+            module_settings.shm_transport =
+                ShmTransportSettings{segment->get_fd(), segment->find_slot(module_id).value()};
+        }
+        return module_settings;
+    };
+    const auto make_var = [](const json& value) {
+        return MqttMessagePayload{MqttMessageType::Var, json{{"data", value}}};
+    };
+
+    const auto pong = spawn([&settings_of, &make_var] {
+        MQTTAbstractionImpl mqtt(settings_of("pong"));
+        if (not mqtt.connect()) {
+            return;
+        }
+        auto main_loop = mqtt.spawn_main_loop_thread();
+        mqtt.register_handler(ping_topic,
+                              std::make_shared<TypedHandler>(
+                                  HandlerType::SubscribeVar,
+                                  std::make_shared<Handler>([&mqtt, &make_var](const std::string&, json value) {
+                                      mqtt.publish(pong_topic, make_var(value));
+                                  })),
+                              QOS::QOS2);
+        main_loop.wait();
+    });
+
+    MQTTAbstractionImpl mqtt(settings_of("ping"));
+    if (not mqtt.connect()) {
+        stop(pong, nullptr);
+        return std::nullopt;
+    }
+    auto main_loop = mqtt.spawn_main_loop_thread();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::uint64_t received = 0;
+    mqtt.register_handler(pong_topic,
+                          std::make_shared<TypedHandler>(HandlerType::SubscribeVar,
+                                                         std::make_shared<Handler>([&](const std::string&, json) {
+                                                             std::lock_guard<std::mutex> lock(mutex);
+                                                             received++;
+                                                             cv.notify_one();
+                                                         })),
+                          QOS::QOS2);
+
+    const json value = payload;
+    const auto round_trip = [&](std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+        const auto expected = received + 1;
+        lock.unlock();
+        mqtt.publish(ping_topic, make_var(value));
+        lock.lock();
+        // answers of timed out warm up round trips may still arrive
+        const auto answered = cv.wait_for(lock, timeout, [&] { return received >= expected; });
+        received = std::max(received, expected);
+        return answered;
+    };
+    const auto measured = measure(count, pong, round_trip);
+
+    mqtt.disconnect();
+    main_loop.wait();
+    return measured;
+}
+
+void report(const std::string& name, const result& measured) {
+    printf("%-24s %12.1f %12.1f %18.1f\n", name.c_str(), measured.p50_us, measured.p99_us,
+           measured.cpu_us_per_round_trip);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int count = (argc > 1) ? std::atoi(argv[1]) : 10000;
+    const std::size_t payload_size = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 64;
+    const std::string host = (argc > 3) ? argv[3] : "localhost";
+    const auto port = static_cast<std::uint16_t>((argc > 4) ? std::atoi(argv[4]) : 1883);
+
+    Logging::init();
+    const std::string payload(payload_size, 'x');
+    const auto settings = create_mqtt_settings(host, port, "everest/", "external/");
+
+    printf("%-24s %12s %12s %18s\n", "transport", "p50 [us]", "p99 [us]", "CPU [us/round trip]");
+    report("shm ring", run_shm(count, payload));
+
+    const auto mqtt = run_mqtt(count, payload, settings, false);
+    if (not mqtt.has_value()) {
+        printf("no broker reachable at %s:%u, skipping the MQTT runs\n", host.c_str(), port);
+        return EXIT_SUCCESS;
+    }
+    report("mqtt", mqtt.value());
+    report("mqtt + shm", run_mqtt(count, payload, settings, true).value_or(result{0, 0, 0}));
+
+    return EXIT_SUCCESS;
+}
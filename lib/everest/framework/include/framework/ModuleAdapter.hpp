@@ -75,6 +75,8 @@ struct ErrorFactory;
 } // namespace error
 struct ModuleAdapter {
     using CallFunc = std::function<Result(const Requirement&, const std::string&, const Parameters&)>;
+    using CallAsyncFunc =
+        std::function<void(const Requirement&, const std::string&, const Parameters&, const AsyncCmdResultHandler&)>;
     using PublishFunc = std::function<void(const std::string&, const std::string&, const Value&)>;
     using SubscribeFunc = std::function<void(const Requirement&, const std::string&, const ValueCallback&)>;
     using GetErrorManagerImplFunc = std::function<std::shared_ptr<error::ErrorManagerImpl>(const std::string&)>;
@@ -91,10 +93,14 @@ struct ModuleAdapter {
         std::function<void(const std::string&, const std::string&, const std::string&, const TelemetryMap&)>;
     using GetMappingFunc = std::function<std::optional<ModuleTierMappings>()>;
     using GetConfigServiceClientFunc = std::function<std::shared_ptr<config::ConfigServiceClient>()>;
+    using GetExecutorFunc = std::function<ModuleExecutor&()>;
+    using SetVarPolicyFunc = std::function<void(const Requirement&, const std::string&, const TopicPolicy&)>;
 
     CallFunc call;
+    CallAsyncFunc call_async;
     PublishFunc publish;
     SubscribeFunc subscribe;
+    SubscribeFunc subscribe_async;
     GetErrorManagerImplFunc get_error_manager_impl;
     GetErrorStateMonitorImplFunc get_error_state_monitor_impl;
     GetErrorFactoryFunc get_error_factory;
@@ -109,6 +115,8 @@ struct ModuleAdapter {
     TelemetryPublishFunc telemetry_publish;
     GetMappingFunc get_mapping;
     GetConfigServiceClientFunc get_config_service_client;
+    GetExecutorFunc get_executor;
+    SetVarPolicyFunc set_var_policy;
 
     void check_complete();
 
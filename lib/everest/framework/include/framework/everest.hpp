@@ -8,16 +8,21 @@
 #include <functional>
 #include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <thread>
 #include <variant>
 
 #include <everest/exceptions.hpp>
 
+#include <utils/async_cmd_call.hpp>
+#include <utils/async_result.hpp>
 #include <utils/config.hpp>
 #include <utils/config_service.hpp>
 #include <utils/error.hpp>
 #include <utils/exceptions.hpp>
+#include <utils/module_executor.hpp>
 #include <utils/mqtt_abstraction.hpp>
 #include <utils/types.hpp>
 
@@ -82,6 +87,14 @@ public:
     ///
     nlohmann::json call_cmd(const Requirement& req, const std::string& cmd_name, const nlohmann::json& args);
 
+    ///
+    /// \brief Calls a command like call_cmd() without blocking the calling thread. The \p handler is called on the
+    /// module executor with the result of the call or the exception it failed with, e.g. CmdTimeout. Invalid
+    /// arguments are reported by throwing like call_cmd()
+    ///
+    void call_cmd_async(const Requirement& req, const std::string& cmd_name, const nlohmann::json& args,
+                        const AsyncCmdResultHandler& handler);
+
     ///
     /// \brief Publishes a variable of the given \p impl_id, names \p var_name with the given \p value
     ///
@@ -93,6 +106,24 @@ public:
     ///
     void subscribe_var(const Requirement& req, const std::string& var_name, const JsonCallback& callback);
 
+    ///
+    /// \brief Subscribes to a variable like subscribe_var(), but the given \p callback is called on the module
+    /// executor
+    ///
+    void subscribe_var_async(const Requirement& req, const std::string& var_name, const JsonCallback& callback);
+
+    ///
+    /// \brief Sets the \p policy used to dispatch the values of the variable \p var_name of another module identified
+    /// by the given \p req to its subscribers, e.g. to only handle the latest value if a subscriber falls behind
+    ///
+    void set_var_policy(const Requirement& req, const std::string& var_name, const TopicPolicy& policy);
+
+    ///
+    /// \brief Returns the executor that runs the asynchronous calls, subscriptions and timers of this module. It is
+    /// started on first use
+    ///
+    ModuleExecutor& get_executor();
+
     ///
     /// \brief Return the error manager for the given \p impl_id
     ///
@@ -194,6 +225,11 @@ public:
     ///
     void signal_ready();
 
+    ///
+    /// \brief Publishes the startup trace \p events of this module to the manager
+    ///
+    void publish_startup_trace(const nlohmann::json& events);
+
     ///
     /// \brief registers a callback \p handler that is called when the global ready signal is received via mqtt
     ///
@@ -205,6 +241,19 @@ public:
     void ensure_ready() const;
 
 private:
+    struct CmdCall {
+        std::string call_id;
+        std::string identifier; ///< printable identifier of the called implementation
+        std::string cmd_topic;
+        std::string cmd_response_topic;
+    };
+
+    CmdCall prepare_cmd_call(const Requirement& req, const std::string& cmd_name, const nlohmann::json& args);
+    /// \returns the token of the registered result handler
+    std::shared_ptr<TypedHandler> send_cmd_call(const CmdCall& call, const std::string& cmd_name,
+                                                const nlohmann::json& args,
+                                                const std::function<void(CmdResult)>& result_handler);
+
     std::shared_ptr<MQTTAbstraction> mqtt_abstraction;
     Config config;
     std::string module_id;
@@ -219,6 +268,7 @@ private:
     std::shared_ptr<config::ConfigServiceClient> config_service_client;
     std::map<std::string, std::set<std::string>> registered_cmds;
     std::atomic<bool> ready_received;
+    std::atomic<bool> ready_received_early;
     std::atomic<bool> ready_processed;
     std::chrono::seconds remote_cmd_res_timeout;
     bool validate_data_with_schema;
@@ -235,8 +285,11 @@ private:
     bool telemetry_enabled;
     std::optional<ModuleTierMappings> module_tier_mappings;
     bool forward_exceptions;
+    std::once_flag executor_started;
+    // declared last so that it is stopped before the members its tasks use are destroyed
+    std::unique_ptr<ModuleExecutor> executor;
 
-    void handle_ready(const nlohmann::json& data);
+    void handle_ready(const nlohmann::json& data, bool requirements_ready = false);
 
     void heartbeat();
 
@@ -41,7 +41,11 @@ inline constexpr auto EV_MQTT_EXTERNAL_PREFIX = "EV_MQTT_EXTERNAL_PREFIX";
 inline constexpr auto EV_MQTT_BROKER_SOCKET_PATH = "EV_MQTT_BROKER_SOCKET_PATH";
 inline constexpr auto EV_MQTT_BROKER_HOST = "EV_MQTT_BROKER_HOST";
 inline constexpr auto EV_MQTT_BROKER_PORT = "EV_MQTT_BROKER_PORT";
+inline constexpr auto EV_MQTT_PAYLOAD_ENCODING = "EV_MQTT_PAYLOAD_ENCODING";
 inline constexpr auto EV_VALIDATE_SCHEMA = "EV_VALIDATE_SCHEMA";
+inline constexpr auto EV_STARTUP_TRACE = "EV_STARTUP_TRACE";
+inline constexpr auto EV_SHM_TRANSPORT = "EV_SHM_TRANSPORT";
+inline constexpr auto EV_MESSAGE_HANDLER_THREADS = "EV_MESSAGE_HANDLER_THREADS";
 inline constexpr auto VERSION_INFORMATION_FILE = "version_information.txt";
 
 // FIXME (aw): this needs to be made available by
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_ASYNC_CMD_CALL_HPP
+#define UTILS_ASYNC_CMD_CALL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <utils/async_result.hpp>
+#include <utils/module_executor.hpp>
+#include <utils/types.hpp>
+
+namespace Everest {
+
+using AsyncCmdResultHandler = std::function<void(AsyncResult<nlohmann::json>)>;
+
+/// \returns the result of a finished command call, throws the exception matching the error of a failed call
+nlohmann::json get_cmd_result(CmdResult&& result);
+
+/// \returns the result of a finished command call, or the exception matching the error of a failed call as failure
+AsyncResult<nlohmann::json> to_async_result(CmdResult&& result);
+
+///
+/// \brief Completes an asynchronous command call exactly once, either with its result or with a CmdTimeout
+///
+/// The result and the timeout race for completing the call, the handler of the call always runs on the executor. If
+/// the timeout wins, its callback removes the response handler of the call, so it does not stay registered waiting
+/// for a result that might never arrive.
+///
+class AsyncCmdCall {
+public:
+    AsyncCmdCall(ModuleExecutor& executor, AsyncCmdResultHandler handler);
+
+    /// \brief Fails the \p call with a CmdTimeout carrying \p message after \p timeout and calls \p on_timeout before
+    /// its handler, unless the call was completed before. Does nothing if the result arrived already.
+    static void start_timeout(const std::shared_ptr<AsyncCmdCall>& call, std::chrono::milliseconds timeout,
+                              const std::string& message, const std::function<void()>& on_timeout);
+
+    /// \brief Completes the call with \p result unless it timed out already, may be called from any thread
+    void complete(CmdResult result);
+
+private:
+    ModuleExecutor& executor;
+    AsyncCmdResultHandler handler;
+    std::atomic_bool completed{false};
+    std::atomic<ModuleExecutor::TimerId> timeout{0};
+};
+
+} // namespace Everest
+
+#endif // UTILS_ASYNC_CMD_CALL_HPP
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_ASYNC_RESULT_HPP
+#define UTILS_ASYNC_RESULT_HPP
+
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Everest {
+
+///
+/// \brief Outcome of an asynchronous command call that is passed to its result handler: either the result of the
+/// call or the exception it failed with, e.g. Everest::CmdTimeout
+///
+template <typename T> class AsyncResult {
+public:
+    AsyncResult(T value) : value(std::move(value)) {
+    }
+
+    static AsyncResult failure(std::exception_ptr error) {
+        AsyncResult result;
+        result.error = std::move(error);
+        return result;
+    }
+
+    bool has_error() const {
+        return error != nullptr;
+    }
+
+    std::exception_ptr get_error() const {
+        return error;
+    }
+
+    /// \returns the result of the call, rethrows the exception of the call if it failed
+    const T& get() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return value.value();
+    }
+
+    /// \returns the result of applying \p convert to the result of the call, a failed call or an exception thrown by
+    /// \p convert is passed on as failure
+    template <typename F> auto then(F&& convert) const -> AsyncResult<std::invoke_result_t<F, const T&>> {
+        using U = std::invoke_result_t<F, const T&>;
+        if (error) {
+            return AsyncResult<U>::failure(error);
+        }
+        try {
+            if constexpr (std::is_void_v<U>) {
+                std::invoke(std::forward<F>(convert), value.value());
+                return AsyncResult<U>();
+            } else {
+                return AsyncResult<U>(std::invoke(std::forward<F>(convert), value.value()));
+            }
+        } catch (...) {
+            return AsyncResult<U>::failure(std::current_exception());
+        }
+    }
+
+private:
+    AsyncResult() = default;
+
+    std::optional<T> value;
+    std::exception_ptr error;
+};
+
+///
+/// \brief Outcome of an asynchronous command call without result
+///
+template <> class AsyncResult<void> {
+public:
+    AsyncResult() = default;
+
+    static AsyncResult failure(std::exception_ptr error) {
+        AsyncResult result;
+        result.error = std::move(error);
+        return result;
+    }
+
+    bool has_error() const {
+        return error != nullptr;
+    }
+
+    std::exception_ptr get_error() const {
+        return error;
+    }
+
+    /// \brief Rethrows the exception of the call if it failed
+    void get() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    std::exception_ptr error;
+};
+
+} // namespace Everest
+
+#endif // UTILS_ASYNC_RESULT_HPP
@@ -3,11 +3,33 @@
 #ifndef UTILS_CONFIG_MQTT_SETTINGS_HPP
 #define UTILS_CONFIG_MQTT_SETTINGS_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace Everest {
 
+/// \brief Encoding of json payloads published on topics below the everest prefix
+enum class MQTTPayloadEncoding {
+    JSON, ///< JSON text
+    CBOR, ///< Self-described CBOR, smaller and cheaper to encode and decode than JSON text
+};
+
+/// \brief Slot of a module in the shared memory segment of the manager, see ShmTransport
+struct ShmTransportSettings {
+    int fd = -1;          ///< File descriptor of the segment, inherited from the manager
+    std::size_t slot = 0; ///< Slot of the module in the segment
+};
+
+/// \brief Bounds of the worker pool that handles the vars, commands and errors received by a module
+/// \note A handler waiting for a synchronous command that calls back into the module blocks its worker, so such
+/// modules need a max_threads of at least two
+struct MessageHandlerSettings {
+    std::size_t min_threads = 1; ///< Workers that are kept alive while idle
+    std::size_t max_threads = 0; ///< Workers the pool scales up to under load, 0 for hardware_concurrency()
+};
+
 /// \brief minimal MQTT connection settings needed for an initial connection of a module to the manager
 struct MQTTSettings {
     std::string broker_socket_path; ///< A path to a socket the MQTT broker uses in socket mode. If this is set
@@ -16,6 +38,12 @@ struct MQTTSettings {
     std::uint16_t broker_port = 0;  ///< The port the MQTT broker listens on
     std::string everest_prefix;     ///< MQTT topic prefix for the "everest" topic
     std::string external_prefix;    ///< MQTT topic prefix for external topics
+    /// Encoding of json payloads published on everest topics, external topics always use JSON
+    MQTTPayloadEncoding everest_payload_encoding = MQTTPayloadEncoding::JSON;
+    /// Shared memory segment for var messages between modules spawned by the manager, the broker is used if not set
+    std::optional<ShmTransportSettings> shm_transport;
+    /// Worker pool bounds of the message handler
+    MessageHandlerSettings message_handler;
 
     /// \brief Indicates if a Unix Domain Socket is used for connection to the MQTT broker
     /// \returns true is a UDS is used, false if a connection via host and port is used
@@ -33,12 +61,18 @@ MQTTSettings create_mqtt_settings(const std::string& mqtt_broker_host, std::uint
                                   const std::string& mqtt_everest_prefix, const std::string& mqtt_external_prefix);
 
 /// \brief Populates the given MQTTSettings \p mqtt_settings with a Unix Domain Socket with the provided \p
-/// mqtt_broker_socket_path using the \p mqtt_everest_prefix and \p mqtt_external_prefix
+/// mqtt_broker_socket_path using the \p mqtt_everest_prefix and \p mqtt_external_prefix. The everest payload
+/// encoding, the shared memory transport and the message handler settings are taken from the environment, see
+/// mqtt_payload_encoding_from_environment(), shm_transport_settings_from_environment() and
+/// message_handler_settings_from_environment()
 void populate_mqtt_settings(MQTTSettings& mqtt_settings, const std::string& mqtt_broker_socket_path,
                             const std::string& mqtt_everest_prefix, const std::string& mqtt_external_prefix);
 
 /// \brief  Populates the given MQTTSettings \p mqtt_settings for IP based connections with the provided \p
-/// mqtt_broker_host and \p mqtt_broker_port using the \p mqtt_everest_prefix and \p mqtt_external_prefix
+/// mqtt_broker_host and \p mqtt_broker_port using the \p mqtt_everest_prefix and \p mqtt_external_prefix. The everest
+/// payload encoding, the shared memory transport and the message handler settings are taken from the environment, see
+/// mqtt_payload_encoding_from_environment(), shm_transport_settings_from_environment() and
+/// message_handler_settings_from_environment()
 void populate_mqtt_settings(MQTTSettings& mqtt_settings, const std::string& mqtt_broker_host,
                             std::uint16_t mqtt_broker_port, const std::string& mqtt_everest_prefix,
                             const std::string& mqtt_external_prefix);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <map>
 #include <string>
 
 #include <nlohmann/json.hpp>
@@ -66,11 +67,14 @@ struct ManagerSettings {
 
     nlohmann::json config; ///< Parsed json of the config_file
 
-    MQTTSettings mqtt_settings;       ///< MQTT connection settings
-    RuntimeSettings runtime_settings; ///< Runtime settings needed to successfully run modules
+    MQTTSettings mqtt_settings;              ///< MQTT connection settings
+    std::size_t shm_transport_ring_size = 0; ///< Ring size of the shared memory transport, 0 if it is disabled
+    RuntimeSettings runtime_settings;        ///< Runtime settings needed to successfully run modules
     ConfigBootMode boot_mode =
         ConfigBootMode::YamlFile; ///< Source of the config, can be YamlFile, Database or DatabaseInit
     std::unique_ptr<everest::config::SqliteStorage> storage; ///< Sqlite Storage for settings and module configs
+    /// Value of EV_MESSAGE_HANDLER_THREADS per module id, the entry with an empty id applies to all other modules
+    std::map<std::string, std::string> message_handler_threads;
 
     ManagerSettings() = default;
 
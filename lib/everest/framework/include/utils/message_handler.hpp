@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <map>
 #include <string>
 #include <thread>
@@ -16,6 +18,7 @@
 #include <everest/util/async/thread_pool_scaling.hpp>
 #include <everest/util/queue/thread_safe_queue.hpp>
 
+#include <utils/config/mqtt_settings.hpp>
 #include <utils/message_queue.hpp>
 #include <utils/types.hpp>
 
@@ -28,18 +31,28 @@ constexpr std::size_t THREAD_POOL_SCALING_LATENCY_THRESHOLD_MS = 50;
 constexpr std::chrono::seconds THREAD_POOL_SCALING_IDLE_TIMEOUT{2};
 constexpr std::size_t THREAD_POOL_SCALING_MIN_THREAD_COUNT = 1;
 constexpr std::size_t MAX_PENDING_MESSAGES_PER_TOPIC = 100;
+constexpr std::size_t MAX_MESSAGE_HANDLER_THREADS = 256;
+
+/// \brief Reads the worker pool bounds of the message handler from the EV_MESSAGE_HANDLER_THREADS environment
+/// variable, formatted as "<max>" or "<min>:<max>" with 1 <= min <= max <= MAX_MESSAGE_HANDLER_THREADS
+/// \returns the bounds from the environment, the defaults of MessageHandlerSettings if it is not set or invalid
+MessageHandlerSettings message_handler_settings_from_environment();
 
 /// \brief Handles message dispatching and thread-safe queuing of different message types.
 ///
 /// Messages are routed to one of four channels based on their type:
 ///   - operation_message_queue → operation_dispatcher_thread → operation_thread_pool
-///     (vars, cmds, errors, GetConfig, ModuleReady — parallel across topics, serial per topic)
+///     (vars, cmds, errors, GetConfig, ModuleReady, StartupTrace — parallel across topics, serial per topic)
 ///   - result_message_queue    → result_worker_thread (cmd results, GetConfig responses — serial)
 ///   - external_mqtt_message_queue → external_mqtt_worker_thread (external MQTT — serial)
-///   - GlobalReady             → ready_thread (one-shot, spawned per message)
+///   - ready_message_queue     → ready_worker_thread (GlobalReady — serial)
+///
+/// Operation messages whose topic is not in flight wait in one ready queue per TopicPriority, the pool workers always
+/// take the oldest message of the highest priority. Messages of a topic in flight wait in its pending queue, which is
+/// bounded or merged according to the TopicPolicy of the topic.
 class MessageHandler {
 public:
-    MessageHandler();
+    explicit MessageHandler(const MessageHandlerSettings& settings = {});
     ~MessageHandler();
 
     /// \brief Adds given \p message to the message queue for processing
@@ -51,6 +64,12 @@ public:
     /// \brief Registers a \p handler for a specific \p topic
     void register_handler(const std::string& topic, std::shared_ptr<TypedHandler> handler);
 
+    /// \brief Removes the \p handler registered for \p topic, a result handler is identified by its call id
+    void unregister_handler(const std::string& topic, const std::shared_ptr<TypedHandler>& handler);
+
+    /// \brief Sets the \p policy used to dispatch operation messages of the given \p topic, wildcards are not supported
+    void set_topic_policy(const std::string& topic, const TopicPolicy& policy);
+
     using SharedTypedHandler = std::shared_ptr<TypedHandler>;
     using SingleHandlerMap = std::map<MqttTopic, SharedTypedHandler>;
     using MultiHandlerMap = std::map<MqttTopic, std::vector<SharedTypedHandler>>;
@@ -59,6 +78,9 @@ private:
     struct OperationTopics {
         std::unordered_set<std::string> in_flight;
         std::unordered_map<std::string, everest::lib::util::simple_queue<ParsedMessage>> pending_messages;
+        // messages of topics not in flight, indexed by TopicPriority
+        std::array<std::deque<ParsedMessage>, static_cast<std::size_t>(TopicPriority::High) + 1> ready;
+        std::unordered_map<std::string, TopicPolicy> policies;
     };
 
     struct ResponseHandlers {
@@ -73,15 +95,18 @@ private:
         SingleHandlerMap get_module_config; // get module config handler of manager
         SharedTypedHandler global_ready;    // global ready handler of module
         SingleHandlerMap module_ready;      // module ready handlers of manager
+        SingleHandlerMap startup_trace;     // startup trace handlers of manager
         MultiHandlerMap external_var;       // external MQTT handlers of module
     };
 
     void run_operation_dispatcher();
     void run_result_message_worker();
     void run_external_mqtt_worker();
+    void run_ready_worker();
 
     void dispatch_operation_message(ParsedMessage&& message);
-    void schedule_operation_message(ParsedMessage&& message);
+    void schedule_operation_message();
+    void run_next_operation_message();
     void on_operation_message_done(const std::string& topic);
 
     void handle_operation_message(const std::string& topic, const json& payload);
@@ -94,6 +119,7 @@ private:
     void handle_error_message(const std::string& topic, const json& data);
     void handle_get_config_message(const std::string& topic, const json& data);
     void handle_module_ready_message(const std::string& topic, const json& data);
+    void handle_startup_trace_message(const std::string& topic, const json& data);
     void handle_cmd_result(const std::string& topic, const json& payload);
     void handle_get_config_response(const std::string& topic, const json& payload);
 
@@ -102,11 +128,7 @@ private:
                                              // ModuleReady messages
     std::thread result_worker_thread;        // processes cmd results and GetConfig responses
     std::thread external_mqtt_worker_thread; // processes external MQTT messages
-
-    // Wrapped in a monitor so that concurrent GlobalReady arrivals in add() are safe:
-    // the steal-then-join pattern moves the previous thread out under the lock and joins
-    // outside the lock, preventing concurrent join/assignment races on the raw std::thread.
-    everest::lib::util::monitor<std::thread> ready;
+    std::thread ready_worker_thread;         // processes GlobalReady messages, ready() may block for a long time
 
     using LatencyScaling = everest::lib::util::LatencyScaling<THREAD_POOL_SCALING_LATENCY_THRESHOLD_MS>;
     using ThreadPool = everest::lib::util::thread_pool_scaling<LatencyScaling, everest::lib::util::RethrowExceptions>;
@@ -116,6 +138,7 @@ private:
     MessageQueue operation_message_queue;
     MessageQueue result_message_queue;
     MessageQueue external_mqtt_message_queue;
+    MessageQueue ready_message_queue;
 
     everest::lib::util::monitor<OperationTopics> operations;
     everest::lib::util::monitor<ResponseHandlers> responses;
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_MODULE_EXECUTOR_HPP
+#define UTILS_MODULE_EXECUTOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Everest {
+
+/// \brief Runs the asynchronous continuations of a module on a small, fixed number of threads
+///
+/// Results of asynchronous command calls, values of asynchronous var subscriptions and timers are posted to the
+/// executor instead of blocking a thread per flow. With a single thread all posted tasks run one after another, so
+/// flows sharing the executor do not need to lock their state against each other.
+class ModuleExecutor {
+public:
+    using Task = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
+    using TimerId = std::uint64_t;
+
+    /// \brief Starts \p thread_count worker threads, at least one
+    explicit ModuleExecutor(std::size_t thread_count = 1);
+
+    /// \brief Stops the executor, tasks and timers that did not run yet are dropped
+    ~ModuleExecutor();
+
+    ModuleExecutor(const ModuleExecutor&) = delete;
+    ModuleExecutor& operator=(const ModuleExecutor&) = delete;
+
+    /// \brief Queues \p task to run on one of the worker threads
+    void post(Task task);
+
+    /// \brief Runs \p task once \p deadline is reached
+    /// \returns an id that can be passed to cancel()
+    TimerId post_at(Clock::time_point deadline, Task task);
+
+    /// \brief Runs \p task after \p delay
+    /// \returns an id that can be passed to cancel()
+    TimerId post_after(Clock::duration delay, Task task);
+
+    /// \brief Cancels the timer with the given \p id
+    /// \returns true if the timer was cancelled before its task was queued
+    bool cancel(TimerId id);
+
+    /// \returns true if called from one of the worker threads of this executor
+    bool is_executor_thread() const;
+
+    /// \brief Stops and joins the worker threads, must not be called from a worker thread
+    void stop();
+
+private:
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Task> tasks;
+    std::set<std::pair<Clock::time_point, TimerId>> deadlines;
+    std::map<TimerId, std::pair<Clock::time_point, Task>> timers;
+    TimerId next_timer_id{1};
+    bool running{true};
+    std::vector<std::thread> threads;
+};
+
+} // namespace Everest
+
+#endif // UTILS_MODULE_EXECUTOR_HPP
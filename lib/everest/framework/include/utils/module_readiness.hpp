@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_MODULE_READINESS_HPP
+#define UTILS_MODULE_READINESS_HPP
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <utils/config/types.hpp>
+
+namespace Everest {
+
+///
+/// \brief Tracks the readiness of modules incrementally along the requirement graph built from the config.
+///
+/// A module's requirements are considered ready once every module in its transitive requirement closure has
+/// signalled ModuleReady. Using the closure instead of the direct requirements keeps this well defined for cyclic
+/// requirements. This class is not thread safe, callers have to synchronize access.
+///
+class ModuleReadiness {
+public:
+    struct Update {
+        bool newly_ready{false}; ///< false if the module had already been ready before
+        bool all_ready{false};   ///< true if all tracked modules are ready now
+        /// modules that are ready themselves and whose requirements became ready with this update, including the
+        /// updated module itself if applicable
+        std::vector<std::string> requirements_ready;
+    };
+
+    ModuleReadiness() = default;
+
+    ///
+    /// \brief Builds the requirement graph of \p module_configs, modules in \p ignored_modules are not tracked and
+    /// requirements fulfilled by them are not waited for
+    ///
+    ModuleReadiness(const everest::config::ModuleConfigurations& module_configs,
+                    const std::vector<std::string>& ignored_modules);
+
+    ///
+    /// \brief Marks \p module_id as ready
+    ///
+    /// \throws std::out_of_range if the module is not tracked
+    Update set_ready(const std::string& module_id);
+
+    bool is_ready(const std::string& module_id) const;
+    bool all_ready() const;
+    std::size_t ready_count() const;
+    std::size_t size() const;
+
+    ///
+    /// \returns the tracked modules ordered so that modules providing requirements come before the modules using
+    /// them, as far as cycles allow
+    std::vector<std::string> spawn_order() const;
+
+private:
+    struct Node {
+        bool ready{false};
+        bool requirements_released{false};
+        std::set<std::string> requirements;  // direct requirements
+        std::size_t pending_closure{0};      // not yet ready modules in the transitive requirement closure
+        std::vector<std::string> closure_of; // modules that have this module in their closure
+    };
+
+    void release_if_possible(const std::string& module_id, Node& node, Update& update);
+
+    std::map<std::string, Node> nodes;
+    std::size_t ready_modules{0};
+};
+
+} // namespace Everest
+
+#endif // UTILS_MODULE_READINESS_HPP
@@ -87,6 +87,9 @@ public:
     /// \brief unsubscribes a handler identified by its \p token from the given \p topic
     virtual void unregister_handler(const std::string& topic, const Token& token) = 0;
 
+    /// \brief sets the \p policy used to dispatch the received messages of \p topic to its handlers
+    virtual void set_topic_policy(const std::string& topic, const TopicPolicy& policy) = 0;
+
 protected:
     MQTTAbstraction() = default;
 };
@@ -23,6 +23,7 @@
 #include <utils/message_handler.hpp>
 #include <utils/message_queue.hpp>
 #include <utils/mqtt_abstraction.hpp>
+#include <utils/shm_transport.hpp>
 #include <utils/thread.hpp>
 #include <utils/types.hpp>
 
@@ -65,6 +66,7 @@ public:
     std::shared_future<void> get_main_loop_future() override;
     void register_handler(const std::string& topic, std::shared_ptr<TypedHandler> handler, QOS qos) override;
     void unregister_handler(const std::string& topic, const Token& token) override;
+    void set_topic_policy(const std::string& topic, const TopicPolicy& policy) override;
 
     ///
     /// \brief checks if the given \p full_topic matches the given \p wildcard_topic that can contain "+" and "#"
@@ -96,6 +98,9 @@ private:
     std::uint16_t mqtt_server_port = 0;
     std::string mqtt_everest_prefix;
     std::string mqtt_external_prefix;
+    MQTTPayloadEncoding everest_payload_encoding;
+    // carries var messages between modules spawned by the manager, if it provided a shared memory segment
+    std::unique_ptr<ShmTransport> shm_transport;
 
     std::unique_ptr<everest::lib::io::mqtt::mqtt_client> mqtt_client;
     everest::lib::io::event::event_fd disconnect_event;
@@ -106,6 +111,8 @@ private:
     Thread mqtt_mainloop_thread;
 
     void on_mqtt_message();
+    void on_shm_message();
+    bool uses_shm_transport(const std::string& topic) const;
     void on_mqtt_connect();
     void handle_mqtt_message(const Message& message);
 
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_MQTT_PAYLOAD_HPP
+#define UTILS_MQTT_PAYLOAD_HPP
+
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include <utils/config/mqtt_settings.hpp>
+
+namespace Everest {
+
+///
+/// \brief Encodes \p json as MQTT payload with the given \p encoding
+///
+/// CBOR payloads start with the self-described CBOR tag (RFC 8949, section 3.4.6), which can never start a JSON text.
+/// This is what allows receivers to accept both encodings without any negotiation.
+///
+std::string encode_mqtt_payload(const nlohmann::json& json, MQTTPayloadEncoding encoding);
+
+/// \returns true if \p payload was encoded as CBOR by encode_mqtt_payload()
+bool is_cbor_mqtt_payload(std::string_view payload);
+
+///
+/// \brief Decodes a \p payload encoded with any MQTTPayloadEncoding
+/// \throws nlohmann::json::parse_error if the payload is malformed
+///
+nlohmann::json decode_mqtt_payload(std::string_view payload);
+
+///
+/// \brief Reads the encoding for payloads on everest topics from the EV_MQTT_PAYLOAD_ENCODING environment variable
+///
+/// Accepted values are "json" and "cbor". If the variable is unset or has any other value, JSON is used.
+///
+MQTTPayloadEncoding mqtt_payload_encoding_from_environment();
+
+} // namespace Everest
+
+#endif // UTILS_MQTT_PAYLOAD_HPP
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_SHM_TRANSPORT_HPP
+#define UTILS_SHM_TRANSPORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <utils/config/mqtt_settings.hpp>
+
+namespace Everest {
+
+/// \brief Reads the slot of this module in the shared memory segment of the manager from the EV_SHM_TRANSPORT
+/// environment variable
+/// \returns the settings if the manager spawned this module with a shared memory transport, std::nullopt otherwise
+std::optional<ShmTransportSettings> shm_transport_settings_from_environment();
+
+///
+/// \brief Shared memory transport for messages between modules spawned by the same manager
+///
+/// The manager creates a memfd backed segment with one slot per module before spawning the modules, which inherit
+/// the segment and one eventfd per slot. Every slot holds the topics the module subscribed to. For every pair of
+/// slots there is a lock-free single producer, single consumer ring buffer. Publishing a message copies it into the
+/// rings of all subscribed slots and notifies their eventfds, receiving drains all rings of the own slot. Messages
+/// that do not fit into a ring are split into fragments.
+///
+class ShmTransport {
+public:
+    using MessageCallback = std::function<void(std::string_view topic, std::string_view payload)>;
+
+    /// \brief Default size of a single ring buffer in bytes
+    static constexpr std::size_t DEFAULT_RING_SIZE = 64 * 1024;
+    /// \brief Maximum length of a topic that can be subscribed to
+    static constexpr std::size_t MAX_TOPIC_LENGTH = 255;
+    /// \brief Maximum number of topics a single module can subscribe to
+    static constexpr std::size_t MAX_SUBSCRIPTIONS = 512;
+
+    /// \brief Creates a segment with one slot for each of the \p module_ids and rings of \p ring_size bytes. The
+    /// segment and the eventfds are inherited by child processes.
+    /// \throws std::runtime_error if the segment could not be created
+    static std::unique_ptr<ShmTransport> create(const std::vector<std::string>& module_ids,
+                                                std::size_t ring_size = DEFAULT_RING_SIZE);
+
+    /// \brief Maps the segment inherited from the manager and uses the slot given in \p settings
+    /// \throws std::runtime_error if the segment is invalid
+    static std::unique_ptr<ShmTransport> attach(const ShmTransportSettings& settings);
+
+    ~ShmTransport();
+
+    ShmTransport(const ShmTransport&) = delete;
+    ShmTransport& operator=(const ShmTransport&) = delete;
+
+    /// \returns the file descriptor of the segment
+    int get_fd() const;
+
+    /// \returns the slot of the module with the given \p module_id, std::nullopt if it has no slot
+    std::optional<std::size_t> find_slot(std::string_view module_id) const;
+
+    /// \returns the eventfd that becomes readable when messages for the own slot arrive
+    int get_notify_fd() const;
+
+    /// \brief Adds \p topic to the subscriptions of the own slot, wildcards are not supported
+    /// \returns false if the topic is too long or the subscription table of the slot is full
+    bool subscribe(const std::string& topic);
+
+    /// \brief Removes \p topic from the subscriptions of the own slot
+    /// \returns false if the topic was not subscribed
+    bool unsubscribe(const std::string& topic);
+
+    /// \brief Copies the message into the rings of all slots that subscribed to \p topic
+    /// \returns the number of slots the message was delivered to
+    std::size_t publish(std::string_view topic, std::string_view payload);
+
+    /// \brief Drains the rings of the own slot and calls \p callback for every complete message
+    /// \returns the number of received messages
+    std::size_t receive(const MessageCallback& callback);
+
+private:
+    struct RingProducer {
+        std::mutex mutex;
+        // set if the receiver did not drain the ring in time, writes are dropped until the ring is empty again
+        bool stalled{false};
+    };
+    struct PendingMessage {
+        std::string topic;
+        std::string payload;
+        bool active{false};
+    };
+
+    ShmTransport(int fd, bool owns_descriptors, void* mapping, std::size_t mapping_size,
+                 std::optional<std::size_t> own_slot);
+
+    std::vector<std::size_t> get_receivers(std::string_view topic);
+    bool write(std::size_t receiver, std::string_view topic, std::string_view payload);
+    bool write_record(std::size_t receiver, std::uint16_t flags, std::string_view topic, std::string_view data);
+
+    int fd;
+    bool owns_descriptors;
+    void* mapping;
+    std::size_t mapping_size;
+    std::optional<std::size_t> own_slot;
+    std::unordered_map<std::string, std::size_t> slots;
+
+    std::mutex subscription_mutex;
+    std::map<std::string, std::size_t> subscription_entries;
+
+    std::mutex receivers_mutex;
+    std::uint64_t receivers_generation{0};
+    std::unordered_map<std::string, std::vector<std::size_t>> receivers_cache;
+
+    // producers of the same process are serialized per receiving slot, processes never share a ring
+    std::unique_ptr<RingProducer[]> producers;
+    // fragmented messages per sending slot, only accessed by receive()
+    std::vector<PendingMessage> pending_messages;
+};
+
+} // namespace Everest
+
+#endif // UTILS_SHM_TRANSPORT_HPP
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_SHUTDOWN_HANDLER_HPP
+#define UTILS_SHUTDOWN_HANDLER_HPP
+
+#include <functional>
+
+namespace Everest {
+
+/// \brief Registers \p handler to run when the module process is stopped with SIGTERM
+///
+/// The manager stops modules with SIGTERM, which terminates them without running any destructors. Once the first
+/// handler is registered, the framework handles SIGTERM instead: a framework thread runs all registered handlers in
+/// reverse order of registration and then terminates the process with the default action of the signal, so the
+/// manager sees the same exit as before. Handlers run outside of the signal handler, but should return within a few
+/// seconds. Processes without registered handlers keep the default action of SIGTERM.
+void register_shutdown_handler(std::function<void()> handler);
+
+} // namespace Everest
+
+#endif // UTILS_SHUTDOWN_HANDLER_HPP
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef UTILS_STARTUP_TRACE_HPP
+#define UTILS_STARTUP_TRACE_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace Everest {
+
+///
+/// \brief Records timestamped startup phase spans of a single process (manager or module).
+///
+/// Spans are stored as Chrome trace "complete" events (ph = "X") with microsecond wall clock timestamps, so that
+/// events recorded in different processes line up on a common timeline. A disabled trace records nothing and all
+/// operations on it are cheap no-ops.
+///
+class StartupTrace {
+public:
+    using Clock = std::chrono::system_clock;
+
+    ///
+    /// \brief RAII helper that records a span from construction until end() is called or it goes out of scope
+    ///
+    class Span {
+    public:
+        Span(StartupTrace& trace, std::string name);
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+        Span(Span&& other) noexcept;
+        Span& operator=(Span&&) = delete;
+        ~Span();
+
+        ///
+        /// \brief Ends the span, subsequent calls are ignored
+        ///
+        void end();
+
+    private:
+        StartupTrace* trace;
+        std::string name;
+        Clock::time_point start;
+    };
+
+    ///
+    /// \brief Creates a trace for the process identified by \p process_name, recording only if \p enabled is set
+    ///
+    StartupTrace(std::string process_name, bool enabled);
+
+    ///
+    /// \brief Creates a trace that is enabled if the EV_STARTUP_TRACE environment variable is set
+    ///
+    static StartupTrace from_environment(const std::string& process_name);
+
+    bool is_enabled() const;
+
+    ///
+    /// \brief Starts a span named \p name which ends when the returned object is destroyed or ended
+    ///
+    Span span(const std::string& name);
+
+    ///
+    /// \brief Records a span \p name from \p start to \p end
+    ///
+    void record(const std::string& name, Clock::time_point start, Clock::time_point end);
+
+    ///
+    /// \returns all recorded spans as a json array of Chrome trace events, including process metadata
+    ///
+    nlohmann::json to_json() const;
+
+private:
+    std::string process_name;
+    bool enabled;
+    int pid;
+    mutable std::mutex events_mutex;
+    std::vector<nlohmann::json> events;
+};
+
+///
+/// \brief Collects Chrome trace events from the manager and all modules and writes them into a single
+/// Chrome-trace/Perfetto compatible json file
+///
+class StartupTraceCollector {
+public:
+    explicit StartupTraceCollector(std::filesystem::path output_path);
+
+    ///
+    /// \brief Adds the json array of trace \p events reported by a process
+    ///
+    void add(const nlohmann::json& events);
+
+    ///
+    /// \brief Writes all collected events to the output file, replacing its previous content
+    ///
+    /// \returns true on success
+    bool write() const;
+
+private:
+    std::filesystem::path output_path;
+    mutable std::mutex events_mutex;
+    nlohmann::json events;
+};
+
+} // namespace Everest
+
+#endif // UTILS_STARTUP_TRACE_HPP
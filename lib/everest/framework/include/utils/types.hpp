@@ -46,6 +46,7 @@ enum class HandlerType {
     ConfigRequest,
     ModuleReady,
     GlobalReady,
+    StartupTrace,
     ExternalMQTT,
     Unknown
 };
@@ -64,6 +65,27 @@ struct TypedHandler {
 
 using Token = std::shared_ptr<TypedHandler>;
 
+/// \brief Order in which ready messages of different topics are handed to the message handler worker pool
+enum class TopicPriority {
+    Low,    ///< startup traces
+    Normal, ///< vars and errors
+    High,   ///< commands, GetConfig and ModuleReady
+};
+
+/// \brief Handling of messages arriving on a topic while the previous message of the topic is still handled
+enum class TopicBacklog {
+    Queue,      ///< handle every message in order, warn once MAX_PENDING_MESSAGES_PER_TOPIC are pending
+    DropOldest, ///< handle messages in order, drop the oldest pending message once max_pending are pending
+    KeepLatest, ///< merge all pending messages into the latest one, e.g. for vars that carry samples
+};
+
+/// \brief Dispatching policy of the messages of a single topic
+struct TopicPolicy {
+    std::optional<TopicPriority> priority; ///< overrides the priority derived from the message type
+    TopicBacklog backlog = TopicBacklog::Queue;
+    std::size_t max_pending = 0; ///< limit of TopicBacklog::DropOldest, 0 uses MAX_PENDING_MESSAGES_PER_TOPIC
+};
+
 struct ModuleInfo {
     struct Paths {
         std::filesystem::path etc;
@@ -93,7 +115,8 @@ enum class MqttMessageType {
     Telemetry,         ///< Telemetry message
     Heartbeat,         ///< Heartbeat message
     ModuleReady,       ///< Module ready message
-    GlobalReady        ///< Global ready message
+    GlobalReady,       ///< Global ready message
+    StartupTrace       ///< Startup trace events of a module
 };
 
 std::string mqtt_message_type_to_string(MqttMessageType type);
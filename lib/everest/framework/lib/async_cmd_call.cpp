@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <utils/async_cmd_call.hpp>
+
+#include <fmt/format.h>
+
+#include <utils/conversions.hpp>
+#include <utils/exceptions.hpp>
+
+namespace Everest {
+
+json get_cmd_result(CmdResult&& result) {
+    if (result.error.has_value()) {
+        const auto& error = result.error.value();
+        const auto error_message = fmt::format("{}", error.msg);
+        switch (error.event) {
+        case CmdErrorType::MessageParsingError:
+            throw MessageParsingError(error_message);
+        case CmdErrorType::SchemaValidationError:
+            throw SchemaValidationError(error_message);
+        case CmdErrorType::HandlerException:
+            throw HandlerException(error_message);
+        case CmdErrorType::CmdTimeout:
+            throw CmdTimeout(error_message);
+        case CmdErrorType::Shutdown:
+            throw Shutdown(error_message);
+        case CmdErrorType::NotReady:
+            throw NotReady(error_message);
+        default:
+            throw CmdError(fmt::format("{}: {}", conversions::cmd_error_type_to_string(error.event), error.msg));
+        }
+    }
+
+    if (not result.result.has_value()) {
+        throw CmdError("Command did not return result");
+    }
+
+    return std::move(result.result.value());
+}
+
+AsyncResult<json> to_async_result(CmdResult&& result) {
+    try {
+        return AsyncResult<json>(get_cmd_result(std::move(result)));
+    } catch (...) {
+        return AsyncResult<json>::failure(std::current_exception());
+    }
+}
+
+AsyncCmdCall::AsyncCmdCall(ModuleExecutor& executor, AsyncCmdResultHandler handler) :
+    executor(executor), handler(std::move(handler)) {
+}
+
+void AsyncCmdCall::start_timeout(const std::shared_ptr<AsyncCmdCall>& call, std::chrono::milliseconds timeout,
+                                 const std::string& message, const std::function<void()>& on_timeout) {
+    if (call->completed) {
+        return;
+    }
+    call->timeout = call->executor.post_after(timeout, [call, message, on_timeout]() {
+        if (call->completed.exchange(true)) {
+            return;
+        }
+        on_timeout();
+        call->handler(AsyncResult<json>::failure(std::make_exception_ptr(CmdTimeout(message))));
+    });
+}
+
+void AsyncCmdCall::complete(CmdResult result) {
+    if (this->completed.exchange(true)) {
+        return;
+    }
+    this->executor.cancel(this->timeout);
+    this->executor.post([handler = this->handler, result = std::move(result)]() mutable {
+        handler(to_async_result(std::move(result)));
+    });
+}
+
+} // namespace Everest
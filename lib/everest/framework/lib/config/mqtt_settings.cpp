@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright Pionix GmbH and Contributors to EVerest
 #include <utils/config/mqtt_settings.hpp>
+#include <utils/message_handler.hpp>
+#include <utils/mqtt_payload.hpp>
+#include <utils/shm_transport.hpp>
 
 namespace Everest {
 
@@ -31,6 +34,9 @@ void populate_mqtt_settings(MQTTSettings& mqtt_settings, const std::string& mqtt
     mqtt_settings.broker_socket_path = mqtt_broker_socket_path;
     mqtt_settings.everest_prefix = mqtt_everest_prefix;
     mqtt_settings.external_prefix = mqtt_external_prefix;
+    mqtt_settings.everest_payload_encoding = mqtt_payload_encoding_from_environment();
+    mqtt_settings.shm_transport = shm_transport_settings_from_environment();
+    mqtt_settings.message_handler = message_handler_settings_from_environment();
 }
 
 void populate_mqtt_settings(MQTTSettings& mqtt_settings, const std::string& mqtt_broker_host,
@@ -40,6 +46,9 @@ void populate_mqtt_settings(MQTTSettings& mqtt_settings, const std::string& mqtt
     mqtt_settings.broker_port = mqtt_broker_port;
     mqtt_settings.everest_prefix = mqtt_everest_prefix;
     mqtt_settings.external_prefix = mqtt_external_prefix;
+    mqtt_settings.everest_payload_encoding = mqtt_payload_encoding_from_environment();
+    mqtt_settings.shm_transport = shm_transport_settings_from_environment();
+    mqtt_settings.message_handler = message_handler_settings_from_environment();
 }
 
 } // namespace Everest
@@ -46,6 +46,7 @@ Everest::Everest(std::string module_id_, const Config& config_, bool validate_da
     config(config_),
     module_id(std::move(module_id_)),
     ready_received(false),
+    ready_received_early(false),
     ready_processed(false),
     remote_cmd_res_timeout(remote_cmd_res_timeout_seconds),
     validate_data_with_schema(validate_data_with_schema),
@@ -197,10 +198,18 @@ Everest::Everest(std::string module_id_, const Config& config_, bool validate_da
     }
 
     // register handler for global ready signal
-    const auto handle_ready_wrapper = [this](const std::string&, const json& data) { this->handle_ready(data); };
+    // the manager sends the same signal on the requirements_ready topic of this module if it is configured to release
+    // modules as soon as all of their requirements are ready
+    const auto global_ready_topic = fmt::format("{}ready", mqtt_everest_prefix);
+    const auto handle_ready_wrapper = [this, global_ready_topic](const std::string& topic, const json& data) {
+        this->handle_ready(data, topic != global_ready_topic);
+    };
     const auto everest_ready =
         std::make_shared<TypedHandler>(HandlerType::GlobalReady, std::make_shared<Handler>(handle_ready_wrapper));
-    this->mqtt_abstraction->register_handler(fmt::format("{}ready", mqtt_everest_prefix), everest_ready, QOS::QOS2);
+    this->mqtt_abstraction->register_handler(global_ready_topic, everest_ready, QOS::QOS2);
+    this->mqtt_abstraction->register_handler(
+        fmt::format("{}/requirements_ready", this->config.mqtt_module_prefix(this->module_id)), everest_ready,
+        QOS::QOS2);
 
     this->publish_metadata();
 }
@@ -311,9 +320,8 @@ void Everest::disconnect() {
     this->mqtt_abstraction->disconnect();
 }
 
-json Everest::call_cmd(const Requirement& req, const std::string& cmd_name, const json& json_args) {
-    BOOST_LOG_FUNCTION();
-
+Everest::CmdCall Everest::prepare_cmd_call(const Requirement& req, const std::string& cmd_name,
+                                           const json& json_args) {
     // resolve requirement
     const auto& connections = this->config.resolve_requirement(this->module_id, req.id);
     const auto& connection = connections.at(req.index);
@@ -321,8 +329,6 @@ json Everest::call_cmd(const Requirement& req, const std::string& cmd_name, cons
     // extract manifest definition of this command
     const json& cmd_definition = get_cmd_definition(connection.module_id, connection.implementation_id, cmd_name, true);
 
-    const json& return_type = cmd_definition.at("result").at("type");
-
     // check args against manifest
     if (this->validate_data_with_schema) {
         std::set<std::string, std::less<>> arg_names = Config::keys(json_args);
@@ -366,47 +372,61 @@ json Everest::call_cmd(const Requirement& req, const std::string& cmd_name, cons
         }
     }
 
-    const std::string call_id = everest::helpers::get_uuid();
-
-    std::promise<CmdResult> res_promise;
-    std::future<CmdResult> res_future = res_promise.get_future();
+    CmdCall call;
+    call.call_id = everest::helpers::get_uuid();
+    call.identifier = this->config.printable_identifier(connection.module_id, connection.implementation_id);
+    call.cmd_topic = fmt::format(
+        "{}/cmd/{}", this->config.mqtt_prefix(connection.module_id, connection.implementation_id), cmd_name);
+    call.cmd_response_topic = fmt::format("{}/response/{}", call.cmd_topic, this->module_id);
+    return call;
+}
 
-    const auto res_handler = [this, &res_promise, call_id, connection, cmd_name, return_type](const std::string&,
-                                                                                              json data) {
+std::shared_ptr<TypedHandler> Everest::send_cmd_call(const CmdCall& call, const std::string& cmd_name,
+                                                     const json& json_args,
+                                                     const std::function<void(CmdResult)>& result_handler) {
+    const auto res_handler = [call, cmd_name, result_handler](const std::string&, json data) {
         const auto& data_id = data.at("id");
-        if (data_id != call_id) {
-            EVLOG_debug << fmt::format("RES: data_id != call_id ({} != {})", data_id, call_id);
+        if (data_id != call.call_id) {
+            EVLOG_debug << fmt::format("RES: data_id != call_id ({} != {})", data_id, call.call_id);
             return;
         }
 
         if (data.contains("error")) {
-            EVLOG_error << fmt::format(
-                "{}: {} during command call: {}->{}()", data.at("error").at(conversions::ERROR_TYPE).get<std::string>(),
-                data.at("error").at(conversions::ERROR_MSG),
-                this->config.printable_identifier(connection.module_id, connection.implementation_id), cmd_name);
-            res_promise.set_value(CmdResult{std::nullopt, data.at("error")});
+            EVLOG_error << fmt::format("{}: {} during command call: {}->{}()",
+                                       data.at("error").at(conversions::ERROR_TYPE).get<std::string>(),
+                                       data.at("error").at(conversions::ERROR_MSG), call.identifier, cmd_name);
+            result_handler(CmdResult{std::nullopt, data.at("error")});
         } else {
-            EVLOG_verbose << fmt::format(
-                "Incoming res {} for {}->{}()", data_id,
-                this->config.printable_identifier(connection.module_id, connection.implementation_id), cmd_name);
+            EVLOG_verbose << fmt::format("Incoming res {} for {}->{}()", data_id, call.identifier, cmd_name);
 
-            res_promise.set_value(CmdResult{std::move(data["retval"]), std::nullopt});
+            result_handler(CmdResult{std::move(data["retval"]), std::nullopt});
         }
     };
 
-    const auto cmd_topic = fmt::format(
-        "{}/cmd/{}", this->config.mqtt_prefix(connection.module_id, connection.implementation_id), cmd_name);
-    const auto cmd_response_topic = fmt::format("{}/response/{}", cmd_topic, this->module_id);
-
-    const std::shared_ptr<TypedHandler> res_token =
-        std::make_shared<TypedHandler>(cmd_name, call_id, HandlerType::Result, std::make_shared<Handler>(res_handler));
-    this->mqtt_abstraction->register_handler(cmd_response_topic, res_token, QOS::QOS2);
+    const std::shared_ptr<TypedHandler> res_token = std::make_shared<TypedHandler>(
+        cmd_name, call.call_id, HandlerType::Result, std::make_shared<Handler>(res_handler));
+    this->mqtt_abstraction->register_handler(call.cmd_response_topic, res_token, QOS::QOS2);
 
-    const json cmd_publish_data = json::object({{"id", call_id}, {"args", json_args}, {"origin", this->module_id}});
+    const json cmd_publish_data =
+        json::object({{"id", call.call_id}, {"args", json_args}, {"origin", this->module_id}});
 
     MqttMessagePayload payload{MqttMessageType::Cmd, cmd_publish_data};
 
-    this->mqtt_abstraction->publish(cmd_topic, payload, QOS::QOS2);
+    this->mqtt_abstraction->publish(call.cmd_topic, payload, QOS::QOS2);
+    return res_token;
+}
+
+json Everest::call_cmd(const Requirement& req, const std::string& cmd_name, const json& json_args) {
+    BOOST_LOG_FUNCTION();
+
+    const auto call = this->prepare_cmd_call(req, cmd_name, json_args);
+
+    // shared with the result handler, which may still be called after a timeout
+    const auto res_promise = std::make_shared<std::promise<CmdResult>>();
+    std::future<CmdResult> res_future = res_promise->get_future();
+
+    this->send_cmd_call(call, cmd_name, json_args,
+                        [res_promise](CmdResult result) { res_promise->set_value(std::move(result)); });
 
     // wait for result future
     const std::chrono::time_point<std::chrono::steady_clock> res_wait =
@@ -418,42 +438,33 @@ json Everest::call_cmd(const Requirement& req, const std::string& cmd_name, cons
 
     CmdResult result;
     if (res_future_status == std::future_status::timeout) {
-        result.error = CmdResultError{
-            CmdErrorType::CmdTimeout,
-            fmt::format("Timeout while waiting for result of {}->{}()",
-                        this->config.printable_identifier(connection.module_id, connection.implementation_id),
-                        cmd_name)};
+        result.error = CmdResultError{CmdErrorType::CmdTimeout,
+                                      fmt::format("Timeout while waiting for result of {}->{}()", call.identifier,
+                                                  cmd_name)};
     }
     if (res_future_status == std::future_status::ready) {
         result = res_future.get();
     }
 
-    if (result.error.has_value()) {
-        const auto& error = result.error.value();
-        const auto error_message = fmt::format("{}", error.msg);
-        switch (error.event) {
-        case CmdErrorType::MessageParsingError:
-            throw MessageParsingError(error_message);
-        case CmdErrorType::SchemaValidationError:
-            throw SchemaValidationError(error_message);
-        case CmdErrorType::HandlerException:
-            throw HandlerException(error_message);
-        case CmdErrorType::CmdTimeout:
-            throw CmdTimeout(error_message);
-        case CmdErrorType::Shutdown:
-            throw Shutdown(error_message);
-        case CmdErrorType::NotReady:
-            throw NotReady(error_message);
-        default:
-            throw CmdError(fmt::format("{}: {}", conversions::cmd_error_type_to_string(error.event), error.msg));
-        }
-    }
+    return get_cmd_result(std::move(result));
+}
 
-    if (not result.result.has_value()) {
-        throw CmdError("Command did not return result");
-    }
+void Everest::call_cmd_async(const Requirement& req, const std::string& cmd_name, const json& json_args,
+                             const AsyncCmdResultHandler& handler) {
+    BOOST_LOG_FUNCTION();
+
+    const auto call = this->prepare_cmd_call(req, cmd_name, json_args);
+    const auto async_call = std::make_shared<AsyncCmdCall>(this->get_executor(), handler);
 
-    return result.result.value();
+    const auto res_token = this->send_cmd_call(
+        call, cmd_name, json_args, [async_call](CmdResult result) { async_call->complete(std::move(result)); });
+
+    // a result handler is only removed when its result arrives, after a timeout it is removed explicitly
+    AsyncCmdCall::start_timeout(async_call, this->remote_cmd_res_timeout,
+                                fmt::format("Timeout while waiting for result of {}->{}()", call.identifier, cmd_name),
+                                [this, res_token, topic = call.cmd_response_topic]() {
+                                    this->mqtt_abstraction->unregister_handler(topic, res_token);
+                                });
 }
 
 void Everest::publish_var(const std::string& impl_id, const std::string& var_name, const json& value) {
@@ -551,6 +562,30 @@ void Everest::subscribe_var(const Requirement& req, const std::string& var_name,
     this->mqtt_abstraction->register_handler(var_topic, token, QOS::QOS2);
 }
 
+void Everest::subscribe_var_async(const Requirement& req, const std::string& var_name,
+                                  const JsonCallback& callback) {
+    BOOST_LOG_FUNCTION();
+
+    this->subscribe_var(req, var_name, [this, callback](json data) {
+        this->get_executor().post([callback, data = std::move(data)]() { callback(data); });
+    });
+}
+
+void Everest::set_var_policy(const Requirement& req, const std::string& var_name, const TopicPolicy& policy) {
+    BOOST_LOG_FUNCTION();
+
+    const auto& connection = this->config.resolve_requirement(this->module_id, req.id).at(req.index);
+    const auto var_topic = fmt::format(
+        "{}/var/{}", this->config.mqtt_prefix(connection.module_id, connection.implementation_id), var_name);
+
+    this->mqtt_abstraction->set_topic_policy(var_topic, policy);
+}
+
+ModuleExecutor& Everest::get_executor() {
+    std::call_once(this->executor_started, [this]() { this->executor = std::make_unique<ModuleExecutor>(); });
+    return *this->executor;
+}
+
 void Everest::subscribe_error(const Requirement& req, const error::ErrorType& error_type,
                               const error::ErrorCallback& raise_callback, const error::ErrorCallback& clear_callback) {
     BOOST_LOG_FUNCTION();
@@ -810,6 +845,15 @@ void Everest::signal_ready() {
     this->mqtt_abstraction->publish(ready_topic, payload, QOS::QOS2);
 }
 
+void Everest::publish_startup_trace(const json& events) {
+    BOOST_LOG_FUNCTION();
+
+    const auto trace_topic = fmt::format("{}/startup_trace", this->config.mqtt_module_prefix(this->module_id));
+
+    MqttMessagePayload payload{MqttMessageType::StartupTrace, events};
+    this->mqtt_abstraction->publish(trace_topic, payload, QOS::QOS2);
+}
+
 void Everest::ensure_ready() const {
     /// When calling this we actually expect that `ready_processed` is true.
     while (!ready_processed) { // In C++20 we might mark it as [[unlikely]]
@@ -820,9 +864,10 @@ void Everest::ensure_ready() const {
 
 ///
 /// \brief Ready handler for global readyness (e.g. all modules are ready now).
-/// This will called when receiving the global ready signal from manager.
+/// This will called when receiving the global ready signal from manager, or the requirements ready signal if the
+/// manager releases modules as soon as their requirements are ready.
 ///
-void Everest::handle_ready(const json& data) {
+void Everest::handle_ready(const json& data, bool requirements_ready) {
     BOOST_LOG_FUNCTION();
 
     EVLOG_debug << fmt::format("handle_ready: {}", data.dump());
@@ -838,13 +883,19 @@ void Everest::handle_ready(const json& data) {
         return;
     }
 
-    if (this->ready_received) {
-        EVLOG_warning << "Ignoring repeated everest ready signal (possibly triggered by "
-                         "restarting a standalone module)!";
-        return;
+    if (requirements_ready) {
+        this->ready_received_early = true;
     }
 
-    this->ready_received = true;
+    if (this->ready_received.exchange(true)) {
+        if (requirements_ready or this->ready_received_early) {
+            EVLOG_debug << "Ignoring ready signal, module has already been released because its requirements are ready";
+        } else {
+            EVLOG_warning << "Ignoring repeated everest ready signal (possibly triggered by "
+                             "restarting a standalone module)!";
+        }
+        return;
+    }
 
     // call module ready handler
     EVLOG_debug << "Framework now ready to process events, calling module ready handler";
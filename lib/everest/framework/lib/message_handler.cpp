@@ -7,6 +7,11 @@
 #include <everest/logging.hpp>
 #include <fmt/format.h>
 
+#include <framework/runtime.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <optional>
 
 namespace Everest {
@@ -99,16 +104,109 @@ void warn_on_high_queue_size(everest::lib::util::simple_queue<ParsedMessage> con
     }
 }
 
+void push_pending_message(everest::lib::util::simple_queue<ParsedMessage>& queue, ParsedMessage&& message,
+                          const TopicPolicy& policy) {
+    switch (policy.backlog) {
+    case TopicBacklog::Queue:
+        warn_on_high_queue_size(queue, message.topic);
+        break;
+    case TopicBacklog::DropOldest: {
+        const auto max_pending = (policy.max_pending != 0) ? policy.max_pending : MAX_PENDING_MESSAGES_PER_TOPIC;
+        while (queue.size() >= max_pending) {
+            queue.pop();
+        }
+        break;
+    }
+    case TopicBacklog::KeepLatest:
+        // the handler only gets to see the newest message once it is done with the current one
+        while (queue.pop().has_value()) {
+        }
+        break;
+    }
+    queue.push(std::move(message));
+}
+
+TopicPriority default_topic_priority(const json& payload) {
+    auto msg_type_it = payload.find("msg_type");
+    if (msg_type_it == payload.end() || !msg_type_it->is_string()) {
+        return TopicPriority::Normal;
+    }
+    switch (string_to_mqtt_message_type(msg_type_it->get_ref<const std::string&>())) {
+    case MqttMessageType::Cmd:
+    case MqttMessageType::GetConfig:
+    case MqttMessageType::ModuleReady:
+        return TopicPriority::High;
+    case MqttMessageType::StartupTrace:
+        return TopicPriority::Low;
+    default:
+        return TopicPriority::Normal;
+    }
+}
+
+/// \brief Parses a worker count of EV_MESSAGE_HANDLER_THREADS
+/// \returns the count if \p value only consists of digits and is within 1..MAX_MESSAGE_HANDLER_THREADS
+std::optional<std::size_t> parse_thread_count(const std::string& value) {
+    // std::stoul would accept leading whitespace, signs and trailing garbage, e.g. "-1" as ULONG_MAX
+    if (value.empty() or value.size() > 3 or
+        not std::all_of(value.begin(), value.end(), [](unsigned char c) { return std::isdigit(c) != 0; })) {
+        return std::nullopt;
+    }
+    const auto count = static_cast<std::size_t>(std::stoul(value));
+    if (count == 0 or count > MAX_MESSAGE_HANDLER_THREADS) {
+        return std::nullopt;
+    }
+    return count;
+}
+
+const TopicPolicy& find_topic_policy(const std::unordered_map<std::string, TopicPolicy>& policies,
+                                     const std::string& topic) {
+    static const TopicPolicy default_policy;
+    auto const* ptr = everest::lib::util::find_ptr(policies, topic);
+    return (ptr != nullptr) ? ptr->second : default_policy;
+}
+
 } // namespace
 
 using everest::lib::util::bind_obj;
 
-MessageHandler::MessageHandler() {
-    operation_thread_pool = std::make_unique<ThreadPool>(
-        THREAD_POOL_SCALING_MIN_THREAD_COUNT, std::thread::hardware_concurrency(), THREAD_POOL_SCALING_IDLE_TIMEOUT);
+MessageHandlerSettings message_handler_settings_from_environment() {
+    MessageHandlerSettings settings;
+    // NOLINTNEXTLINE(concurrency-mt-unsafe): not problematic that this function is not threadsafe here
+    const char* value = std::getenv(EV_MESSAGE_HANDLER_THREADS);
+    if (value == nullptr) {
+        return settings;
+    }
+    // format: <max> or <min>:<max>
+    const std::string settings_string = value;
+    const auto separator = settings_string.find(':');
+    std::optional<std::size_t> min_threads = settings.min_threads;
+    std::optional<std::size_t> max_threads;
+    if (separator == std::string::npos) {
+        max_threads = parse_thread_count(settings_string);
+    } else {
+        min_threads = parse_thread_count(settings_string.substr(0, separator));
+        max_threads = parse_thread_count(settings_string.substr(separator + 1));
+    }
+    if (not min_threads.has_value() or not max_threads.has_value() or min_threads.value() > max_threads.value()) {
+        EVLOG_warning << "Environment variable " << EV_MESSAGE_HANDLER_THREADS << " has invalid value '"
+                      << settings_string << "'. Using the default message handler threads.";
+        return settings;
+    }
+    settings.min_threads = min_threads.value();
+    settings.max_threads = max_threads.value();
+    return settings;
+}
+
+MessageHandler::MessageHandler(const MessageHandlerSettings& settings) {
+    // at least one worker has to stay alive, the latency based scaling only grows a pool after the threshold
+    const auto min_threads = std::max(settings.min_threads, THREAD_POOL_SCALING_MIN_THREAD_COUNT);
+    const auto max_threads = std::max<std::size_t>(
+        (settings.max_threads != 0) ? settings.max_threads : std::thread::hardware_concurrency(), min_threads);
+    operation_thread_pool = std::make_unique<ThreadPool>(min_threads, max_threads, THREAD_POOL_SCALING_IDLE_TIMEOUT);
     operation_dispatcher_thread = std::thread([this] { run_operation_dispatcher(); });
     result_worker_thread = std::thread([this] { run_result_message_worker(); });
     external_mqtt_worker_thread = std::thread([this] { run_external_mqtt_worker(); });
+    ready_worker_thread = std::thread([this] { run_ready_worker(); });
 }
 
 MessageHandler::~MessageHandler() {
@@ -131,30 +229,10 @@ void MessageHandler::add(const ParsedMessage& message) {
         EVLOG_verbose << "Pushing cmd_result message to queue: " << message.data;
         result_message_queue.push(message);
     } else if (msg_type == MqttMessageType::GlobalReady) {
-        const auto topic_copy = message.topic;
-        const auto data_copy = message.data.at("data");
-
-        // Steal the previous ready thread under the monitor lock, then join it outside.
-        // Using steal-then-join avoids holding the lock during join(), which could block
-        // other add() calls for an arbitrary duration while the handler runs.
-        std::thread old_ready;
-        {
-            auto handle = ready.handle();
-            old_ready = std::move(*handle);
-            *handle = std::thread([this, topic_copy, data_copy] {
-                SharedTypedHandler action;
-                {
-                    auto handle = handlers.handle();
-                    action = handle->global_ready;
-                }
-                if (action) {
-                    (*action->handler)(topic_copy, data_copy);
-                }
-            });
-        } // release ready monitor lock before joining
-        if (old_ready.joinable()) {
-            old_ready.join();
-        }
+        // Handled on a dedicated thread, since ready() may wait for cmd results or vars delivered by the other
+        // threads. Repeated ready signals (e.g. the global ready after the requirements ready signal, or a ready
+        // signal sent again to a restarted module) queue up behind it and are never dropped here.
+        ready_message_queue.push(message);
     } else if (msg_type == MqttMessageType::ExternalMQTT) {
         external_mqtt_message_queue.push(message);
     } else {
@@ -170,6 +248,7 @@ void MessageHandler::stop() {
     operation_message_queue.stop();
     result_message_queue.stop();
     external_mqtt_message_queue.stop();
+    ready_message_queue.stop();
 
     // Join the dispatcher first: it must not be able to call schedule_operation_message()
     // (which dereferences operation_thread_pool) after the pool is destroyed.
@@ -184,13 +263,8 @@ void MessageHandler::stop() {
     if (external_mqtt_worker_thread.joinable()) {
         external_mqtt_worker_thread.join();
     }
-    std::thread ready_to_join;
-    {
-        auto handle = ready.handle();
-        ready_to_join = std::move(*handle);
-    }
-    if (ready_to_join.joinable()) {
-        ready_to_join.join();
+    if (ready_worker_thread.joinable()) {
+        ready_worker_thread.join();
     }
 }
 
@@ -205,39 +279,52 @@ void MessageHandler::run_operation_dispatcher() {
 void MessageHandler::dispatch_operation_message(ParsedMessage&& message) {
     {
         auto handle = operations.handle();
+        const auto& policy = find_topic_policy(handle->policies, message.topic);
         if (everest::lib::util::exists(handle->in_flight, message.topic)) {
-            auto& pending_queue = handle->pending_messages[message.topic];
-            warn_on_high_queue_size(pending_queue, message.topic);
-            pending_queue.push(std::move(message));
+            push_pending_message(handle->pending_messages[message.topic], std::move(message), policy);
             return;
         }
         handle->in_flight.insert(message.topic);
+        const auto priority = policy.priority.value_or(default_topic_priority(message.data));
+        handle->ready.at(static_cast<std::size_t>(priority)).push_back(std::move(message));
     }
 
-    schedule_operation_message(std::move(message));
+    schedule_operation_message();
 }
 
-void MessageHandler::schedule_operation_message(ParsedMessage&& message) {
-    auto handle_operation_message_ftor = bind_obj(&MessageHandler::handle_operation_message, this);
-    auto on_operation_message_done_ftor = bind_obj(&MessageHandler::on_operation_message_done, this);
-    auto operation = [handle = std::move(handle_operation_message_ftor),
-                      done = std::move(on_operation_message_done_ftor), message = std::move(message)]() {
-        try {
-            handle(message.topic, message.data);
-        } catch (...) {
-            done(message.topic);
-            throw;
+void MessageHandler::schedule_operation_message() {
+    // every scheduled run takes one ready message, so the pool sees the same backlog as with one task per message
+    if (operation_thread_pool) {
+        operation_thread_pool->run(bind_obj(&MessageHandler::run_next_operation_message, this));
+    }
+}
+
+void MessageHandler::run_next_operation_message() {
+    std::optional<ParsedMessage> message;
+    {
+        auto handle = operations.handle();
+        for (auto ready = handle->ready.rbegin(); ready != handle->ready.rend(); ++ready) {
+            if (not ready->empty()) {
+                message = std::move(ready->front());
+                ready->pop_front();
+                break;
+            }
         }
-        done(message.topic);
-    };
+    }
+    if (!message.has_value()) {
+        return;
+    }
 
-    if (operation_thread_pool) {
-        operation_thread_pool->run(std::move(operation));
+    try {
+        handle_operation_message(message->topic, message->data);
+    } catch (...) {
+        on_operation_message_done(message->topic);
+        throw;
     }
+    on_operation_message_done(message->topic);
 }
 
 void MessageHandler::on_operation_message_done(const std::string& topic) {
-    std::optional<ParsedMessage> next_message;
     {
         auto handle = operations.handle();
         if (!running) {
@@ -253,20 +340,29 @@ void MessageHandler::on_operation_message_done(const std::string& topic) {
         }
         auto& pending_it = opt_pending_it.value();
         auto& pending_messages = pending_it->second;
-        next_message = pending_messages.pop();
+        auto next_message = pending_messages.pop();
         if (pending_messages.empty()) {
             handle->pending_messages.erase(pending_it);
         }
-    }
 
-    if (!next_message.has_value()) {
-        EVLOG_error << "Internal error: pending_messages queue for topic '" << topic
-                    << "' was empty when expected to contain a message";
-        auto handle = operations.handle();
-        handle->in_flight.erase(topic);
-        return;
+        if (!next_message.has_value()) {
+            EVLOG_error << "Internal error: pending_messages queue for topic '" << topic
+                        << "' was empty when expected to contain a message";
+            handle->in_flight.erase(topic);
+            return;
+        }
+        // the topic stays in flight, its next message competes with the other ready messages by priority
+        const auto& policy = find_topic_policy(handle->policies, topic);
+        const auto priority = policy.priority.value_or(default_topic_priority(next_message->data));
+        handle->ready.at(static_cast<std::size_t>(priority)).push_back(std::move(*next_message));
     }
-    schedule_operation_message(std::move(*next_message));
+
+    schedule_operation_message();
+}
+
+void MessageHandler::set_topic_policy(const std::string& topic, const TopicPolicy& policy) {
+    auto handle = operations.handle();
+    handle->policies[topic] = policy;
 }
 
 void MessageHandler::run_result_message_worker() {
@@ -283,6 +379,20 @@ void MessageHandler::run_external_mqtt_worker() {
     EVLOG_debug << "External MQTT worker thread stopped";
 }
 
+void MessageHandler::run_ready_worker() {
+    while (auto message = ready_message_queue.wait_and_pop()) {
+        SharedTypedHandler action;
+        {
+            auto handle = handlers.handle();
+            action = handle->global_ready;
+        }
+        if (action) {
+            (*action->handler)(message->topic, message->data.at("data"));
+        }
+    }
+    EVLOG_debug << "Ready worker thread stopped";
+}
+
 void MessageHandler::handle_operation_message(const std::string& topic, const json& payload) {
     MqttMessageType msg_type = MqttMessageType::ExternalMQTT;
 
@@ -315,6 +425,9 @@ void MessageHandler::handle_operation_message(const std::string& topic, const js
     case MqttMessageType::ModuleReady:
         handle_module_ready_message(topic, data);
         break;
+    case MqttMessageType::StartupTrace:
+        handle_startup_trace_message(topic, data);
+        break;
     default:
         break;
     }
@@ -385,12 +498,85 @@ void MessageHandler::register_handler(const std::string& topic, std::shared_ptr<
         lock->global_ready = handler;
         break;
     }
+    case HandlerType::StartupTrace: {
+        auto lock = handlers.handle();
+        lock->startup_trace[topic] = handler;
+        break;
+    }
     default:
         EVLOG_warning << "Unknown handler type for topic: " << topic;
         break;
     }
 }
 
+void MessageHandler::unregister_handler(const std::string& topic, const std::shared_ptr<TypedHandler>& handler) {
+    const auto erase_from = [&topic, &handler](MultiHandlerMap& map) {
+        const auto it = map.find(topic);
+        if (it == map.end()) {
+            return;
+        }
+        auto& topic_handlers = it->second;
+        topic_handlers.erase(std::remove(topic_handlers.begin(), topic_handlers.end(), handler), topic_handlers.end());
+        if (topic_handlers.empty()) {
+            map.erase(it);
+        }
+    };
+    const auto erase_single = [&topic, &handler](SingleHandlerMap& map) {
+        const auto it = map.find(topic);
+        if (it != map.end() and it->second == handler) {
+            map.erase(it);
+        }
+    };
+
+    switch (handler->type) {
+    case HandlerType::Call:
+        erase_single(handlers.handle()->cmd);
+        break;
+    case HandlerType::Result: {
+        auto lock = responses.handle();
+        const auto it = lock->cmd.find(handler->id);
+        if (it != lock->cmd.end() and it->second == handler) {
+            lock->cmd.erase(it);
+        }
+        break;
+    }
+    case HandlerType::SubscribeVar:
+        erase_from(handlers.handle()->var);
+        break;
+    case HandlerType::SubscribeError:
+        erase_from(handlers.handle()->error);
+        break;
+    case HandlerType::ExternalMQTT:
+        erase_from(handlers.handle()->external_var);
+        break;
+    case HandlerType::GetConfig:
+        erase_single(handlers.handle()->get_module_config);
+        break;
+    case HandlerType::GetConfigResponse: {
+        auto lock = responses.handle();
+        if (lock->config == handler) {
+            lock->config = nullptr;
+        }
+        break;
+    }
+    case HandlerType::ModuleReady:
+        erase_single(handlers.handle()->module_ready);
+        break;
+    case HandlerType::GlobalReady: {
+        auto lock = handlers.handle();
+        if (lock->global_ready == handler) {
+            lock->global_ready = nullptr;
+        }
+        break;
+    }
+    case HandlerType::StartupTrace:
+        erase_single(handlers.handle()->startup_trace);
+        break;
+    default:
+        break;
+    }
+}
+
 // Private message handler methods
 void MessageHandler::handle_var_message(const std::string& topic, const json& data) {
     std::vector<SharedTypedHandler> handler_copy;
@@ -465,6 +651,18 @@ void MessageHandler::handle_module_ready_message(const std::string& topic, const
     }
 }
 
+void MessageHandler::handle_startup_trace_message(const std::string& topic, const json& data) {
+    SharedTypedHandler handler_copy;
+    {
+        auto handle = handlers.handle();
+        handler_copy = copy_shared_handler(handle->startup_trace, topic);
+    }
+
+    if (handler_copy) {
+        (*handler_copy->handler)(topic, data);
+    }
+}
+
 void MessageHandler::handle_cmd_result(const std::string& topic, const json& payload) {
     const auto& data = payload.at("data").at("data");
     const auto& id = data.at("id").get<std::string>();
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <utils/module_executor.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#include <everest/logging.hpp>
+
+namespace Everest {
+
+ModuleExecutor::ModuleExecutor(std::size_t thread_count) {
+    thread_count = std::max<std::size_t>(thread_count, 1);
+    for (std::size_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([this] { run(); });
+    }
+}
+
+ModuleExecutor::~ModuleExecutor() {
+    stop();
+}
+
+void ModuleExecutor::post(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (not running) {
+            return;
+        }
+        tasks.push_back(std::move(task));
+    }
+    cv.notify_one();
+}
+
+ModuleExecutor::TimerId ModuleExecutor::post_at(Clock::time_point deadline, Task task) {
+    TimerId id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (not running) {
+            return id;
+        }
+        id = next_timer_id++;
+        deadlines.emplace(deadline, id);
+        timers.emplace(id, std::make_pair(deadline, std::move(task)));
+    }
+    // the new timer might expire before the one the workers are waiting for
+    cv.notify_all();
+    return id;
+}
+
+ModuleExecutor::TimerId ModuleExecutor::post_after(Clock::duration delay, Task task) {
+    return post_at(Clock::now() + delay, std::move(task));
+}
+
+bool ModuleExecutor::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto timer = timers.find(id);
+    if (timer == timers.end()) {
+        return false;
+    }
+    deadlines.erase({timer->second.first, id});
+    timers.erase(timer);
+    return true;
+}
+
+bool ModuleExecutor::is_executor_thread() const {
+    const auto this_thread = std::this_thread::get_id();
+    return std::any_of(threads.begin(), threads.end(),
+                       [this_thread](const std::thread& thread) { return thread.get_id() == this_thread; });
+}
+
+void ModuleExecutor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        tasks.clear();
+        deadlines.clear();
+        timers.clear();
+    }
+    cv.notify_all();
+
+    for (auto& thread : threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void ModuleExecutor::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (running) {
+        // queue the tasks of all expired timers
+        const auto now = Clock::now();
+        while (not deadlines.empty() and deadlines.begin()->first <= now) {
+            const auto timer = timers.find(deadlines.begin()->second);
+            tasks.push_back(std::move(timer->second.second));
+            timers.erase(timer);
+            deadlines.erase(deadlines.begin());
+        }
+
+        if (tasks.empty()) {
+            if (deadlines.empty()) {
+                cv.wait(lock);
+            } else {
+                // copy the deadline, the timer might be cancelled while waiting
+                const auto next_deadline = deadlines.begin()->first;
+                cv.wait_until(lock, next_deadline);
+            }
+            continue;
+        }
+
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Uncaught exception in module executor task: " << e.what();
+        } catch (...) {
+            EVLOG_error << "Uncaught exception in module executor task";
+        }
+        lock.lock();
+    }
+}
+
+} // namespace Everest
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <utils/module_readiness.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace Everest {
+
+ModuleReadiness::ModuleReadiness(const everest::config::ModuleConfigurations& module_configs,
+                                 const std::vector<std::string>& ignored_modules) {
+    const auto is_ignored = [&ignored_modules](const std::string& module_id) {
+        return std::find(ignored_modules.begin(), ignored_modules.end(), module_id) != ignored_modules.end();
+    };
+
+    for (const auto& [module_id, module_config] : module_configs) {
+        if (not is_ignored(module_id)) {
+            this->nodes[module_id];
+        }
+    }
+
+    for (const auto& [module_id, module_config] : module_configs) {
+        const auto node_it = this->nodes.find(module_id);
+        if (node_it == this->nodes.end()) {
+            continue;
+        }
+        for (const auto& [requirement_id, fulfillments] : module_config.connections) {
+            for (const auto& fulfillment : fulfillments) {
+                if (fulfillment.module_id != module_id and this->nodes.count(fulfillment.module_id) != 0) {
+                    node_it->second.requirements.insert(fulfillment.module_id);
+                }
+            }
+        }
+    }
+
+    // the transitive closure is computed once per module, configs are small enough for this to be cheap
+    for (auto& [module_id, node] : this->nodes) {
+        std::set<std::string> closure;
+        std::vector<std::string> to_visit(node.requirements.begin(), node.requirements.end());
+        while (not to_visit.empty()) {
+            auto current = std::move(to_visit.back());
+            to_visit.pop_back();
+            if (current == module_id or not closure.insert(current).second) {
+                continue;
+            }
+            const auto& current_requirements = this->nodes.at(current).requirements;
+            to_visit.insert(to_visit.end(), current_requirements.begin(), current_requirements.end());
+        }
+
+        node.pending_closure = closure.size();
+        for (const auto& required_module_id : closure) {
+            this->nodes.at(required_module_id).closure_of.push_back(module_id);
+        }
+    }
+}
+
+ModuleReadiness::Update ModuleReadiness::set_ready(const std::string& module_id) {
+    auto& node = this->nodes.at(module_id);
+
+    Update update;
+    if (not node.ready) {
+        node.ready = true;
+        update.newly_ready = true;
+        this->ready_modules += 1;
+
+        for (const auto& dependent_module_id : node.closure_of) {
+            auto& dependent = this->nodes.at(dependent_module_id);
+            dependent.pending_closure -= 1;
+            release_if_possible(dependent_module_id, dependent, update);
+        }
+        release_if_possible(module_id, node, update);
+    }
+
+    update.all_ready = this->all_ready();
+    return update;
+}
+
+void ModuleReadiness::release_if_possible(const std::string& module_id, Node& node, Update& update) {
+    if (node.ready and not node.requirements_released and node.pending_closure == 0) {
+        node.requirements_released = true;
+        update.requirements_ready.push_back(module_id);
+    }
+}
+
+bool ModuleReadiness::is_ready(const std::string& module_id) const {
+    const auto node_it = this->nodes.find(module_id);
+    return node_it != this->nodes.end() and node_it->second.ready;
+}
+
+bool ModuleReadiness::all_ready() const {
+    return this->ready_modules == this->nodes.size();
+}
+
+std::size_t ModuleReadiness::ready_count() const {
+    return this->ready_modules;
+}
+
+std::size_t ModuleReadiness::size() const {
+    return this->nodes.size();
+}
+
+std::vector<std::string> ModuleReadiness::spawn_order() const {
+    std::vector<std::string> order;
+    order.reserve(this->nodes.size());
+    std::set<std::string> visited;
+
+    // depth first post-order, so requirements are emitted before the modules requiring them
+    const std::function<void(const std::string&)> visit = [this, &order, &visited, &visit](const std::string& id) {
+        if (not visited.insert(id).second) {
+            return;
+        }
+        for (const auto& requirement : this->nodes.at(id).requirements) {
+            visit(requirement);
+        }
+        order.push_back(id);
+    };
+
+    for (const auto& [module_id, node] : this->nodes) {
+        visit(module_id);
+    }
+    return order;
+}
+
+} // namespace Everest
@@ -28,6 +28,7 @@
 #include <everest/logging.hpp>
 
 #include <utils/mqtt_abstraction_impl.hpp>
+#include <utils/mqtt_payload.hpp>
 
 namespace Everest {
 constexpr auto mqtt_keep_alive = 20;
@@ -62,7 +63,9 @@ MessageWithQOS::MessageWithQOS(const std::string& topic, const std::string& payl
 MQTTAbstractionImpl::MQTTAbstractionImpl(const MQTTSettings& mqtt_settings) :
     mqtt_everest_prefix(mqtt_settings.everest_prefix),
     mqtt_external_prefix(mqtt_settings.external_prefix),
-    running(true) {
+    everest_payload_encoding(mqtt_settings.everest_payload_encoding),
+    running(true),
+    message_handler(mqtt_settings.message_handler) {
     BOOST_LOG_FUNCTION();
 
     EVLOG_debug << "Initializing MQTT abstraction layer...";
@@ -76,6 +79,18 @@ MQTTAbstractionImpl::MQTTAbstractionImpl(const MQTTSettings& mqtt_settings) :
 
     this->mqtt_is_connected = false;
 
+    if (mqtt_settings.shm_transport.has_value()) {
+        // the other modules expect the vars of this module in shared memory, falling back to MQTT only would
+        // silently cut off their subscriptions
+        try {
+            this->shm_transport = ShmTransport::attach(mqtt_settings.shm_transport.value());
+            EVLOG_debug << "Using shared memory transport for var messages between modules";
+        } catch (const std::exception& e) {
+            EVLOG_AND_THROW(
+                EverestInternalError(fmt::format("Could not attach to shared memory transport: {}", e.what())));
+        }
+    }
+
     this->mqtt_client = std::make_unique<everest::lib::io::mqtt::mqtt_client>(mqtt_reconnect_timeout_ms);
     this->mqtt_client->set_error_handler([](int error, std::string const& msg) {
         if (error) {
@@ -137,6 +152,11 @@ void MQTTAbstractionImpl::publish(const std::string& topic, const json& json) {
 void MQTTAbstractionImpl::publish(const std::string& topic, const json& json, QOS qos, bool retain) {
     BOOST_LOG_FUNCTION();
 
+    if (this->everest_payload_encoding != MQTTPayloadEncoding::JSON and
+        topic.compare(0, this->mqtt_everest_prefix.size(), this->mqtt_everest_prefix) == 0) {
+        publish(topic, encode_mqtt_payload(json, this->everest_payload_encoding), qos, retain);
+        return;
+    }
     publish(topic, json.dump(), qos, retain);
 }
 
@@ -155,6 +175,11 @@ void MQTTAbstractionImpl::publish(const std::string& topic, const std::string& d
 
     auto mqtt_qos = to_io_qos(qos, everest::lib::io::mqtt::mqtt_client::QoS::at_most_once);
 
+    // modules with a slot receive the message through shared memory, the broker still carries it for everyone else
+    if (not retain and this->uses_shm_transport(topic)) {
+        this->shm_transport->publish(topic, data);
+    }
+
     if (retain) {
         if (not(data.empty() and qos == QOS::QOS0)) {
             // topic should be retained, so save the topic in retained_topics
@@ -195,6 +220,11 @@ void MQTTAbstractionImpl::subscribe(const std::string& topic, QOS qos) {
     auto handle = this->managed_topics.handle();
     handle->subscribed_topics.insert(topic);
 
+    if (this->uses_shm_transport(topic) and this->shm_transport->subscribe(topic)) {
+        EVLOG_verbose << fmt::format("Subscribed to {} through shared memory", topic);
+        return;
+    }
+
     this->ev_handler.add_action([this, topic, max_qos_level]() {
         const auto result = this->mqtt_client->subscribe(
             topic,
@@ -219,6 +249,9 @@ void MQTTAbstractionImpl::unsubscribe(const std::string& topic) {
     EVLOG_verbose << fmt::format("Unsubscribing from topic: {}", topic);
 
     handle->subscribed_topics.erase(topic);
+    if (this->shm_transport != nullptr and this->shm_transport->unsubscribe(topic)) {
+        return;
+    }
     this->ev_handler.add_action([this, topic]() { this->mqtt_client->unsubscribe(topic, {}); });
 }
 
@@ -321,6 +354,11 @@ std::shared_future<void> MQTTAbstractionImpl::spawn_main_loop_thread() {
                                                     [this](const auto&) { this->running = false; });
             this->ev_handler.register_event_handler(&this->new_message_event,
                                                     [this](const auto&) { on_mqtt_message(); });
+            if (this->shm_transport != nullptr) {
+                this->ev_handler.register_event_handler(
+                    this->shm_transport->get_notify_fd(), [this](const auto&) { on_shm_message(); },
+                    everest::lib::io::event::poll_events::read);
+            }
 
             this->ev_handler.run(this->running);
         } catch (boost::exception& e) {
@@ -354,6 +392,36 @@ void MQTTAbstractionImpl::on_mqtt_message() {
     }
 }
 
+void MQTTAbstractionImpl::on_shm_message() {
+    this->shm_transport->receive(
+        [this](std::string_view topic, std::string_view payload) { handle_mqtt_message(Message{topic, payload}); });
+}
+
+bool MQTTAbstractionImpl::uses_shm_transport(const std::string& topic) const {
+    if (this->shm_transport == nullptr) {
+        return false;
+    }
+
+    // only var topics of modules with a slot, <everest prefix>modules/<module id>/impl/<impl id>/var/<var name>
+    const std::string_view modules_prefix = "modules/";
+    std::string_view topic_view = topic;
+    if (topic_view.compare(0, this->mqtt_everest_prefix.size(), this->mqtt_everest_prefix) != 0) {
+        return false;
+    }
+    topic_view.remove_prefix(this->mqtt_everest_prefix.size());
+    if (topic_view.compare(0, modules_prefix.size(), modules_prefix) != 0) {
+        return false;
+    }
+    topic_view.remove_prefix(modules_prefix.size());
+
+    const auto module_id_end = topic_view.find('/');
+    if (module_id_end == std::string_view::npos or topic_view.find("/var/", module_id_end) == std::string_view::npos or
+        topic_view.find_first_of("+#") != std::string_view::npos) {
+        return false;
+    }
+    return this->shm_transport->find_slot(topic_view.substr(0, module_id_end)).has_value();
+}
+
 void MQTTAbstractionImpl::handle_mqtt_message(const Message& message) {
     BOOST_LOG_FUNCTION();
 
@@ -369,7 +437,8 @@ void MQTTAbstractionImpl::handle_mqtt_message(const Message& message) {
             topic_view.compare(0, mqtt_everest_prefix_view.size(), mqtt_everest_prefix_view) == 0) {
             EVLOG_verbose << fmt::format("topic {} starts with {}", topic, mqtt_everest_prefix);
             try {
-                this->message_handler.add(ParsedMessage{std::move(topic), json::parse(payload.begin(), payload.end())});
+                // payloads are decoded independently of everest_payload_encoding, publishers may use any encoding
+                this->message_handler.add(ParsedMessage{std::move(topic), decode_mqtt_payload(payload)});
             } catch (nlohmann::detail::parse_error& e) {
                 EVLOG_warning << fmt::format("Could not decode json for incoming topic '{}': {}", topic, payload);
                 return;
@@ -404,8 +473,16 @@ void MQTTAbstractionImpl::on_mqtt_connect() {
         this->mqtt_is_connected = true;
         to_publish = std::move(*handle);
     }
+    // publish() already wrote these messages to the shared memory transport and recorded retained topics, they
+    // only still have to go to the broker
     for (auto& message : to_publish) {
-        this->publish(message->topic, message->payload, message->qos, message->retain);
+        const auto error =
+            this->mqtt_client->publish(message->topic, message->payload,
+                                       to_io_qos(message->qos, everest::lib::io::mqtt::mqtt_client::QoS::at_most_once),
+                                       message->retain, {});
+        if (error != everest::lib::io::mqtt::ErrorCode::Success) {
+            EVLOG_error << "MQTT error during publishing";
+        }
     }
 }
 
@@ -432,11 +509,22 @@ void MQTTAbstractionImpl::register_handler(const std::string& topic, std::shared
     }
 }
 
+void MQTTAbstractionImpl::set_topic_policy(const std::string& topic, const TopicPolicy& policy) {
+    this->message_handler.set_topic_policy(topic, policy);
+}
+
 void MQTTAbstractionImpl::unregister_handler(const std::string& topic, const Token& token) {
     BOOST_LOG_FUNCTION();
 
     EVLOG_verbose << fmt::format("Unregistering handler {} for {}", fmt::ptr(&token), topic);
 
+    this->message_handler.unregister_handler(topic, token);
+
+    // the response topic of a cmd is shared by all calls of the cmd and stays subscribed
+    if (token->type == HandlerType::Result) {
+        return;
+    }
+
     if (this->mqtt_is_connected) {
         this->unsubscribe(topic);
     }
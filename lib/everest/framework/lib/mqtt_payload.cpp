@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <cstdlib>
+
+#include <everest/logging.hpp>
+
+#include <framework/runtime.hpp>
+#include <utils/mqtt_payload.hpp>
+
+namespace Everest {
+
+namespace {
+// tag 55799 as CBOR head, the self-described CBOR magic number
+constexpr std::string_view CBOR_MAGIC{"\xd9\xd9\xf7", 3};
+} // namespace
+
+std::string encode_mqtt_payload(const nlohmann::json& json, MQTTPayloadEncoding encoding) {
+    if (encoding == MQTTPayloadEncoding::JSON) {
+        return json.dump();
+    }
+
+    std::string payload(CBOR_MAGIC);
+    nlohmann::json::to_cbor(json, nlohmann::detail::output_adapter<char>(payload));
+    return payload;
+}
+
+bool is_cbor_mqtt_payload(std::string_view payload) {
+    return payload.substr(0, CBOR_MAGIC.size()) == CBOR_MAGIC;
+}
+
+nlohmann::json decode_mqtt_payload(std::string_view payload) {
+    if (is_cbor_mqtt_payload(payload)) {
+        payload.remove_prefix(CBOR_MAGIC.size());
+        return nlohmann::json::from_cbor(payload.begin(), payload.end());
+    }
+    return nlohmann::json::parse(payload.begin(), payload.end());
+}
+
+MQTTPayloadEncoding mqtt_payload_encoding_from_environment() {
+    // NOLINTNEXTLINE(concurrency-mt-unsafe): not problematic that this function is not threadsafe here
+    const char* encoding = std::getenv(EV_MQTT_PAYLOAD_ENCODING);
+    if (encoding == nullptr) {
+        return MQTTPayloadEncoding::JSON;
+    }
+    const std::string_view value = encoding;
+    if (value == "cbor") {
+        return MQTTPayloadEncoding::CBOR;
+    }
+    if (value != "json") {
+        EVLOG_warning << "Environment variable " << EV_MQTT_PAYLOAD_ENCODING << " set to unknown encoding '" << value
+                      << "'. Using json.";
+    }
+    return MQTTPayloadEncoding::JSON;
+}
+
+} // namespace Everest
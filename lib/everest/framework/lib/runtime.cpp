@@ -10,6 +10,7 @@
 #include <utils/error/error_manager_req.hpp>
 #include <utils/error/error_state_monitor.hpp>
 #include <utils/filesystem.hpp>
+#include <utils/startup_trace.hpp>
 
 #include <algorithm>
 #include <cstdlib>
@@ -449,12 +450,17 @@ int ModuleLoader::initialize() {
     Logging::init(this->logging_config_file.string(), this->module_id);
 
     const auto start_time = std::chrono::system_clock::now();
+    auto startup_trace = StartupTrace::from_environment(this->module_id);
 
+    auto mqtt_connect_span = startup_trace.span("mqtt connect");
     this->mqtt = std::shared_ptr<MQTTAbstraction>(make_mqtt_abstraction(this->mqtt_settings));
     this->mqtt->connect();
     this->mqtt->spawn_main_loop_thread();
+    mqtt_connect_span.end();
 
+    auto get_config_span = startup_trace.span("get_config");
     const auto result = get_module_config(this->mqtt, this->module_id);
+    get_config_span.end();
     const auto get_config_time = std::chrono::system_clock::now();
     EVLOG_debug << "Module " << fmt::format(TERMINAL_STYLE_OK, "{}", module_id) << " get_config() ["
                 << std::chrono::duration_cast<std::chrono::milliseconds>(get_config_time - start_time).count() << "ms]";
@@ -478,7 +484,9 @@ int ModuleLoader::initialize() {
     };
 
     try {
+        auto config_span = startup_trace.span("Config()");
         const auto config = Config(this->mqtt_settings, result);
+        config_span.end();
         const auto config_instantiation_time = std::chrono::system_clock::now();
         EVLOG_debug
             << "Module " << fmt::format(TERMINAL_STYLE_OK, "{}", module_id) << " after Config() instantiation ["
@@ -506,6 +514,7 @@ int ModuleLoader::initialize() {
         }
         Logging::update_process_name(module_identifier);
 
+        auto everest_span = startup_trace.span("Everest()");
         auto everest = Everest(this->module_id, config, rs->validate_schema, this->mqtt, rs->telemetry_prefix,
                                rs->telemetry_enabled, rs->forward_exceptions);
 
@@ -522,6 +531,7 @@ int ModuleLoader::initialize() {
             }
             return 1;
         }
+        everest_span.end();
 
         ModuleAdapter module_adapter;
 
@@ -529,6 +539,11 @@ int ModuleLoader::initialize() {
             return everest.call_cmd(req, cmd_name, args);
         };
 
+        module_adapter.call_async = [&everest](const Requirement& req, const std::string& cmd_name,
+                                               const Parameters& args, const AsyncCmdResultHandler& handler) {
+            everest.call_cmd_async(req, cmd_name, args, handler);
+        };
+
         module_adapter.publish = [&everest](const std::string& req, const std::string& var_name, const Value& value) {
             return everest.publish_var(req, var_name, value);
         };
@@ -538,6 +553,18 @@ int ModuleLoader::initialize() {
             return everest.subscribe_var(req, var_name, callback);
         };
 
+        module_adapter.subscribe_async = [&everest](const Requirement& req, const std::string& var_name,
+                                                    const ValueCallback& callback) {
+            return everest.subscribe_var_async(req, var_name, callback);
+        };
+
+        module_adapter.get_executor = [&everest]() -> ModuleExecutor& { return everest.get_executor(); };
+
+        module_adapter.set_var_policy = [&everest](const Requirement& req, const std::string& var_name,
+                                                   const TopicPolicy& policy) {
+            everest.set_var_policy(req, var_name, policy);
+        };
+
         module_adapter.get_error_manager_impl = [&everest](const std::string& impl_id) {
             return everest.get_error_manager_impl(impl_id);
         };
@@ -605,15 +632,29 @@ int ModuleLoader::initialize() {
             module_info.mapping = module_mappings.value().module;
         }
 
+        auto init_span = startup_trace.span("init()");
         this->callbacks.init(module_configs, module_info);
+        init_span.end();
 
         everest.spawn_main_loop_thread();
 
         // register the modules ready handler with the framework
         // this handler gets called when the global ready signal is received
-        everest.register_on_ready_handler(this->callbacks.ready);
+        StartupTrace::Clock::time_point signal_ready_time;
+        if (startup_trace.is_enabled()) {
+            everest.register_on_ready_handler([this, &everest, &startup_trace, &signal_ready_time]() {
+                startup_trace.record("ModuleReady handshake", signal_ready_time, StartupTrace::Clock::now());
+                auto ready_span = startup_trace.span("ready()");
+                this->callbacks.ready();
+                ready_span.end();
+                everest.publish_startup_trace(startup_trace.to_json());
+            });
+        } else {
+            everest.register_on_ready_handler(this->callbacks.ready);
+        }
 
         // the module should now be ready
+        signal_ready_time = StartupTrace::Clock::now();
         everest.signal_ready();
 
         const auto end_time = std::chrono::system_clock::now();
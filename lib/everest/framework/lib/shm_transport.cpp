@@ -0,0 +1,527 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <everest/logging.hpp>
+
+#include <framework/runtime.hpp>
+#include <utils/shm_transport.hpp>
+
+namespace Everest {
+
+namespace {
+constexpr std::uint32_t SEGMENT_MAGIC = 0x45565348; // "EVSH"
+constexpr std::uint32_t SEGMENT_VERSION = 1;
+constexpr std::size_t MAX_MODULE_ID_LENGTH = 127;
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+constexpr std::size_t PAGE_SIZE = 4096;
+constexpr std::size_t MIN_RING_SIZE = 4096;
+constexpr auto WRITE_TIMEOUT = std::chrono::milliseconds(100);
+
+constexpr std::uint16_t RECORD_PADDING = 1; ///< skip to the start of the ring
+constexpr std::uint16_t RECORD_FIRST = 2;   ///< first fragment of a message, carries the topic
+constexpr std::uint16_t RECORD_LAST = 4;    ///< last fragment of a message
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free and std::atomic<std::uint64_t>::is_always_lock_free,
+              "the shared memory transport needs address free atomics");
+
+struct SegmentHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slot_count;
+    std::uint32_t ring_size;
+    // incremented on every change of a subscription table, publishers cache their receivers per generation
+    std::atomic<std::uint64_t> subscription_generation;
+};
+
+struct SubscriptionEntry {
+    std::atomic<std::uint32_t> length; ///< length of the topic, 0 if the entry is free
+    char topic[ShmTransport::MAX_TOPIC_LENGTH + 1];
+};
+
+struct SlotHeader {
+    char module_id[MAX_MODULE_ID_LENGTH + 1];
+    std::int32_t notify_fd;
+    std::atomic<std::uint32_t> entries_used; ///< number of entries that have ever been used
+    SubscriptionEntry entries[ShmTransport::MAX_SUBSCRIPTIONS];
+};
+
+struct RingHeader {
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> write_pos;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> read_pos;
+};
+
+struct RecordHeader {
+    std::uint32_t size; ///< size of the record including this header and alignment
+    std::uint32_t data_size;
+    std::uint16_t topic_size;
+    std::uint16_t flags;
+    std::uint32_t reserved;
+};
+
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+constexpr std::size_t slots_offset() {
+    return align_up(sizeof(SegmentHeader), CACHE_LINE_SIZE);
+}
+
+constexpr std::size_t slot_stride() {
+    return align_up(sizeof(SlotHeader), CACHE_LINE_SIZE);
+}
+
+std::size_t rings_offset(std::size_t slot_count) {
+    return align_up(slots_offset() + slot_count * slot_stride(), PAGE_SIZE);
+}
+
+std::size_t ring_stride(std::size_t ring_size) {
+    return sizeof(RingHeader) + ring_size;
+}
+
+std::size_t segment_size(std::size_t slot_count, std::size_t ring_size) {
+    return rings_offset(slot_count) + slot_count * slot_count * ring_stride(ring_size);
+}
+
+SegmentHeader& header_of(void* mapping) {
+    return *static_cast<SegmentHeader*>(mapping);
+}
+
+SlotHeader& slot_of(void* mapping, std::size_t slot) {
+    return *reinterpret_cast<SlotHeader*>(static_cast<char*>(mapping) + slots_offset() + slot * slot_stride());
+}
+
+RingHeader& ring_of(void* mapping, std::size_t sender, std::size_t receiver) {
+    const auto& header = header_of(mapping);
+    const auto index = sender * header.slot_count + receiver;
+    return *reinterpret_cast<RingHeader*>(static_cast<char*>(mapping) + rings_offset(header.slot_count) +
+                                          index * ring_stride(header.ring_size));
+}
+
+char* ring_data(RingHeader& ring) {
+    return reinterpret_cast<char*>(&ring) + sizeof(RingHeader);
+}
+
+void notify(int notify_fd) {
+    if (eventfd_write(notify_fd, 1) != 0) {
+        EVLOG_warning << fmt::format("Could not notify shared memory transport receiver: {}", std::strerror(errno));
+    }
+}
+} // namespace
+
+std::optional<ShmTransportSettings> shm_transport_settings_from_environment() {
+    // NOLINTNEXTLINE(concurrency-mt-unsafe): not problematic that this function is not threadsafe here
+    const char* value = std::getenv(EV_SHM_TRANSPORT);
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    // format: <segment fd>:<slot>
+    const std::string_view settings_string = value;
+    const auto separator = settings_string.find(':');
+    try {
+        if (separator == std::string_view::npos) {
+            throw std::invalid_argument("missing separator");
+        }
+        ShmTransportSettings settings;
+        settings.fd = std::stoi(std::string(settings_string.substr(0, separator)));
+        settings.slot = std::stoul(std::string(settings_string.substr(separator + 1)));
+        return settings;
+    } catch (const std::exception&) {
+        EVLOG_warning << "Environment variable " << EV_SHM_TRANSPORT << " has invalid value '" << settings_string
+                      << "'. Not using the shared memory transport.";
+    }
+    return std::nullopt;
+}
+
+ShmTransport::ShmTransport(int fd, bool owns_descriptors, void* mapping, std::size_t mapping_size,
+                           std::optional<std::size_t> own_slot) :
+    fd(fd), owns_descriptors(owns_descriptors), mapping(mapping), mapping_size(mapping_size), own_slot(own_slot) {
+    const auto slot_count = header_of(mapping).slot_count;
+    for (std::size_t slot = 0; slot < slot_count; slot++) {
+        const auto& module_id = slot_of(mapping, slot).module_id;
+        const auto length = strnlen(module_id, sizeof(module_id));
+        if (length > 0 and length < sizeof(module_id)) {
+            this->slots.emplace(std::string(module_id, length), slot);
+        }
+    }
+    this->producers = std::make_unique<RingProducer[]>(slot_count);
+    this->pending_messages.resize(slot_count);
+}
+
+std::unique_ptr<ShmTransport> ShmTransport::create(const std::vector<std::string>& module_ids,
+                                                   std::size_t ring_size) {
+    ring_size = align_up(std::max(ring_size, MIN_RING_SIZE), CACHE_LINE_SIZE);
+    const auto size = segment_size(module_ids.size(), ring_size);
+
+    // without MFD_CLOEXEC, the segment is inherited by the spawned modules
+    const int fd = memfd_create("everest_shm_transport", 0);
+    if (fd == -1) {
+        throw std::runtime_error(fmt::format("Could not create shared memory segment: {}", std::strerror(errno)));
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        const auto error = errno;
+        close(fd);
+        throw std::runtime_error(fmt::format("Could not resize shared memory segment: {}", std::strerror(error)));
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        const auto error = errno;
+        close(fd);
+        throw std::runtime_error(fmt::format("Could not map shared memory segment: {}", std::strerror(error)));
+    }
+
+    // the memfd is zero initialized, which is a valid state for all atomics
+    auto& header = header_of(mapping);
+    header.magic = SEGMENT_MAGIC;
+    header.version = SEGMENT_VERSION;
+    header.slot_count = static_cast<std::uint32_t>(module_ids.size());
+    header.ring_size = static_cast<std::uint32_t>(ring_size);
+
+    for (std::size_t slot = 0; slot < module_ids.size(); slot++) {
+        auto& slot_header = slot_of(mapping, slot);
+        const auto& module_id = module_ids.at(slot);
+        if (module_id.size() <= MAX_MODULE_ID_LENGTH) {
+            module_id.copy(slot_header.module_id, module_id.size());
+        } else {
+            EVLOG_warning << fmt::format("Module id '{}' is too long for the shared memory transport", module_id);
+        }
+        // without EFD_CLOEXEC, the eventfd is inherited by the spawned modules
+        slot_header.notify_fd = eventfd(0, EFD_NONBLOCK);
+        if (slot_header.notify_fd == -1) {
+            const auto error = errno;
+            ShmTransport cleanup(fd, true, mapping, size, std::nullopt);
+            throw std::runtime_error(fmt::format("Could not create eventfd: {}", std::strerror(error)));
+        }
+    }
+
+    return std::unique_ptr<ShmTransport>(new ShmTransport(fd, true, mapping, size, std::nullopt));
+}
+
+std::unique_ptr<ShmTransport> ShmTransport::attach(const ShmTransportSettings& settings) {
+    struct stat segment_stat {};
+    if (fstat(settings.fd, &segment_stat) != 0) {
+        throw std::runtime_error(
+            fmt::format("Could not access shared memory segment {}: {}", settings.fd, std::strerror(errno)));
+    }
+    const auto size = static_cast<std::size_t>(segment_stat.st_size);
+    if (size < sizeof(SegmentHeader)) {
+        throw std::runtime_error("Shared memory segment is too small");
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, settings.fd, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(fmt::format("Could not map shared memory segment: {}", std::strerror(errno)));
+    }
+
+    const auto& header = header_of(mapping);
+    if (header.magic != SEGMENT_MAGIC or header.version != SEGMENT_VERSION or
+        size < segment_size(header.slot_count, header.ring_size) or settings.slot >= header.slot_count) {
+        munmap(mapping, size);
+        throw std::runtime_error("Shared memory segment or slot is invalid");
+    }
+
+    return std::unique_ptr<ShmTransport>(new ShmTransport(settings.fd, false, mapping, size, settings.slot));
+}
+
+ShmTransport::~ShmTransport() {
+    if (this->owns_descriptors) {
+        const auto slot_count = header_of(this->mapping).slot_count;
+        for (std::size_t slot = 0; slot < slot_count; slot++) {
+            const auto notify_fd = slot_of(this->mapping, slot).notify_fd;
+            if (notify_fd > 0) {
+                close(notify_fd);
+            }
+        }
+    }
+    munmap(this->mapping, this->mapping_size);
+    if (this->owns_descriptors) {
+        close(this->fd);
+    }
+}
+
+int ShmTransport::get_fd() const {
+    return this->fd;
+}
+
+std::optional<std::size_t> ShmTransport::find_slot(std::string_view module_id) const {
+    const auto slot = this->slots.find(std::string(module_id));
+    if (slot == this->slots.end()) {
+        return std::nullopt;
+    }
+    return slot->second;
+}
+
+int ShmTransport::get_notify_fd() const {
+    if (not this->own_slot.has_value()) {
+        return -1;
+    }
+    return slot_of(this->mapping, this->own_slot.value()).notify_fd;
+}
+
+bool ShmTransport::subscribe(const std::string& topic) {
+    if (not this->own_slot.has_value() or topic.empty() or topic.size() > MAX_TOPIC_LENGTH) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(this->subscription_mutex);
+    if (this->subscription_entries.find(topic) != this->subscription_entries.end()) {
+        return true;
+    }
+
+    auto& header = header_of(this->mapping);
+    auto& slot = slot_of(this->mapping, this->own_slot.value());
+    for (std::size_t index = 0; index < MAX_SUBSCRIPTIONS; index++) {
+        auto& entry = slot.entries[index];
+        if (entry.length.load(std::memory_order_relaxed) != 0) {
+            continue;
+        }
+        // readers of a previous topic in this entry see the generation change and discard what they read
+        header.subscription_generation.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        topic.copy(entry.topic, topic.size());
+        entry.topic[topic.size()] = '\0';
+        entry.length.store(static_cast<std::uint32_t>(topic.size()), std::memory_order_release);
+        if (index >= slot.entries_used.load(std::memory_order_relaxed)) {
+            slot.entries_used.store(static_cast<std::uint32_t>(index + 1), std::memory_order_release);
+        }
+        header.subscription_generation.fetch_add(1, std::memory_order_acq_rel);
+        this->subscription_entries.emplace(topic, index);
+        return true;
+    }
+
+    EVLOG_warning << fmt::format("Shared memory subscription table is full, cannot subscribe to {}", topic);
+    return false;
+}
+
+bool ShmTransport::unsubscribe(const std::string& topic) {
+    std::lock_guard<std::mutex> lock(this->subscription_mutex);
+    const auto subscription = this->subscription_entries.find(topic);
+    if (subscription == this->subscription_entries.end()) {
+        return false;
+    }
+
+    auto& slot = slot_of(this->mapping, this->own_slot.value());
+    slot.entries[subscription->second].length.store(0, std::memory_order_release);
+    header_of(this->mapping).subscription_generation.fetch_add(1, std::memory_order_acq_rel);
+    this->subscription_entries.erase(subscription);
+    return true;
+}
+
+std::vector<std::size_t> ShmTransport::get_receivers(std::string_view topic) {
+    auto& header = header_of(this->mapping);
+
+    std::lock_guard<std::mutex> lock(this->receivers_mutex);
+    const auto generation = header.subscription_generation.load(std::memory_order_acquire);
+    if (generation != this->receivers_generation) {
+        this->receivers_cache.clear();
+        this->receivers_generation = generation;
+    }
+
+    std::string topic_string(topic);
+    const auto cached = this->receivers_cache.find(topic_string);
+    if (cached != this->receivers_cache.end()) {
+        return cached->second;
+    }
+
+    std::vector<std::size_t> receivers;
+    for (std::size_t slot_index = 0; slot_index < header.slot_count; slot_index++) {
+        const auto& slot = slot_of(this->mapping, slot_index);
+        const auto entries_used =
+            std::min<std::size_t>(slot.entries_used.load(std::memory_order_acquire), MAX_SUBSCRIPTIONS);
+        for (std::size_t index = 0; index < entries_used; index++) {
+            const auto& entry = slot.entries[index];
+            if (entry.length.load(std::memory_order_acquire) == topic.size() and
+                std::memcmp(entry.topic, topic.data(), topic.size()) == 0) {
+                receivers.push_back(slot_index);
+                break;
+            }
+        }
+    }
+
+    // only cache the receivers if no subscription changed while reading the tables
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header.subscription_generation.load(std::memory_order_relaxed) == generation) {
+        this->receivers_cache.emplace(std::move(topic_string), receivers);
+    }
+    return receivers;
+}
+
+std::size_t ShmTransport::publish(std::string_view topic, std::string_view payload) {
+    if (not this->own_slot.has_value() or topic.size() > MAX_TOPIC_LENGTH) {
+        return 0;
+    }
+
+    std::size_t delivered = 0;
+    for (const auto receiver : this->get_receivers(topic)) {
+        if (this->write(receiver, topic, payload)) {
+            delivered++;
+        }
+    }
+    return delivered;
+}
+
+bool ShmTransport::write(std::size_t receiver, std::string_view topic, std::string_view payload) {
+    auto& producer = this->producers[receiver];
+    std::lock_guard<std::mutex> lock(producer.mutex);
+
+    auto& ring = ring_of(this->mapping, this->own_slot.value(), receiver);
+    if (producer.stalled) {
+        if (ring.read_pos.load(std::memory_order_acquire) != ring.write_pos.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        EVLOG_info << fmt::format("Shared memory transport receiver {} drains its messages again",
+                                  slot_of(this->mapping, receiver).module_id);
+        producer.stalled = false;
+    }
+
+    // a quarter of the ring per record lets the receiver drain fragments while the next ones are written
+    const std::size_t max_record_size = header_of(this->mapping).ring_size / 4;
+    const std::size_t max_first_fragment = max_record_size - sizeof(RecordHeader) - topic.size();
+    const std::size_t max_fragment = max_record_size - sizeof(RecordHeader);
+
+    std::size_t offset = 0;
+    std::uint16_t flags = RECORD_FIRST;
+    do {
+        const auto fragment_size =
+            std::min(payload.size() - offset, (flags & RECORD_FIRST) ? max_first_fragment : max_fragment);
+        if (offset + fragment_size == payload.size()) {
+            flags |= RECORD_LAST;
+        }
+        if (not this->write_record(receiver, flags, (flags & RECORD_FIRST) ? topic : std::string_view(),
+                                   payload.substr(offset, fragment_size))) {
+            EVLOG_error << fmt::format("Shared memory transport receiver {} does not drain its messages, dropping "
+                                       "messages on {} until it does",
+                                       slot_of(this->mapping, receiver).module_id, topic);
+            producer.stalled = true;
+            return false;
+        }
+        offset += fragment_size;
+        flags = 0;
+    } while (offset < payload.size());
+
+    return true;
+}
+
+bool ShmTransport::write_record(std::size_t receiver, std::uint16_t flags, std::string_view topic,
+                                std::string_view data) {
+    const std::size_t ring_size = header_of(this->mapping).ring_size;
+    auto& ring = ring_of(this->mapping, this->own_slot.value(), receiver);
+    char* buffer = ring_data(ring);
+
+    const auto record_size = align_up(sizeof(RecordHeader) + topic.size() + data.size(), sizeof(std::uint64_t));
+    // this process is the only producer of the ring
+    const auto write_pos = ring.write_pos.load(std::memory_order_relaxed);
+    auto offset = write_pos % ring_size;
+    const auto contiguous = ring_size - offset;
+    const auto padding = contiguous < record_size ? contiguous : 0;
+    const auto total_size = padding + record_size;
+
+    const auto deadline = std::chrono::steady_clock::now() + WRITE_TIMEOUT;
+    while (write_pos + total_size - ring.read_pos.load(std::memory_order_acquire) > ring_size) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    if (padding != 0) {
+        const RecordHeader padding_header{static_cast<std::uint32_t>(padding), 0, 0, RECORD_PADDING, 0};
+        std::memcpy(buffer + offset, &padding_header, sizeof(padding_header));
+        offset = 0;
+    }
+    const RecordHeader record_header{static_cast<std::uint32_t>(record_size), static_cast<std::uint32_t>(data.size()),
+                                     static_cast<std::uint16_t>(topic.size()), flags, 0};
+    std::memcpy(buffer + offset, &record_header, sizeof(record_header));
+    std::memcpy(buffer + offset + sizeof(record_header), topic.data(), topic.size());
+    std::memcpy(buffer + offset + sizeof(record_header) + topic.size(), data.data(), data.size());
+
+    ring.write_pos.store(write_pos + total_size, std::memory_order_seq_cst);
+    // only wake up the receiver if it had drained the ring, otherwise it still reads and sees the new write position
+    if (ring.read_pos.load(std::memory_order_seq_cst) == write_pos) {
+        notify(slot_of(this->mapping, receiver).notify_fd);
+    }
+    return true;
+}
+
+std::size_t ShmTransport::receive(const MessageCallback& callback) {
+    if (not this->own_slot.has_value()) {
+        return 0;
+    }
+
+    // reset the notification before draining, so that messages written meanwhile notify again
+    eventfd_t notifications = 0;
+    eventfd_read(this->get_notify_fd(), &notifications);
+
+    const auto& header = header_of(this->mapping);
+    const std::size_t ring_size = header.ring_size;
+    std::size_t received = 0;
+
+    for (std::size_t sender = 0; sender < header.slot_count; sender++) {
+        auto& ring = ring_of(this->mapping, sender, this->own_slot.value());
+        const char* buffer = ring_data(ring);
+        auto& pending = this->pending_messages.at(sender);
+
+        auto read_pos = ring.read_pos.load(std::memory_order_relaxed);
+        auto write_pos = ring.write_pos.load(std::memory_order_seq_cst);
+        while (read_pos != write_pos) {
+            const auto offset = read_pos % ring_size;
+            RecordHeader record_header{};
+            std::memcpy(&record_header, buffer + offset, sizeof(record_header));
+            if (record_header.size < sizeof(RecordHeader) or record_header.size > ring_size - offset or
+                sizeof(RecordHeader) + record_header.topic_size + record_header.data_size > record_header.size) {
+                EVLOG_error << fmt::format("Corrupted record in shared memory ring of {}, dropping its messages",
+                                           slot_of(this->mapping, sender).module_id);
+                pending.active = false;
+                ring.read_pos.store(write_pos, std::memory_order_seq_cst);
+                break;
+            }
+
+            const auto flags = record_header.flags;
+            const std::string_view topic(buffer + offset + sizeof(RecordHeader), record_header.topic_size);
+            const std::string_view data(topic.data() + topic.size(), record_header.data_size);
+            read_pos += record_header.size;
+
+            if ((flags & RECORD_PADDING) == 0) {
+                if ((flags & RECORD_FIRST) and (flags & RECORD_LAST)) {
+                    // the record stays valid until the read position is published
+                    callback(topic, data);
+                    received++;
+                } else if (flags & RECORD_FIRST) {
+                    pending.topic.assign(topic);
+                    pending.payload.assign(data);
+                    pending.active = true;
+                } else if (pending.active) {
+                    pending.payload.append(data);
+                    if (flags & RECORD_LAST) {
+                        pending.active = false;
+                        callback(pending.topic, pending.payload);
+                        received++;
+                    }
+                }
+            }
+
+            ring.read_pos.store(read_pos, std::memory_order_seq_cst);
+            if (read_pos == write_pos) {
+                write_pos = ring.write_pos.load(std::memory_order_seq_cst);
+            }
+        }
+    }
+
+    return received;
+}
+
+} // namespace Everest
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <utils/shutdown_handler.hpp>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+#include <fmt/format.h>
+
+namespace Everest {
+
+namespace {
+
+struct ShutdownHandlers {
+    std::once_flag installed;
+    std::mutex mutex;
+    std::vector<std::function<void()>> handlers;
+};
+
+ShutdownHandlers& shutdown_handlers() {
+    static ShutdownHandlers instance;
+    return instance;
+}
+
+// written by the signal handler, the only async-signal-safe way to hand SIGTERM over to a regular thread
+int wakeup_fd = -1;
+
+void handle_sigterm(int) {
+    const auto saved_errno = errno;
+    const std::uint64_t one = 1;
+    (void)write(wakeup_fd, &one, sizeof(one));
+    errno = saved_errno;
+}
+
+void run_shutdown_handlers() {
+    std::uint64_t count = 0;
+    while (read(wakeup_fd, &count, sizeof(count)) < 0 and errno == EINTR) {
+    }
+
+    std::vector<std::function<void()>> handlers;
+    {
+        auto& instance = shutdown_handlers();
+        const std::lock_guard<std::mutex> lock(instance.mutex);
+        handlers = instance.handlers;
+    }
+    EVLOG_info << fmt::format("Received SIGTERM, running {} shutdown handler(s)", handlers.size());
+    for (auto handler = handlers.rbegin(); handler != handlers.rend(); ++handler) {
+        try {
+            (*handler)();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Shutdown handler failed: " << e.what();
+        }
+    }
+
+    std::signal(SIGTERM, SIG_DFL);
+    std::raise(SIGTERM);
+}
+
+void install_sigterm_handler() {
+    wakeup_fd = eventfd(0, EFD_CLOEXEC);
+    if (wakeup_fd < 0) {
+        throw std::runtime_error(fmt::format("Could not create shutdown wakeup event: {}", strerror(errno)));
+    }
+    struct sigaction action {};
+    action.sa_handler = handle_sigterm;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGTERM, &action, nullptr) != 0) {
+        throw std::runtime_error(fmt::format("Could not install SIGTERM handler: {}", strerror(errno)));
+    }
+    std::thread(run_shutdown_handlers).detach();
+}
+
+} // namespace
+
+void register_shutdown_handler(std::function<void()> handler) {
+    auto& instance = shutdown_handlers();
+    std::call_once(instance.installed, install_sigterm_handler);
+    const std::lock_guard<std::mutex> lock(instance.mutex);
+    instance.handlers.push_back(std::move(handler));
+}
+
+} // namespace Everest
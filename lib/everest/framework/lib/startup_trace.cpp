@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <utils/startup_trace.hpp>
+
+#include <cstdlib>
+#include <fstream>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+#include <framework/runtime.hpp>
+
+namespace Everest {
+
+namespace {
+std::int64_t to_trace_timestamp(StartupTrace::Clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time_point.time_since_epoch()).count();
+}
+
+long current_thread_id() {
+    return syscall(SYS_gettid);
+}
+} // namespace
+
+StartupTrace::Span::Span(StartupTrace& trace, std::string name) :
+    trace(&trace), name(std::move(name)), start(Clock::now()) {
+}
+
+StartupTrace::Span::Span(Span&& other) noexcept :
+    trace(other.trace), name(std::move(other.name)), start(other.start) {
+    other.trace = nullptr;
+}
+
+StartupTrace::Span::~Span() {
+    this->end();
+}
+
+void StartupTrace::Span::end() {
+    if (this->trace == nullptr) {
+        return;
+    }
+    this->trace->record(this->name, this->start, Clock::now());
+    this->trace = nullptr;
+}
+
+StartupTrace::StartupTrace(std::string process_name, bool enabled) :
+    process_name(std::move(process_name)), enabled(enabled), pid(getpid()) {
+}
+
+StartupTrace StartupTrace::from_environment(const std::string& process_name) {
+    return StartupTrace(process_name, std::getenv(EV_STARTUP_TRACE) != nullptr);
+}
+
+bool StartupTrace::is_enabled() const {
+    return this->enabled;
+}
+
+StartupTrace::Span StartupTrace::span(const std::string& name) {
+    return Span(*this, name);
+}
+
+void StartupTrace::record(const std::string& name, Clock::time_point start, Clock::time_point end) {
+    if (not this->enabled) {
+        return;
+    }
+
+    nlohmann::json event = {
+        {"name", name},
+        {"cat", "startup"},
+        {"ph", "X"},
+        {"ts", to_trace_timestamp(start)},
+        {"dur", std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()},
+        {"pid", this->pid},
+        {"tid", current_thread_id()},
+    };
+
+    const std::lock_guard<std::mutex> lock(this->events_mutex);
+    this->events.push_back(std::move(event));
+}
+
+nlohmann::json StartupTrace::to_json() const {
+    auto result = nlohmann::json::array();
+    if (not this->enabled) {
+        return result;
+    }
+
+    result.push_back({
+        {"name", "process_name"},
+        {"ph", "M"},
+        {"pid", this->pid},
+        {"args", {{"name", this->process_name}}},
+    });
+
+    const std::lock_guard<std::mutex> lock(this->events_mutex);
+    for (const auto& event : this->events) {
+        result.push_back(event);
+    }
+    return result;
+}
+
+StartupTraceCollector::StartupTraceCollector(std::filesystem::path output_path) :
+    output_path(std::move(output_path)), events(nlohmann::json::array()) {
+}
+
+void StartupTraceCollector::add(const nlohmann::json& events) {
+    if (not events.is_array()) {
+        EVLOG_warning << "Ignoring startup trace that is not a json array";
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(this->events_mutex);
+    for (const auto& event : events) {
+        this->events.push_back(event);
+    }
+}
+
+bool StartupTraceCollector::write() const {
+    nlohmann::json trace;
+    {
+        const std::lock_guard<std::mutex> lock(this->events_mutex);
+        trace = {{"traceEvents", this->events}, {"displayTimeUnit", "ms"}};
+    }
+
+    // write to a temporary file first so that readers never see a partially written trace
+    auto tmp_path = this->output_path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream output_stream(tmp_path, std::ios::trunc);
+        if (not output_stream) {
+            EVLOG_error << "Could not open startup trace file for writing: " << tmp_path.string();
+            return false;
+        }
+        output_stream << trace.dump();
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, this->output_path, ec);
+    if (ec) {
+        EVLOG_error << "Could not write startup trace file " << this->output_path.string() << ": " << ec.message();
+        return false;
+    }
+    return true;
+}
+
+} // namespace Everest
@@ -59,6 +59,8 @@ std::string mqtt_message_type_to_string(MqttMessageType type) {
         return "ModuleReady";
     case MqttMessageType::GlobalReady:
         return "GlobalReady";
+    case MqttMessageType::StartupTrace:
+        return "StartupTrace";
     default:
         throw std::runtime_error("Unknown MQTT message type");
     }
@@ -87,6 +89,8 @@ MqttMessageType string_to_mqtt_message_type(std::string_view str) {
         return MqttMessageType::ModuleReady;
     } else if (str == "GlobalReady") {
         return MqttMessageType::GlobalReady;
+    } else if (str == "StartupTrace") {
+        return MqttMessageType::StartupTrace;
     }
 
     throw std::runtime_error(fmt::format("Unknown MQTT message type string: {}", str));
@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright Pionix GmbH and Contributors to EVerest
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 #include <cstdlib>
@@ -28,7 +31,10 @@
 #include <framework/everest.hpp>
 #include <framework/runtime.hpp>
 #include <utils/config.hpp>
+#include <utils/module_readiness.hpp>
 #include <utils/mqtt_abstraction.hpp>
+#include <utils/shm_transport.hpp>
+#include <utils/startup_trace.hpp>
 #include <utils/status_fifo.hpp>
 
 #include "controller/ipc.hpp"
@@ -95,6 +101,21 @@ struct ModuleStartInfo {
     std::vector<std::string> capabilities;
 };
 
+// Startup tracing state of the manager, only recording if the --startup-trace option is given
+struct ManagerStartupTrace {
+    explicit ManagerStartupTrace(const std::string& output_path) : trace("manager", not output_path.empty()) {
+        if (not output_path.empty()) {
+            collector.emplace(output_path);
+        }
+    }
+
+    StartupTrace trace;
+    std::optional<StartupTraceCollector> collector;
+    // once set, the trace of the manager was added and every incoming module trace causes the trace file to be
+    // rewritten
+    std::atomic<bool> global_ready{false};
+};
+
 namespace {
 /// \brief Setup common environment variables for everestjs and everestpy
 void setup_environment(const ModuleStartInfo& module_info, const RuntimeSettings& rs,
@@ -234,12 +255,30 @@ void exec_module(const RuntimeSettings& rs, const MQTTSettings& mqtt_settings, c
     }
 }
 
-std::map<pid_t, std::string> spawn_modules(const std::vector<ModuleStartInfo>& modules, const ManagerSettings& ms) {
+std::map<pid_t, std::string> spawn_modules(const std::vector<ModuleStartInfo>& modules, const ManagerSettings& ms,
+                                           StartupTrace& startup_trace) {
     std::map<pid_t, std::string> started_modules;
 
     const auto& rs = ms.runtime_settings;
 
+    // C++ modules use the MQTTAbstraction of the framework, they inherit the segment and exchange vars through it
+    std::unique_ptr<ShmTransport> shm_transport;
+    if (ms.shm_transport_ring_size != 0) {
+        std::vector<std::string> module_ids;
+        for (const auto& module : modules) {
+            if (module.language == ModuleStartInfo::Language::cpp) {
+                module_ids.push_back(module.name);
+            }
+        }
+        try {
+            shm_transport = ShmTransport::create(module_ids, ms.shm_transport_ring_size);
+        } catch (const std::exception& e) {
+            EVLOG_warning << fmt::format("Could not create shared memory transport, using MQTT only: {}", e.what());
+        }
+    }
+
     for (const auto& module : modules) {
+        auto spawn_span = startup_trace.span(fmt::format("fork/exec {}", module.name));
 
         auto proc_handle = system::SubProcess::create(ms.run_as_user, module.capabilities);
 
@@ -247,6 +286,20 @@ std::map<pid_t, std::string> spawn_modules(const std::vector<ModuleStartInfo>& m
             // first, check if we need any capabilities
 
             try {
+                const auto shm_transport_slot =
+                    shm_transport != nullptr ? shm_transport->find_slot(module.name) : std::nullopt;
+                if (shm_transport_slot.has_value()) {
+                    const auto shm_transport_setting =
+                        fmt::format("{}:{}", shm_transport->get_fd(), shm_transport_slot.value());
+                    setenv(EV_SHM_TRANSPORT, shm_transport_setting.c_str(), 1);
+                }
+                auto message_handler_threads = ms.message_handler_threads.find(module.name);
+                if (message_handler_threads == ms.message_handler_threads.end()) {
+                    message_handler_threads = ms.message_handler_threads.find("");
+                }
+                if (message_handler_threads != ms.message_handler_threads.end()) {
+                    setenv(EV_MESSAGE_HANDLER_THREADS, message_handler_threads->second.c_str(), 1);
+                }
                 exec_module(rs, ms.mqtt_settings, module, proc_handle);
             } catch (const std::exception& err) {
                 proc_handle.send_error_and_exit(err.what());
@@ -265,15 +318,17 @@ std::map<pid_t, std::string> spawn_modules(const std::vector<ModuleStartInfo>& m
 } // namespace
 
 struct ModuleReadyInfo {
-    bool ready;
     std::shared_ptr<TypedHandler> ready_token;
     std::shared_ptr<TypedHandler> get_config_token;
+    std::shared_ptr<TypedHandler> startup_trace_token{nullptr};
 };
 
 // FIXME (aw): these are globals here, because they are used in the ready callback handlers
 using ModulesReadyType = std::unordered_map<std::string, ModuleReadyInfo>;
 namespace {
 ModulesReadyType modules_ready; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// incrementally tracks which modules and which module requirements are ready, guarded by modules_ready_mutex
+ModuleReadiness module_readiness; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 // Don't hold the mutex and use any function of the `mqtt_abstraction` since the
 // mutex is also held inside the `ready` handler which can deadlock.
 std::mutex modules_ready_mutex; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -281,9 +336,12 @@ std::mutex modules_ready_mutex; // NOLINT(cppcoreguidelines-avoid-non-const-glob
 std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstraction& mqtt_abstraction,
                                            const std::vector<std::string>& ignored_modules,
                                            const std::vector<std::string>& standalone_modules,
-                                           const ManagerSettings& ms, StatusFifo& status_fifo, bool retain_topics) {
+                                           const ManagerSettings& ms, StatusFifo& status_fifo, bool retain_topics,
+                                           bool ready_on_requirements, ManagerStartupTrace& startup_trace) {
     BOOST_LOG_FUNCTION();
 
+    auto publish_config_span = startup_trace.trace.span("publish config");
+
     std::vector<ModuleStartInfo> modules_to_spawn;
 
     const auto& module_configurations = config.get_module_configurations();
@@ -365,6 +423,14 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
     mqtt_abstraction.publish(fmt::format("{}module_names", ms.mqtt_settings.everest_prefix), module_names_payload,
                              QOS::QOS2, true);
 
+    publish_config_span.end();
+    const auto modules_start_time = StartupTrace::Clock::now();
+
+    {
+        const std::lock_guard<std::mutex> lock(modules_ready_mutex);
+        module_readiness = ModuleReadiness(module_configurations, ignored_modules);
+    }
+
     for (const auto& [module_id_, module_config] : module_configurations) {
         const auto& module_name = module_config.module_name;
         const auto& module_id = module_id_;
@@ -375,7 +441,7 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
         }
 
         // FIXME (aw): implicitly adding ModuleReadyInfo and setting its ready member
-        auto module_it = modules_ready.emplace(module_id, ModuleReadyInfo{false, nullptr, nullptr}).first;
+        auto module_it = modules_ready.emplace(module_id, ModuleReadyInfo{nullptr, nullptr}).first;
 
         std::vector<std::string> capabilities =
             module_configurations.at(module_id).capabilities.value_or(std::vector<std::string>{});
@@ -387,34 +453,63 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
 
         const Handler module_ready_handler = [module_id, &mqtt_abstraction, &config, standalone_modules,
                                               mqtt_everest_prefix = ms.mqtt_settings.everest_prefix, &status_fifo,
-                                              retain_topics](const std::string&, const nlohmann::json& json) {
+                                              retain_topics, ready_on_requirements, &startup_trace,
+                                              modules_start_time](const std::string&, const nlohmann::json& json) {
             EVLOG_debug << fmt::format("received module ready signal for module: {}({})", module_id, json.dump());
+            if (not json.is_boolean() or not json.get<bool>()) {
+                EVLOG_warning << fmt::format("Ignoring non-truish module ready signal of module: {}", module_id);
+                return;
+            }
             const std::unique_lock<std::mutex> lock(modules_ready_mutex);
             // FIXME (aw): here are race conditions, if the ready handler gets called while modules are shut down!
+            ModuleReadiness::Update update;
             try {
-                modules_ready.at(module_id).ready = json.get<bool>();
+                update = module_readiness.set_ready(module_id);
             } catch (const std::out_of_range& ex) {
                 // This can happen if we're shutting down and a module becomes
                 // ready.
                 EVLOG_error << "The module " << module_id << " is not in `modules_ready`: " << ex.what();
                 return;
             }
-            std::size_t modules_spawned = 0;
-            for (const auto& mod : modules_ready) {
-                const std::string text_ready =
-                    fmt::format((mod.second.ready) ? TERMINAL_STYLE_OK : TERMINAL_STYLE_ERROR, "ready");
-                EVLOG_debug << fmt::format("  {}: {}", mod.first, text_ready);
-                if (mod.second.ready) {
-                    modules_spawned += 1;
+            if (not update.newly_ready) {
+                EVLOG_debug << fmt::format("Module {} signalled ready repeatedly", module_id);
+                if (module_readiness.all_ready()) {
+                    // e.g. a restarted standalone module: the global ready signal is not retained, so without sending
+                    // it again the module would wait for it forever
+                    EVLOG_info << fmt::format("Sending ready signal to module {} again", module_id);
+                    MqttMessagePayload payload{MqttMessageType::GlobalReady, nlohmann::json(true)};
+                    mqtt_abstraction.publish(fmt::format("{}/requirements_ready", config.mqtt_module_prefix(module_id)),
+                                             payload);
                 }
+                return;
             }
+            startup_trace.trace.record(fmt::format("ModuleReady {}", module_id), modules_start_time,
+                                       StartupTrace::Clock::now());
+            EVLOG_debug << fmt::format("{}/{} modules ready", module_readiness.ready_count(), module_readiness.size());
             if (!standalone_modules.empty() && std::find(standalone_modules.begin(), standalone_modules.end(),
                                                          module_id) != standalone_modules.end()) {
                 EVLOG_info << fmt::format("Standalone module {} initialized.", module_id);
             }
-            if (std::all_of(modules_ready.begin(), modules_ready.end(),
-                            [](const auto& element) { return element.second.ready; })) {
+            if (ready_on_requirements and not update.all_ready) {
+                // the global ready signal reaches these modules later as well, they ignore it
+                MqttMessagePayload payload{MqttMessageType::GlobalReady, nlohmann::json(true)};
+                for (const auto& released_module_id : update.requirements_ready) {
+                    EVLOG_debug << fmt::format("Requirements of module {} are ready", released_module_id);
+                    mqtt_abstraction.publish(
+                        fmt::format("{}/requirements_ready", config.mqtt_module_prefix(released_module_id)), payload);
+                }
+            }
+            if (update.all_ready) {
                 const auto complete_end_time = std::chrono::system_clock::now();
+                // modules restarted from the admin panel become ready again, but the spans of the manager are
+                // only added to the trace once
+                if (startup_trace.collector.has_value() and not startup_trace.global_ready) {
+                    startup_trace.trace.record("wait for ModuleReady", modules_start_time, complete_end_time);
+                    startup_trace.trace.record("startup", complete_start_time, complete_end_time);
+                    startup_trace.collector->add(startup_trace.trace.to_json());
+                    startup_trace.collector->write();
+                    startup_trace.global_ready = true;
+                }
                 status_fifo.update(StatusFifo::ALL_MODULES_STARTED);
                 if (not retain_topics) {
                     EVLOG_info << "Clearing retained topics published by manager during startup";
@@ -431,7 +526,7 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
 
                 mqtt_abstraction.publish(fmt::format("{}ready", mqtt_everest_prefix), payload);
             } else if (!standalone_modules.empty()) {
-                if (modules_spawned == modules_ready.size() - standalone_modules.size()) {
+                if (module_readiness.ready_count() == module_readiness.size() - standalone_modules.size()) {
                     EVLOG_info << fmt::format(fg(fmt::terminal_color::green),
                                               "Modules started by manager are ready, waiting for standalone modules.");
                     status_fifo.update(StatusFifo::WAITING_FOR_STANDALONE_MODULES);
@@ -444,6 +539,20 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
             std::make_shared<TypedHandler>(HandlerType::ModuleReady, std::make_shared<Handler>(module_ready_handler));
         mqtt_abstraction.register_handler(ready_topic, module_it->second.ready_token, QOS::QOS2);
 
+        if (startup_trace.collector.has_value()) {
+            const Handler startup_trace_handler = [&startup_trace](const std::string&, const nlohmann::json& json) {
+                startup_trace.collector->add(json);
+                if (startup_trace.global_ready) {
+                    startup_trace.collector->write();
+                }
+            };
+            const std::string startup_trace_topic =
+                fmt::format("{}/startup_trace", config.mqtt_module_prefix(module_id));
+            module_it->second.startup_trace_token = std::make_shared<TypedHandler>(
+                HandlerType::StartupTrace, std::make_shared<Handler>(startup_trace_handler));
+            mqtt_abstraction.register_handler(startup_trace_topic, module_it->second.startup_trace_token, QOS::QOS2);
+        }
+
         if (std::any_of(standalone_modules.begin(), standalone_modules.end(),
                         [module_id](const auto& element) { return element == module_id; })) {
             EVLOG_info << "Not starting standalone module: " << fmt::format(TERMINAL_STYLE_BLUE, "{}", module_id);
@@ -488,7 +597,21 @@ std::map<pid_t, std::string> start_modules(ManagerConfig& config, MQTTAbstractio
         }
     }
 
-    return spawn_modules(modules_to_spawn, ms);
+    // spawn modules providing requirements first, so that they tend to become ready before the modules using them
+    std::unordered_map<std::string, std::size_t> spawn_position;
+    {
+        const std::lock_guard<std::mutex> lock(modules_ready_mutex);
+        for (const auto& module_id : module_readiness.spawn_order()) {
+            spawn_position.emplace(module_id, spawn_position.size());
+        }
+    }
+    std::stable_sort(modules_to_spawn.begin(), modules_to_spawn.end(),
+                     [&spawn_position](const ModuleStartInfo& lhs, const ModuleStartInfo& rhs) {
+                         return spawn_position.at(lhs.name) < spawn_position.at(rhs.name);
+                     });
+
+    auto spawn_modules_span = startup_trace.trace.span("spawn_modules");
+    return spawn_modules(modules_to_spawn, ms, startup_trace.trace);
 }
 
 void shutdown_modules(const std::map<pid_t, std::string>& modules, ManagerConfig& config,
@@ -500,6 +623,7 @@ void shutdown_modules(const std::map<pid_t, std::string>& modules, ManagerConfig
         modules_ready_moved = std::move(modules_ready);
         // Probably not needed after our move but lets be explicit.
         modules_ready.clear();
+        module_readiness = ModuleReadiness();
     }
 
     for (const auto& module : modules_ready_moved) {
@@ -507,6 +631,11 @@ void shutdown_modules(const std::map<pid_t, std::string>& modules, ManagerConfig
         const auto& module_name = module.first;
         const std::string topic = fmt::format("{}/ready", config.mqtt_module_prefix(module_name));
         mqtt_abstraction.unregister_handler(topic, ready_info.ready_token);
+        if (ready_info.startup_trace_token != nullptr) {
+            const std::string startup_trace_topic =
+                fmt::format("{}/startup_trace", config.mqtt_module_prefix(module_name));
+            mqtt_abstraction.unregister_handler(startup_trace_topic, ready_info.startup_trace_token);
+        }
     }
 
     for (const auto& child : modules) {
@@ -613,8 +742,15 @@ int boot(const po::variables_map& vm) {
     const auto db_init = vm.count("db-init") != 0;
     ConfigBootMode boot_mode = parse_config_boot_mode(config_opt, db_opt, db_init);
 
+    // the startup trace has to be known before any module is spawned, the modules inherit the environment
+    ManagerStartupTrace startup_trace(parse_string_option(vm, "startup-trace"));
+    if (startup_trace.trace.is_enabled()) {
+        setenv(EV_STARTUP_TRACE, "1", 1);
+    }
+
     ManagerSettings ms;
 
+    auto load_settings_span = startup_trace.trace.span("load settings (yaml parsing)");
     switch (boot_mode) {
     case ConfigBootMode::YamlFile:
         ms = ManagerSettings(prefix_opt, config_opt);
@@ -628,6 +764,7 @@ int boot(const po::variables_map& vm) {
     default:
         throw BootException(fmt::format("Invalid boot source: {}", static_cast<int>(boot_mode)));
     }
+    load_settings_span.end();
 
     // CLI override for mqtt_everest_prefix (e.g. for parallel test execution).
     if (vm.count("mqtt_everest_prefix") != 0) {
@@ -638,6 +775,21 @@ int boot(const po::variables_map& vm) {
         ms.mqtt_settings.everest_prefix = prefix;
     }
 
+    if (vm.count("shm-transport") != 0) {
+        ms.shm_transport_ring_size = vm["shm-transport"].as<std::size_t>() * 1024;
+    }
+
+    if (vm.count("message-handler-threads") != 0) {
+        for (const auto& entry : vm["message-handler-threads"].as<std::vector<std::string>>()) {
+            const auto separator = entry.find('=');
+            if (separator == std::string::npos) {
+                ms.message_handler_threads[""] = entry;
+            } else {
+                ms.message_handler_threads[entry.substr(0, separator)] = entry.substr(separator + 1);
+            }
+        }
+    }
+
     Logging::init(ms.runtime_settings.logging_config_file.string());
 
     EVLOG_info << "  \033[0;1;35;95m_\033[0;1;31;91m__\033[0;1;33;93m__\033[0;1;32;92m__\033[0;1;36;96m_\033[0m      "
@@ -712,9 +864,11 @@ int boot(const po::variables_map& vm) {
     }
 
     const bool retain_topics = (vm.count("retain-topics") != 0);
+    const bool ready_on_requirements = (vm.count("ready-on-requirements") != 0);
 
     const auto start_time = std::chrono::system_clock::now();
     std::shared_ptr<ManagerConfig> config; // TODO: maybe this can stay unique when we re-work start_modules()
+    auto load_config_span = startup_trace.trace.span("load and validate config (schema validation)");
     try {
         config = std::make_shared<ManagerConfig>(ms);
     } catch (EverestInternalError& e) {
@@ -729,6 +883,7 @@ int boot(const po::variables_map& vm) {
         EVLOG_critical << fmt::format("Caught top level std::exception:\n{}", boost::diagnostic_information(e, true));
         return EXIT_FAILURE;
     }
+    load_config_span.end();
     const auto end_time = std::chrono::system_clock::now();
     EVLOG_info << "Config loading completed in "
                << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count() << "ms";
@@ -788,6 +943,7 @@ int boot(const po::variables_map& vm) {
     // create StatusFifo object
     auto status_fifo = StatusFifo::create_from_path(vm["status-fifo"].as<std::string>());
 
+    auto mqtt_connect_span = startup_trace.trace.span("mqtt connect");
     auto mqtt_abstraction = make_mqtt_abstraction(ms.mqtt_settings);
 
     if (!mqtt_abstraction->connect()) {
@@ -802,11 +958,12 @@ int boot(const po::variables_map& vm) {
     }
 
     mqtt_abstraction->spawn_main_loop_thread();
+    mqtt_connect_span.end();
 
     auto config_service = std::make_unique<config::ConfigService>(*mqtt_abstraction, config);
 
-    auto module_handles =
-        start_modules(*config, *mqtt_abstraction, ignored_modules, standalone_modules, ms, status_fifo, retain_topics);
+    auto module_handles = start_modules(*config, *mqtt_abstraction, ignored_modules, standalone_modules, ms,
+                                        status_fifo, retain_topics, ready_on_requirements, startup_trace);
     bool modules_started = true;
     bool restart_modules = false;
 
@@ -874,7 +1031,7 @@ int boot(const po::variables_map& vm) {
 #ifdef ENABLE_ADMIN_PANEL
         if (module_handles.size() == 0 && restart_modules) {
             module_handles = start_modules(*config, *mqtt_abstraction, ignored_modules, standalone_modules, ms,
-                                           status_fifo, retain_topics);
+                                           status_fifo, retain_topics, ready_on_requirements, startup_trace);
             restart_modules = false;
             modules_started = true;
         }
@@ -944,6 +1101,21 @@ int main(int argc, char* argv[]) {
                        "Path to a named pipe, that shall be used for status updates from the manager");
     desc.add_options()("retain-topics", "Retain configuration MQTT topics setup by manager for inspection, by default "
                                         "these will be cleared after startup");
+    desc.add_options()("ready-on-requirements",
+                       "Call the ready() handler of a module as soon as all modules it requires (transitively) are "
+                       "ready, instead of waiting for all modules");
+    desc.add_options()("startup-trace", po::value<std::string>(),
+                       "Record the startup phases of the manager and all modules and write them as Chrome "
+                       "trace/Perfetto json into the given file");
+    desc.add_options()("shm-transport",
+                       po::value<std::size_t>()->implicit_value(ShmTransport::DEFAULT_RING_SIZE / 1024),
+                       "Exchange vars between C++ modules through shared memory ring buffers of the given size in "
+                       "KiB, the MQTT broker still carries all other topics");
+    desc.add_options()("message-handler-threads", po::value<std::vector<std::string>>()->multitoken(),
+                       "Bounds of the worker pool that handles the vars, commands and errors received by a module as "
+                       "<max> or <min>:<max>, prefixed with <module_id>= to only apply to that module. A module "
+                       "whose handlers call commands that call back into the same module needs at least two "
+                       "workers, with a single worker such a call deadlocks");
     desc.add_options()("mqtt_everest_prefix", po::value<std::string>(),
                        "Override the MQTT everest prefix (useful for running multiple instances in parallel)");
 
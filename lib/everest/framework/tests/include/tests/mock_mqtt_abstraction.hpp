@@ -89,6 +89,9 @@ public:
         m_handlers.erase(topic);
     }
 
+    void set_topic_policy(const std::string& /*topic*/, const TopicPolicy& /*policy*/) override {
+    }
+
     bool connect() override {
         return true;
     }
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <utils/async_cmd_call.hpp>
+#include <utils/exceptions.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+Everest::CmdResult error_result(Everest::CmdErrorType type) {
+    Everest::CmdResult result;
+    result.error = Everest::CmdResultError{type, "failed", nullptr};
+    return result;
+}
+} // namespace
+
+SCENARIO("Results of cmd calls are mapped to async results", "[async_cmd_call]") {
+    GIVEN("A successful call") {
+        Everest::CmdResult result;
+        result.result = 42;
+        THEN("Its result is passed on") {
+            CHECK(Everest::to_async_result(std::move(result)).get() == 42);
+        }
+    }
+
+    GIVEN("Failed calls") {
+        THEN("Their errors are passed on as the matching exceptions") {
+            using Everest::CmdErrorType;
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::MessageParsingError)).get(),
+                            Everest::MessageParsingError);
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::SchemaValidationError)).get(),
+                            Everest::SchemaValidationError);
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::HandlerException)).get(),
+                            Everest::HandlerException);
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::CmdTimeout)).get(),
+                            Everest::CmdTimeout);
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::Shutdown)).get(), Everest::Shutdown);
+            CHECK_THROWS_AS(Everest::to_async_result(error_result(CmdErrorType::NotReady)).get(), Everest::NotReady);
+            CHECK_THROWS_WITH(Everest::to_async_result(error_result(CmdErrorType::CmdTimeout)).get(), "failed");
+        }
+    }
+
+    GIVEN("A call without result and error") {
+        THEN("It fails with a CmdError") {
+            CHECK_THROWS_AS(Everest::to_async_result(Everest::CmdResult{}).get(), Everest::CmdError);
+        }
+    }
+}
+
+SCENARIO("Asynchronous cmd calls complete exactly once on the executor", "[async_cmd_call]") {
+    GIVEN("An executor") {
+        Everest::ModuleExecutor executor;
+
+        WHEN("The result arrives before the timeout") {
+            std::promise<std::pair<bool, int>> completion;
+            std::atomic<int> timeouts{0};
+            const auto call = std::make_shared<Everest::AsyncCmdCall>(
+                executor, [&completion, &executor](Everest::AsyncResult<nlohmann::json> result) {
+                    completion.set_value({executor.is_executor_thread(), result.get().get<int>()});
+                });
+            Everest::AsyncCmdCall::start_timeout(call, 200ms, "timeout", [&timeouts] { timeouts++; });
+
+            Everest::CmdResult result;
+            result.result = 7;
+            call->complete(std::move(result));
+
+            THEN("The handler gets the result on the executor and the response handler is kept") {
+                auto future = completion.get_future();
+                REQUIRE(future.wait_for(1s) == std::future_status::ready);
+                const auto [on_executor, value] = future.get();
+                CHECK(on_executor);
+                CHECK(value == 7);
+                std::this_thread::sleep_for(300ms);
+                CHECK(timeouts == 0);
+            }
+        }
+
+        WHEN("The timeout expires before the result") {
+            std::promise<bool> completion;
+            std::atomic<int> calls{0};
+            std::atomic<int> timeouts{0};
+            const auto call = std::make_shared<Everest::AsyncCmdCall>(
+                executor, [&completion, &executor, &calls, &timeouts](Everest::AsyncResult<nlohmann::json> result) {
+                    calls++;
+                    CHECK(timeouts == 1);
+                    CHECK_THROWS_AS(result.get(), Everest::CmdTimeout);
+                    completion.set_value(executor.is_executor_thread());
+                });
+            Everest::AsyncCmdCall::start_timeout(call, 10ms, "timeout", [&timeouts] { timeouts++; });
+
+            THEN("The response handler is unregistered and a late result is discarded") {
+                auto future = completion.get_future();
+                REQUIRE(future.wait_for(1s) == std::future_status::ready);
+                CHECK(future.get());
+
+                Everest::CmdResult result;
+                result.result = 7;
+                call->complete(std::move(result));
+                std::promise<void> drained;
+                executor.post([&drained] { drained.set_value(); });
+                REQUIRE(drained.get_future().wait_for(1s) == std::future_status::ready);
+                CHECK(calls == 1);
+                CHECK(timeouts == 1);
+            }
+        }
+
+        WHEN("Results arrive at the same moment as the timeout") {
+            THEN("Every call completes exactly once, only timed out calls unregister their response handler") {
+                for (int i = 0; i < 200; i++) {
+                    std::atomic<int> calls{0};
+                    std::atomic<int> timeouts{0};
+                    std::atomic<bool> timed_out{false};
+                    const auto call = std::make_shared<Everest::AsyncCmdCall>(
+                        executor, [&calls, &timed_out](Everest::AsyncResult<nlohmann::json> result) {
+                            calls++;
+                            timed_out = result.has_error();
+                        });
+                    Everest::AsyncCmdCall::start_timeout(call, 1ms, "timeout", [&timeouts] { timeouts++; });
+                    std::thread result_thread([call] {
+                        std::this_thread::sleep_for(1ms);
+                        Everest::CmdResult result;
+                        result.result = 1;
+                        call->complete(std::move(result));
+                    });
+                    result_thread.join();
+
+                    std::promise<void> drained;
+                    executor.post_after(5ms, [&drained] { drained.set_value(); });
+                    REQUIRE(drained.get_future().wait_for(1s) == std::future_status::ready);
+                    REQUIRE(calls == 1);
+                    REQUIRE(timeouts == (timed_out ? 1 : 0));
+                }
+            }
+        }
+    }
+}
@@ -8,6 +8,8 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdlib>
+#include <future>
 #include <map>
 #include <mutex>
 #include <set>
@@ -469,6 +471,35 @@ TEST_CASE("MessageHandler processes result messages separately", "[message_handl
     CHECK(events[0].sequence == 42);
 }
 
+TEST_CASE("MessageHandler drops results of unregistered result handlers", "[message_handler][result]") {
+    MessageHandlerFixture handler;
+    ExecutionTracker tracker;
+
+    auto handler_func = std::make_shared<Handler>(
+        [&](const std::string& topic, const json& data) { tracker.record(topic, data.value("sequence", 0)); });
+    auto timed_out_handler =
+        std::make_shared<TypedHandler>("test-handler", "timed-out-id", HandlerType::Result, handler_func);
+    auto result_handler =
+        std::make_shared<TypedHandler>("test-handler", "result-id", HandlerType::Result, handler_func);
+
+    handler->register_handler("", timed_out_handler);
+    handler->register_handler("", result_handler);
+    handler->unregister_handler("", timed_out_handler);
+
+    ParsedMessage msg;
+    msg.topic = "test/result";
+    msg.data = {{"msg_type", "CmdResult"}, {"data", {{"data", {{"id", "timed-out-id"}, {"sequence", 1}}}}}};
+    handler->add(msg);
+    msg.data = {{"msg_type", "CmdResult"}, {"data", {{"data", {{"id", "result-id"}, {"sequence", 2}}}}}};
+    handler->add(msg);
+
+    // results are handled in order, so the first one was dropped once the second one arrived
+    tracker.wait_for_count(1);
+    auto events = tracker.get_events();
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].sequence == 2);
+}
+
 // ============================================================================
 // Test: Shutdown with Pending Messages
 // ============================================================================
@@ -891,6 +922,59 @@ TEST_CASE("MessageHandler: GlobalReady arrives before register_handler") {
     handler->stop();
 }
 
+TEST_CASE("MessageHandler delivers a repeated GlobalReady after ready() returns", "[message_handler][ready]") {
+    MessageHandler handler;
+
+    // ready() waits for a var, which is delivered by the operation dispatcher
+    std::promise<void> var_received;
+    auto var_future = var_received.get_future();
+    std::vector<std::string> ready_topics;
+    std::mutex ready_topics_mutex;
+    std::promise<bool> ready_result;
+    auto ready_future = ready_result.get_future();
+    handler.register_handler(
+        "global", std::make_shared<TypedHandler>(HandlerType::GlobalReady,
+                                                 std::make_shared<Handler>([&](const std::string& topic, const json&) {
+                                                     std::size_t calls = 0;
+                                                     {
+                                                         std::lock_guard<std::mutex> lock(ready_topics_mutex);
+                                                         ready_topics.push_back(topic);
+                                                         calls = ready_topics.size();
+                                                     }
+                                                     if (calls == 1) {
+                                                         ready_result.set_value(var_future.wait_for(5s) ==
+                                                                                std::future_status::ready);
+                                                     }
+                                                 })));
+    handler.register_handler("test/var",
+                             std::make_shared<TypedHandler>(
+                                 HandlerType::SubscribeVar,
+                                 std::make_shared<Handler>([&](const std::string&, const json&) {
+                                     var_received.set_value();
+                                 })));
+
+    handler.add(create_message("global", "GlobalReady", true));
+    std::this_thread::sleep_for(50ms);
+
+    // the second ready signal must not block add() while the first ready() is running
+    const auto start = std::chrono::steady_clock::now();
+    handler.add(create_message("requirements_ready", "GlobalReady", true));
+    CHECK(std::chrono::steady_clock::now() - start < 1s);
+
+    handler.add(create_var_message("test/var"));
+    REQUIRE(ready_future.wait_for(5s) == std::future_status::ready);
+    CHECK(ready_future.get());
+
+    // it is not dropped either, the handler decides how to treat a repeated signal
+    std::this_thread::sleep_for(50ms);
+    {
+        std::lock_guard<std::mutex> lock(ready_topics_mutex);
+        CHECK(ready_topics == std::vector<std::string>{"global", "requirements_ready"});
+    }
+
+    handler.stop();
+}
+
 TEST_CASE("MessageHandler: Per-topic mutual exclusion (at most one in-flight per topic)") {
     auto handler = std::make_unique<MessageHandler>();
 
@@ -972,3 +1056,132 @@ TEST_CASE("MessageHandler: Per-topic mutual exclusion (at most one in-flight per
 
     handler->stop();
 }
+
+// ============================================================================
+// Test: Topic Priorities and Backlog Policies
+// ============================================================================
+
+namespace {
+
+// Handler that blocks on its first message until the gate is opened
+std::shared_ptr<TypedHandler> create_gated_handler(ExecutionTracker& tracker, std::shared_future<void> gate,
+                                                   HandlerType type = HandlerType::SubscribeVar) {
+    auto handler_func = std::make_shared<Handler>([&tracker, gate](const std::string& topic, const json& data) {
+        tracker.record(topic, data.value("sequence", 0));
+        gate.wait();
+    });
+    return std::make_shared<TypedHandler>(type, handler_func);
+}
+
+std::vector<int> sequences_of(const ExecutionTracker& tracker, const std::string& topic) {
+    std::vector<int> sequences;
+    for (const auto& event : tracker.get_events()) {
+        if (event.topic == topic) {
+            sequences.push_back(event.sequence);
+        }
+    }
+    return sequences;
+}
+
+} // namespace
+
+TEST_CASE("MessageHandler runs commands before vars when the pool is busy", "[message_handler][priority]") {
+    MessageHandler handler(MessageHandlerSettings{1, 1});
+    ExecutionTracker tracker;
+    std::promise<void> gate;
+    auto gate_future = gate.get_future().share();
+
+    handler.register_handler("topic/busy", create_gated_handler(tracker, gate_future));
+    handler.register_handler("topic/var", create_gated_handler(tracker, gate_future));
+    handler.register_handler("topic/cmd", create_gated_handler(tracker, gate_future, HandlerType::Call));
+
+    handler.add(create_var_message("topic/busy", 1));
+    tracker.wait_for_count(1);
+    handler.add(create_var_message("topic/var", 2));
+    handler.add(create_cmd_message("topic/cmd", 3));
+    std::this_thread::sleep_for(100ms);
+
+    gate.set_value();
+    tracker.wait_for_count(3);
+
+    auto events = tracker.get_events();
+    REQUIRE(events.size() == 3);
+    CHECK(events[1].topic == "topic/cmd");
+    CHECK(events[2].topic == "topic/var");
+
+    handler.stop();
+}
+
+TEST_CASE("MessageHandler applies the backlog policy of a topic", "[message_handler][policy]") {
+    MessageHandlerFixture handler;
+    ExecutionTracker tracker;
+    std::promise<void> gate;
+    const std::string topic = "topic/samples";
+
+    TopicPolicy policy;
+    std::vector<int> expected;
+    SECTION("KeepLatest only handles the latest pending message") {
+        policy.backlog = TopicBacklog::KeepLatest;
+        expected = {1, 6};
+    }
+    SECTION("DropOldest keeps the newest max_pending messages") {
+        policy.backlog = TopicBacklog::DropOldest;
+        policy.max_pending = 2;
+        expected = {1, 5, 6};
+    }
+    SECTION("Queue handles every message") {
+        expected = {1, 2, 3, 4, 5, 6};
+    }
+
+    handler->set_topic_policy(topic, policy);
+    handler->register_handler(topic, create_gated_handler(tracker, gate.get_future().share()));
+
+    handler->add(create_var_message(topic, 1));
+    tracker.wait_for_count(1);
+    for (int i = 2; i <= 6; ++i) {
+        handler->add(create_var_message(topic, i));
+    }
+    std::this_thread::sleep_for(100ms);
+
+    gate.set_value();
+    tracker.wait_for_count(expected.size());
+    std::this_thread::sleep_for(50ms);
+
+    CHECK(sequences_of(tracker, topic) == expected);
+}
+
+TEST_CASE("MessageHandler reads its pool bounds from the environment", "[message_handler][settings]") {
+    SECTION("Maximum only") {
+        setenv("EV_MESSAGE_HANDLER_THREADS", "4", 1);
+        const auto settings = message_handler_settings_from_environment();
+        CHECK(settings.min_threads == 1);
+        CHECK(settings.max_threads == 4);
+    }
+    SECTION("Minimum and maximum") {
+        setenv("EV_MESSAGE_HANDLER_THREADS", "2:3", 1);
+        const auto settings = message_handler_settings_from_environment();
+        CHECK(settings.min_threads == 2);
+        CHECK(settings.max_threads == 3);
+    }
+    SECTION("Invalid value") {
+        setenv("EV_MESSAGE_HANDLER_THREADS", "many", 1);
+        const auto settings = message_handler_settings_from_environment();
+        CHECK(settings.min_threads == 1);
+        CHECK(settings.max_threads == 0);
+    }
+    SECTION("Rejected values") {
+        for (const auto* value :
+             {"-1:2", "1:-2", "-4", "+4", " 4", "4x", "0", "2:1", "1:257", "99999999999999999999"}) {
+            setenv("EV_MESSAGE_HANDLER_THREADS", value, 1);
+            const auto settings = message_handler_settings_from_environment();
+            INFO(value);
+            CHECK(settings.min_threads == 1);
+            CHECK(settings.max_threads == 0);
+        }
+    }
+    SECTION("Upper bound") {
+        setenv("EV_MESSAGE_HANDLER_THREADS", "256", 1);
+        CHECK(message_handler_settings_from_environment().max_threads == MAX_MESSAGE_HANDLER_THREADS);
+    }
+    unsetenv("EV_MESSAGE_HANDLER_THREADS");
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <utils/async_result.hpp>
+#include <utils/module_executor.hpp>
+
+using namespace std::chrono_literals;
+
+SCENARIO("Tasks and timers run on the module executor", "[module_executor]") {
+    GIVEN("A single threaded executor") {
+        Everest::ModuleExecutor executor;
+
+        WHEN("Several tasks are posted") {
+            std::vector<int> order;
+            std::promise<void> done;
+            for (int i = 0; i < 5; i++) {
+                executor.post([&order, i] { order.push_back(i); });
+            }
+            executor.post([&done] { done.set_value(); });
+
+            THEN("They run in the order they were posted") {
+                REQUIRE(done.get_future().wait_for(1s) == std::future_status::ready);
+                CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+            }
+        }
+
+        WHEN("Timers are posted out of order") {
+            std::vector<std::string> order;
+            std::promise<void> done;
+            executor.post_after(60ms, [&order, &done] {
+                order.push_back("late");
+                done.set_value();
+            });
+            executor.post_after(10ms, [&order] { order.push_back("early"); });
+
+            THEN("They run in the order of their deadlines") {
+                REQUIRE(done.get_future().wait_for(1s) == std::future_status::ready);
+                CHECK(order == std::vector<std::string>{"early", "late"});
+            }
+        }
+
+        WHEN("A timer is cancelled before it expires") {
+            bool cancelled_ran = false;
+            std::promise<void> done;
+            const auto id = executor.post_after(10ms, [&cancelled_ran] { cancelled_ran = true; });
+            executor.post_after(40ms, [&done] { done.set_value(); });
+
+            THEN("Its task does not run") {
+                CHECK(executor.cancel(id));
+                REQUIRE(done.get_future().wait_for(1s) == std::future_status::ready);
+                CHECK_FALSE(cancelled_ran);
+                CHECK_FALSE(executor.cancel(id));
+            }
+        }
+
+        WHEN("A task throws") {
+            std::promise<bool> done;
+            executor.post([] { throw std::runtime_error("task failed"); });
+            executor.post([&executor, &done] { done.set_value(executor.is_executor_thread()); });
+
+            THEN("The executor keeps running the following tasks") {
+                auto future = done.get_future();
+                REQUIRE(future.wait_for(1s) == std::future_status::ready);
+                CHECK(future.get());
+                CHECK_FALSE(executor.is_executor_thread());
+            }
+        }
+
+        WHEN("The executor is stopped") {
+            executor.stop();
+
+            THEN("New tasks and timers are dropped") {
+                executor.post([] { FAIL("task ran after stop"); });
+                CHECK(executor.post_after(1ms, [] { FAIL("timer ran after stop"); }) == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Results of asynchronous calls can be converted", "[module_executor]") {
+    GIVEN("A successful result") {
+        const Everest::AsyncResult<int> result(21);
+
+        THEN("The conversion is applied to its value") {
+            const auto doubled = result.then([](const int& value) { return std::to_string(value * 2); });
+            REQUIRE_FALSE(doubled.has_error());
+            CHECK(doubled.get() == "42");
+        }
+
+        THEN("An exception thrown by the conversion becomes the error") {
+            const auto converted = result.then([](const int&) -> int { throw std::runtime_error("bad value"); });
+            CHECK(converted.has_error());
+            CHECK_THROWS_AS(converted.get(), std::runtime_error);
+        }
+    }
+
+    GIVEN("A failed result") {
+        const auto result = Everest::AsyncResult<int>::failure(std::make_exception_ptr(std::runtime_error("timeout")));
+
+        THEN("The error is passed on without calling the conversion") {
+            bool called = false;
+            const auto converted = result.then([&called](const int&) { called = true; });
+            CHECK_FALSE(called);
+            CHECK(converted.has_error());
+            CHECK_THROWS_AS(converted.get(), std::runtime_error);
+        }
+    }
+}
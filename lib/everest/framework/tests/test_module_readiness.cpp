@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+
+#include <utils/module_readiness.hpp>
+
+namespace {
+everest::config::ModuleConfig make_module_config(const std::string& module_id,
+                                                 const std::vector<std::string>& required_modules) {
+    everest::config::ModuleConfig module_config;
+    module_config.module_id = module_id;
+    for (const auto& required_module : required_modules) {
+        Fulfillment fulfillment;
+        fulfillment.module_id = required_module;
+        fulfillment.implementation_id = "main";
+        module_config.connections["req_" + required_module].push_back(fulfillment);
+    }
+    return module_config;
+}
+
+std::size_t position(const std::vector<std::string>& order, const std::string& module_id) {
+    return std::distance(order.begin(), std::find(order.begin(), order.end(), module_id));
+}
+} // namespace
+
+SCENARIO("Module readiness follows the requirement graph", "[module_readiness]") {
+    GIVEN("A chain api -> evse -> powermeter and an independent display") {
+        everest::config::ModuleConfigurations module_configs;
+        module_configs["api"] = make_module_config("api", {"evse"});
+        module_configs["evse"] = make_module_config("evse", {"powermeter"});
+        module_configs["powermeter"] = make_module_config("powermeter", {});
+        module_configs["display"] = make_module_config("display", {});
+
+        Everest::ModuleReadiness readiness(module_configs, {});
+
+        THEN("Requirements are spawned first") {
+            const auto order = readiness.spawn_order();
+            REQUIRE(order.size() == 4);
+            CHECK(position(order, "powermeter") < position(order, "evse"));
+            CHECK(position(order, "evse") < position(order, "api"));
+        }
+
+        WHEN("The api becomes ready first") {
+            const auto update = readiness.set_ready("api");
+
+            THEN("It has to wait for its transitive requirements") {
+                CHECK(update.newly_ready);
+                CHECK(update.requirements_ready.empty());
+                CHECK_FALSE(update.all_ready);
+            }
+
+            AND_WHEN("The powermeter and the evse become ready") {
+                const auto powermeter_update = readiness.set_ready("powermeter");
+                const auto evse_update = readiness.set_ready("evse");
+
+                THEN("Each module is released exactly once") {
+                    CHECK(powermeter_update.requirements_ready == std::vector<std::string>{"powermeter"});
+                    CHECK(evse_update.requirements_ready.size() == 2);
+                    CHECK(readiness.ready_count() == 3);
+                    CHECK_FALSE(evse_update.all_ready);
+                    CHECK(readiness.set_ready("display").all_ready);
+                    CHECK_FALSE(readiness.set_ready("display").newly_ready);
+                }
+            }
+        }
+    }
+
+    GIVEN("Two modules requiring each other and one ignored requirement") {
+        everest::config::ModuleConfigurations module_configs;
+        module_configs["a"] = make_module_config("a", {"b", "ignored"});
+        module_configs["b"] = make_module_config("b", {"a"});
+        module_configs["ignored"] = make_module_config("ignored", {});
+
+        Everest::ModuleReadiness readiness(module_configs, {"ignored"});
+
+        THEN("Both are released once both are ready") {
+            CHECK(readiness.size() == 2);
+            CHECK(readiness.set_ready("a").requirements_ready.empty());
+            const auto update = readiness.set_ready("b");
+            CHECK(update.requirements_ready.size() == 2);
+            CHECK(update.all_ready);
+            CHECK_THROWS_AS(readiness.set_ready("ignored"), std::out_of_range);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <cstdlib>
+
+#include <nlohmann/json.hpp>
+
+#include <framework/runtime.hpp>
+#include <utils/mqtt_payload.hpp>
+
+using namespace Everest;
+
+namespace {
+// a powermeter var message as published by the framework
+nlohmann::json powermeter_var() {
+    return {{"msg_type", "Var"},
+            {"data",
+             {{"var", "powermeter"},
+              {"data",
+               {{"timestamp", "2026-01-01T12:00:00.000Z"},
+                {"meter_id", "DZG-GSH200-0001"},
+                {"energy_Wh_import", {{"total", 123456.7}, {"L1", 41152.2}, {"L2", 41152.3}, {"L3", 41152.2}}},
+                {"power_W", {{"total", 11040.0}, {"L1", 3680.1}, {"L2", 3679.8}, {"L3", 3680.1}}},
+                {"voltage_V", {{"L1", 230.1}, {"L2", 229.8}, {"L3", 230.4}}},
+                {"current_A", {{"L1", 16}, {"L2", 15}, {"L3", 16}, {"N", 0}}},
+                {"phase_seq_error", false},
+                {"temperatures", nlohmann::json::array({{{"temperature", 41.5}, {"location", "plug"}}})}}}}}};
+}
+} // namespace
+
+SCENARIO("MQTT payloads are decoded independently of their encoding", "[mqtt_payload]") {
+    const auto json = powermeter_var();
+
+    GIVEN("A payload encoded as JSON") {
+        const auto payload = encode_mqtt_payload(json, MQTTPayloadEncoding::JSON);
+        THEN("It is the JSON text of the message") {
+            CHECK(payload == json.dump());
+            CHECK_FALSE(is_cbor_mqtt_payload(payload));
+            CHECK(decode_mqtt_payload(payload) == json);
+        }
+    }
+
+    GIVEN("A payload encoded as CBOR") {
+        const auto payload = encode_mqtt_payload(json, MQTTPayloadEncoding::CBOR);
+        THEN("It is recognized, decodes to the same message and is smaller than JSON") {
+            CHECK(is_cbor_mqtt_payload(payload));
+            CHECK(decode_mqtt_payload(payload) == json);
+            CHECK(payload.size() < json.dump().size());
+        }
+    }
+
+    GIVEN("Payloads of every JSON type") {
+        for (const auto& value : {nlohmann::json(nullptr), nlohmann::json(true), nlohmann::json(-42),
+                                  nlohmann::json(1.5), nlohmann::json("text \xc3\xa4"), nlohmann::json::array(),
+                                  nlohmann::json::object()}) {
+            CHECK(decode_mqtt_payload(encode_mqtt_payload(value, MQTTPayloadEncoding::CBOR)) == value);
+            CHECK(decode_mqtt_payload(encode_mqtt_payload(value, MQTTPayloadEncoding::JSON)) == value);
+        }
+    }
+
+    GIVEN("Malformed payloads") {
+        THEN("Decoding throws a parse error") {
+            CHECK_THROWS_AS(decode_mqtt_payload("{\"key\":"), nlohmann::json::parse_error);
+            CHECK_THROWS_AS(decode_mqtt_payload(std::string("\xd9\xd9\xf7\xa1", 4)), nlohmann::json::parse_error);
+        }
+    }
+}
+
+SCENARIO("The MQTT payload encoding is taken from the environment", "[mqtt_payload]") {
+    CHECK(unsetenv(EV_MQTT_PAYLOAD_ENCODING) == 0);
+    CHECK(mqtt_payload_encoding_from_environment() == MQTTPayloadEncoding::JSON);
+
+    CHECK(setenv(EV_MQTT_PAYLOAD_ENCODING, "cbor", 1) == 0);
+    CHECK(mqtt_payload_encoding_from_environment() == MQTTPayloadEncoding::CBOR);
+    CHECK(create_mqtt_settings("/tmp/mqtt.sock", "everest/", "external/").everest_payload_encoding ==
+          MQTTPayloadEncoding::CBOR);
+
+    CHECK(setenv(EV_MQTT_PAYLOAD_ENCODING, "msgpack", 1) == 0);
+    CHECK(mqtt_payload_encoding_from_environment() == MQTTPayloadEncoding::JSON);
+
+    CHECK(unsetenv(EV_MQTT_PAYLOAD_ENCODING) == 0);
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <utils/shm_transport.hpp>
+
+using Everest::ShmTransport;
+
+namespace {
+using Messages = std::vector<std::pair<std::string, std::string>>;
+
+Messages receive_all(ShmTransport& transport) {
+    Messages messages;
+    transport.receive([&messages](std::string_view topic, std::string_view payload) {
+        messages.emplace_back(std::string(topic), std::string(payload));
+    });
+    return messages;
+}
+
+std::unique_ptr<ShmTransport> attach(const ShmTransport& segment, const std::string& module_id) {
+    return ShmTransport::attach({segment.get_fd(), segment.find_slot(module_id).value()});
+}
+
+const std::string var_topic = "everest/modules/evse/impl/main/var/powermeter";
+} // namespace
+
+SCENARIO("Modules exchange messages through the shared memory transport", "[shm_transport]") {
+    GIVEN("A segment with three modules") {
+        const auto segment = ShmTransport::create({"evse", "ocpp", "api"});
+        auto evse = attach(*segment, "evse");
+        auto ocpp = attach(*segment, "ocpp");
+        auto api = attach(*segment, "api");
+
+        THEN("Only modules of the segment have a slot") {
+            CHECK(segment->find_slot("ocpp") == 1);
+            CHECK_FALSE(segment->find_slot("display").has_value());
+        }
+
+        WHEN("Nobody subscribed to a topic") {
+            THEN("Publishing delivers nothing") {
+                CHECK(evse->publish(var_topic, "{}") == 0);
+                CHECK(receive_all(*ocpp).empty());
+            }
+        }
+
+        WHEN("Two modules subscribed to a topic") {
+            REQUIRE(ocpp->subscribe(var_topic));
+            REQUIRE(api->subscribe(var_topic));
+
+            THEN("Both receive the messages in order and are notified") {
+                CHECK(evse->publish(var_topic, "1") == 2);
+                CHECK(evse->publish(var_topic, "2") == 2);
+
+                std::uint64_t notifications = 0;
+                CHECK(read(ocpp->get_notify_fd(), &notifications, sizeof(notifications)) == sizeof(notifications));
+                CHECK(notifications == 1);
+
+                const Messages expected{{var_topic, "1"}, {var_topic, "2"}};
+                CHECK(receive_all(*ocpp) == expected);
+                CHECK(receive_all(*api) == expected);
+                CHECK(receive_all(*evse).empty());
+            }
+
+            AND_WHEN("One of them unsubscribes") {
+                REQUIRE(api->unsubscribe(var_topic));
+
+                THEN("Only the other one receives further messages") {
+                    CHECK(evse->publish(var_topic, "3") == 1);
+                    CHECK(receive_all(*ocpp) == Messages{{var_topic, "3"}});
+                    CHECK(receive_all(*api).empty());
+                }
+            }
+        }
+
+        WHEN("A message is larger than a ring") {
+            REQUIRE(ocpp->subscribe(var_topic));
+            std::string payload;
+            for (int i = 0; payload.size() < 3 * ShmTransport::DEFAULT_RING_SIZE; i++) {
+                payload += std::to_string(i);
+            }
+
+            THEN("It is received in one piece while the receiver drains the ring") {
+                Messages received;
+                pid_t receiver = fork();
+                if (receiver == 0) {
+                    // the child publishes, the parent drains
+                    _exit(evse->publish(var_topic, payload) == 1 ? 0 : 1);
+                }
+                while (received.empty()) {
+                    auto messages = receive_all(*ocpp);
+                    received.insert(received.end(), messages.begin(), messages.end());
+                }
+                int status = 0;
+                waitpid(receiver, &status, 0);
+                CHECK(WEXITSTATUS(status) == 0);
+                REQUIRE(received.size() == 1);
+                CHECK(received.at(0).second == payload);
+            }
+        }
+
+        WHEN("A topic is too long") {
+            THEN("It cannot be subscribed to") {
+                CHECK_FALSE(ocpp->subscribe(std::string(ShmTransport::MAX_TOPIC_LENGTH + 1, 'a')));
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <csignal>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <utils/shutdown_handler.hpp>
+
+using namespace Everest;
+
+TEST_CASE("Shutdown handlers run on SIGTERM before the process terminates", "[shutdown_handler]") {
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+
+    const auto pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+        // child: the handlers write their order into the pipe
+        close(fds[0]);
+        register_shutdown_handler([fd = fds[1]] { (void)write(fd, "1", 1); });
+        register_shutdown_handler([fd = fds[1]] { (void)write(fd, "2", 1); });
+        kill(getpid(), SIGTERM);
+        pause();
+        _exit(0); // not reached, the process is terminated by the signal
+    }
+
+    close(fds[1]);
+    int status = 0;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    CHECK(WIFSIGNALED(status));
+    CHECK(WTERMSIG(status) == SIGTERM);
+
+    std::string order;
+    char c = 0;
+    while (read(fds[0], &c, 1) == 1) {
+        order.push_back(c);
+    }
+    close(fds[0]);
+    // reverse order of registration
+    CHECK(order == "21");
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <catch2/catch_all.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include <utils/startup_trace.hpp>
+
+SCENARIO("Startup trace records spans as Chrome trace events", "[startup_trace]") {
+    GIVEN("An enabled startup trace") {
+        Everest::StartupTrace trace("test_module", true);
+
+        WHEN("Spans are recorded") {
+            {
+                auto scoped_span = trace.span("scoped");
+            }
+            auto ended_span = trace.span("ended");
+            ended_span.end();
+            ended_span.end();
+
+            THEN("Each span is reported once after the process metadata") {
+                const auto events = trace.to_json();
+                REQUIRE(events.size() == 3);
+                CHECK(events.at(0).at("ph") == "M");
+                CHECK(events.at(0).at("args").at("name") == "test_module");
+                CHECK(events.at(1).at("name") == "scoped");
+                CHECK(events.at(1).at("ph") == "X");
+                CHECK(events.at(2).at("name") == "ended");
+                CHECK(events.at(2).at("dur").get<int64_t>() >= 0);
+            }
+        }
+    }
+
+    GIVEN("A disabled startup trace") {
+        Everest::StartupTrace trace("test_module", false);
+
+        WHEN("A span is recorded") {
+            {
+                auto span = trace.span("ignored");
+            }
+
+            THEN("Nothing is reported") {
+                CHECK(trace.to_json().empty());
+            }
+        }
+    }
+
+    GIVEN("A collector") {
+        const auto output_path = std::filesystem::temp_directory_path() / "everest_startup_trace_test.json";
+        Everest::StartupTraceCollector collector(output_path);
+        Everest::StartupTrace trace("test_module", true);
+        trace.span("phase").end();
+
+        WHEN("Traces of several processes are added and written") {
+            collector.add(trace.to_json());
+            collector.add(nlohmann::json::object());
+            REQUIRE(collector.write());
+
+            THEN("The file contains all valid events") {
+                std::ifstream input(output_path);
+                const auto written = nlohmann::json::parse(input);
+                CHECK(written.at("traceEvents").size() == 2);
+            }
+            std::filesystem::remove(output_path);
+        }
+    }
+}
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+// Serialization and parsing of OCPP calls through nlohmann::json compared to JsonWriter/JsonReader.
+//
+// usage: libocpp_json_stream_benchmark [iterations]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include <nlohmann/json.hpp>
+#include <ocpp/v2/json_stream.hpp>
+
+using namespace ocpp;
+using namespace ocpp::v2;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+std::atomic<std::uint64_t> allocations{0};
+} // namespace
+
+// count every heap allocation of the process, the benchmark is single threaded
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+Call<TransactionEventRequest> create_transaction_event() {
+    TransactionEventRequest req;
+    req.eventType = TransactionEventEnum::Updated;
+    req.timestamp = ocpp::DateTime("2024-01-01T12:00:00.000Z");
+    req.triggerReason = TriggerReasonEnum::MeterValuePeriodic;
+    req.seqNo = 7;
+    req.transactionInfo.transactionId = "6d1f3c52-4c8a-4f0e-9d7b-2a3f1b9c8e21";
+    req.transactionInfo.chargingState = ChargingStateEnum::Charging;
+    req.evse = EVSE{1, 1, std::nullopt};
+
+    std::vector<MeterValue> meter_values;
+    for (int i = 0; i < 4; i++) {
+        MeterValue meter_value{{}, ocpp::DateTime("2024-01-01T12:00:00.000Z"), std::nullopt};
+        for (const auto phase : {PhaseEnum::L1, PhaseEnum::L2, PhaseEnum::L3}) {
+            for (const auto measurand : {MeasurandEnum::Current_Import, MeasurandEnum::Voltage,
+                                         MeasurandEnum::Power_Active_Import,
+                                         MeasurandEnum::Energy_Active_Import_Register}) {
+                SampledValue sampled_value;
+                sampled_value.value = 230.1f + i;
+                sampled_value.measurand = measurand;
+                sampled_value.phase = phase;
+                sampled_value.context = ReadingContextEnum::Sample_Periodic;
+                sampled_value.unitOfMeasure = UnitOfMeasure{CiString<20>("W"), 0, std::nullopt};
+                meter_value.sampledValue.push_back(sampled_value);
+            }
+        }
+        meter_values.push_back(meter_value);
+    }
+    req.meterValue = meter_values;
+    return Call<TransactionEventRequest>(req, MessageId("benchmark"));
+}
+
+Call<NotifyReportRequest> create_notify_report() {
+    NotifyReportRequest req;
+    req.requestId = 1;
+    req.generatedAt = ocpp::DateTime("2024-01-01T12:00:00.000Z");
+    req.seqNo = 0;
+    req.tbc = false;
+
+    std::vector<ReportData> report_data;
+    for (int i = 0; i < 200; i++) {
+        VariableAttribute attribute;
+        attribute.type = AttributeEnum::Actual;
+        attribute.value = CiString<2500>(std::to_string(i * 10));
+        attribute.mutability = MutabilityEnum::ReadWrite;
+        attribute.persistent = true;
+        attribute.constant = false;
+        VariableCharacteristics characteristics;
+        characteristics.dataType = DataEnum::integer;
+        characteristics.supportsMonitoring = true;
+        report_data.push_back(ReportData{{"SampledDataCtrlr", EVSE{1, std::nullopt, std::nullopt}, std::nullopt},
+                                         {"TxUpdatedInterval_" + std::to_string(i)},
+                                         {attribute},
+                                         characteristics,
+                                         std::nullopt});
+    }
+    req.reportData = report_data;
+    return Call<NotifyReportRequest>(req, MessageId("benchmark"));
+}
+
+struct result {
+    double ns_per_message;
+    double allocations_per_message;
+};
+
+template <class Function> result measure(int iterations, Function&& function) {
+    const auto start_allocations = allocations.load();
+    const auto start = clock_type::now();
+    for (int i = 0; i < iterations; i++) {
+        function();
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+    return {elapsed / iterations, static_cast<double>(allocations.load() - start_allocations) / iterations};
+}
+
+void print(const std::string& message, const std::string& path, std::size_t size, const result& r) {
+    printf("%-20s %-24s %9zu %14.0f %14.1f %10.1f\n", message.c_str(), path.c_str(), size, r.ns_per_message,
+           r.allocations_per_message, size * 1e3 / r.ns_per_message);
+}
+
+template <class T> void report(const std::string& name, const Call<T>& call, int iterations) {
+    std::size_t sink = 0;
+
+    std::string text;
+    const auto dump = measure(iterations, [&] {
+        text = json(call).dump();
+        sink += text.size();
+    });
+    print(name, "json(call).dump()", text.size(), dump);
+
+    std::string buffer;
+    const auto write = measure(iterations, [&] {
+        buffer.clear();
+        JsonWriter writer(buffer);
+        write_json(writer, call);
+        sink += buffer.size();
+    });
+    print(name, "write_json", buffer.size(), write);
+
+    const auto parse = measure(iterations, [&] {
+        const auto parsed = json::parse(text).get<Call<T>>();
+        sink += parsed.uniqueId.get().size();
+    });
+    print(name, "json::parse + from_json", text.size(), parse);
+
+    const auto read = measure(iterations, [&] {
+        JsonReader reader(text);
+        Call<T> parsed;
+        read_json(reader, parsed);
+        sink += parsed.uniqueId.get().size();
+    });
+    print(name, "read_json", text.size(), read);
+
+    if (sink == 0) {
+        printf("nothing serialized\n");
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int iterations = (argc > 1) ? std::atoi(argv[1]) : 2000;
+
+    printf("%-20s %-24s %9s %14s %14s %10s\n", "message", "path", "bytes", "ns/message", "allocs/message", "MB/s");
+    report("TransactionEvent", create_transaction_event(), iterations);
+    report("NotifyReport", create_notify_report(), iterations);
+
+    return EXIT_SUCCESS;
+}
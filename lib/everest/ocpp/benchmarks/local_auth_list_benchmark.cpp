@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+// Import of a full local authorization list entry by entry compared to the transactional bulk import.
+//
+// usage: libocpp_local_auth_list_benchmark [entries]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <everest/database/sqlite/connection.hpp>
+#include <ocpp/v2/database_handler.hpp>
+
+using namespace ocpp;
+using namespace ocpp::v2;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+std::vector<AuthorizationData> create_local_authorization_list(int entries) {
+    std::vector<AuthorizationData> local_authorization_list;
+    local_authorization_list.reserve(entries);
+    for (int i = 0; i < entries; i++) {
+        IdTokenInfo id_token_info;
+        id_token_info.status = AuthorizationStatusEnum::Accepted;
+        id_token_info.cacheExpiryDateTime = ocpp::DateTime("2030-01-01T00:00:00.000Z");
+        id_token_info.groupIdToken = IdToken{"GROUP", "ISO14443"};
+        local_authorization_list.push_back(
+            AuthorizationData{IdToken{"TOKEN" + std::to_string(i), "ISO14443"}, id_token_info});
+    }
+    return local_authorization_list;
+}
+
+// every run starts with an empty database file, so all paths pay for creating the database pages
+template <class Function> double measure(const std::filesystem::path& database_file, Function&& function) {
+    std::filesystem::remove(database_file);
+    DatabaseHandler database_handler{std::make_unique<everest::db::sqlite::Connection>(database_file),
+                                     std::filesystem::path(MIGRATION_FILES_SOURCE_DIR_V2)};
+    database_handler.open_connection();
+
+    const auto start = clock_type::now();
+    function(database_handler);
+    const auto elapsed = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+
+    if (database_handler.get_local_authorization_list_number_of_entries() == 0) {
+        printf("nothing imported\n");
+    }
+    return elapsed;
+}
+
+void print(const std::string& path, int entries, double ms) {
+    printf("%-40s %9d %12.1f %14.0f\n", path.c_str(), entries, ms, entries * 1e3 / ms);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int entries = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    const auto database_file = std::filesystem::temp_directory_path() / "libocpp_local_auth_list_benchmark.db";
+    const auto local_authorization_list = create_local_authorization_list(entries);
+
+    printf("%-40s %9s %12s %14s\n", "path", "entries", "ms", "entries/s");
+
+    print("insert_or_update_..._entry per entry", entries, measure(database_file, [&](DatabaseHandler& handler) {
+              for (const auto& entry : local_authorization_list) {
+                  handler.insert_or_update_local_authorization_list_entry(entry.idToken, entry.idTokenInfo.value());
+              }
+          }));
+
+    print("insert_or_update_local_authorization_list", entries,
+          measure(database_file, [&](DatabaseHandler& handler) {
+              handler.insert_or_update_local_authorization_list(local_authorization_list);
+          }));
+
+    print("replace_local_authorization_list", entries, measure(database_file, [&](DatabaseHandler& handler) {
+              handler.replace_local_authorization_list(local_authorization_list);
+          }));
+
+    std::filesystem::remove(database_file);
+    return EXIT_SUCCESS;
+}
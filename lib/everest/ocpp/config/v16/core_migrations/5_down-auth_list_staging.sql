@@ -0,0 +1 @@
+DROP TABLE AUTH_LIST_STAGING;
@@ -0,0 +1,7 @@
+-- Full updates of the local authorization list are written to this table and swapped with AUTH_LIST afterwards
+CREATE TABLE AUTH_LIST_STAGING (
+    ID_TAG TEXT PRIMARY KEY NOT NULL,
+    AUTH_STATUS TEXT NOT NULL,
+    EXPIRY_DATE TEXT,
+    PARENT_ID_TAG TEXT
+);
@@ -0,0 +1,5 @@
+-- Full updates of the local authorization list are written to this table and swapped with AUTH_LIST afterwards
+CREATE TABLE AUTH_LIST_STAGING (
+    ID_TOKEN_HASH TEXT PRIMARY KEY NOT NULL,
+    ID_TOKEN_INFO TEXT NOT NULL
+);
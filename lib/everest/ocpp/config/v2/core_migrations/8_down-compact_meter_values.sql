@@ -0,0 +1,31 @@
+DROP INDEX TRANSACTION_METER_VALUES_TRANSACTION_ID;
+DROP TABLE TRANSACTION_METER_VALUES;
+
+-- The legacy tables still exist if the DatabaseHandler did not convert them yet
+CREATE TABLE IF NOT EXISTS LEGACY_METER_VALUES (
+    ROWID INTEGER PRIMARY KEY,
+    TRANSACTION_ID TEXT NOT NULL,
+    TIMESTAMP INT64 NOT NULL,
+    READING_CONTEXT INTEGER REFERENCES READING_CONTEXT_ENUM (ID),
+    CUSTOM_DATA TEXT,
+    UNIQUE(TRANSACTION_ID, TIMESTAMP, READING_CONTEXT)
+);
+
+CREATE TABLE IF NOT EXISTS LEGACY_METER_VALUE_ITEMS (
+    METER_VALUE_ID INTEGER REFERENCES LEGACY_METER_VALUES (ROWID),
+    VALUE REAL NOT NULL,
+    MEASURAND INTEGER REFERENCES MEASURAND_ENUM (ID),
+    PHASE INTEGER REFERENCES PHASE_ENUM (ID),
+    LOCATION INTEGER REFERENCES LOCATION_ENUM (ID),
+    CUSTOM_DATA TEXT,
+    UNIT_CUSTOM_DATA TEXT,
+    UNIT_TEXT TEXT,
+    UNIT_MULTIPLIER INT,
+    SIGNED_METER_DATA TEXT,
+    SIGNING_METHOD TEXT,
+    ENCODING_METHOD TEXT,
+    PUBLIC_KEY TEXT
+);
+
+ALTER TABLE LEGACY_METER_VALUES RENAME TO METER_VALUES;
+ALTER TABLE LEGACY_METER_VALUE_ITEMS RENAME TO METER_VALUE_ITEMS;
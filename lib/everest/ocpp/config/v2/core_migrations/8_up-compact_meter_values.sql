@@ -0,0 +1,13 @@
+-- Meter values of a transaction are stored as one compact record per MeterValue, see MeterValueCodec.
+-- The previous tables are kept as LEGACY_* so the DatabaseHandler can convert the meter values of transactions that
+-- are still ongoing. It drops the legacy tables once they are converted.
+ALTER TABLE METER_VALUES RENAME TO LEGACY_METER_VALUES;
+ALTER TABLE METER_VALUE_ITEMS RENAME TO LEGACY_METER_VALUE_ITEMS;
+
+CREATE TABLE TRANSACTION_METER_VALUES (
+    ID INTEGER PRIMARY KEY,
+    TRANSACTION_ID TEXT NOT NULL,
+    DATA BLOB NOT NULL
+);
+
+CREATE INDEX TRANSACTION_METER_VALUES_TRANSACTION_ID ON TRANSACTION_METER_VALUES (TRANSACTION_ID);
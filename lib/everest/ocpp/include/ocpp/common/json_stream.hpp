@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_STREAM_HPP
+#define OCPP_COMMON_JSON_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <everest/util/json/json_stream.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/cistring.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+using json = nlohmann::json;
+
+// The writer, the reader and the overloads for the standard types are shared with other libraries. The overloads are
+// found by argument dependent lookup on the JsonWriter and JsonReader as well.
+using everest::lib::util::JsonReader;
+using everest::lib::util::JsonStreamException;
+using everest::lib::util::JsonWriter;
+using everest::lib::util::read_json;
+using everest::lib::util::write_json;
+
+inline void write_json(JsonWriter& writer, const DateTime& value) {
+    writer.value(value.to_rfc3339());
+}
+
+template <size_t L> void write_json(JsonWriter& writer, const CiString<L>& value) {
+    writer.value(value.get());
+}
+
+inline void read_json(JsonReader& reader, DateTime& value) {
+    value = DateTime(reader.read_string());
+}
+
+template <size_t L> void read_json(JsonReader& reader, CiString<L>& value) {
+    value.set(reader.read_string());
+}
+
+/// \brief Writes the OCPP-J CALL \p call, equivalent to json(call).dump()
+template <class T> void write_json(JsonWriter& writer, const Call<T>& call) {
+    writer.begin_array();
+    writer.value(static_cast<std::int32_t>(MessageTypeId::CALL));
+    writer.value(call.uniqueId.get());
+    writer.value(call.msg.get_type());
+    write_json(writer, call.msg);
+    writer.end_array();
+}
+
+/// \brief Writes the OCPP-J CALLRESULT \p call_result, equivalent to json(call_result).dump()
+template <class T> void write_json(JsonWriter& writer, const CallResult<T>& call_result) {
+    writer.begin_array();
+    writer.value(static_cast<std::int32_t>(MessageTypeId::CALLRESULT));
+    writer.value(call_result.uniqueId.get());
+    write_json(writer, call_result.msg);
+    writer.end_array();
+}
+
+/// \brief Reads an OCPP-J CALL into \p call, the action is not checked
+template <class T> void read_json(JsonReader& reader, Call<T>& call) {
+    reader.begin_array();
+    if (!reader.next_element() or reader.read_int32() != static_cast<std::int32_t>(MessageTypeId::CALL)) {
+        throw JsonStreamException("OCPP-J message is no CALL");
+    }
+    if (!reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALL has no message id");
+    }
+    call.uniqueId.set(reader.read_string());
+    if (!reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALL has no action");
+    }
+    reader.skip_value();
+    if (!reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALL has no payload");
+    }
+    read_json(reader, call.msg);
+    if (reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALL has too many elements");
+    }
+}
+
+/// \brief Reads an OCPP-J CALLRESULT into \p call_result
+template <class T> void read_json(JsonReader& reader, CallResult<T>& call_result) {
+    reader.begin_array();
+    if (!reader.next_element() or reader.read_int32() != static_cast<std::int32_t>(MessageTypeId::CALLRESULT)) {
+        throw JsonStreamException("OCPP-J message is no CALLRESULT");
+    }
+    if (!reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALLRESULT has no message id");
+    }
+    call_result.uniqueId.set(reader.read_string());
+    if (!reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALLRESULT has no payload");
+    }
+    read_json(reader, call_result.msg);
+    if (reader.next_element()) {
+        throw JsonStreamException("OCPP-J CALLRESULT has too many elements");
+    }
+}
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_STREAM_HPP
@@ -20,6 +20,15 @@ public:
     /// \param triggered indicates if the call was triggered by a TriggerMessage. Default is false.
     virtual void dispatch_call(const json& call, bool triggered = false) = 0;
 
+    /// \brief Dispatches a Call message that the caller already serialized, so it does not have to be serialized again.
+    /// The default implementation ignores the serialization.
+    /// \param call the OCPP Call message.
+    /// \param serialized_call \p call serialized as it shall be sent.
+    /// \param triggered indicates if the call was triggered by a TriggerMessage. Default is false.
+    virtual void dispatch_serialized_call(const json& call, std::string serialized_call, bool triggered = false) {
+        this->dispatch_call(call, triggered);
+    }
+
     /// \brief Dispatches a Call message asynchronously.
     /// \param call the OCPP Call message.
     /// \param triggered indicates if the call was triggered by a TriggerMessage. Default is false.
@@ -17,6 +17,7 @@
 
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/message_validator.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/messages/StopTransaction.hpp>
 #include <ocpp/v16/types.hpp>
@@ -42,6 +43,9 @@ template <typename M> struct MessageQueueConfig {
         60; // interval for BootNotification.req in case response by CSMS is CALLERROR or CSMS does not respond at all
             // (within specified MessageTimeout)
 
+    // validates incoming and outgoing payloads against the OCPP message schemas if set
+    std::shared_ptr<MessageValidator> message_validator;
+
     /// \brief Returns true if the given \p message_type shall be queued based on the configuration of
     /// queue_all_messages and message_types_discard_for_queueing
     bool check_queue(const M& message_type) {
@@ -58,6 +62,7 @@ template <typename M> struct EnhancedMessage {
     MessageTypeId messageTypeId = MessageTypeId::UNKNOWN; ///< The OCPP message type ID (CALL/CALLRESULT/CALLERROR)
     json call_message;    ///< If the message is a CALLRESULT or CALLERROR this can contain the original CALL message
     bool offline = false; ///< A flag indicating if the connection to the central system is offline
+    std::optional<std::string> validation_error; ///< Set if the payload does not match its OCPP message schema
 };
 
 /// \brief This contains an internal control message
@@ -69,6 +74,7 @@ template <typename M> struct ControlMessage {
     DateTime timestamp;                       ///< A timestamp that shows when this message can be sent
     MessageId initial_unique_id;
     bool stall_until_accepted; // if true, message shall be sent only if registration status is accepted
+    std::string serialized_message; ///< The message as sent if it was serialized before it was queued, else empty
 
     /// \brief Creates a new ControlMessage object from the provided \p message
     explicit ControlMessage(const json& message, const bool stall_until_accepted = false);
@@ -178,6 +184,8 @@ private:
     std::recursive_mutex message_mutex;
     std::condition_variable_any cv;
     std::function<bool(json message)> send_callback;
+    // sends messages that were already serialized when they were pushed
+    std::function<bool(const std::string& message)> send_serialized_callback;
     std::vector<M> external_notify;
     bool paused;
     // Transiently true while the queue is paused, but is waiting to unpause
@@ -187,6 +195,8 @@ private:
     bool is_registration_status_accepted;
     std::recursive_mutex next_message_mutex;
     std::optional<MessageId> next_message_to_send;
+    // action of the CALL that next_message_to_send responds to
+    std::string next_message_action;
 
     Everest::SteadyTimer in_flight_timeout_timer;
     Everest::SteadyTimer notify_queue_timer;
@@ -212,6 +222,17 @@ private:
     std::function<void(const std::string& new_message_id, const std::string& old_message_id)>
         start_transaction_message_retry_callback;
 
+    void validate_outgoing_call(const json& call) {
+        if (this->config.message_validator == nullptr) {
+            return;
+        }
+        const auto& action = call.at(CALL_ACTION).template get_ref<const std::string&>();
+        const auto error = this->config.message_validator->validate_request(action, call.at(CALL_PAYLOAD));
+        if (error.has_value()) {
+            EVLOG_warning << "Outgoing " << action << " does not match its schema: " << error.value();
+        }
+    }
+
     MessageId getMessageId(const json::array_t& json_message) {
         if (json_message.size() < 2) {
             throw MalformedRpcMessage("Message has too few elements, could not get message id.");
@@ -313,6 +334,7 @@ private:
                 // Generate a new message ID for the retry
                 const auto old_message_id = this->in_flight->message[MESSAGE_ID];
                 this->in_flight->message[MESSAGE_ID] = ocpp::create_message_id();
+                this->in_flight->serialized_message.clear();
                 if (this->config.transaction_message_retry_interval > 0) {
                     // exponential backoff
                     this->in_flight->timestamp =
@@ -370,6 +392,7 @@ private:
             EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
             // Generate a new message ID for the retry
             this->in_flight->message[MESSAGE_ID] = ocpp::create_message_id();
+            this->in_flight->serialized_message.clear();
             // Spec does not define how to handle retries for BootNotification.req: We use the
             // the boot_notification_retry_interval_seconds
             this->in_flight->timestamp =
@@ -641,6 +664,7 @@ public:
                     this->in_flight->message.at(3)["transactionId"] =
                         this->message_id_transaction_id_map.at(this->in_flight->message.at(1));
                     this->message_id_transaction_id_map.erase(this->in_flight->message.at(1));
+                    this->in_flight->serialized_message.clear();
                 }
 
                 // we drop the message from the in-memory queue in any case
@@ -658,7 +682,11 @@ public:
                     break;
                 }
 
-                if (!this->send_callback(this->in_flight->message)) {
+                const auto sent = (!this->in_flight->serialized_message.empty() and
+                                   this->send_serialized_callback != nullptr)
+                                      ? this->send_serialized_callback(this->in_flight->serialized_message)
+                                      : this->send_callback(this->in_flight->message);
+                if (!sent) {
                     EVLOG_error
                         << "Could not send message, this can occur due to a connection error or a very large message";
                     this->handle_timeout_or_callerror(std::nullopt);
@@ -738,11 +766,21 @@ public:
     }
 
     void push_call(const json& message, const bool stall_until_accepted = false) {
+        this->push_serialized_call(message, {}, stall_until_accepted);
+    }
+
+    /// \brief Pushes a new call \p message onto the message queue that was already serialized to \p serialized_message
+    /// by the caller. The serialization is sent instead of dumping \p message again, unless the queue has to modify
+    /// the message or no send_serialized_callback is set
+    void push_serialized_call(const json& message, std::string serialized_message,
+                              const bool stall_until_accepted = false) {
         if (!running) {
             return;
         }
 
+        this->validate_outgoing_call(message);
         auto control_message = std::make_shared<ControlMessage<M>>(message, stall_until_accepted);
+        control_message->serialized_message = std::move(serialized_message);
         if (is_transaction_message(*control_message)) {
             // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
             // MeterValues have to be delivered in chronological order
@@ -772,6 +810,14 @@ public:
             if (next_message_to_send.has_value()) {
                 if (next_message_to_send.value() == static_cast<MessageId>(call_result.at(MESSAGE_ID))) {
                     next_message_to_send.reset();
+                    if (this->config.message_validator != nullptr) {
+                        const auto error = this->config.message_validator->validate_response(
+                            next_message_action, call_result.at(CALLRESULT_PAYLOAD));
+                        if (error.has_value()) {
+                            EVLOG_warning << "Outgoing " << next_message_action
+                                          << "Response does not match its schema: " << error.value();
+                        }
+                    }
                 }
             }
         }
@@ -801,6 +847,7 @@ public:
     /// \brief pushes a new \p call message onto the message queue
     /// \returns a future from which the CallResult can be extracted
     std::future<EnhancedMessage<M>> push_call_async(const json& call) {
+        this->validate_outgoing_call(call);
         auto message = std::make_shared<ControlMessage<M>>(call);
 
         if (!running) {
@@ -838,14 +885,20 @@ public:
         enhanced_message.messageTypeId = this->getMessageTypeId(enhanced_message.message);
 
         if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
-            enhanced_message.messageType = this->string_to_messagetype(enhanced_message.message.at(CALL_ACTION));
+            const auto& action = enhanced_message.message.at(CALL_ACTION).template get_ref<const std::string&>();
+            enhanced_message.messageType = this->string_to_messagetype(action);
             enhanced_message.call_message = enhanced_message.message;
+            if (this->config.message_validator != nullptr) {
+                enhanced_message.validation_error =
+                    this->config.message_validator->validate_request(action, enhanced_message.message.at(CALL_PAYLOAD));
+            }
 
             {
                 const std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
                 // save the uid of the message we just received to ensure the next message we send is a response to
                 // this message
                 next_message_to_send.emplace(enhanced_message.uniqueId);
+                next_message_action = action;
             }
         }
 
@@ -895,6 +948,15 @@ public:
 
         if (this->in_flight->uniqueId() == enhanced_message.uniqueId) {
             enhanced_message.call_message = this->in_flight->message;
+            if (this->config.message_validator != nullptr) {
+                const auto& action = this->in_flight->message.at(CALL_ACTION).template get_ref<const std::string&>();
+                enhanced_message.validation_error = this->config.message_validator->validate_response(
+                    action, enhanced_message.message.at(CALLRESULT_PAYLOAD));
+                if (enhanced_message.validation_error.has_value()) {
+                    EVLOG_warning << "Received " << action << "Response does not match its schema: "
+                                  << enhanced_message.validation_error.value();
+                }
+            }
             enhanced_message.messageType = this->string_to_messagetype(
                 this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
             this->in_flight->promise.set_value(enhanced_message);
@@ -973,6 +1035,12 @@ public:
         }
     }
 
+    /// \brief Sets the callback that sends messages pushed with push_serialized_call. Without it they are sent as json
+    /// through the send_callback
+    void set_send_serialized_callback(const std::function<bool(const std::string& message)>& callback) {
+        this->send_serialized_callback = callback;
+    }
+
     void set_registration_status_accepted() {
         {
             const std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
@@ -1061,6 +1129,7 @@ public:
                     if (meter_value_message_id == static_cast<std::string>((*it)->message.at(1))) {
                         EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
                         (*it)->message.at(3)["transactionId"] = transaction_id;
+                        (*it)->serialized_message.clear();
                     }
                 }
             }
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_MESSAGE_VALIDATOR_HPP
+#define OCPP_COMMON_MESSAGE_VALIDATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <nlohmann/json-schema.hpp>
+#include <nlohmann/json_fwd.hpp>
+#include <ocpp/common/support_older_cpp_versions.hpp>
+
+namespace ocpp {
+
+using json = nlohmann::json;
+
+/// \brief Number and duration of the validations against one message schema
+struct MessageValidationStatistics {
+    std::uint64_t validations = 0;          ///< number of validated payloads
+    std::uint64_t failures = 0;             ///< number of payloads that did not match the schema
+    std::chrono::nanoseconds total_time{0}; ///< accumulated validation time
+    std::chrono::nanoseconds max_time{0};   ///< longest single validation
+};
+
+/// \brief Validates OCPP-J payloads against the JSON schemas of the OCPP specification
+///
+/// All schemas of a directory are parsed and compiled into one validator per message when the object is created, so
+/// a validation only walks the payload. Request schemas are named "<Action>Request.json" (OCPP 2.x) or
+/// "<Action>.json" (OCPP 1.6), response schemas "<Action>Response.json". Payloads of actions without a schema are
+/// considered valid.
+class MessageValidator {
+public:
+    /// \brief Loads and compiles every schema in \p schemas_path
+    /// \throws std::runtime_error if \p schemas_path is no directory or one of the schemas is invalid
+    explicit MessageValidator(const fs::path& schemas_path);
+    ~MessageValidator();
+
+    /// \brief Provides the validator for \p schemas_path, which is shared by all callers that hold it at the same
+    /// time. The schemas are only compiled again once every caller released it.
+    static std::shared_ptr<MessageValidator> get_shared(const fs::path& schemas_path);
+
+    /// \brief Validates the \p payload of a CALL of \p action
+    /// \returns a description of the first violation, std::nullopt if the payload is valid
+    std::optional<std::string> validate_request(const std::string& action, const json& payload) const;
+
+    /// \brief Validates the \p payload of a CALLRESULT to a CALL of \p action
+    /// \returns a description of the first violation, std::nullopt if the payload is valid
+    std::optional<std::string> validate_response(const std::string& action, const json& payload) const;
+
+    /// \brief Provides the validation statistics, keyed by schema name e.g. "BootNotificationRequest"
+    std::map<std::string, MessageValidationStatistics> get_statistics() const;
+
+    /// \brief Provides the statistics of all schemas that were used, one line per schema, for logging
+    std::string get_statistics_summary() const;
+
+private:
+    struct CompiledSchema {
+        nlohmann::json_schema::json_validator validator;
+        mutable std::atomic<std::uint64_t> validations{0};
+        mutable std::atomic<std::uint64_t> failures{0};
+        mutable std::atomic<std::int64_t> total_ns{0};
+        mutable std::atomic<std::int64_t> max_ns{0};
+    };
+
+    std::optional<std::string> validate(const std::map<std::string, std::unique_ptr<CompiledSchema>>& schemas,
+                                        const std::string& action, const json& payload) const;
+
+    std::map<std::string, std::unique_ptr<CompiledSchema>> requests;
+    std::map<std::string, std::unique_ptr<CompiledSchema>> responses;
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_MESSAGE_VALIDATOR_HPP
@@ -3,10 +3,14 @@
 #ifndef OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 #define OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <thread>
 
 #include <ocpp/common/support_older_cpp_versions.hpp>
 #include <ocpp/v16/charge_point_configuration_base.hpp>
@@ -28,22 +32,60 @@ private:
 
     std::recursive_mutex configuration_mutex;
 
+    // typed copies of values that are read for every meter value, heartbeat, transaction or per connector, kept in
+    // sync with config by their setters
+    MeasurandWithPhaseList meter_values_aligned_data_vector;
+    MeasurandWithPhaseList meter_values_sampled_data_vector;
+    std::atomic<std::int32_t> clock_aligned_data_interval;
+    std::atomic<std::int32_t> meter_value_sample_interval;
+    std::atomic<std::int32_t> heartbeat_interval;
+    std::atomic<std::int32_t> number_of_connectors;
+    std::atomic<std::int32_t> transaction_message_attempts;
+    std::atomic<std::int32_t> transaction_message_retry_interval;
+    std::atomic_bool authorize_remote_tx_requests;
+    std::atomic_bool local_authorize_offline;
+    std::atomic_bool local_pre_authorize;
+    std::atomic_bool stop_transaction_on_invalid_id;
+
+    // in-memory copy of the user config file. Changes are collected for user_config_write_delay and then written
+    // to disk by user_config_writer in a single atomic write
+    json user_config;
+    std::mutex user_config_mutex;
+    std::condition_variable user_config_cv;
+    bool user_config_dirty{false};
+    bool user_config_writer_stopped{false};
+    std::chrono::milliseconds user_config_write_delay;
+    std::thread user_config_writer;
+
     bool validate_measurands(const json& config);
     json get_user_config();
     void setInUserConfig(const std::string& profile, const std::string& key, json value);
+    void markUserConfigDirty();
+    void runUserConfigWriter();
+    void writeUserConfig(const std::string& user_config_str);
 
     void setChargepointInformationProperty(json& user_config, const std::string& key,
                                            const std::optional<std::string>& value);
 
 public:
+    /// \brief Default time that changes of the user config are collected before they are written to disk
+    static constexpr std::chrono::milliseconds DEFAULT_USER_CONFIG_WRITE_DELAY{500};
+
+    /// \brief Creates the charge point configuration
+    /// \param config the configuration json including default values
+    /// \param ocpp_main_path path containing the profile_schemas directory
+    /// \param user_config_path path to the user config file that persists changed values
+    /// \param user_config_write_delay time that changes are collected before the user config file is rewritten.
+    /// All changes are written at the latest when the configuration is destroyed
     ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
-                             const fs::path& user_config_path);
+                             const fs::path& user_config_path,
+                             std::chrono::milliseconds user_config_write_delay = DEFAULT_USER_CONFIG_WRITE_DELAY);
     ChargePointConfiguration() = delete;
     ChargePointConfiguration(const ChargePointConfiguration&) = delete;
     ChargePointConfiguration(ChargePointConfiguration&&) = delete;
     ChargePointConfiguration& operator=(const ChargePointConfiguration&) = delete;
     ChargePointConfiguration& operator=(ChargePointConfiguration&&) = delete;
-    virtual ~ChargePointConfiguration() = default;
+    virtual ~ChargePointConfiguration();
 
     void setChargepointInformation(const std::string& chargePointVendor, const std::string& chargePointModel,
                                    const std::optional<std::string>& chargePointSerialNumber,
@@ -175,6 +217,9 @@ public:
     std::optional<std::string> getMessageTypesDiscardForQueueing() override;
     std::optional<KeyValue> getMessageTypesDiscardForQueueingKeyValue() override;
 
+    std::optional<std::string> getMessageSchemasPath() override;
+    std::optional<KeyValue> getMessageSchemasPathKeyValue() override;
+
     std::optional<int> getMessageQueueSizeThreshold() override;
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue() override;
 
@@ -174,6 +174,7 @@ public:
     std::optional<std::string> getHostName() override;
     std::optional<std::string> getIFace() override;
     std::optional<std::string> getMessageTypesDiscardForQueueing() override;
+    std::optional<std::string> getMessageSchemasPath() override;
     std::optional<std::string> getSeccLeafSubjectCommonName() override;
     std::optional<std::string> getSeccLeafSubjectCountry() override;
     std::optional<std::string> getSeccLeafSubjectOrganization() override;
@@ -232,6 +233,7 @@ public:
     std::optional<KeyValue> getIFaceKeyValue() override;
     std::optional<KeyValue> getIgnoredProfilePurposesOfflineKeyValue() override;
     std::optional<KeyValue> getMessageTypesDiscardForQueueingKeyValue() override;
+    std::optional<KeyValue> getMessageSchemasPathKeyValue() override;
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue() override;
     std::optional<KeyValue> getPublicKeyKeyValue(std::uint32_t connector_id) override;
     std::optional<KeyValue> getQueueAllMessagesKeyValue() override;
@@ -94,6 +94,7 @@ public:
     virtual std::optional<std::string> getHostName() = 0;
     virtual std::optional<std::string> getIFace() = 0;
     virtual std::optional<std::string> getMessageTypesDiscardForQueueing() = 0;
+    virtual std::optional<std::string> getMessageSchemasPath() = 0;
     virtual std::optional<std::string> getSeccLeafSubjectCommonName() = 0;
     virtual std::optional<std::string> getSeccLeafSubjectCountry() = 0;
     virtual std::optional<std::string> getSeccLeafSubjectOrganization() = 0;
@@ -152,6 +153,7 @@ public:
     virtual std::optional<KeyValue> getIFaceKeyValue() = 0;
     virtual std::optional<KeyValue> getIgnoredProfilePurposesOfflineKeyValue() = 0;
     virtual std::optional<KeyValue> getMessageTypesDiscardForQueueingKeyValue() = 0;
+    virtual std::optional<KeyValue> getMessageSchemasPathKeyValue() = 0;
     virtual std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue() = 0;
     virtual std::optional<KeyValue> getPublicKeyKeyValue(std::uint32_t connector_id) = 0;
     virtual std::optional<KeyValue> getQueueAllMessagesKeyValue() = 0;
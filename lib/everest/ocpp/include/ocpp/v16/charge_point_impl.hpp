@@ -109,6 +109,8 @@ private:
     std::unique_ptr<ocpp::MessageDispatcherInterface<MessageType>> message_dispatcher;
     Everest::SteadyTimer websocket_timer;
     std::unique_ptr<MessageQueue<v16::MessageType>> message_queue;
+    std::shared_ptr<MessageValidator> message_validator;
+    Everest::SteadyTimer message_validation_statistics_timer;
     std::map<std::int32_t, std::shared_ptr<Connector>> connectors;
     std::unique_ptr<SmartChargingHandler> smart_charging_handler;
     std::int32_t heartbeat_interval;
@@ -48,6 +48,11 @@ private:
     void init_sql() override;
     void init_connector_table();
 
+    // Applies all entries of the list to \p table using one prepared statement per operation, to be called within a
+    // transaction
+    void write_local_authorization_list(const std::string& table,
+                                        const std::vector<v16::LocalAuthorizationList>& local_authorization_list);
+
 public:
     DatabaseHandler(std::unique_ptr<everest::db::sqlite::ConnectionInterface> database,
                     const fs::path& sql_migration_files_path, std::int32_t number_of_connectors);
@@ -127,8 +132,13 @@ public:
     void insert_or_update_local_authorization_list_entry(const CiString<20>& id_tag, const v16::IdTagInfo& id_tag_info);
 
     /// \brief Inserts or updates a local authorization list entries \p local_authorization_list to the AUTH_LIST table.
+    /// Entries without IdTagInfo are deleted. Either all entries are applied or none.
     void insert_or_update_local_authorization_list(std::vector<v16::LocalAuthorizationList> local_authorization_list);
 
+    /// \brief Replaces all entries of the AUTH_LIST table with the entries of \p local_authorization_list that have an
+    /// IdTagInfo. Lookups see either the complete previous list or the complete new list.
+    void replace_local_authorization_list(const std::vector<v16::LocalAuthorizationList>& local_authorization_list);
+
     /// \brief Deletes the authorization list entry with the given \p id_tag
     void delete_local_authorization_list_entry(const std::string& id_tag);
 
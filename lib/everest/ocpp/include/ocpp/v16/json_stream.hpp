@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+// This code is generated using the generator in 'src/code_generator/common`, please do not edit manually
+
+#ifndef OCPP_V16_JSON_STREAM_HPP
+#define OCPP_V16_JSON_STREAM_HPP
+
+#include <ocpp/common/json_stream.hpp>
+#include <ocpp/v16/messages/MeterValues.hpp>
+#include <ocpp/v16/messages/StopTransaction.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+/// \brief Writes the given SampledValue \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SampledValue& k);
+
+/// \brief Reads a SampledValue from \p reader into \p k
+void read_json(JsonReader& reader, SampledValue& k);
+
+/// \brief Writes the given MeterValue \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValue& k);
+
+/// \brief Reads a MeterValue from \p reader into \p k
+void read_json(JsonReader& reader, MeterValue& k);
+
+/// \brief Writes the given MeterValuesRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
+/// \brief Reads a MeterValuesRequest from \p reader into \p k
+void read_json(JsonReader& reader, MeterValuesRequest& k);
+
+/// \brief Writes the given MeterValuesResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
+/// \brief Reads a MeterValuesResponse from \p reader into \p k
+void read_json(JsonReader& reader, MeterValuesResponse& k);
+
+/// \brief Writes the given TransactionData \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TransactionData& k);
+
+/// \brief Reads a TransactionData from \p reader into \p k
+void read_json(JsonReader& reader, TransactionData& k);
+
+/// \brief Writes the given StopTransactionRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionRequest& k);
+
+/// \brief Reads a StopTransactionRequest from \p reader into \p k
+void read_json(JsonReader& reader, StopTransactionRequest& k);
+
+/// \brief Writes the given IdTagInfo \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const IdTagInfo& k);
+
+/// \brief Reads a IdTagInfo from \p reader into \p k
+void read_json(JsonReader& reader, IdTagInfo& k);
+
+/// \brief Writes the given StopTransactionResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionResponse& k);
+
+/// \brief Reads a StopTransactionResponse from \p reader into \p k
+void read_json(JsonReader& reader, StopTransactionResponse& k);
+
+} // namespace v16
+} // namespace ocpp
+
+#endif // OCPP_V16_JSON_STREAM_HPP
@@ -103,6 +103,7 @@ namespace ocpp::v16::keys {
     mapping(SeccLeafSubjectOrganization, ISO15118CtrlrOrganizationName, Actual) \
     mapping(QueueAllMessages, QueueAllMessages, Actual) \
     mapping(MessageTypesDiscardForQueueing, MessageTypesDiscardForQueueing, Actual) \
+    mapping(MessageSchemasPath, MessageSchemasPath, Actual) \
     mapping(MessageQueueSizeThreshold, MessageQueueSizeThreshold, Actual) \
     mapping(MaxMessageSize, MaxMessageSize, Actual) \
     mapping(TLSKeylogFile, TLSKeylogFile, Actual) \
@@ -282,6 +283,7 @@ namespace ocpp::v16::keys {
     key(Internal, MaxCompositeScheduleDuration) \
     key(Internal, MaxMessageSize) \
     key(Internal, MessageQueueSizeThreshold) \
+    key(Internal, MessageSchemasPath) \
     key(Internal, MessageTypesDiscardForQueueing) \
     key(Internal, MeterPublicKeys) \
     key(Internal, MeterSerialNumber) \
@@ -7,7 +7,10 @@
 #include <memory>
 #include <set>
 
+#include <everest/timer.hpp>
+
 #include <ocpp/common/message_dispatcher.hpp>
+#include <ocpp/common/message_validator.hpp>
 
 #include <ocpp/common/charging_station_base.hpp>
 
@@ -383,6 +386,8 @@ private:
 
     // utility
     std::shared_ptr<MessageQueue<v2::MessageType>> message_queue;
+    std::shared_ptr<MessageValidator> message_validator;
+    Everest::SteadyTimer message_validation_statistics_timer;
     std::shared_ptr<DatabaseHandler> database_handler;
     fs::path share_path;
 
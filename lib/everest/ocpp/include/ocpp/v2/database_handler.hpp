@@ -5,11 +5,14 @@
 
 #include "ocpp/v2/types.hpp"
 #include "sqlite3.h"
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ocpp/common/support_older_cpp_versions.hpp>
 
 #include <everest/database/sqlite/connection.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/v2/meter_value_codec.hpp>
 #include <ocpp/v2/ocpp_types.hpp>
 #include <ocpp/v2/transaction.hpp>
 
@@ -104,9 +107,15 @@ public:
                                                                  const IdTokenInfo& id_token_info) = 0;
 
     /// \brief Inserts or updates a local authorization list entries \p local_authorization_list to the AUTH_LIST table.
+    /// Entries without IdTokenInfo are deleted. Either all entries are applied or none.
     virtual void
     insert_or_update_local_authorization_list(const std::vector<v2::AuthorizationData>& local_authorization_list) = 0;
 
+    /// \brief Replaces all entries of the AUTH_LIST table with the entries of \p local_authorization_list that have
+    /// an IdTokenInfo. Lookups see either the complete previous list or the complete new list.
+    virtual void
+    replace_local_authorization_list(const std::vector<v2::AuthorizationData>& local_authorization_list) = 0;
+
     /// \brief Deletes the authorization list entry with the given \p id_tag
     virtual void delete_local_authorization_list_entry(const IdToken& id_token) = 0;
 
@@ -218,6 +227,23 @@ private:
                              bool replace);
     OperationalStatusEnum get_availability(std::int32_t evse_id, std::int32_t connector_id);
 
+    // Local authorization list management (internal helpers)
+    // Applies all entries of the list to \p table using one prepared statement per operation, to be called within a
+    // transaction
+    void write_local_authorization_list(const std::string& table,
+                                        const std::vector<v2::AuthorizationData>& local_authorization_list);
+
+    // Transaction metervalues (internal helpers)
+    // Every MeterValue is stored as one record encoded by the MeterValueCodec of its transaction. Codecs are kept per
+    // transaction so appending does not need to read the previous records.
+    std::mutex meter_value_codecs_mutex;
+    std::map<std::string, MeterValueCodec> meter_value_codecs;
+    MeterValueCodec restore_meter_value_codec(const std::string& transaction_id);
+    void for_each_meter_value_record(const std::string& transaction_id,
+                                     const std::function<void(const std::vector<std::uint8_t>&)>& handle_record);
+    // Converts the meter values left in the legacy tables by the compact_meter_values migration and drops these tables
+    void convert_legacy_meter_values();
+
 public:
     DatabaseHandler(std::unique_ptr<everest::db::sqlite::ConnectionInterface> database,
                     const fs::path& sql_migration_files_path);
@@ -249,6 +275,7 @@ public:
                                                          const IdTokenInfo& id_token_info) override;
     void insert_or_update_local_authorization_list(
         const std::vector<v2::AuthorizationData>& local_authorization_list) override;
+    void replace_local_authorization_list(const std::vector<v2::AuthorizationData>& local_authorization_list) override;
     void delete_local_authorization_list_entry(const IdToken& id_token) override;
     std::optional<v2::IdTokenInfo> get_local_authorization_list_entry(const IdToken& id_token) override;
     void clear_local_authorization_list() override;
@@ -119,6 +119,12 @@ public:
         const std::optional<std::vector<ComponentVariable>>& component_variables = std::nullopt,
         const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria = std::nullopt) override;
 
+    void visit_base_report_data(const ReportBaseEnum& report_base, const ReportDataVisitor& visitor) override;
+
+    void visit_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
+                                  const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria,
+                                  const ReportDataVisitor& visitor) override;
+
     std::vector<SetMonitoringResult>
     set_monitors(const std::vector<SetMonitoringData>& requests,
                  const VariableMonitorType type = VariableMonitorType::CustomMonitor) override;
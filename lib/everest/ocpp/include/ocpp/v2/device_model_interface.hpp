@@ -4,6 +4,7 @@
 #ifndef DEVICE_MODEL_INTERFACE_HPP
 #define DEVICE_MODEL_INTERFACE_HPP
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
@@ -38,6 +39,9 @@ struct VariableMetaData {
 using VariableMap = std::map<Variable, VariableMetaData>;
 using DeviceModelMap = std::map<Component, VariableMap>;
 
+/// \brief Called for every ReportData of a report, returning false stops the iteration
+using ReportDataVisitor = std::function<bool(const ReportData& report_data)>;
+
 class DeviceModelError : public std::exception {
 public:
     [[nodiscard]] const char* what() const noexcept override {
@@ -131,6 +135,33 @@ public:
         const std::optional<std::vector<ComponentVariable>>& component_variables = std::nullopt,
         const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria = std::nullopt) = 0;
 
+    /// \brief Passes the ReportData for the specified report base to \p visitor one at a time, so that the report
+    /// does not have to be held in memory as a whole. The default implementation is based on get_base_report_data
+    /// \param report_base The report base filter
+    /// \param visitor Called for each ReportData
+    virtual void visit_base_report_data(const ReportBaseEnum& report_base, const ReportDataVisitor& visitor) {
+        for (const auto& report_data : this->get_base_report_data(report_base)) {
+            if (!visitor(report_data)) {
+                return;
+            }
+        }
+    }
+
+    /// \brief Passes the ReportData for the specified filters to \p visitor one at a time, so that the report does
+    /// not have to be held in memory as a whole. The default implementation is based on get_custom_report_data
+    /// \param component_variables Optional component variables filter
+    /// \param component_criteria Optional component criteria filter
+    /// \param visitor Called for each ReportData
+    virtual void visit_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
+                                          const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria,
+                                          const ReportDataVisitor& visitor) {
+        for (const auto& report_data : this->get_custom_report_data(component_variables, component_criteria)) {
+            if (!visitor(report_data)) {
+                return;
+            }
+        }
+    }
+
     // ============================================================================
     // Monitoring operations
     // ============================================================================
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ocpp/v2/device_model_interface.hpp>
 #include <ocpp/v2/message_handler.hpp>
 
 namespace ocpp::v2 {
@@ -110,7 +111,10 @@ private:
     // Functions
     /* OCPP message requests */
 
-    void notify_report_req(const int request_id, const std::vector<ReportData>& report_data);
+    /// \brief Sends the report \p request_id as one or more NotifyReport.req, streaming the ReportData produced by
+    /// \p visit_report_data into calls of at most MaxMessageSize bytes and ItemsPerMessageGetReport ReportData
+    void notify_report_req(const int request_id,
+                           const std::function<void(const ReportDataVisitor& visitor)>& visit_report_data);
 
     /* OCPP message handlers */
 
@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+// This code is generated using the generator in 'src/code_generator/common`, please do not edit manually
+
+#ifndef OCPP_V2_JSON_STREAM_HPP
+#define OCPP_V2_JSON_STREAM_HPP
+
+#include <ocpp/common/json_stream.hpp>
+#include <ocpp/v2/messages/GetVariables.hpp>
+#include <ocpp/v2/messages/MeterValues.hpp>
+#include <ocpp/v2/messages/NotifyReport.hpp>
+#include <ocpp/v2/messages/SetVariables.hpp>
+#include <ocpp/v2/messages/TransactionEvent.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+/// \brief Writes the given EVSE \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const EVSE& k);
+
+/// \brief Reads a EVSE from \p reader into \p k
+void read_json(JsonReader& reader, EVSE& k);
+
+/// \brief Writes the given Component \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const Component& k);
+
+/// \brief Reads a Component from \p reader into \p k
+void read_json(JsonReader& reader, Component& k);
+
+/// \brief Writes the given Variable \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const Variable& k);
+
+/// \brief Reads a Variable from \p reader into \p k
+void read_json(JsonReader& reader, Variable& k);
+
+/// \brief Writes the given GetVariableData \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableData& k);
+
+/// \brief Reads a GetVariableData from \p reader into \p k
+void read_json(JsonReader& reader, GetVariableData& k);
+
+/// \brief Writes the given GetVariablesRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesRequest& k);
+
+/// \brief Reads a GetVariablesRequest from \p reader into \p k
+void read_json(JsonReader& reader, GetVariablesRequest& k);
+
+/// \brief Writes the given StatusInfo \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const StatusInfo& k);
+
+/// \brief Reads a StatusInfo from \p reader into \p k
+void read_json(JsonReader& reader, StatusInfo& k);
+
+/// \brief Writes the given GetVariableResult \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableResult& k);
+
+/// \brief Reads a GetVariableResult from \p reader into \p k
+void read_json(JsonReader& reader, GetVariableResult& k);
+
+/// \brief Writes the given GetVariablesResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesResponse& k);
+
+/// \brief Reads a GetVariablesResponse from \p reader into \p k
+void read_json(JsonReader& reader, GetVariablesResponse& k);
+
+/// \brief Writes the given SignedMeterValue \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SignedMeterValue& k);
+
+/// \brief Reads a SignedMeterValue from \p reader into \p k
+void read_json(JsonReader& reader, SignedMeterValue& k);
+
+/// \brief Writes the given UnitOfMeasure \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const UnitOfMeasure& k);
+
+/// \brief Reads a UnitOfMeasure from \p reader into \p k
+void read_json(JsonReader& reader, UnitOfMeasure& k);
+
+/// \brief Writes the given SampledValue \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SampledValue& k);
+
+/// \brief Reads a SampledValue from \p reader into \p k
+void read_json(JsonReader& reader, SampledValue& k);
+
+/// \brief Writes the given MeterValue \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValue& k);
+
+/// \brief Reads a MeterValue from \p reader into \p k
+void read_json(JsonReader& reader, MeterValue& k);
+
+/// \brief Writes the given MeterValuesRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
+/// \brief Reads a MeterValuesRequest from \p reader into \p k
+void read_json(JsonReader& reader, MeterValuesRequest& k);
+
+/// \brief Writes the given MeterValuesResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
+/// \brief Reads a MeterValuesResponse from \p reader into \p k
+void read_json(JsonReader& reader, MeterValuesResponse& k);
+
+/// \brief Writes the given VariableAttribute \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const VariableAttribute& k);
+
+/// \brief Reads a VariableAttribute from \p reader into \p k
+void read_json(JsonReader& reader, VariableAttribute& k);
+
+/// \brief Writes the given VariableCharacteristics \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const VariableCharacteristics& k);
+
+/// \brief Reads a VariableCharacteristics from \p reader into \p k
+void read_json(JsonReader& reader, VariableCharacteristics& k);
+
+/// \brief Writes the given ReportData \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const ReportData& k);
+
+/// \brief Reads a ReportData from \p reader into \p k
+void read_json(JsonReader& reader, ReportData& k);
+
+/// \brief Writes the given NotifyReportRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportRequest& k);
+
+/// \brief Reads a NotifyReportRequest from \p reader into \p k
+void read_json(JsonReader& reader, NotifyReportRequest& k);
+
+/// \brief Writes the given NotifyReportResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportResponse& k);
+
+/// \brief Reads a NotifyReportResponse from \p reader into \p k
+void read_json(JsonReader& reader, NotifyReportResponse& k);
+
+/// \brief Writes the given SetVariableData \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableData& k);
+
+/// \brief Reads a SetVariableData from \p reader into \p k
+void read_json(JsonReader& reader, SetVariableData& k);
+
+/// \brief Writes the given SetVariablesRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesRequest& k);
+
+/// \brief Reads a SetVariablesRequest from \p reader into \p k
+void read_json(JsonReader& reader, SetVariablesRequest& k);
+
+/// \brief Writes the given SetVariableResult \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableResult& k);
+
+/// \brief Reads a SetVariableResult from \p reader into \p k
+void read_json(JsonReader& reader, SetVariableResult& k);
+
+/// \brief Writes the given SetVariablesResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesResponse& k);
+
+/// \brief Reads a SetVariablesResponse from \p reader into \p k
+void read_json(JsonReader& reader, SetVariablesResponse& k);
+
+/// \brief Writes the given TransactionLimit \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TransactionLimit& k);
+
+/// \brief Reads a TransactionLimit from \p reader into \p k
+void read_json(JsonReader& reader, TransactionLimit& k);
+
+/// \brief Writes the given Transaction \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const Transaction& k);
+
+/// \brief Reads a Transaction from \p reader into \p k
+void read_json(JsonReader& reader, Transaction& k);
+
+/// \brief Writes the given TotalPrice \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TotalPrice& k);
+
+/// \brief Reads a TotalPrice from \p reader into \p k
+void read_json(JsonReader& reader, TotalPrice& k);
+
+/// \brief Writes the given TaxRate \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TaxRate& k);
+
+/// \brief Reads a TaxRate from \p reader into \p k
+void read_json(JsonReader& reader, TaxRate& k);
+
+/// \brief Writes the given Price \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const Price& k);
+
+/// \brief Reads a Price from \p reader into \p k
+void read_json(JsonReader& reader, Price& k);
+
+/// \brief Writes the given TotalCost \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TotalCost& k);
+
+/// \brief Reads a TotalCost from \p reader into \p k
+void read_json(JsonReader& reader, TotalCost& k);
+
+/// \brief Writes the given TotalUsage \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TotalUsage& k);
+
+/// \brief Reads a TotalUsage from \p reader into \p k
+void read_json(JsonReader& reader, TotalUsage& k);
+
+/// \brief Writes the given CostDimension \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const CostDimension& k);
+
+/// \brief Reads a CostDimension from \p reader into \p k
+void read_json(JsonReader& reader, CostDimension& k);
+
+/// \brief Writes the given ChargingPeriod \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const ChargingPeriod& k);
+
+/// \brief Reads a ChargingPeriod from \p reader into \p k
+void read_json(JsonReader& reader, ChargingPeriod& k);
+
+/// \brief Writes the given CostDetails \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const CostDetails& k);
+
+/// \brief Reads a CostDetails from \p reader into \p k
+void read_json(JsonReader& reader, CostDetails& k);
+
+/// \brief Writes the given AdditionalInfo \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const AdditionalInfo& k);
+
+/// \brief Reads a AdditionalInfo from \p reader into \p k
+void read_json(JsonReader& reader, AdditionalInfo& k);
+
+/// \brief Writes the given IdToken \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const IdToken& k);
+
+/// \brief Reads a IdToken from \p reader into \p k
+void read_json(JsonReader& reader, IdToken& k);
+
+/// \brief Writes the given TransactionEventRequest \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventRequest& k);
+
+/// \brief Reads a TransactionEventRequest from \p reader into \p k
+void read_json(JsonReader& reader, TransactionEventRequest& k);
+
+/// \brief Writes the given MessageContent \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const MessageContent& k);
+
+/// \brief Reads a MessageContent from \p reader into \p k
+void read_json(JsonReader& reader, MessageContent& k);
+
+/// \brief Writes the given IdTokenInfo \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const IdTokenInfo& k);
+
+/// \brief Reads a IdTokenInfo from \p reader into \p k
+void read_json(JsonReader& reader, IdTokenInfo& k);
+
+/// \brief Writes the given TransactionEventResponse \p k to \p writer, equivalent to json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventResponse& k);
+
+/// \brief Reads a TransactionEventResponse from \p reader into \p k
+void read_json(JsonReader& reader, TransactionEventResponse& k);
+
+} // namespace v2
+} // namespace ocpp
+
+#endif // OCPP_V2_JSON_STREAM_HPP
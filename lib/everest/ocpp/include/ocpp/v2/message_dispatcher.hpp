@@ -17,6 +17,7 @@ public:
                       std::atomic<RegistrationStatusEnum>& registration_status) :
         message_queue(message_queue), device_model(device_model), registration_status(registration_status){};
     void dispatch_call(const json& call, bool triggered = false) override;
+    void dispatch_serialized_call(const json& call, std::string serialized_call, bool triggered = false) override;
     std::future<ocpp::EnhancedMessage<MessageType>> dispatch_call_async(const json& call, bool triggered) override;
     void dispatch_call_result(const json& call_result) override;
     void dispatch_call_error(const json& call_error) override;
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ocpp/v2/ocpp_types.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+/// \brief Compact binary encoding of the meter values of a transaction
+///
+/// Every MeterValue is encoded into one record holding the timestamp as difference to the previous record, the
+/// reading context and, per sampled value, an index into a dictionary of descriptors followed by the value and, if
+/// present, the signed meter value. A descriptor holds every field of a SampledValue except value, context and
+/// signedMeterValue, e.g. measurand, phase and unit. It is written into the record that uses it for the first time, so
+/// periodic samples of the same measurands only add an index and four bytes per sampled value.
+///
+/// Records depend on the records before them and have to be decoded in the order they were encoded. Decoding the
+/// existing records of a transaction restores the state needed to encode further records.
+class MeterValueCodec {
+public:
+    /// \brief Encodes \p meter_value into a record following the previously encoded or decoded records
+    /// \throws std::invalid_argument if the sampled values do not share the same reading context
+    std::vector<std::uint8_t> encode(const MeterValue& meter_value);
+
+    /// \brief Decodes \p record following the previously encoded or decoded records
+    /// \throws std::runtime_error if the record is malformed
+    MeterValue decode(const std::vector<std::uint8_t>& record);
+
+private:
+    std::int64_t previous_timestamp{0};
+    std::vector<SampledValue> descriptors;
+    std::map<std::string, std::uint64_t> descriptor_indices; ///< serialized descriptor to its index in descriptors
+};
+
+} // namespace v2
+} // namespace ocpp
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#ifndef OCPP_NOTIFY_REPORT_STREAMER_HPP
+#define OCPP_NOTIFY_REPORT_STREAMER_HPP
+
+#include <functional>
+#include <optional>
+#include <string>
+
+#include "ocpp/common/call_types.hpp"
+#include "ocpp/v2/messages/NotifyReport.hpp"
+#include "ocpp/v2/types.hpp"
+
+namespace ocpp {
+namespace v2 {
+
+/// \brief Builds the NotifyReport calls of a report while its ReportData is produced, e.g. by
+/// DeviceModelInterface::visit_base_report_data. Each ReportData is serialized once into the buffer of the pending call
+/// until the next one would exceed the maximum message size or item count, then the call is handed over together with
+/// its serialization, which is assembled from the buffered bytes. In contrast to the NotifyReportRequestsSplitter, the
+/// report never has to be held in memory as a whole.
+class NotifyReportStreamer {
+public:
+    using CallCallback = std::function<void(const json& call, std::string serialized_call)>;
+
+    /// \brief Creates a streamer for the report \p request_id
+    /// \param request_id requestId of the GetBaseReport.req or GetReport.req
+    /// \param max_size maximum size of a serialized call. A single ReportData that exceeds it is sent on its own
+    /// \param max_items maximum number of ReportData per call, 0 for no limit
+    /// \param message_id_generator_callback generates the message ids of the calls
+    /// \param call_callback called with each complete NotifyReport call and its serialization
+    NotifyReportStreamer(int request_id, size_t max_size, size_t max_items,
+                         std::function<MessageId()>&& message_id_generator_callback, CallCallback&& call_callback);
+    NotifyReportStreamer() = delete;
+
+    /// \brief Adds \p report_data to the report. Hands over the pending call if \p report_data does not fit into it
+    void add(const ReportData& report_data);
+
+    /// \brief Hands over the last call of the report with tbc set to false. A report always consists of at least one
+    /// call, even without any ReportData
+    void finish();
+
+    /// \brief The number of calls handed over so far
+    int get_call_count() const;
+
+private:
+    // cppcheck-suppress unusedStructMember
+    static const std::string MESSAGE_TYPE; // NotifyReport
+    const int request_id;
+    const ocpp::DateTime generated_at;
+    // cppcheck-suppress unusedStructMember
+    const size_t max_size;
+    // cppcheck-suppress unusedStructMember
+    const size_t max_items;
+    const std::function<MessageId()> message_id_generator_callback;
+    const CallCallback call_callback;
+
+    int seq_no{0};
+    MessageId message_id;
+    std::string call_head; // serialized start of the pending call, up to the members of the request
+    json report_data_json{json::array()}; // reportData of the pending call
+    std::string report_data_buffer;       // serialized items of report_data_json, separated by commas
+    // cppcheck-suppress unusedStructMember
+    size_t report_data_max_size{0}; // space left for report_data_buffer in the pending call
+
+    NotifyReportRequest create_request(std::optional<bool> tbc) const;
+    void start_call();
+    void send_call(bool tbc);
+};
+
+} // namespace v2
+} // namespace ocpp
+
+#endif // OCPP_NOTIFY_REPORT_STREAMER_HPP
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <ocpp/common/message_validator.hpp>
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include <everest/logging.hpp>
+#include <nlohmann/json.hpp>
+#include <ocpp/common/schemas.hpp>
+
+namespace ocpp {
+
+namespace {
+const std::string REQUEST_SUFFIX = "Request";
+const std::string RESPONSE_SUFFIX = "Response";
+
+bool ends_with(const std::string& value, const std::string& suffix) {
+    return value.size() > suffix.size() and value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// \brief Keeps the first violation, the remaining ones are usually a consequence of it
+class FirstErrorHandler : public nlohmann::json_schema::error_handler {
+public:
+    void error(const json::json_pointer& ptr, const json& /*instance*/, const std::string& message) override {
+        if (!first_error.has_value()) {
+            first_error = ptr.to_string() + ": " + message;
+        }
+    }
+
+    std::optional<std::string> first_error;
+};
+
+void update_max(std::atomic<std::int64_t>& max, std::int64_t value) {
+    auto current = max.load(std::memory_order_relaxed);
+    while (current < value and !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+} // namespace
+
+MessageValidator::MessageValidator(const fs::path& schemas_path) {
+    if (!fs::is_directory(schemas_path)) {
+        throw std::runtime_error("OCPP message schema directory " + schemas_path.string() + " does not exist");
+    }
+
+    for (const auto& file : fs::directory_iterator(schemas_path)) {
+        if (file.path().extension() != ".json") {
+            continue;
+        }
+
+        std::ifstream ifs(file.path().c_str());
+        const std::string schema_file((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+
+        auto schema = std::make_unique<CompiledSchema>();
+        schema->validator = nlohmann::json_schema::json_validator(
+            [](const nlohmann::json_uri& uri, json& /*schema*/) {
+                throw std::runtime_error(uri.url() + " is not supported for message schema loading");
+            },
+            Schemas::format_checker);
+        try {
+            schema->validator.set_root_schema(json::parse(schema_file));
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Could not compile OCPP message schema " + file.path().string() + ": " +
+                                     e.what());
+        }
+
+        const auto name = file.path().stem().string();
+        if (ends_with(name, RESPONSE_SUFFIX)) {
+            this->responses[name.substr(0, name.size() - RESPONSE_SUFFIX.size())] = std::move(schema);
+        } else if (ends_with(name, REQUEST_SUFFIX)) {
+            this->requests[name.substr(0, name.size() - REQUEST_SUFFIX.size())] = std::move(schema);
+        } else {
+            this->requests[name] = std::move(schema);
+        }
+    }
+
+    EVLOG_info << "Loaded " << this->requests.size() << " request and " << this->responses.size()
+               << " response OCPP message schemas from " << schemas_path;
+}
+
+MessageValidator::~MessageValidator() = default;
+
+std::shared_ptr<MessageValidator> MessageValidator::get_shared(const fs::path& schemas_path) {
+    static std::mutex validators_mutex;
+    static std::map<fs::path, std::weak_ptr<MessageValidator>> validators;
+
+    const auto key = fs::weakly_canonical(fs::absolute(schemas_path));
+    const std::lock_guard<std::mutex> lk(validators_mutex);
+    auto validator = validators[key].lock();
+    if (validator == nullptr) {
+        validator = std::make_shared<MessageValidator>(key);
+        validators[key] = validator;
+    }
+    return validator;
+}
+
+std::optional<std::string> MessageValidator::validate_request(const std::string& action, const json& payload) const {
+    return this->validate(this->requests, action, payload);
+}
+
+std::optional<std::string> MessageValidator::validate_response(const std::string& action, const json& payload) const {
+    return this->validate(this->responses, action, payload);
+}
+
+std::optional<std::string>
+MessageValidator::validate(const std::map<std::string, std::unique_ptr<CompiledSchema>>& schemas,
+                           const std::string& action, const json& payload) const {
+    const auto schema = schemas.find(action);
+    if (schema == schemas.end()) {
+        return std::nullopt;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    FirstErrorHandler error_handler;
+    schema->second->validator.validate(payload, error_handler);
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    schema->second->validations.fetch_add(1, std::memory_order_relaxed);
+    schema->second->total_ns.fetch_add(duration, std::memory_order_relaxed);
+    update_max(schema->second->max_ns, duration);
+    if (error_handler.first_error.has_value()) {
+        schema->second->failures.fetch_add(1, std::memory_order_relaxed);
+    }
+    return error_handler.first_error;
+}
+
+std::map<std::string, MessageValidationStatistics> MessageValidator::get_statistics() const {
+    std::map<std::string, MessageValidationStatistics> statistics;
+    const auto collect = [&statistics](const std::map<std::string, std::unique_ptr<CompiledSchema>>& schemas,
+                                       const std::string& suffix) {
+        for (const auto& [action, schema] : schemas) {
+            MessageValidationStatistics& entry = statistics[action + suffix];
+            entry.validations = schema->validations.load(std::memory_order_relaxed);
+            entry.failures = schema->failures.load(std::memory_order_relaxed);
+            entry.total_time = std::chrono::nanoseconds(schema->total_ns.load(std::memory_order_relaxed));
+            entry.max_time = std::chrono::nanoseconds(schema->max_ns.load(std::memory_order_relaxed));
+        }
+    };
+    collect(this->requests, REQUEST_SUFFIX);
+    collect(this->responses, RESPONSE_SUFFIX);
+    return statistics;
+}
+
+std::string MessageValidator::get_statistics_summary() const {
+    std::ostringstream summary;
+    for (const auto& [schema, statistics] : this->get_statistics()) {
+        if (statistics.validations == 0) {
+            continue;
+        }
+        const auto average = statistics.total_time / statistics.validations;
+        const auto max = std::chrono::duration_cast<std::chrono::microseconds>(statistics.max_time);
+        summary << schema << ": " << statistics.validations << " validations, " << statistics.failures
+                << " failed, average " << std::chrono::duration_cast<std::chrono::microseconds>(average).count()
+                << " us, max " << max.count() << " us\n";
+    }
+    const auto result = summary.str();
+    return result.empty() ? "no messages validated" : result.substr(0, result.size() - 1);
+}
+
+} // namespace ocpp
@@ -18,13 +18,24 @@
 namespace ocpp::v16 {
 
 ChargePointConfiguration::ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
-                                                   const fs::path& user_config_path) :
-    ChargePointConfigurationBase(ocpp_main_path), user_config_path(user_config_path) {
+                                                   const fs::path& user_config_path,
+                                                   std::chrono::milliseconds user_config_write_delay) :
+    ChargePointConfigurationBase(ocpp_main_path),
+    user_config_path(user_config_path),
+    user_config_write_delay(user_config_write_delay) {
     if (!fs::exists(this->user_config_path)) {
         EVLOG_critical << "User config file does not exist";
         throw std::runtime_error("User config file does not exist");
     }
 
+    try {
+        this->user_config = this->get_user_config();
+    } catch (const json::parse_error& e) {
+        // never replace a corrupt user config, it still holds every persisted key
+        EVLOG_error << "Error while parsing user config file.";
+        EVLOG_AND_THROW(e);
+    }
+
     // validate config entries
     const auto schemas_path = ocpp_main_path / "profile_schemas";
     Schemas schemas = Schemas(schemas_path);
@@ -116,6 +127,36 @@ ChargePointConfiguration::ChargePointConfiguration(const std::string& config, co
                                            "StopTxnAlignedData or StopTxnSampledData are invalid or do not match the "
                                            "Measurands configured in SupportedMeasurands"));
     }
+
+    this->meter_values_aligned_data_vector =
+        this->csvToMeasurandWithPhaseVector(this->config["Core"]["MeterValuesAlignedData"]).value_or(
+            MeasurandWithPhaseList{});
+    this->meter_values_sampled_data_vector =
+        this->csvToMeasurandWithPhaseVector(this->config["Core"]["MeterValuesSampledData"]).value_or(
+            MeasurandWithPhaseList{});
+    this->clock_aligned_data_interval = this->config["Core"]["ClockAlignedDataInterval"];
+    this->meter_value_sample_interval = this->config["Core"]["MeterValueSampleInterval"];
+    this->heartbeat_interval = this->config["Core"]["HeartbeatInterval"];
+    this->number_of_connectors = this->config["Core"]["NumberOfConnectors"];
+    this->transaction_message_attempts = this->config["Core"]["TransactionMessageAttempts"];
+    this->transaction_message_retry_interval = this->config["Core"]["TransactionMessageRetryInterval"];
+    this->authorize_remote_tx_requests = this->config["Core"]["AuthorizeRemoteTxRequests"];
+    this->local_authorize_offline = this->config["Core"]["LocalAuthorizeOffline"];
+    this->local_pre_authorize = this->config["Core"]["LocalPreAuthorize"];
+    this->stop_transaction_on_invalid_id = this->config["Core"]["StopTransactionOnInvalidId"];
+
+    // started last, the destructor that joins it does not run if the constructor throws
+    this->user_config_writer = std::thread(&ChargePointConfiguration::runUserConfigWriter, this);
+}
+
+ChargePointConfiguration::~ChargePointConfiguration() {
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        this->user_config_writer_stopped = true;
+    }
+    this->user_config_cv.notify_one();
+    // pending changes are written before the writer exits
+    this->user_config_writer.join();
 }
 
 json ChargePointConfiguration::get_user_config() {
@@ -131,6 +172,46 @@ json ChargePointConfiguration::get_user_config() {
 }
 
 void ChargePointConfiguration::setInUserConfig(const std::string& profile, const std::string& key, const json value) {
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        this->user_config[profile][key] = value;
+        this->user_config_dirty = true;
+    }
+    this->user_config_cv.notify_one();
+}
+
+void ChargePointConfiguration::markUserConfigDirty() {
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        this->user_config_dirty = true;
+    }
+    this->user_config_cv.notify_one();
+}
+
+void ChargePointConfiguration::runUserConfigWriter() {
+    std::unique_lock<std::mutex> lock(this->user_config_mutex);
+    while (true) {
+        this->user_config_cv.wait(lock,
+                                  [this]() { return this->user_config_dirty or this->user_config_writer_stopped; });
+        if (!this->user_config_dirty) {
+            return;
+        }
+
+        // collect further changes, e.g. of a ChangeConfiguration burst after boot, into the same write. The delay
+        // starts with the first change, so a steady stream of changes can not postpone the write indefinitely
+        this->user_config_cv.wait_for(lock, this->user_config_write_delay,
+                                      [this]() { return this->user_config_writer_stopped; });
+
+        const auto user_config_str = this->user_config.dump();
+        this->user_config_dirty = false;
+
+        lock.unlock();
+        this->writeUserConfig(user_config_str);
+        lock.lock();
+    }
+}
+
+void ChargePointConfiguration::writeUserConfig(const std::string& user_config_str) {
     // write to a separate file to minimise corruption and data loss; then rename
     namespace fs = std::filesystem;
 
@@ -138,11 +219,13 @@ void ChargePointConfiguration::setInUserConfig(const std::string& profile, const
         const auto tmp_file = user_config_path.string() + '$';
         fs::remove(tmp_file);
 
-        json user_config = get_user_config();
-        user_config[profile][key] = value;
         std::ofstream ofs(tmp_file);
-        ofs << user_config << std::endl;
+        ofs << user_config_str << std::endl;
         ofs.close();
+        if (ofs.fail()) {
+            EVLOG_error << "Error writing user config: " << tmp_file;
+            return;
+        }
 
         fs::rename(tmp_file, user_config_path);
     } catch (const fs::filesystem_error& ex) {
@@ -164,50 +247,45 @@ void ChargePointConfiguration::setChargepointInformation(const std::string& char
                                                          const std::optional<std::string>& chargePointSerialNumber,
                                                          const std::optional<std::string>& chargeBoxSerialNumber,
                                                          const std::optional<std::string>& firmwareVersion) {
-    // load current persistent configuration from disk
-    json user_config = this->get_user_config();
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
 
-    this->config["Internal"]["ChargePointVendor"] = chargePointVendor;
-    user_config["Internal"]["ChargePointVendor"] = chargePointVendor;
+        this->config["Internal"]["ChargePointVendor"] = chargePointVendor;
+        this->user_config["Internal"]["ChargePointVendor"] = chargePointVendor;
 
-    this->config["Internal"]["ChargePointModel"] = chargePointModel;
-    user_config["Internal"]["ChargePointModel"] = chargePointModel;
+        this->config["Internal"]["ChargePointModel"] = chargePointModel;
+        this->user_config["Internal"]["ChargePointModel"] = chargePointModel;
 
-    setChargepointInformationProperty(user_config, "ChargePointSerialNumber", chargePointSerialNumber);
-    setChargepointInformationProperty(user_config, "ChargeBoxSerialNumber", chargeBoxSerialNumber);
-    setChargepointInformationProperty(user_config, "FirmwareVersion", firmwareVersion);
+        setChargepointInformationProperty(this->user_config, "ChargePointSerialNumber", chargePointSerialNumber);
+        setChargepointInformationProperty(this->user_config, "ChargeBoxSerialNumber", chargeBoxSerialNumber);
+        setChargepointInformationProperty(this->user_config, "FirmwareVersion", firmwareVersion);
+    }
 
     // save the changes back
-    std::ofstream ofs(this->user_config_path.c_str());
-    ofs << user_config << std::endl;
-    ofs.close();
+    this->markUserConfigDirty();
 }
 
 void ChargePointConfiguration::setChargepointModemInformation(const std::optional<std::string>& ICCID,
                                                               const std::optional<std::string>& IMSI) {
-    // load current persistent configuration from disk
-    json user_config = this->get_user_config();
-
-    setChargepointInformationProperty(user_config, "ICCID", ICCID);
-    setChargepointInformationProperty(user_config, "IMSI", IMSI);
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        setChargepointInformationProperty(this->user_config, "ICCID", ICCID);
+        setChargepointInformationProperty(this->user_config, "IMSI", IMSI);
+    }
 
     // save the changes back
-    std::ofstream ofs(this->user_config_path.c_str());
-    ofs << user_config << std::endl;
-    ofs.close();
+    this->markUserConfigDirty();
 }
 void ChargePointConfiguration::setChargepointMeterInformation(const std::optional<std::string>& meterSerialNumber,
                                                               const std::optional<std::string>& meterType) {
-    // load current persistent configuration from disk
-    json user_config = this->get_user_config();
-
-    setChargepointInformationProperty(user_config, "MeterSerialNumber", meterSerialNumber);
-    setChargepointInformationProperty(user_config, "MeterType", meterType);
+    {
+        const std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        setChargepointInformationProperty(this->user_config, "MeterSerialNumber", meterSerialNumber);
+        setChargepointInformationProperty(this->user_config, "MeterType", meterType);
+    }
 
     // save the changes back
-    std::ofstream ofs(this->user_config_path.c_str());
-    ofs << user_config << std::endl;
-    ofs.close();
+    this->markUserConfigDirty();
 }
 
 // Internal config options
@@ -990,6 +1068,26 @@ std::optional<KeyValue> ChargePointConfiguration::getMessageTypesDiscardForQueue
     return message_types_discard_for_queueing_kv;
 }
 
+std::optional<std::string> ChargePointConfiguration::getMessageSchemasPath() {
+    if (this->config["Internal"].contains("MessageSchemasPath")) {
+        return this->config["Internal"]["MessageSchemasPath"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageSchemasPathKeyValue() {
+    std::optional<KeyValue> message_schemas_path_kv = std::nullopt;
+    auto message_schemas_path = this->getMessageSchemasPath();
+    if (message_schemas_path.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageSchemasPath";
+        kv.readonly = true;
+        kv.value.emplace(message_schemas_path.value());
+        message_schemas_path_kv.emplace(kv);
+    }
+    return message_schemas_path_kv;
+}
+
 std::optional<int> ChargePointConfiguration::getMessageQueueSizeThreshold() {
     std::optional<int> message_queue_size_threshold = std::nullopt;
     if (this->config["Internal"].contains("MessageQueueSizeThreshold")) {
@@ -1067,10 +1165,11 @@ std::optional<KeyValue> ChargePointConfiguration::getAuthorizationCacheEnabledKe
 
 // Core Profile
 bool ChargePointConfiguration::getAuthorizeRemoteTxRequests() {
-    return this->config["Core"]["AuthorizeRemoteTxRequests"];
+    return this->authorize_remote_tx_requests;
 }
 void ChargePointConfiguration::setAuthorizeRemoteTxRequests(bool enabled) {
     this->config["Core"]["AuthorizeRemoteTxRequests"] = enabled;
+    this->authorize_remote_tx_requests = enabled;
     this->setInUserConfig("Core", "AuthorizeRemoteTxRequests", enabled);
 }
 KeyValue ChargePointConfiguration::getAuthorizeRemoteTxRequestsKeyValue() {
@@ -1110,10 +1209,11 @@ std::optional<KeyValue> ChargePointConfiguration::getBlinkRepeatKeyValue() {
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getClockAlignedDataInterval() {
-    return this->config["Core"]["ClockAlignedDataInterval"];
+    return this->clock_aligned_data_interval;
 }
 void ChargePointConfiguration::setClockAlignedDataInterval(std::int32_t interval) {
     this->config["Core"]["ClockAlignedDataInterval"] = interval;
+    this->clock_aligned_data_interval = interval;
     this->setInUserConfig("Core", "ClockAlignedDataInterval", interval);
 }
 KeyValue ChargePointConfiguration::getClockAlignedDataIntervalKeyValue() {
@@ -1191,10 +1291,11 @@ KeyValue ChargePointConfiguration::getGetConfigurationMaxKeysKeyValue() {
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getHeartbeatInterval() {
-    return this->config["Core"]["HeartbeatInterval"];
+    return this->heartbeat_interval;
 }
 void ChargePointConfiguration::setHeartbeatInterval(std::int32_t interval) {
     this->config["Core"]["HeartbeatInterval"] = interval;
+    this->heartbeat_interval = interval;
     this->setInUserConfig("Core", "HeartbeatInterval", interval);
 }
 KeyValue ChargePointConfiguration::getHeartbeatIntervalKeyValue() {
@@ -1234,10 +1335,11 @@ std::optional<KeyValue> ChargePointConfiguration::getLightIntensityKeyValue() {
 
 // Core Profile
 bool ChargePointConfiguration::getLocalAuthorizeOffline() {
-    return this->config["Core"]["LocalAuthorizeOffline"];
+    return this->local_authorize_offline;
 }
 void ChargePointConfiguration::setLocalAuthorizeOffline(bool local_authorize_offline) {
     this->config["Core"]["LocalAuthorizeOffline"] = local_authorize_offline;
+    this->local_authorize_offline = local_authorize_offline;
     this->setInUserConfig("Core", "LocalAuthorizeOffline", local_authorize_offline);
 }
 KeyValue ChargePointConfiguration::getLocalAuthorizeOfflineKeyValue() {
@@ -1250,10 +1352,11 @@ KeyValue ChargePointConfiguration::getLocalAuthorizeOfflineKeyValue() {
 
 // Core Profile
 bool ChargePointConfiguration::getLocalPreAuthorize() {
-    return this->config["Core"]["LocalPreAuthorize"];
+    return this->local_pre_authorize;
 }
 void ChargePointConfiguration::setLocalPreAuthorize(bool local_pre_authorize) {
     this->config["Core"]["LocalPreAuthorize"] = local_pre_authorize;
+    this->local_pre_authorize = local_pre_authorize;
     this->setInUserConfig("Core", "LocalPreAuthorize", local_pre_authorize);
 }
 KeyValue ChargePointConfiguration::getLocalPreAuthorizeKeyValue() {
@@ -1299,6 +1402,11 @@ bool ChargePointConfiguration::setMeterValuesAlignedData(const std::string& mete
     if (!this->isValidSupportedMeasurands(meter_values_aligned_data)) {
         return false;
     }
+    {
+        const std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+        this->meter_values_aligned_data_vector =
+            this->csvToMeasurandWithPhaseVector(meter_values_aligned_data).value_or(MeasurandWithPhaseList{});
+    }
     this->config["Core"]["MeterValuesAlignedData"] = meter_values_aligned_data;
     this->setInUserConfig("Core", "MeterValuesAlignedData", meter_values_aligned_data);
     return true;
@@ -1311,12 +1419,8 @@ KeyValue ChargePointConfiguration::getMeterValuesAlignedDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesAlignedDataVector() {
-    std::vector<MeasurandWithPhase> result;
-    auto res = csvToMeasurandWithPhaseVector(getMeterValuesAlignedData());
-    if (res) {
-        result = std::move(res.value());
-    }
-    return result;
+    const std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    return this->meter_values_aligned_data_vector;
 }
 
 // Core Profile - optional
@@ -1348,6 +1452,11 @@ bool ChargePointConfiguration::setMeterValuesSampledData(const std::string& mete
     if (!this->isValidSupportedMeasurands(meter_values_sampled_data)) {
         return false;
     }
+    {
+        const std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+        this->meter_values_sampled_data_vector =
+            this->csvToMeasurandWithPhaseVector(meter_values_sampled_data).value_or(MeasurandWithPhaseList{});
+    }
     this->config["Core"]["MeterValuesSampledData"] = meter_values_sampled_data;
     this->setInUserConfig("Core", "MeterValuesSampledData", meter_values_sampled_data);
     return true;
@@ -1360,12 +1469,8 @@ KeyValue ChargePointConfiguration::getMeterValuesSampledDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesSampledDataVector() {
-    std::vector<MeasurandWithPhase> result;
-    auto res = csvToMeasurandWithPhaseVector(getMeterValuesSampledData());
-    if (res) {
-        result = std::move(res.value());
-    }
-    return result;
+    const std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    return this->meter_values_sampled_data_vector;
 }
 
 // Core Profile - optional
@@ -1391,10 +1496,11 @@ std::optional<KeyValue> ChargePointConfiguration::getMeterValuesSampledDataMaxLe
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getMeterValueSampleInterval() {
-    return this->config["Core"]["MeterValueSampleInterval"];
+    return this->meter_value_sample_interval;
 }
 void ChargePointConfiguration::setMeterValueSampleInterval(std::int32_t interval) {
     this->config["Core"]["MeterValueSampleInterval"] = interval;
+    this->meter_value_sample_interval = interval;
     this->setInUserConfig("Core", "MeterValueSampleInterval", interval);
 }
 KeyValue ChargePointConfiguration::getMeterValueSampleIntervalKeyValue() {
@@ -1434,7 +1540,7 @@ std::optional<KeyValue> ChargePointConfiguration::getMinimumStatusDurationKeyVal
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getNumberOfConnectors() {
-    return this->config["Core"]["NumberOfConnectors"];
+    return this->number_of_connectors;
 }
 KeyValue ChargePointConfiguration::getNumberOfConnectorsKeyValue() {
     KeyValue kv;
@@ -1506,10 +1612,11 @@ std::optional<KeyValue> ChargePointConfiguration::getStopTransactionOnEVSideDisc
 
 // Core Profile
 bool ChargePointConfiguration::getStopTransactionOnInvalidId() {
-    return this->config["Core"]["StopTransactionOnInvalidId"];
+    return this->stop_transaction_on_invalid_id;
 }
 void ChargePointConfiguration::setStopTransactionOnInvalidId(bool stop_transaction_on_invalid_id) {
     this->config["Core"]["StopTransactionOnInvalidId"] = stop_transaction_on_invalid_id;
+    this->stop_transaction_on_invalid_id = stop_transaction_on_invalid_id;
     this->setInUserConfig("Core", "StopTransactionOnInvalidId", stop_transaction_on_invalid_id);
 }
 KeyValue ChargePointConfiguration::getStopTransactionOnInvalidIdKeyValue() {
@@ -1641,10 +1748,11 @@ std::optional<KeyValue> ChargePointConfiguration::getSupportedFeatureProfilesMax
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getTransactionMessageAttempts() {
-    return this->config["Core"]["TransactionMessageAttempts"];
+    return this->transaction_message_attempts;
 }
 void ChargePointConfiguration::setTransactionMessageAttempts(std::int32_t attempts) {
     this->config["Core"]["TransactionMessageAttempts"] = attempts;
+    this->transaction_message_attempts = attempts;
     this->setInUserConfig("Core", "TransactionMessageAttempts", attempts);
 }
 KeyValue ChargePointConfiguration::getTransactionMessageAttemptsKeyValue() {
@@ -1657,10 +1765,11 @@ KeyValue ChargePointConfiguration::getTransactionMessageAttemptsKeyValue() {
 
 // Core Profile
 std::int32_t ChargePointConfiguration::getTransactionMessageRetryInterval() {
-    return this->config["Core"]["TransactionMessageRetryInterval"];
+    return this->transaction_message_retry_interval;
 }
 void ChargePointConfiguration::setTransactionMessageRetryInterval(std::int32_t retry_interval) {
     this->config["Core"]["TransactionMessageRetryInterval"] = retry_interval;
+    this->transaction_message_retry_interval = retry_interval;
     this->setInUserConfig("Core", "TransactionMessageRetryInterval", retry_interval);
 }
 KeyValue ChargePointConfiguration::getTransactionMessageRetryIntervalKeyValue() {
@@ -3224,6 +3333,9 @@ std::optional<KeyValue> ChargePointConfiguration::get(const CiString<50>& key) {
     if (key == "MessageQueueSizeThreshold") {
         return this->getMessageQueueSizeThresholdKeyValue();
     }
+    if (key == "MessageSchemasPath") {
+        return this->getMessageSchemasPathKeyValue();
+    }
     if (key == "StopTransactionIfUnlockNotSupported") {
         return this->getStopTransactionIfUnlockNotSupportedKeyValue();
     }
@@ -1462,6 +1462,10 @@ std::optional<std::string> ChargePointConfigurationDeviceModel::getMessageTypesD
     return get_optional<std::string>(*storage, keys::valid_keys::MessageTypesDiscardForQueueing);
 }
 
+std::optional<std::string> ChargePointConfigurationDeviceModel::getMessageSchemasPath() {
+    return get_optional<std::string>(*storage, keys::valid_keys::MessageSchemasPath);
+}
+
 std::optional<std::string> ChargePointConfigurationDeviceModel::getSeccLeafSubjectCommonName() {
     return get_optional<std::string>(*storage, keys::valid_keys::SeccLeafSubjectCommonName);
 }
@@ -1720,6 +1724,10 @@ std::optional<KeyValue> ChargePointConfigurationDeviceModel::getMessageTypesDisc
     return get_key_value_optional(*storage, keys::valid_keys::MessageTypesDiscardForQueueing);
 }
 
+std::optional<KeyValue> ChargePointConfigurationDeviceModel::getMessageSchemasPathKeyValue() {
+    return get_key_value_optional(*storage, keys::valid_keys::MessageSchemasPath);
+}
+
 std::optional<KeyValue> ChargePointConfigurationDeviceModel::getMessageQueueSizeThresholdKeyValue() {
     return get_key_value_optional(*storage, keys::valid_keys::MessageQueueSizeThreshold);
 }
@@ -3240,6 +3248,7 @@ std::optional<ConfigurationStatus> ChargePointConfigurationDeviceModel::set(cons
         case keys::valid_keys::MaxMessageSize:
         case keys::valid_keys::MessageQueueSizeThreshold:
         case keys::valid_keys::MessageTypesDiscardForQueueing:
+        case keys::valid_keys::MessageSchemasPath:
         case keys::valid_keys::MeterType:
         case keys::valid_keys::QueueAllMessages:
         case keys::valid_keys::SupportedChargingProfilePurposeTypes:
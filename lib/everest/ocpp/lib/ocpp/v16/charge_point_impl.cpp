@@ -35,6 +35,7 @@ const auto WEBSOCKET_INIT_DELAY = std::chrono::seconds(2);
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 1000;
 const auto DEFAULT_BOOT_NOTIFICATION_INTERVAL_S = 60; // fallback interval if BootNotification returns interval of 0.
 const auto DEFAULT_PRICE_NUMBER_OF_DECIMALS = 3;
+const auto MESSAGE_VALIDATION_STATISTICS_INTERVAL = std::chrono::minutes(15);
 const auto DEFAULT_WAIT_FOR_SET_USER_PRICE_TIMEOUT_MS = 0;
 
 ChargePointImpl::ChargePointImpl(
@@ -278,13 +279,24 @@ std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_me
         }
     }
 
+    MessageQueueConfig<v16::MessageType> message_queue_config{
+        this->configuration.getTransactionMessageAttempts(), this->configuration.getTransactionMessageRetryInterval(),
+        this->configuration.getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->configuration.getQueueAllMessages().value_or(false), message_types_discard_for_queueing};
+
+    this->message_validator = nullptr;
+    const auto message_schemas_path = this->configuration.getMessageSchemasPath();
+    if (message_schemas_path.has_value() && !message_schemas_path.value().empty()) {
+        try {
+            this->message_validator = MessageValidator::get_shared(message_schemas_path.value());
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not load OCPP message schemas, messages are not validated: " << e.what();
+        }
+    }
+    message_queue_config.message_validator = this->message_validator;
+
     return std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig<v16::MessageType>{
-            this->configuration.getTransactionMessageAttempts(),
-            this->configuration.getTransactionMessageRetryInterval(),
-            this->configuration.getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->configuration.getQueueAllMessages().value_or(false), message_types_discard_for_queueing},
+        [this](json message) -> bool { return this->websocket->send(message.dump()); }, message_queue_config,
         this->external_notify, this->database_handler, start_transaction_message_retry_callback);
 }
 
@@ -1187,6 +1199,15 @@ bool ChargePointImpl::start(const std::map<int, ChargePointStatus>& connector_st
     this->boot_notification();
     this->call_set_connection_timeout();
 
+    if (this->message_validator != nullptr) {
+        this->message_validation_statistics_timer.interval(
+            [this]() {
+                EVLOG_debug << "OCPP message validation statistics:\n"
+                            << this->message_validator->get_statistics_summary();
+            },
+            MESSAGE_VALIDATION_STATISTICS_INTERVAL);
+    }
+
     switch (bootreason) {
     case BootReasonEnum::RemoteReset:
         this->securityEventNotification(
@@ -1308,6 +1329,7 @@ bool ChargePointImpl::stop() {
         if (this->change_time_offset_timer != nullptr) {
             this->change_time_offset_timer->stop();
         }
+        this->message_validation_statistics_timer.stop();
 
         for (const auto& [id, connector] : this->connectors) {
             if (connector->trigger_metervalue_at_time_timer != nullptr) {
@@ -1411,6 +1433,17 @@ void ChargePointImpl::message_callback(const std::string& message) {
             return;
         }
 
+        if (enhanced_message.messageTypeId == MessageTypeId::CALL && enhanced_message.validation_error.has_value()) {
+            EVLOG_error << "Received " << conversions::messagetype_to_string(enhanced_message.messageType)
+                        << " does not match its schema: " << enhanced_message.validation_error.value();
+            this->securityEventNotification(ocpp::security_events::INVALIDMESSAGES,
+                                            CiString<255>(message, StringTooLarge::Truncate), true);
+            auto call_error = CallError(enhanced_message.uniqueId, "FormationViolation",
+                                        enhanced_message.validation_error.value(), json({}, true));
+            this->message_dispatcher->dispatch_call_error(call_error);
+            return;
+        }
+
         switch (this->connection_state) {
         case ChargePointConnectionState::Disconnected: {
             EVLOG_error << "Received a message in disconnected state, this cannot be correct";
@@ -3186,10 +3219,8 @@ void ChargePointImpl::handleSendLocalListRequest(ocpp::Call<SendLocalListRequest
             response.status = UpdateStatus::NotSupported;
         } else if (call.msg.updateType == UpdateType::Full) {
             if (call.msg.localAuthorizationList) {
-                auto local_auth_list = call.msg.localAuthorizationList.value();
-                this->database_handler->clear_local_authorization_list();
                 this->database_handler->insert_or_update_local_list_version(call.msg.listVersion);
-                this->database_handler->insert_or_update_local_authorization_list(local_auth_list);
+                this->database_handler->replace_local_authorization_list(call.msg.localAuthorizationList.value());
             } else {
                 this->database_handler->insert_or_update_local_list_version(call.msg.listVersion);
                 this->database_handler->clear_local_authorization_list();
@@ -429,23 +429,70 @@ void DatabaseHandler::insert_or_update_local_authorization_list_entry(const CiSt
 
 void DatabaseHandler::insert_or_update_local_authorization_list(
     std::vector<v16::LocalAuthorizationList> local_authorization_list) {
-    bool success = true; // indicates if all database operations succeeded
+    auto transaction = this->database->begin_transaction();
+    this->write_local_authorization_list("AUTH_LIST", local_authorization_list);
+    transaction->commit();
+}
+
+void DatabaseHandler::replace_local_authorization_list(
+    const std::vector<v16::LocalAuthorizationList>& local_authorization_list) {
+    auto transaction = this->database->begin_transaction();
+
+    // The new list is written to AUTH_LIST_STAGING, so lookups keep seeing the complete previous list meanwhile. The
+    // staging table may contain a previous list if the last replacement was interrupted.
+    if (!this->database->clear_table("AUTH_LIST_STAGING")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    // entries without IdTagInfo are deleted from the staging table, which does not contain them
+    this->write_local_authorization_list("AUTH_LIST_STAGING", local_authorization_list);
+
+    // Renaming the tables does not depend on the size of the lists. All statements are executed within one call of
+    // sqlite3_exec, which holds the connection mutex, so lookups of other threads always find an AUTH_LIST table.
+    if (!this->database->execute_statement("ALTER TABLE AUTH_LIST RENAME TO AUTH_LIST_PREVIOUS;"
+                                           "ALTER TABLE AUTH_LIST_STAGING RENAME TO AUTH_LIST;"
+                                           "ALTER TABLE AUTH_LIST_PREVIOUS RENAME TO AUTH_LIST_STAGING;")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    if (!this->database->clear_table("AUTH_LIST_STAGING")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    transaction->commit();
+}
+
+void DatabaseHandler::write_local_authorization_list(
+    const std::string& table, const std::vector<v16::LocalAuthorizationList>& local_authorization_list) {
+    auto insert_stmt = this->database->new_statement("INSERT OR REPLACE INTO " + table +
+                                                     " (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
+                                                     "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)");
+    auto delete_stmt = this->database->new_statement("DELETE FROM " + table + " WHERE ID_TAG = @id_tag;");
+
     for (const auto& authorization_data : local_authorization_list) {
-        try {
-            if (authorization_data.idTagInfo) {
-                this->insert_or_update_local_authorization_list_entry(authorization_data.idTag,
-                                                                      authorization_data.idTagInfo.value());
+        auto& stmt = authorization_data.idTagInfo.has_value() ? *insert_stmt : *delete_stmt;
+
+        stmt.bind_text("@id_tag", authorization_data.idTag.get(), SQLiteString::Transient);
+        if (authorization_data.idTagInfo.has_value()) {
+            const auto& id_tag_info = authorization_data.idTagInfo.value();
+            stmt.bind_text("@auth_status", v16::conversions::authorization_status_to_string(id_tag_info.status),
+                           SQLiteString::Transient);
+            // bindings are kept by reset(), so optional values are bound for every entry
+            if (id_tag_info.expiryDate.has_value()) {
+                stmt.bind_text("@expiry_date", id_tag_info.expiryDate.value().to_rfc3339(), SQLiteString::Transient);
             } else {
-                this->delete_local_authorization_list_entry(authorization_data.idTag.get());
+                stmt.bind_null("@expiry_date");
+            }
+            if (id_tag_info.parentIdTag.has_value()) {
+                stmt.bind_text("@parent_id_tag", id_tag_info.parentIdTag.value().get(), SQLiteString::Transient);
+            } else {
+                stmt.bind_null("@parent_id_tag");
             }
-        } catch (const QueryExecutionException& e) {
-            // catch but continue with remaining entries
-            success = false;
         }
-    }
 
-    if (!success) {
-        throw QueryExecutionException("At least one insertion or deletion of local authorization list entries failed");
+        if (stmt.step() != SQLITE_DONE) {
+            EVLOG_error << "Could not insert or delete local authorization list entry in " << table;
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+        stmt.reset();
     }
 }
 
@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+// This code is generated using the generator in 'src/code_generator/common`, please do not edit manually
+
+#include <ocpp/v16/json_stream.hpp>
+
+#include <ocpp/v16/ocpp_enums.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.begin_object();
+    writer.key("value");
+    write_json(writer, k.value);
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_to_string(k.context.value()));
+    }
+    if (k.format) {
+        writer.key("format");
+        writer.value(conversions::value_format_to_string(k.format.value()));
+    }
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_to_string(k.location.value()));
+    }
+    if (k.unit) {
+        writer.key("unit");
+        writer.value(conversions::unit_of_measure_to_string(k.unit.value()));
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SampledValue& k) {
+    bool has_value = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "value") {
+            read_json(reader, k.value);
+            has_value = true;
+        } else if (key == "context") {
+            k.context.emplace(conversions::string_to_reading_context(reader.read_string()));
+        } else if (key == "format") {
+            k.format.emplace(conversions::string_to_value_format(reader.read_string()));
+        } else if (key == "measurand") {
+            k.measurand.emplace(conversions::string_to_measurand(reader.read_string()));
+        } else if (key == "phase") {
+            k.phase.emplace(conversions::string_to_phase(reader.read_string()));
+        } else if (key == "location") {
+            k.location.emplace(conversions::string_to_location(reader.read_string()));
+        } else if (key == "unit") {
+            k.unit.emplace(conversions::string_to_unit_of_measure(reader.read_string()));
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_value, "value");
+}
+
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.begin_object();
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValue& k) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            read_json(reader, k.sampledValue);
+            has_sampledValue = true;
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_timestamp, "timestamp");
+    reader.require(has_sampledValue, "sampledValue");
+}
+
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.begin_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("meterValue");
+    write_json(writer, k.meterValue);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesRequest& k) {
+    bool has_connectorId = false;
+    bool has_meterValue = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "connectorId") {
+            read_json(reader, k.connectorId);
+            has_connectorId = true;
+        } else if (key == "meterValue") {
+            read_json(reader, k.meterValue);
+            has_meterValue = true;
+        } else if (key == "transactionId") {
+            read_json(reader, k.transactionId.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_connectorId, "connectorId");
+    reader.require(has_meterValue, "meterValue");
+}
+
+void write_json(JsonWriter& writer, const MeterValuesResponse& /*k*/) {
+    writer.begin_object();
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesResponse& /*k*/) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        reader.skip_value();
+    }
+}
+
+void write_json(JsonWriter& writer, const TransactionData& k) {
+    writer.begin_object();
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionData& k) {
+    bool has_timestamp = false;
+    bool has_sampledValue = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "sampledValue") {
+            read_json(reader, k.sampledValue);
+            has_sampledValue = true;
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_timestamp, "timestamp");
+    reader.require(has_sampledValue, "sampledValue");
+}
+
+void write_json(JsonWriter& writer, const StopTransactionRequest& k) {
+    writer.begin_object();
+    writer.key("meterStop");
+    write_json(writer, k.meterStop);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    if (k.idTag) {
+        writer.key("idTag");
+        write_json(writer, k.idTag.value());
+    }
+    if (k.reason) {
+        writer.key("reason");
+        writer.value(conversions::reason_to_string(k.reason.value()));
+    }
+    if (k.transactionData) {
+        writer.key("transactionData");
+        write_json(writer, k.transactionData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StopTransactionRequest& k) {
+    bool has_meterStop = false;
+    bool has_timestamp = false;
+    bool has_transactionId = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "meterStop") {
+            read_json(reader, k.meterStop);
+            has_meterStop = true;
+        } else if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "transactionId") {
+            read_json(reader, k.transactionId);
+            has_transactionId = true;
+        } else if (key == "idTag") {
+            read_json(reader, k.idTag.emplace());
+        } else if (key == "reason") {
+            k.reason.emplace(conversions::string_to_reason(reader.read_string()));
+        } else if (key == "transactionData") {
+            read_json(reader, k.transactionData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_meterStop, "meterStop");
+    reader.require(has_timestamp, "timestamp");
+    reader.require(has_transactionId, "transactionId");
+}
+
+void write_json(JsonWriter& writer, const IdTagInfo& k) {
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::authorization_status_to_string(k.status));
+    if (k.expiryDate) {
+        writer.key("expiryDate");
+        write_json(writer, k.expiryDate.value());
+    }
+    if (k.parentIdTag) {
+        writer.key("parentIdTag");
+        write_json(writer, k.parentIdTag.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, IdTagInfo& k) {
+    bool has_status = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "status") {
+            k.status = conversions::string_to_authorization_status(reader.read_string());
+            has_status = true;
+        } else if (key == "expiryDate") {
+            read_json(reader, k.expiryDate.emplace());
+        } else if (key == "parentIdTag") {
+            read_json(reader, k.parentIdTag.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_status, "status");
+}
+
+void write_json(JsonWriter& writer, const StopTransactionResponse& k) {
+    writer.begin_object();
+    if (k.idTagInfo) {
+        writer.key("idTagInfo");
+        write_json(writer, k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StopTransactionResponse& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "idTagInfo") {
+            read_json(reader, k.idTagInfo.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -51,6 +51,7 @@ using ocpp::v16::keys::valid_keys;
     key(WebsocketPongTimeout) \
     key(QueueAllMessages) \
     key(MessageTypesDiscardForQueueing) \
+    key(MessageSchemasPath) \
     key(MessageQueueSizeThreshold) \
     key(ConnectorPhaseRotationMaxLength) \
     key(GetConfigurationMaxKeys) \
@@ -46,6 +46,7 @@ namespace ocpp {
 namespace v2 {
 
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 1000;
+const auto MESSAGE_VALIDATION_STATISTICS_INTERVAL = std::chrono::minutes(15);
 
 ChargePoint::ChargePoint(const std::map<std::int32_t, std::int32_t>& evse_connector_structure,
                          std::shared_ptr<DeviceModelAbstract> device_model,
@@ -143,6 +144,15 @@ void ChargePoint::start(BootReasonEnum bootreason, bool start_connecting) {
         this->connectivity_manager->connect();
     }
 
+    if (this->message_validator != nullptr) {
+        this->message_validation_statistics_timer.interval(
+            [this]() {
+                EVLOG_debug << "OCPP message validation statistics:\n"
+                            << this->message_validator->get_statistics_summary();
+            },
+            MESSAGE_VALIDATION_STATISTICS_INTERVAL);
+    }
+
     const auto firmware_version =
         this->device_model->get_value<std::string>(ControllerComponentVariables::FirmwareVersion);
 
@@ -179,6 +189,7 @@ void ChargePoint::stop() {
     this->diagnostics->stop_monitoring();
     this->message_queue->stop();
     this->security->stop_certificate_signed_timer();
+    this->message_validation_statistics_timer.stop();
 }
 
 void ChargePoint::disconnect_websocket() {
@@ -537,18 +548,32 @@ void ChargePoint::initialize(const std::map<std::int32_t, std::int32_t>& evse_co
             EVLOG_warning << "Could not apply MessageTypesDiscardForQueueing configuration";
         }
 
+        MessageQueueConfig<v2::MessageType> message_queue_config{
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
+            this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
+                .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+            this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
+                .value_or(false),
+            message_types_discard_for_queueing,
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)};
+
+        const auto message_schemas_path =
+            this->device_model->get_optional_value<std::string>(ControllerComponentVariables::MessageSchemasPath);
+        if (message_schemas_path.has_value() and !message_schemas_path.value().empty()) {
+            try {
+                this->message_validator = MessageValidator::get_shared(message_schemas_path.value());
+            } catch (const std::exception& e) {
+                EVLOG_error << "Could not load OCPP message schemas, messages are not validated: " << e.what();
+            }
+        }
+        message_queue_config.message_validator = this->message_validator;
+
         this->message_queue = std::make_unique<ocpp::MessageQueue<v2::MessageType>>(
             [this](json message) -> bool { return this->connectivity_manager->send_to_websocket(message.dump()); },
-            MessageQueueConfig<v2::MessageType>{
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
-                this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
-                    .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-                this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
-                    .value_or(false),
-                message_types_discard_for_queueing,
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)},
-            this->database_handler);
+            message_queue_config, this->database_handler);
+        this->message_queue->set_send_serialized_callback(
+            [this](const std::string& message) { return this->connectivity_manager->send_to_websocket(message); });
     }
 
     this->message_dispatcher =
@@ -975,6 +1000,19 @@ void ChargePoint::message_callback(const std::string& message) {
     enhanced_message.message_size = message.size();
     auto json_message = enhanced_message.message;
     this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+
+    if (enhanced_message.messageTypeId == MessageTypeId::CALL and enhanced_message.validation_error.has_value()) {
+        EVLOG_error << "Received " << conversions::messagetype_to_string(enhanced_message.messageType)
+                    << " does not match its schema: " << enhanced_message.validation_error.value();
+        auto call_error = CallError(enhanced_message.uniqueId, "FormatViolation",
+                                    enhanced_message.validation_error.value(), json({}));
+        this->message_dispatcher->dispatch_call_error(call_error);
+        const auto& security_event = ocpp::security_events::INVALIDMESSAGES;
+        this->security->security_event_notification_req(CiString<50>(security_event, StringTooLarge::Truncate),
+                                                        CiString<255>(message, StringTooLarge::Truncate), true,
+                                                        utils::is_critical(security_event));
+        return;
+    }
     try {
         if (this->registration_status == RegistrationStatusEnum::Accepted) {
             this->handle_message(enhanced_message);
@@ -321,6 +321,12 @@ const ComponentVariable MaxMessageSize = {
         "MaxMessageSize",
     }),
 };
+const ComponentVariable MessageSchemasPath = {
+    ControllerComponents::InternalCtrlr,
+    std::optional<Variable>({
+        "MessageSchemasPath",
+    }),
+};
 const ComponentVariable ResumeTransactionsOnBoot = {
     ControllerComponents::InternalCtrlr,
     std::optional<Variable>({
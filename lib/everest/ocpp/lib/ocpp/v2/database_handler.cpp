@@ -10,6 +10,7 @@
 #include <numeric>
 #include <ocpp/common/message_queue.hpp>
 #include <ocpp/v2/database_handler.hpp>
+#include <ocpp/v2/json_stream.hpp>
 #include <ocpp/v2/types.hpp>
 #include <ocpp/v2/utils.hpp>
 #include <string>
@@ -44,6 +45,8 @@ void DatabaseHandler::init_sql() {
         throw std::logic_error("SQLite must be in serialized thread mode");
     }
 
+    this->convert_legacy_meter_values();
+
     auto get_stmt = this->database->new_statement("SELECT * FROM TRANSACTIONS");
     if (get_stmt->step() == SQLITE_ROW) {
         EVLOG_info << "Not clearing tables as there is an ongoing transaction";
@@ -56,8 +59,12 @@ void DatabaseHandler::inintialize_enum_tables() {
 
     // TODO: Don't throw away all meter value items to allow resuming transactions
     // Also we should add functionality then to clean up old/unknown transactions from the database
-    if (!this->database->clear_table("METER_VALUE_ITEMS") or !this->database->clear_table("METER_VALUES")) {
-        EVLOG_error << "Could not clear tables METER_VALUE_ITEMS or METER_VALUES";
+    {
+        std::lock_guard<std::mutex> lk(this->meter_value_codecs_mutex);
+        this->meter_value_codecs.clear();
+    }
+    if (!this->database->clear_table("TRANSACTION_METER_VALUES")) {
+        EVLOG_error << "Could not clear table TRANSACTION_METER_VALUES";
         throw QueryExecutionException(this->database->get_error_message());
     }
 
@@ -310,23 +317,63 @@ void DatabaseHandler::insert_or_update_local_authorization_list_entry(const IdTo
 
 void DatabaseHandler::insert_or_update_local_authorization_list(
     const std::vector<AuthorizationData>& local_authorization_list) {
-    bool success = true; // indicates if all database operations succeeded
+    auto transaction = this->database->begin_transaction();
+    this->write_local_authorization_list("AUTH_LIST", local_authorization_list);
+    transaction->commit();
+}
+
+void DatabaseHandler::replace_local_authorization_list(
+    const std::vector<AuthorizationData>& local_authorization_list) {
+    auto transaction = this->database->begin_transaction();
+
+    // The new list is written to AUTH_LIST_STAGING, so lookups keep seeing the complete previous list meanwhile. The
+    // staging table may contain a previous list if the last replacement was interrupted.
+    if (!this->database->clear_table("AUTH_LIST_STAGING")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    // entries without IdTokenInfo are deleted from the staging table, which does not contain them
+    this->write_local_authorization_list("AUTH_LIST_STAGING", local_authorization_list);
+
+    // Renaming the tables does not depend on the size of the lists. All statements are executed within one call of
+    // sqlite3_exec, which holds the connection mutex, so lookups of other threads always find an AUTH_LIST table.
+    if (!this->database->execute_statement("ALTER TABLE AUTH_LIST RENAME TO AUTH_LIST_PREVIOUS;"
+                                           "ALTER TABLE AUTH_LIST_STAGING RENAME TO AUTH_LIST;"
+                                           "ALTER TABLE AUTH_LIST_PREVIOUS RENAME TO AUTH_LIST_STAGING;")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    if (!this->database->clear_table("AUTH_LIST_STAGING")) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    transaction->commit();
+}
+
+void DatabaseHandler::write_local_authorization_list(const std::string& table,
+                                                     const std::vector<AuthorizationData>& local_authorization_list) {
+    auto insert_stmt = this->database->new_statement("INSERT OR REPLACE INTO " + table +
+                                                     " (ID_TOKEN_HASH, ID_TOKEN_INFO) "
+                                                     "VALUES (@id_token_hash, @id_token_info)");
+    auto delete_stmt = this->database->new_statement("DELETE FROM " + table + " WHERE ID_TOKEN_HASH = @id_token_hash;");
+
+    // reused for every entry, so it only grows until it fits the largest IdTokenInfo
+    std::string id_token_info;
     for (const auto& authorization_data : local_authorization_list) {
-        try {
-            if (authorization_data.idTokenInfo.has_value()) {
-                this->insert_or_update_local_authorization_list_entry(authorization_data.idToken,
-                                                                      authorization_data.idTokenInfo.value());
-            } else {
-                this->delete_local_authorization_list_entry(authorization_data.idToken);
-            }
-        } catch (const QueryExecutionException& e) {
-            // catch but continue with remaining entries
-            success = false;
+        auto& stmt = authorization_data.idTokenInfo.has_value() ? *insert_stmt : *delete_stmt;
+
+        stmt.bind_text("@id_token_hash", utils::generate_token_hash(authorization_data.idToken),
+                       SQLiteString::Transient);
+        if (authorization_data.idTokenInfo.has_value()) {
+            id_token_info.clear();
+            JsonWriter writer(id_token_info);
+            write_json(writer, authorization_data.idTokenInfo.value());
+            stmt.bind_text("@id_token_info", id_token_info, SQLiteString::Transient);
         }
-    }
 
-    if (!success) {
-        throw QueryExecutionException("At least one insertion or deletion of local authorization list entries failed");
+        if (stmt.step() != SQLITE_DONE) {
+            EVLOG_error << "Could not insert or delete local authorization list entry in " << table;
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+        stmt.reset();
     }
 }
 
@@ -384,246 +431,189 @@ void DatabaseHandler::transaction_metervalues_insert(const std::string& transact
         return;
     }
 
-    auto sampled_value_context = meter_value.sampledValue.at(0).context;
-    if (!sampled_value_context.has_value()) {
+    if (!meter_value.sampledValue.at(0).context.has_value()) {
         return;
     }
 
-    auto context = sampled_value_context.value();
-    if (std::find_if(meter_value.sampledValue.begin(), meter_value.sampledValue.end(), [context](const auto& item) {
-            return !item.context.has_value() or item.context.value() != context;
-        }) != meter_value.sampledValue.end()) {
-        throw std::invalid_argument("All metervalues must have the same context");
+    std::lock_guard<std::mutex> lk(this->meter_value_codecs_mutex);
+    auto codec = this->meter_value_codecs.find(transaction_id);
+    if (codec == this->meter_value_codecs.end()) {
+        codec = this->meter_value_codecs.emplace(transaction_id, this->restore_meter_value_codec(transaction_id)).first;
     }
 
-    const std::string sql1 =
-        "INSERT INTO METER_VALUES (TRANSACTION_ID, TIMESTAMP, READING_CONTEXT, CUSTOM_DATA) VALUES "
-        "(@transaction_id, @timestamp, @context, @custom_data)";
-
-    auto stmt = this->database->new_statement(sql1);
+    const auto record = codec->second.encode(meter_value);
 
+    auto stmt = this->database->new_statement(
+        "INSERT INTO TRANSACTION_METER_VALUES (TRANSACTION_ID, DATA) VALUES (@transaction_id, @data)");
     stmt->bind_text("@transaction_id", transaction_id);
-    stmt->bind_int64("@timestamp", to_unix_milliseconds(meter_value.timestamp));
-    stmt->bind_int("@context", static_cast<int>(context));
-    stmt->bind_null("@custom_data");
+    stmt->bind_blob("@data", record);
 
     if (stmt->step() != SQLITE_DONE) {
         EVLOG_warning << "Could not insert meter values into database";
+        // the codec already accounts for the record, it is restored from the stored records with the next insert
+        this->meter_value_codecs.erase(codec);
         throw QueryExecutionException(this->database->get_error_message());
     }
+}
 
-    auto last_row_id = this->database->get_last_inserted_rowid();
-    (*stmt).reset();
-
-    const std::string sql2 =
-        "INSERT INTO METER_VALUE_ITEMS (METER_VALUE_ID, VALUE, MEASURAND, PHASE, LOCATION, CUSTOM_DATA, "
-        "UNIT_CUSTOM_DATA, UNIT_TEXT, UNIT_MULTIPLIER, SIGNED_METER_DATA, SIGNING_METHOD, "
-        "ENCODING_METHOD, PUBLIC_KEY) VALUES (@meter_value_id, @value, @measurand, "
-        "@phase, @location, @custom_data, @unit_custom_data, @unit_text, @unit_multiplier, "
-        "@signed_meter_data, @signing_method, @encoding_method, @public_key);";
-
-    auto transaction = this->database->begin_transaction();
-    auto insert_stmt = this->database->new_statement(sql2);
-
-    for (const auto& item : meter_value.sampledValue) {
-        insert_stmt->bind_int("@meter_value_id", clamp_to<int>(last_row_id));
-        insert_stmt->bind_double("@value", item.value);
-
-        if (item.measurand.has_value()) {
-            insert_stmt->bind_int("@measurand", static_cast<int>(item.measurand.value()));
-        } else {
-            insert_stmt->bind_null("@measurand");
-        }
-
-        if (item.phase.has_value()) {
-            insert_stmt->bind_int("@phase", static_cast<int>(item.phase.value()));
-        } else {
-            insert_stmt->bind_null("@phase");
-        }
-
-        if (item.location.has_value()) {
-            insert_stmt->bind_int("@location", static_cast<int>(item.location.value()));
-        }
-
-        if (item.customData.has_value()) {
-            insert_stmt->bind_text("@custom_data", item.customData.value().at("vendorId").get<std::string>(),
-                                   SQLiteString::Transient);
-        }
-
-        if (item.unitOfMeasure.has_value()) {
-            const auto& unitOfMeasure = item.unitOfMeasure.value();
-
-            if (unitOfMeasure.customData.has_value()) {
-                insert_stmt->bind_text("@unit_custom_data",
-                                       unitOfMeasure.customData.value().at("vendorId").get<std::string>(),
-                                       SQLiteString::Transient);
-            }
-            if (unitOfMeasure.unit.has_value()) {
-                insert_stmt->bind_text("@unit_text", unitOfMeasure.unit.value().get(), SQLiteString::Transient);
-            }
-            if (unitOfMeasure.multiplier.has_value()) {
-                insert_stmt->bind_int("@unit_multiplier", unitOfMeasure.multiplier.value());
-            }
-        }
-
-        if (item.signedMeterValue.has_value()) {
-            const auto& signedMeterValue = item.signedMeterValue.value();
-
-            insert_stmt->bind_text("@signed_meter_data", signedMeterValue.signedMeterData.get(),
-                                   SQLiteString::Transient);
-            if (signedMeterValue.signingMethod.has_value()) {
-                insert_stmt->bind_text("@signing_method", signedMeterValue.signingMethod.value().get(),
-                                       SQLiteString::Transient);
-            } else {
-                insert_stmt->bind_null("@signing_method");
-            }
-            insert_stmt->bind_text("@encoding_method", signedMeterValue.encodingMethod.get(), SQLiteString::Transient);
-            if (signedMeterValue.publicKey.has_value()) {
-                insert_stmt->bind_text("@public_key", signedMeterValue.publicKey.value().get(),
-                                       SQLiteString::Transient);
-            } else {
-                insert_stmt->bind_null("@public_key");
-            }
-        } else {
-            insert_stmt->bind_null("@signed_meter_data");
-            insert_stmt->bind_null("@signing_method");
-            insert_stmt->bind_null("@encoding_method");
-            insert_stmt->bind_null("@public_key");
-        }
+std::vector<MeterValue> DatabaseHandler::transaction_metervalues_get_all(const std::string& transaction_id) {
+    std::vector<MeterValue> result;
+    MeterValueCodec codec;
+    this->for_each_meter_value_record(transaction_id, [&result, &codec](const std::vector<std::uint8_t>& record) {
+        result.push_back(codec.decode(record));
+    });
+    return result;
+}
 
-        if (insert_stmt->step() != SQLITE_DONE) {
-            throw QueryExecutionException(this->database->get_error_message());
-        }
+void DatabaseHandler::transaction_metervalues_clear(const std::string& transaction_id) {
+    std::lock_guard<std::mutex> lk(this->meter_value_codecs_mutex);
+    this->meter_value_codecs.erase(transaction_id);
 
-        (*insert_stmt).reset();
+    auto delete_stmt = this->database->new_statement(
+        "DELETE FROM TRANSACTION_METER_VALUES WHERE TRANSACTION_ID = @transaction_id");
+    delete_stmt->bind_text("@transaction_id", transaction_id);
+    if (delete_stmt->step() != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
     }
-
-    transaction->commit();
 }
 
-std::vector<MeterValue> DatabaseHandler::transaction_metervalues_get_all(const std::string& transaction_id) {
-
-    const std::string sql1 = "SELECT * FROM METER_VALUES WHERE TRANSACTION_ID = @transaction_id;";
-    const std::string sql2 = "SELECT * FROM METER_VALUE_ITEMS WHERE METER_VALUE_ID = @row_id;";
-    auto select_stmt = this->database->new_statement(sql1);
-    auto select_stmt2 = this->database->new_statement(sql2);
+MeterValueCodec DatabaseHandler::restore_meter_value_codec(const std::string& transaction_id) {
+    MeterValueCodec codec;
+    this->for_each_meter_value_record(
+        transaction_id, [&codec](const std::vector<std::uint8_t>& record) { codec.decode(record); });
+    return codec;
+}
 
+void DatabaseHandler::for_each_meter_value_record(
+    const std::string& transaction_id, const std::function<void(const std::vector<std::uint8_t>&)>& handle_record) {
+    auto select_stmt = this->database->new_statement(
+        "SELECT DATA FROM TRANSACTION_METER_VALUES WHERE TRANSACTION_ID = @transaction_id ORDER BY ID");
     select_stmt->bind_text("@transaction_id", transaction_id);
 
-    std::vector<MeterValue> result;
-
     int status = SQLITE_ERROR;
     while ((status = select_stmt->step()) == SQLITE_ROW) {
-        MeterValue value;
-        value.timestamp = from_unix_milliseconds(select_stmt->column_int64(2));
+        handle_record(select_stmt->column_blob(0));
+    }
 
-        if (select_stmt->column_type(4) == SQLITE_TEXT) {
-            value.customData = CustomData{select_stmt->column_text(4)};
-        }
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+}
 
-        auto row_id = select_stmt->column_int(0);
-        auto context = static_cast<ReadingContextEnum>(select_stmt->column_int(3));
+void DatabaseHandler::convert_legacy_meter_values() {
+    {
+        auto table_stmt = this->database->new_statement(
+            "SELECT name FROM sqlite_master WHERE type='table' AND name='LEGACY_METER_VALUES'");
+        if (table_stmt->step() != SQLITE_ROW) {
+            return;
+        }
+    }
 
-        select_stmt2->bind_int("@row_id", row_id);
+    auto transaction = this->database->begin_transaction();
 
-        while ((status = select_stmt2->step()) == SQLITE_ROW) {
-            SampledValue sampled_value;
+    std::size_t converted = 0;
+    {
+        // the statements have to be finalized before the legacy tables can be dropped
+        auto select_stmt = this->database->new_statement(
+            "SELECT ROWID, TRANSACTION_ID, TIMESTAMP, READING_CONTEXT FROM LEGACY_METER_VALUES ORDER BY ROWID");
+        auto select_items_stmt = this->database->new_statement(
+            "SELECT VALUE, MEASURAND, PHASE, LOCATION, CUSTOM_DATA, UNIT_CUSTOM_DATA, UNIT_TEXT, UNIT_MULTIPLIER, "
+            "SIGNED_METER_DATA, SIGNING_METHOD, ENCODING_METHOD, PUBLIC_KEY FROM LEGACY_METER_VALUE_ITEMS WHERE "
+            "METER_VALUE_ID = @row_id ORDER BY ROWID");
+        auto insert_stmt = this->database->new_statement(
+            "INSERT INTO TRANSACTION_METER_VALUES (TRANSACTION_ID, DATA) VALUES (@transaction_id, @data)");
+
+        std::map<std::string, MeterValueCodec> codecs;
+
+        int status = SQLITE_ERROR;
+        while ((status = select_stmt->step()) == SQLITE_ROW) {
+            const auto transaction_id = select_stmt->column_text(1);
+            MeterValue value;
+            value.timestamp = from_unix_milliseconds(select_stmt->column_int64(2));
+            const auto context = static_cast<ReadingContextEnum>(select_stmt->column_int(3));
+
+            select_items_stmt->reset();
+            select_items_stmt->bind_int64("@row_id", select_stmt->column_int64(0));
+
+            int items_status = SQLITE_ERROR;
+            while ((items_status = select_items_stmt->step()) == SQLITE_ROW) {
+                SampledValue sampled_value;
+                sampled_value.value = clamp_to<float>(select_items_stmt->column_double(0));
+                sampled_value.context = context;
+
+                if (select_items_stmt->column_type(1) == SQLITE_INTEGER) {
+                    sampled_value.measurand = static_cast<MeasurandEnum>(select_items_stmt->column_int(1));
+                }
+                if (select_items_stmt->column_type(2) == SQLITE_INTEGER) {
+                    sampled_value.phase = static_cast<PhaseEnum>(select_items_stmt->column_int(2));
+                }
+                if (select_items_stmt->column_type(3) == SQLITE_INTEGER) {
+                    sampled_value.location = static_cast<LocationEnum>(select_items_stmt->column_int(3));
+                }
+                if (select_items_stmt->column_type(4) == SQLITE_TEXT) {
+                    sampled_value.customData = CustomData{select_items_stmt->column_text(4)};
+                }
 
-            sampled_value.value = clamp_to<float>(select_stmt2->column_double(1));
-            sampled_value.context = context;
+                if (select_items_stmt->column_type(5) == SQLITE_TEXT or
+                    select_items_stmt->column_type(6) == SQLITE_TEXT or
+                    select_items_stmt->column_type(7) == SQLITE_INTEGER) {
+                    UnitOfMeasure unit;
+                    if (select_items_stmt->column_type(5) == SQLITE_TEXT) {
+                        unit.customData = CustomData{select_items_stmt->column_text(5)};
+                    }
+                    if (select_items_stmt->column_type(6) == SQLITE_TEXT) {
+                        unit.unit = select_items_stmt->column_text(6);
+                    }
+                    if (select_items_stmt->column_type(7) == SQLITE_INTEGER) {
+                        unit.multiplier = select_items_stmt->column_int(7);
+                    }
+                    sampled_value.unitOfMeasure.emplace(unit);
+                }
 
-            if (select_stmt2->column_type(2) == SQLITE_INTEGER) {
-                sampled_value.measurand = static_cast<MeasurandEnum>(select_stmt2->column_int(2));
-            }
+                if (select_items_stmt->column_type(8) == SQLITE_TEXT and
+                    select_items_stmt->column_type(9) == SQLITE_TEXT and
+                    select_items_stmt->column_type(10) == SQLITE_TEXT and
+                    select_items_stmt->column_type(11) == SQLITE_TEXT) {
+                    SignedMeterValue signed_meter_value;
+                    signed_meter_value.signedMeterData = select_items_stmt->column_text(8);
+                    signed_meter_value.signingMethod = select_items_stmt->column_text(9);
+                    signed_meter_value.encodingMethod = select_items_stmt->column_text(10);
+                    signed_meter_value.publicKey = select_items_stmt->column_text(11);
+                    sampled_value.signedMeterValue.emplace(signed_meter_value);
+                }
 
-            if (select_stmt2->column_type(3) == SQLITE_INTEGER) {
-                sampled_value.phase = static_cast<PhaseEnum>(select_stmt2->column_int(3));
+                value.sampledValue.push_back(std::move(sampled_value));
             }
 
-            if (select_stmt2->column_type(4) == SQLITE_INTEGER) {
-                sampled_value.location = static_cast<LocationEnum>(select_stmt2->column_int(4));
+            if (items_status != SQLITE_DONE) {
+                throw QueryExecutionException(this->database->get_error_message());
             }
 
-            if (select_stmt2->column_type(5) == SQLITE_TEXT) {
-                sampled_value.customData = CustomData{select_stmt->column_text(5)};
+            if (value.sampledValue.empty()) {
+                continue;
             }
 
-            if (select_stmt2->column_type(6) == SQLITE_TEXT or select_stmt2->column_type(7) == SQLITE_TEXT or
-                select_stmt2->column_type(8) == SQLITE_INTEGER) {
-                UnitOfMeasure unit;
-                if (select_stmt2->column_type(6) == SQLITE_TEXT) {
-                    unit.customData = CustomData{select_stmt2->column_text(6)};
-                }
-                if (select_stmt2->column_type(7) == SQLITE_TEXT) {
-                    unit.unit = select_stmt2->column_text(7);
-                }
-                if (select_stmt2->column_type(8) == SQLITE_INTEGER) {
-                    unit.multiplier = select_stmt2->column_int(8);
-                }
-                sampled_value.unitOfMeasure.emplace(unit);
+            insert_stmt->reset();
+            insert_stmt->bind_text("@transaction_id", transaction_id, SQLiteString::Transient);
+            insert_stmt->bind_blob("@data", codecs[transaction_id].encode(value), SQLiteString::Transient);
+            if (insert_stmt->step() != SQLITE_DONE) {
+                throw QueryExecutionException(this->database->get_error_message());
             }
-
-            if (select_stmt2->column_type(9) == SQLITE_TEXT and select_stmt2->column_type(10) == SQLITE_TEXT and
-                select_stmt2->column_type(11) == SQLITE_TEXT and select_stmt2->column_type(12) == SQLITE_TEXT) {
-                SignedMeterValue signed_meter_value;
-                signed_meter_value.signedMeterData = select_stmt2->column_text(9);
-                signed_meter_value.signingMethod = select_stmt2->column_text(10);
-                signed_meter_value.encodingMethod = select_stmt2->column_text(11);
-                signed_meter_value.publicKey = select_stmt2->column_text(12);
-
-                sampled_value.signedMeterValue.emplace(signed_meter_value);
-            }
-
-            value.sampledValue.push_back(std::move(sampled_value));
+            converted++;
         }
 
         if (status != SQLITE_DONE) {
             throw QueryExecutionException(this->database->get_error_message());
         }
-
-        result.push_back(std::move(value));
-
-        (*select_stmt2).reset();
     }
 
-    if (status != SQLITE_DONE) {
+    if (!this->database->execute_statement("DROP TABLE LEGACY_METER_VALUE_ITEMS") or
+        !this->database->execute_statement("DROP TABLE LEGACY_METER_VALUES")) {
         throw QueryExecutionException(this->database->get_error_message());
     }
 
-    return result;
-}
-
-void DatabaseHandler::transaction_metervalues_clear(const std::string& transaction_id) {
-
-    const std::string sql1 = "SELECT ROWID FROM METER_VALUES WHERE TRANSACTION_ID = @transaction_id;";
-
-    auto select_stmt = this->database->new_statement(sql1);
-
-    select_stmt->bind_text("@transaction_id", transaction_id);
-
-    const std::string sql2 = "DELETE FROM METER_VALUE_ITEMS WHERE METER_VALUE_ID = @row_id";
-    auto delete_stmt = this->database->new_statement(sql2);
-    int status = SQLITE_ERROR;
-    while ((status = select_stmt->step()) == SQLITE_ROW) {
-        auto row_id = select_stmt->column_int(0);
-        delete_stmt->bind_int("@row_id", row_id);
-
-        if (delete_stmt->step() != SQLITE_DONE) {
-            throw QueryExecutionException(this->database->get_error_message());
-        }
-        (*delete_stmt).reset();
-    }
-
-    if (status != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
-
-    const std::string sql3 = "DELETE FROM METER_VALUES WHERE TRANSACTION_ID = @transaction_id";
-    auto delete_stmt2 = this->database->new_statement(sql3);
-    delete_stmt2->bind_text("@transaction_id", transaction_id);
-    if (delete_stmt2->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    transaction->commit();
+    EVLOG_info << "Converted " << converted << " stored meter values to the compact format";
 }
 
 void DatabaseHandler::insert_cs_availability(OperationalStatusEnum operational_status, bool replace) {
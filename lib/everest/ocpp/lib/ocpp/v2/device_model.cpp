@@ -417,13 +417,36 @@ std::optional<VariableMetaData> DeviceModel::get_variable_meta_data(const Compon
 
 std::vector<ReportData> DeviceModel::get_base_report_data(const ReportBaseEnum& report_base) {
     std::vector<ReportData> report_data_vec;
+    this->visit_base_report_data(report_base, [&report_data_vec](const ReportData& report_data) {
+        report_data_vec.push_back(report_data);
+        return true;
+    });
+    return report_data_vec;
+}
+
+std::vector<ReportData>
+DeviceModel::get_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
+                                    const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria) {
+    std::vector<ReportData> report_data_vec;
+    this->visit_custom_report_data(component_variables, component_criteria,
+                                   [&report_data_vec](const ReportData& report_data) {
+                                       report_data_vec.push_back(report_data);
+                                       return true;
+                                   });
+    return report_data_vec;
+}
+
+void DeviceModel::visit_base_report_data(const ReportBaseEnum& report_base, const ReportDataVisitor& visitor) {
+    // a single ReportData is reused for all variables, so only one of them is held in memory at a time
+    ReportData report_data;
 
     for (const auto& [component, variable_map] : this->device_model_map) {
         for (const auto& [variable, variable_meta_data] : variable_map) {
 
-            ReportData report_data;
             report_data.component = component;
             report_data.variable = variable;
+            report_data.variableAttribute.clear();
+            report_data.variableCharacteristics.reset();
 
             ComponentVariable cv;
             cv.component = component;
@@ -443,25 +466,24 @@ std::vector<ReportData> DeviceModel::get_base_report_data(const ReportBaseEnum&
                     if (variable_attribute.mutability == MutabilityEnum::WriteOnly) {
                         report_data.variableAttribute.back().value.reset();
                     }
-                    report_data.variableCharacteristics = variable_map.at(variable).characteristics;
+                    report_data.variableCharacteristics = variable_meta_data.characteristics;
                 } else if (report_base == ReportBaseEnum::SummaryInventory) {
                     if (include_in_summary_inventory(cv, variable_attribute)) {
                         report_data.variableAttribute.push_back(variable_attribute);
                     }
                 }
             }
-            if (!report_data.variableAttribute.empty()) {
-                report_data_vec.push_back(report_data);
+            if (!report_data.variableAttribute.empty() and !visitor(report_data)) {
+                return;
             }
         }
     }
-    return report_data_vec;
 }
 
-std::vector<ReportData>
-DeviceModel::get_custom_report_data(const std::optional<std::vector<ComponentVariable>>& component_variables,
-                                    const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria) {
-    std::vector<ReportData> report_data_vec;
+void DeviceModel::visit_custom_report_data(
+    const std::optional<std::vector<ComponentVariable>>& component_variables,
+    const std::optional<std::vector<ComponentCriterionEnum>>& component_criteria, const ReportDataVisitor& visitor) {
+    ReportData report_data;
 
     for (const auto& [component, variable_map] : this->device_model_map) {
         if (!component_criteria.has_value() or component_criteria_match(component, component_criteria.value())) {
@@ -469,26 +491,26 @@ DeviceModel::get_custom_report_data(const std::optional<std::vector<ComponentVar
             for (const auto& [variable, variable_meta_data] : variable_map) {
                 if (!component_variables.has_value() or
                     component_variables_match(component_variables.value(), component, variable)) {
-                    ReportData report_data;
                     report_data.component = component;
                     report_data.variable = variable;
+                    report_data.variableAttribute.clear();
+                    report_data.variableCharacteristics.reset();
 
                     //  request the variable attribute from the device model
                     const auto variable_attributes = this->device_model->get_variable_attributes(component, variable);
 
                     for (const auto& variable_attribute : variable_attributes) {
                         report_data.variableAttribute.push_back(variable_attribute);
-                        report_data.variableCharacteristics = variable_map.at(variable).characteristics;
+                        report_data.variableCharacteristics = variable_meta_data.characteristics;
                     }
 
-                    if (!report_data.variableAttribute.empty()) {
-                        report_data_vec.push_back(report_data);
+                    if (!report_data.variableAttribute.empty() and !visitor(report_data)) {
+                        return;
                     }
                 }
             }
         }
     }
-    return report_data_vec;
 }
 
 void DeviceModel::check_integrity(const std::map<std::int32_t, std::int32_t>& evse_connector_structure) {
@@ -573,8 +573,7 @@ ocpp::v2::Authorization::apply_local_authorization_list(const SendLocalListReque
             if (!has_duplicate_in_list(list) and
                 std::find_if(list.begin(), list.end(), has_no_token_info) == list.end()) {
                 try {
-                    this->context.database_handler.clear_local_authorization_list();
-                    this->context.database_handler.insert_or_update_local_authorization_list(list);
+                    this->context.database_handler.replace_local_authorization_list(list);
                     status = SendLocalListStatusEnum::Accepted;
                 } catch (const everest::db::Exception& e) {
                     status = SendLocalListStatusEnum::Failed;
@@ -10,7 +10,7 @@
 #include <ocpp/v2/ctrlr_component_variables.hpp>
 #include <ocpp/v2/evse_manager.hpp>
 #include <ocpp/v2/functional_blocks/functional_block_context.hpp>
-#include <ocpp/v2/notify_report_requests_splitter.hpp>
+#include <ocpp/v2/notify_report_streamer.hpp>
 
 #include <ocpp/v2/functional_blocks/availability.hpp>
 #include <ocpp/v2/functional_blocks/diagnostics.hpp>
@@ -163,27 +163,27 @@ Provisioning::set_variables(const std::vector<SetVariableData>& set_variable_dat
     return response;
 }
 
-void Provisioning::notify_report_req(const int request_id, const std::vector<ReportData>& report_data) {
-    NotifyReportRequest req;
-    req.requestId = request_id;
-    req.seqNo = 0;
-    req.generatedAt = ocpp::DateTime();
-    req.reportData.emplace(report_data);
-    req.tbc = false;
-
-    if (report_data.size() <= 1) {
-        const ocpp::Call<NotifyReportRequest> call(req);
-        this->context.message_dispatcher.dispatch_call(call);
-    } else {
-        NotifyReportRequestsSplitter splitter{
-            req,
-            this->context.device_model.get_optional_value<size_t>(ControllerComponentVariables::MaxMessageSize)
-                .value_or(DEFAULT_MAX_MESSAGE_SIZE),
-            []() { return ocpp::create_message_id(); }};
-        for (const auto& msg : splitter.create_call_payloads()) {
-            this->message_queue.push_call(msg);
-        }
-    }
+void Provisioning::notify_report_req(
+    const int request_id, const std::function<void(const ReportDataVisitor& visitor)>& visit_report_data) {
+    // the ItemsPerMessage limit of GetReport.req is applied to the NotifyReport.req as well, so a CSMS that restricts
+    // the items it asks for is not sent more items per message than that
+    const auto max_items_per_message =
+        this->context.device_model.get_value<int>(ControllerComponentVariables::ItemsPerMessageGetReport);
+    NotifyReportStreamer streamer{
+        request_id,
+        this->context.device_model.get_optional_value<size_t>(ControllerComponentVariables::MaxMessageSize)
+            .value_or(DEFAULT_MAX_MESSAGE_SIZE),
+        max_items_per_message > 0 ? static_cast<size_t>(max_items_per_message) : 0,
+        []() { return ocpp::create_message_id(); },
+        [this](const json& call, std::string serialized_call) {
+            this->context.message_dispatcher.dispatch_serialized_call(call, std::move(serialized_call));
+        }};
+
+    visit_report_data([&streamer](const ReportData& report_data) {
+        streamer.add(report_data);
+        return true;
+    });
+    streamer.finish();
 }
 
 void Provisioning::handle_boot_notification_response(CallResult<BootNotificationResponse> call_result) {
@@ -301,15 +301,15 @@ void Provisioning::handle_get_base_report_req(Call<GetBaseReportRequest> call) {
     this->context.message_dispatcher.dispatch_call_result(call_result);
 
     if (response.status == GenericDeviceModelStatusEnum::Accepted) {
-        const auto report_data = this->context.device_model.get_base_report_data(msg.reportBase);
-        this->notify_report_req(msg.requestId, report_data);
+        this->notify_report_req(msg.requestId, [this, &msg](const ReportDataVisitor& visitor) {
+            this->context.device_model.visit_base_report_data(msg.reportBase, visitor);
+        });
     }
 }
 
 void Provisioning::handle_get_report_req(const EnhancedMessage<MessageType>& message) {
     const Call<GetReportRequest> call = message.call_message;
     const auto msg = call.msg;
-    std::vector<ReportData> report_data;
     GetReportResponse response;
 
     const auto max_items_per_message =
@@ -350,10 +350,14 @@ void Provisioning::handle_get_report_req(const EnhancedMessage<MessageType>& mes
 
     if (response.status != GenericDeviceModelStatusEnum::NotSupported) {
 
-        // TODO(piet): Propably split this up into several NotifyReport.req depending on ItemsPerMessage /
-        // BytesPerMessage
-        report_data = this->context.device_model.get_custom_report_data(msg.componentVariable, msg.componentCriteria);
-        if (report_data.empty()) {
+        // only look for the first ReportData here, the report is streamed after the response has been sent
+        bool report_data_empty = true;
+        this->context.device_model.visit_custom_report_data(msg.componentVariable, msg.componentCriteria,
+                                                            [&report_data_empty](const ReportData&) {
+                                                                report_data_empty = false;
+                                                                return false;
+                                                            });
+        if (report_data_empty) {
             response.status = GenericDeviceModelStatusEnum::EmptyResultSet;
         } else {
             response.status = GenericDeviceModelStatusEnum::Accepted;
@@ -364,7 +368,9 @@ void Provisioning::handle_get_report_req(const EnhancedMessage<MessageType>& mes
     this->context.message_dispatcher.dispatch_call_result(call_result);
 
     if (response.status == GenericDeviceModelStatusEnum::Accepted) {
-        this->notify_report_req(msg.requestId, report_data);
+        this->notify_report_req(msg.requestId, [this, &msg](const ReportDataVisitor& visitor) {
+            this->context.device_model.visit_custom_report_data(msg.componentVariable, msg.componentCriteria, visitor);
+        });
     }
 }
 
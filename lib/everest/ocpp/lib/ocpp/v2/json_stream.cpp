@@ -0,0 +1,1787 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+// This code is generated using the generator in 'src/code_generator/common`, please do not edit manually
+
+#include <ocpp/v2/json_stream.hpp>
+
+#include <ocpp/v2/ocpp_enums.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+void write_json(JsonWriter& writer, const EVSE& k) {
+    writer.begin_object();
+    writer.key("id");
+    write_json(writer, k.id);
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, EVSE& k) {
+    bool has_id = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "id") {
+            read_json(reader, k.id);
+            has_id = true;
+        } else if (key == "connectorId") {
+            read_json(reader, k.connectorId.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_id, "id");
+}
+
+void write_json(JsonWriter& writer, const Component& k) {
+    writer.begin_object();
+    writer.key("name");
+    write_json(writer, k.name);
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.instance) {
+        writer.key("instance");
+        write_json(writer, k.instance.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Component& k) {
+    bool has_name = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "name") {
+            read_json(reader, k.name);
+            has_name = true;
+        } else if (key == "evse") {
+            read_json(reader, k.evse.emplace());
+        } else if (key == "instance") {
+            read_json(reader, k.instance.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_name, "name");
+}
+
+void write_json(JsonWriter& writer, const Variable& k) {
+    writer.begin_object();
+    writer.key("name");
+    write_json(writer, k.name);
+    if (k.instance) {
+        writer.key("instance");
+        write_json(writer, k.instance.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Variable& k) {
+    bool has_name = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "name") {
+            read_json(reader, k.name);
+            has_name = true;
+        } else if (key == "instance") {
+            read_json(reader, k.instance.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_name, "name");
+}
+
+void write_json(JsonWriter& writer, const GetVariableData& k) {
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariableData& k) {
+    bool has_component = false;
+    bool has_variable = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "component") {
+            read_json(reader, k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            read_json(reader, k.variable);
+            has_variable = true;
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_component, "component");
+    reader.require(has_variable, "variable");
+}
+
+void write_json(JsonWriter& writer, const GetVariablesRequest& k) {
+    writer.begin_object();
+    writer.key("getVariableData");
+    write_json(writer, k.getVariableData);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariablesRequest& k) {
+    bool has_getVariableData = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "getVariableData") {
+            read_json(reader, k.getVariableData);
+            has_getVariableData = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_getVariableData, "getVariableData");
+}
+
+void write_json(JsonWriter& writer, const StatusInfo& k) {
+    writer.begin_object();
+    writer.key("reasonCode");
+    write_json(writer, k.reasonCode);
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        write_json(writer, k.additionalInfo.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, StatusInfo& k) {
+    bool has_reasonCode = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "reasonCode") {
+            read_json(reader, k.reasonCode);
+            has_reasonCode = true;
+        } else if (key == "additionalInfo") {
+            read_json(reader, k.additionalInfo.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_reasonCode, "reasonCode");
+}
+
+void write_json(JsonWriter& writer, const GetVariableResult& k) {
+    writer.begin_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::get_variable_status_enum_to_string(k.attributeStatus));
+    writer.key("component");
+    write_json(writer, k.component);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeValue) {
+        writer.key("attributeValue");
+        write_json(writer, k.attributeValue.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariableResult& k) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "attributeStatus") {
+            k.attributeStatus = conversions::string_to_get_variable_status_enum(reader.read_string());
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            read_json(reader, k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            read_json(reader, k.variable);
+            has_variable = true;
+        } else if (key == "attributeStatusInfo") {
+            read_json(reader, k.attributeStatusInfo.emplace());
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "attributeValue") {
+            read_json(reader, k.attributeValue.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_attributeStatus, "attributeStatus");
+    reader.require(has_component, "component");
+    reader.require(has_variable, "variable");
+}
+
+void write_json(JsonWriter& writer, const GetVariablesResponse& k) {
+    writer.begin_object();
+    writer.key("getVariableResult");
+    write_json(writer, k.getVariableResult);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, GetVariablesResponse& k) {
+    bool has_getVariableResult = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "getVariableResult") {
+            read_json(reader, k.getVariableResult);
+            has_getVariableResult = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_getVariableResult, "getVariableResult");
+}
+
+void write_json(JsonWriter& writer, const SignedMeterValue& k) {
+    writer.begin_object();
+    writer.key("signedMeterData");
+    write_json(writer, k.signedMeterData);
+    writer.key("encodingMethod");
+    write_json(writer, k.encodingMethod);
+    if (k.signingMethod) {
+        writer.key("signingMethod");
+        write_json(writer, k.signingMethod.value());
+    }
+    if (k.publicKey) {
+        writer.key("publicKey");
+        write_json(writer, k.publicKey.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SignedMeterValue& k) {
+    bool has_signedMeterData = false;
+    bool has_encodingMethod = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "signedMeterData") {
+            read_json(reader, k.signedMeterData);
+            has_signedMeterData = true;
+        } else if (key == "encodingMethod") {
+            read_json(reader, k.encodingMethod);
+            has_encodingMethod = true;
+        } else if (key == "signingMethod") {
+            read_json(reader, k.signingMethod.emplace());
+        } else if (key == "publicKey") {
+            read_json(reader, k.publicKey.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_signedMeterData, "signedMeterData");
+    reader.require(has_encodingMethod, "encodingMethod");
+}
+
+void write_json(JsonWriter& writer, const UnitOfMeasure& k) {
+    writer.begin_object();
+    if (k.unit) {
+        writer.key("unit");
+        write_json(writer, k.unit.value());
+    }
+    if (k.multiplier) {
+        writer.key("multiplier");
+        write_json(writer, k.multiplier.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, UnitOfMeasure& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "unit") {
+            read_json(reader, k.unit.emplace());
+        } else if (key == "multiplier") {
+            read_json(reader, k.multiplier.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.begin_object();
+    writer.key("value");
+    write_json(writer, k.value);
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_enum_to_string(k.measurand.value()));
+    }
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_enum_to_string(k.context.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_enum_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_enum_to_string(k.location.value()));
+    }
+    if (k.signedMeterValue) {
+        writer.key("signedMeterValue");
+        write_json(writer, k.signedMeterValue.value());
+    }
+    if (k.unitOfMeasure) {
+        writer.key("unitOfMeasure");
+        write_json(writer, k.unitOfMeasure.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SampledValue& k) {
+    bool has_value = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "value") {
+            read_json(reader, k.value);
+            has_value = true;
+        } else if (key == "measurand") {
+            k.measurand.emplace(conversions::string_to_measurand_enum(reader.read_string()));
+        } else if (key == "context") {
+            k.context.emplace(conversions::string_to_reading_context_enum(reader.read_string()));
+        } else if (key == "phase") {
+            k.phase.emplace(conversions::string_to_phase_enum(reader.read_string()));
+        } else if (key == "location") {
+            k.location.emplace(conversions::string_to_location_enum(reader.read_string()));
+        } else if (key == "signedMeterValue") {
+            read_json(reader, k.signedMeterValue.emplace());
+        } else if (key == "unitOfMeasure") {
+            read_json(reader, k.unitOfMeasure.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_value, "value");
+}
+
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.begin_object();
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValue& k) {
+    bool has_sampledValue = false;
+    bool has_timestamp = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "sampledValue") {
+            read_json(reader, k.sampledValue);
+            has_sampledValue = true;
+        } else if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_sampledValue, "sampledValue");
+    reader.require(has_timestamp, "timestamp");
+}
+
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.begin_object();
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    writer.key("meterValue");
+    write_json(writer, k.meterValue);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesRequest& k) {
+    bool has_evseId = false;
+    bool has_meterValue = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "evseId") {
+            read_json(reader, k.evseId);
+            has_evseId = true;
+        } else if (key == "meterValue") {
+            read_json(reader, k.meterValue);
+            has_meterValue = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_evseId, "evseId");
+    reader.require(has_meterValue, "meterValue");
+}
+
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MeterValuesResponse& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const VariableAttribute& k) {
+    writer.begin_object();
+    if (k.type) {
+        writer.key("type");
+        writer.value(conversions::attribute_enum_to_string(k.type.value()));
+    }
+    if (k.value) {
+        writer.key("value");
+        write_json(writer, k.value.value());
+    }
+    if (k.mutability) {
+        writer.key("mutability");
+        writer.value(conversions::mutability_enum_to_string(k.mutability.value()));
+    }
+    if (k.persistent) {
+        writer.key("persistent");
+        write_json(writer, k.persistent.value());
+    }
+    if (k.constant) {
+        writer.key("constant");
+        write_json(writer, k.constant.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, VariableAttribute& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "type") {
+            k.type.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "value") {
+            // like from_json, booleans, numbers and structured values are stored as their JSON text
+            k.value.emplace(reader.read_value_as_string());
+        } else if (key == "mutability") {
+            k.mutability.emplace(conversions::string_to_mutability_enum(reader.read_string()));
+        } else if (key == "persistent") {
+            read_json(reader, k.persistent.emplace());
+        } else if (key == "constant") {
+            read_json(reader, k.constant.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const VariableCharacteristics& k) {
+    writer.begin_object();
+    writer.key("dataType");
+    writer.value(conversions::data_enum_to_string(k.dataType));
+    writer.key("supportsMonitoring");
+    write_json(writer, k.supportsMonitoring);
+    if (k.unit) {
+        writer.key("unit");
+        write_json(writer, k.unit.value());
+    }
+    if (k.minLimit) {
+        writer.key("minLimit");
+        write_json(writer, k.minLimit.value());
+    }
+    if (k.maxLimit) {
+        writer.key("maxLimit");
+        write_json(writer, k.maxLimit.value());
+    }
+    if (k.maxElements) {
+        writer.key("maxElements");
+        write_json(writer, k.maxElements.value());
+    }
+    if (k.valuesList) {
+        writer.key("valuesList");
+        write_json(writer, k.valuesList.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, VariableCharacteristics& k) {
+    bool has_dataType = false;
+    bool has_supportsMonitoring = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "dataType") {
+            k.dataType = conversions::string_to_data_enum(reader.read_string());
+            has_dataType = true;
+        } else if (key == "supportsMonitoring") {
+            read_json(reader, k.supportsMonitoring);
+            has_supportsMonitoring = true;
+        } else if (key == "unit") {
+            read_json(reader, k.unit.emplace());
+        } else if (key == "minLimit") {
+            read_json(reader, k.minLimit.emplace());
+        } else if (key == "maxLimit") {
+            read_json(reader, k.maxLimit.emplace());
+        } else if (key == "maxElements") {
+            read_json(reader, k.maxElements.emplace());
+        } else if (key == "valuesList") {
+            read_json(reader, k.valuesList.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_dataType, "dataType");
+    reader.require(has_supportsMonitoring, "supportsMonitoring");
+}
+
+void write_json(JsonWriter& writer, const ReportData& k) {
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.key("variableAttribute");
+    write_json(writer, k.variableAttribute);
+    if (k.variableCharacteristics) {
+        writer.key("variableCharacteristics");
+        write_json(writer, k.variableCharacteristics.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ReportData& k) {
+    bool has_component = false;
+    bool has_variable = false;
+    bool has_variableAttribute = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "component") {
+            read_json(reader, k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            read_json(reader, k.variable);
+            has_variable = true;
+        } else if (key == "variableAttribute") {
+            read_json(reader, k.variableAttribute);
+            has_variableAttribute = true;
+        } else if (key == "variableCharacteristics") {
+            read_json(reader, k.variableCharacteristics.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_component, "component");
+    reader.require(has_variable, "variable");
+    reader.require(has_variableAttribute, "variableAttribute");
+}
+
+void write_json(JsonWriter& writer, const NotifyReportRequest& k) {
+    writer.begin_object();
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.key("generatedAt");
+    write_json(writer, k.generatedAt);
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    if (k.reportData) {
+        writer.key("reportData");
+        write_json(writer, k.reportData.value());
+    }
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyReportRequest& k) {
+    bool has_requestId = false;
+    bool has_generatedAt = false;
+    bool has_seqNo = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "requestId") {
+            read_json(reader, k.requestId);
+            has_requestId = true;
+        } else if (key == "generatedAt") {
+            read_json(reader, k.generatedAt);
+            has_generatedAt = true;
+        } else if (key == "seqNo") {
+            read_json(reader, k.seqNo);
+            has_seqNo = true;
+        } else if (key == "reportData") {
+            read_json(reader, k.reportData.emplace());
+        } else if (key == "tbc") {
+            read_json(reader, k.tbc.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_requestId, "requestId");
+    reader.require(has_generatedAt, "generatedAt");
+    reader.require(has_seqNo, "seqNo");
+}
+
+void write_json(JsonWriter& writer, const NotifyReportResponse& k) {
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, NotifyReportResponse& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const SetVariableData& k) {
+    writer.begin_object();
+    writer.key("attributeValue");
+    write_json(writer, k.attributeValue);
+    writer.key("component");
+    write_json(writer, k.component);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariableData& k) {
+    bool has_attributeValue = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "attributeValue") {
+            read_json(reader, k.attributeValue);
+            has_attributeValue = true;
+        } else if (key == "component") {
+            read_json(reader, k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            read_json(reader, k.variable);
+            has_variable = true;
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_attributeValue, "attributeValue");
+    reader.require(has_component, "component");
+    reader.require(has_variable, "variable");
+}
+
+void write_json(JsonWriter& writer, const SetVariablesRequest& k) {
+    writer.begin_object();
+    writer.key("setVariableData");
+    write_json(writer, k.setVariableData);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariablesRequest& k) {
+    bool has_setVariableData = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "setVariableData") {
+            read_json(reader, k.setVariableData);
+            has_setVariableData = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_setVariableData, "setVariableData");
+}
+
+void write_json(JsonWriter& writer, const SetVariableResult& k) {
+    writer.begin_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::set_variable_status_enum_to_string(k.attributeStatus));
+    writer.key("component");
+    write_json(writer, k.component);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariableResult& k) {
+    bool has_attributeStatus = false;
+    bool has_component = false;
+    bool has_variable = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "attributeStatus") {
+            k.attributeStatus = conversions::string_to_set_variable_status_enum(reader.read_string());
+            has_attributeStatus = true;
+        } else if (key == "component") {
+            read_json(reader, k.component);
+            has_component = true;
+        } else if (key == "variable") {
+            read_json(reader, k.variable);
+            has_variable = true;
+        } else if (key == "attributeType") {
+            k.attributeType.emplace(conversions::string_to_attribute_enum(reader.read_string()));
+        } else if (key == "attributeStatusInfo") {
+            read_json(reader, k.attributeStatusInfo.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_attributeStatus, "attributeStatus");
+    reader.require(has_component, "component");
+    reader.require(has_variable, "variable");
+}
+
+void write_json(JsonWriter& writer, const SetVariablesResponse& k) {
+    writer.begin_object();
+    writer.key("setVariableResult");
+    write_json(writer, k.setVariableResult);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, SetVariablesResponse& k) {
+    bool has_setVariableResult = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "setVariableResult") {
+            read_json(reader, k.setVariableResult);
+            has_setVariableResult = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_setVariableResult, "setVariableResult");
+}
+
+void write_json(JsonWriter& writer, const TransactionLimit& k) {
+    writer.begin_object();
+    if (k.maxCost) {
+        writer.key("maxCost");
+        write_json(writer, k.maxCost.value());
+    }
+    if (k.maxEnergy) {
+        writer.key("maxEnergy");
+        write_json(writer, k.maxEnergy.value());
+    }
+    if (k.maxTime) {
+        writer.key("maxTime");
+        write_json(writer, k.maxTime.value());
+    }
+    if (k.maxSoC) {
+        writer.key("maxSoC");
+        write_json(writer, k.maxSoC.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionLimit& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "maxCost") {
+            read_json(reader, k.maxCost.emplace());
+        } else if (key == "maxEnergy") {
+            read_json(reader, k.maxEnergy.emplace());
+        } else if (key == "maxTime") {
+            read_json(reader, k.maxTime.emplace());
+        } else if (key == "maxSoC") {
+            read_json(reader, k.maxSoC.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const Transaction& k) {
+    writer.begin_object();
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    if (k.chargingState) {
+        writer.key("chargingState");
+        writer.value(conversions::charging_state_enum_to_string(k.chargingState.value()));
+    }
+    if (k.timeSpentCharging) {
+        writer.key("timeSpentCharging");
+        write_json(writer, k.timeSpentCharging.value());
+    }
+    if (k.stoppedReason) {
+        writer.key("stoppedReason");
+        writer.value(conversions::reason_enum_to_string(k.stoppedReason.value()));
+    }
+    if (k.remoteStartId) {
+        writer.key("remoteStartId");
+        write_json(writer, k.remoteStartId.value());
+    }
+    if (k.operationMode) {
+        writer.key("operationMode");
+        writer.value(conversions::operation_mode_enum_to_string(k.operationMode.value()));
+    }
+    if (k.tariffId) {
+        writer.key("tariffId");
+        write_json(writer, k.tariffId.value());
+    }
+    if (k.transactionLimit) {
+        writer.key("transactionLimit");
+        write_json(writer, k.transactionLimit.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Transaction& k) {
+    bool has_transactionId = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "transactionId") {
+            read_json(reader, k.transactionId);
+            has_transactionId = true;
+        } else if (key == "chargingState") {
+            k.chargingState.emplace(conversions::string_to_charging_state_enum(reader.read_string()));
+        } else if (key == "timeSpentCharging") {
+            read_json(reader, k.timeSpentCharging.emplace());
+        } else if (key == "stoppedReason") {
+            k.stoppedReason.emplace(conversions::string_to_reason_enum(reader.read_string()));
+        } else if (key == "remoteStartId") {
+            read_json(reader, k.remoteStartId.emplace());
+        } else if (key == "operationMode") {
+            k.operationMode.emplace(conversions::string_to_operation_mode_enum(reader.read_string()));
+        } else if (key == "tariffId") {
+            read_json(reader, k.tariffId.emplace());
+        } else if (key == "transactionLimit") {
+            read_json(reader, k.transactionLimit.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_transactionId, "transactionId");
+}
+
+void write_json(JsonWriter& writer, const TotalPrice& k) {
+    writer.begin_object();
+    if (k.exclTax) {
+        writer.key("exclTax");
+        write_json(writer, k.exclTax.value());
+    }
+    if (k.inclTax) {
+        writer.key("inclTax");
+        write_json(writer, k.inclTax.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TotalPrice& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "exclTax") {
+            read_json(reader, k.exclTax.emplace());
+        } else if (key == "inclTax") {
+            read_json(reader, k.inclTax.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const TaxRate& k) {
+    writer.begin_object();
+    writer.key("type");
+    write_json(writer, k.type);
+    writer.key("tax");
+    write_json(writer, k.tax);
+    if (k.stack) {
+        writer.key("stack");
+        write_json(writer, k.stack.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TaxRate& k) {
+    bool has_type = false;
+    bool has_tax = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "type") {
+            read_json(reader, k.type);
+            has_type = true;
+        } else if (key == "tax") {
+            read_json(reader, k.tax);
+            has_tax = true;
+        } else if (key == "stack") {
+            read_json(reader, k.stack.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_type, "type");
+    reader.require(has_tax, "tax");
+}
+
+void write_json(JsonWriter& writer, const Price& k) {
+    writer.begin_object();
+    if (k.exclTax) {
+        writer.key("exclTax");
+        write_json(writer, k.exclTax.value());
+    }
+    if (k.inclTax) {
+        writer.key("inclTax");
+        write_json(writer, k.inclTax.value());
+    }
+    if (k.taxRates) {
+        writer.key("taxRates");
+        write_json(writer, k.taxRates.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, Price& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "exclTax") {
+            read_json(reader, k.exclTax.emplace());
+        } else if (key == "inclTax") {
+            read_json(reader, k.inclTax.emplace());
+        } else if (key == "taxRates") {
+            read_json(reader, k.taxRates.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+void write_json(JsonWriter& writer, const TotalCost& k) {
+    writer.begin_object();
+    writer.key("currency");
+    write_json(writer, k.currency);
+    writer.key("typeOfCost");
+    writer.value(conversions::tariff_cost_enum_to_string(k.typeOfCost));
+    writer.key("total");
+    write_json(writer, k.total);
+    if (k.fixed) {
+        writer.key("fixed");
+        write_json(writer, k.fixed.value());
+    }
+    if (k.energy) {
+        writer.key("energy");
+        write_json(writer, k.energy.value());
+    }
+    if (k.chargingTime) {
+        writer.key("chargingTime");
+        write_json(writer, k.chargingTime.value());
+    }
+    if (k.idleTime) {
+        writer.key("idleTime");
+        write_json(writer, k.idleTime.value());
+    }
+    if (k.reservationTime) {
+        writer.key("reservationTime");
+        write_json(writer, k.reservationTime.value());
+    }
+    if (k.reservationFixed) {
+        writer.key("reservationFixed");
+        write_json(writer, k.reservationFixed.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TotalCost& k) {
+    bool has_currency = false;
+    bool has_typeOfCost = false;
+    bool has_total = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "currency") {
+            read_json(reader, k.currency);
+            has_currency = true;
+        } else if (key == "typeOfCost") {
+            k.typeOfCost = conversions::string_to_tariff_cost_enum(reader.read_string());
+            has_typeOfCost = true;
+        } else if (key == "total") {
+            read_json(reader, k.total);
+            has_total = true;
+        } else if (key == "fixed") {
+            read_json(reader, k.fixed.emplace());
+        } else if (key == "energy") {
+            read_json(reader, k.energy.emplace());
+        } else if (key == "chargingTime") {
+            read_json(reader, k.chargingTime.emplace());
+        } else if (key == "idleTime") {
+            read_json(reader, k.idleTime.emplace());
+        } else if (key == "reservationTime") {
+            read_json(reader, k.reservationTime.emplace());
+        } else if (key == "reservationFixed") {
+            read_json(reader, k.reservationFixed.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_currency, "currency");
+    reader.require(has_typeOfCost, "typeOfCost");
+    reader.require(has_total, "total");
+}
+
+void write_json(JsonWriter& writer, const TotalUsage& k) {
+    writer.begin_object();
+    writer.key("energy");
+    write_json(writer, k.energy);
+    writer.key("chargingTime");
+    write_json(writer, k.chargingTime);
+    writer.key("idleTime");
+    write_json(writer, k.idleTime);
+    if (k.reservationTime) {
+        writer.key("reservationTime");
+        write_json(writer, k.reservationTime.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TotalUsage& k) {
+    bool has_energy = false;
+    bool has_chargingTime = false;
+    bool has_idleTime = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "energy") {
+            read_json(reader, k.energy);
+            has_energy = true;
+        } else if (key == "chargingTime") {
+            read_json(reader, k.chargingTime);
+            has_chargingTime = true;
+        } else if (key == "idleTime") {
+            read_json(reader, k.idleTime);
+            has_idleTime = true;
+        } else if (key == "reservationTime") {
+            read_json(reader, k.reservationTime.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_energy, "energy");
+    reader.require(has_chargingTime, "chargingTime");
+    reader.require(has_idleTime, "idleTime");
+}
+
+void write_json(JsonWriter& writer, const CostDimension& k) {
+    writer.begin_object();
+    writer.key("type");
+    writer.value(conversions::cost_dimension_enum_to_string(k.type));
+    writer.key("volume");
+    write_json(writer, k.volume);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CostDimension& k) {
+    bool has_type = false;
+    bool has_volume = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "type") {
+            k.type = conversions::string_to_cost_dimension_enum(reader.read_string());
+            has_type = true;
+        } else if (key == "volume") {
+            read_json(reader, k.volume);
+            has_volume = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_type, "type");
+    reader.require(has_volume, "volume");
+}
+
+void write_json(JsonWriter& writer, const ChargingPeriod& k) {
+    writer.begin_object();
+    writer.key("startPeriod");
+    write_json(writer, k.startPeriod);
+    if (k.dimensions) {
+        writer.key("dimensions");
+        write_json(writer, k.dimensions.value());
+    }
+    if (k.tariffId) {
+        writer.key("tariffId");
+        write_json(writer, k.tariffId.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, ChargingPeriod& k) {
+    bool has_startPeriod = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "startPeriod") {
+            read_json(reader, k.startPeriod);
+            has_startPeriod = true;
+        } else if (key == "dimensions") {
+            read_json(reader, k.dimensions.emplace());
+        } else if (key == "tariffId") {
+            read_json(reader, k.tariffId.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_startPeriod, "startPeriod");
+}
+
+void write_json(JsonWriter& writer, const CostDetails& k) {
+    writer.begin_object();
+    writer.key("totalCost");
+    write_json(writer, k.totalCost);
+    writer.key("totalUsage");
+    write_json(writer, k.totalUsage);
+    if (k.chargingPeriods) {
+        writer.key("chargingPeriods");
+        write_json(writer, k.chargingPeriods.value());
+    }
+    if (k.failureToCalculate) {
+        writer.key("failureToCalculate");
+        write_json(writer, k.failureToCalculate.value());
+    }
+    if (k.failureReason) {
+        writer.key("failureReason");
+        write_json(writer, k.failureReason.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, CostDetails& k) {
+    bool has_totalCost = false;
+    bool has_totalUsage = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "totalCost") {
+            read_json(reader, k.totalCost);
+            has_totalCost = true;
+        } else if (key == "totalUsage") {
+            read_json(reader, k.totalUsage);
+            has_totalUsage = true;
+        } else if (key == "chargingPeriods") {
+            read_json(reader, k.chargingPeriods.emplace());
+        } else if (key == "failureToCalculate") {
+            read_json(reader, k.failureToCalculate.emplace());
+        } else if (key == "failureReason") {
+            read_json(reader, k.failureReason.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_totalCost, "totalCost");
+    reader.require(has_totalUsage, "totalUsage");
+}
+
+void write_json(JsonWriter& writer, const AdditionalInfo& k) {
+    writer.begin_object();
+    writer.key("additionalIdToken");
+    write_json(writer, k.additionalIdToken);
+    writer.key("type");
+    write_json(writer, k.type);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, AdditionalInfo& k) {
+    bool has_additionalIdToken = false;
+    bool has_type = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "additionalIdToken") {
+            read_json(reader, k.additionalIdToken);
+            has_additionalIdToken = true;
+        } else if (key == "type") {
+            read_json(reader, k.type);
+            has_type = true;
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_additionalIdToken, "additionalIdToken");
+    reader.require(has_type, "type");
+}
+
+void write_json(JsonWriter& writer, const IdToken& k) {
+    writer.begin_object();
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.key("type");
+    write_json(writer, k.type);
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        write_json(writer, k.additionalInfo.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, IdToken& k) {
+    bool has_idToken = false;
+    bool has_type = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "idToken") {
+            read_json(reader, k.idToken);
+            has_idToken = true;
+        } else if (key == "type") {
+            read_json(reader, k.type);
+            has_type = true;
+        } else if (key == "additionalInfo") {
+            read_json(reader, k.additionalInfo.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_idToken, "idToken");
+    reader.require(has_type, "type");
+}
+
+void write_json(JsonWriter& writer, const TransactionEventRequest& k) {
+    writer.begin_object();
+    writer.key("eventType");
+    writer.value(conversions::transaction_event_enum_to_string(k.eventType));
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("triggerReason");
+    writer.value(conversions::trigger_reason_enum_to_string(k.triggerReason));
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    writer.key("transactionInfo");
+    write_json(writer, k.transactionInfo);
+    if (k.costDetails) {
+        writer.key("costDetails");
+        write_json(writer, k.costDetails.value());
+    }
+    if (k.meterValue) {
+        writer.key("meterValue");
+        write_json(writer, k.meterValue.value());
+    }
+    if (k.offline) {
+        writer.key("offline");
+        write_json(writer, k.offline.value());
+    }
+    if (k.numberOfPhasesUsed) {
+        writer.key("numberOfPhasesUsed");
+        write_json(writer, k.numberOfPhasesUsed.value());
+    }
+    if (k.cableMaxCurrent) {
+        writer.key("cableMaxCurrent");
+        write_json(writer, k.cableMaxCurrent.value());
+    }
+    if (k.reservationId) {
+        writer.key("reservationId");
+        write_json(writer, k.reservationId.value());
+    }
+    if (k.preconditioningStatus) {
+        writer.key("preconditioningStatus");
+        writer.value(conversions::preconditioning_status_enum_to_string(k.preconditioningStatus.value()));
+    }
+    if (k.evseSleep) {
+        writer.key("evseSleep");
+        write_json(writer, k.evseSleep.value());
+    }
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.idToken) {
+        writer.key("idToken");
+        write_json(writer, k.idToken.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionEventRequest& k) {
+    bool has_eventType = false;
+    bool has_timestamp = false;
+    bool has_triggerReason = false;
+    bool has_seqNo = false;
+    bool has_transactionInfo = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "eventType") {
+            k.eventType = conversions::string_to_transaction_event_enum(reader.read_string());
+            has_eventType = true;
+        } else if (key == "timestamp") {
+            read_json(reader, k.timestamp);
+            has_timestamp = true;
+        } else if (key == "triggerReason") {
+            k.triggerReason = conversions::string_to_trigger_reason_enum(reader.read_string());
+            has_triggerReason = true;
+        } else if (key == "seqNo") {
+            read_json(reader, k.seqNo);
+            has_seqNo = true;
+        } else if (key == "transactionInfo") {
+            read_json(reader, k.transactionInfo);
+            has_transactionInfo = true;
+        } else if (key == "costDetails") {
+            read_json(reader, k.costDetails.emplace());
+        } else if (key == "meterValue") {
+            read_json(reader, k.meterValue.emplace());
+        } else if (key == "offline") {
+            read_json(reader, k.offline.emplace());
+        } else if (key == "numberOfPhasesUsed") {
+            read_json(reader, k.numberOfPhasesUsed.emplace());
+        } else if (key == "cableMaxCurrent") {
+            read_json(reader, k.cableMaxCurrent.emplace());
+        } else if (key == "reservationId") {
+            read_json(reader, k.reservationId.emplace());
+        } else if (key == "preconditioningStatus") {
+            k.preconditioningStatus.emplace(conversions::string_to_preconditioning_status_enum(reader.read_string()));
+        } else if (key == "evseSleep") {
+            read_json(reader, k.evseSleep.emplace());
+        } else if (key == "evse") {
+            read_json(reader, k.evse.emplace());
+        } else if (key == "idToken") {
+            read_json(reader, k.idToken.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_eventType, "eventType");
+    reader.require(has_timestamp, "timestamp");
+    reader.require(has_triggerReason, "triggerReason");
+    reader.require(has_seqNo, "seqNo");
+    reader.require(has_transactionInfo, "transactionInfo");
+}
+
+void write_json(JsonWriter& writer, const MessageContent& k) {
+    writer.begin_object();
+    writer.key("format");
+    writer.value(conversions::message_format_enum_to_string(k.format));
+    writer.key("content");
+    write_json(writer, k.content);
+    if (k.language) {
+        writer.key("language");
+        write_json(writer, k.language.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, MessageContent& k) {
+    bool has_format = false;
+    bool has_content = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "format") {
+            k.format = conversions::string_to_message_format_enum(reader.read_string());
+            has_format = true;
+        } else if (key == "content") {
+            read_json(reader, k.content);
+            has_content = true;
+        } else if (key == "language") {
+            read_json(reader, k.language.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_format, "format");
+    reader.require(has_content, "content");
+}
+
+void write_json(JsonWriter& writer, const IdTokenInfo& k) {
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::authorization_status_enum_to_string(k.status));
+    if (k.cacheExpiryDateTime) {
+        writer.key("cacheExpiryDateTime");
+        write_json(writer, k.cacheExpiryDateTime.value());
+    }
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        write_json(writer, k.chargingPriority.value());
+    }
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    if (k.language1) {
+        writer.key("language1");
+        write_json(writer, k.language1.value());
+    }
+    if (k.language2) {
+        writer.key("language2");
+        write_json(writer, k.language2.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    if (k.personalMessage) {
+        writer.key("personalMessage");
+        write_json(writer, k.personalMessage.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, IdTokenInfo& k) {
+    bool has_status = false;
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "status") {
+            k.status = conversions::string_to_authorization_status_enum(reader.read_string());
+            has_status = true;
+        } else if (key == "cacheExpiryDateTime") {
+            read_json(reader, k.cacheExpiryDateTime.emplace());
+        } else if (key == "chargingPriority") {
+            read_json(reader, k.chargingPriority.emplace());
+        } else if (key == "groupIdToken") {
+            read_json(reader, k.groupIdToken.emplace());
+        } else if (key == "language1") {
+            read_json(reader, k.language1.emplace());
+        } else if (key == "language2") {
+            read_json(reader, k.language2.emplace());
+        } else if (key == "evseId") {
+            read_json(reader, k.evseId.emplace());
+        } else if (key == "personalMessage") {
+            read_json(reader, k.personalMessage.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+    reader.require(has_status, "status");
+}
+
+void write_json(JsonWriter& writer, const TransactionEventResponse& k) {
+    writer.begin_object();
+    if (k.totalCost) {
+        writer.key("totalCost");
+        write_json(writer, k.totalCost.value());
+    }
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        write_json(writer, k.chargingPriority.value());
+    }
+    if (k.idTokenInfo) {
+        writer.key("idTokenInfo");
+        write_json(writer, k.idTokenInfo.value());
+    }
+    if (k.transactionLimit) {
+        writer.key("transactionLimit");
+        write_json(writer, k.transactionLimit.value());
+    }
+    if (k.updatedPersonalMessage) {
+        writer.key("updatedPersonalMessage");
+        write_json(writer, k.updatedPersonalMessage.value());
+    }
+    if (k.updatedPersonalMessageExtra) {
+        writer.key("updatedPersonalMessageExtra");
+        write_json(writer, k.updatedPersonalMessageExtra.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
+void read_json(JsonReader& reader, TransactionEventResponse& k) {
+    reader.begin_object();
+    while (reader.next_key()) {
+        const auto& key = reader.key();
+        if (key == "totalCost") {
+            read_json(reader, k.totalCost.emplace());
+        } else if (key == "chargingPriority") {
+            read_json(reader, k.chargingPriority.emplace());
+        } else if (key == "idTokenInfo") {
+            read_json(reader, k.idTokenInfo.emplace());
+        } else if (key == "transactionLimit") {
+            read_json(reader, k.transactionLimit.emplace());
+        } else if (key == "updatedPersonalMessage") {
+            read_json(reader, k.updatedPersonalMessage.emplace());
+        } else if (key == "updatedPersonalMessageExtra") {
+            read_json(reader, k.updatedPersonalMessageExtra.emplace());
+        } else if (key == "customData") {
+            read_json(reader, k.customData.emplace());
+        } else {
+            reader.skip_value();
+        }
+    }
+}
+
+} // namespace v2
+} // namespace ocpp
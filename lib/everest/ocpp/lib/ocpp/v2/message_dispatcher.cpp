@@ -8,6 +8,10 @@ namespace ocpp {
 namespace v2 {
 
 void MessageDispatcher::dispatch_call(const json& call, bool triggered) {
+    this->dispatch_serialized_call(call, {}, triggered);
+}
+
+void MessageDispatcher::dispatch_serialized_call(const json& call, std::string serialized_call, bool triggered) {
     const auto message_type = conversions::string_to_messagetype(call.at(CALL_ACTION));
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), triggered,
@@ -15,10 +19,10 @@ void MessageDispatcher::dispatch_call(const json& call, bool triggered) {
         this->device_model.get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages).value_or(false));
     switch (message_transmission_priority) {
     case MessageTransmissionPriority::SendImmediately:
-        this->message_queue.push_call(call);
+        this->message_queue.push_serialized_call(call, std::move(serialized_call));
         return;
     case MessageTransmissionPriority::SendAfterRegistrationStatusAccepted:
-        this->message_queue.push_call(call, true);
+        this->message_queue.push_serialized_call(call, std::move(serialized_call), true);
         return;
     case MessageTransmissionPriority::Discard:
         return;
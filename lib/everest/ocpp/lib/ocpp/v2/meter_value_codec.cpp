@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/v2/meter_value_codec.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace ocpp {
+namespace v2 {
+
+namespace {
+// Context values are stored shifted by one, 0 marks a meter value without reading context
+constexpr std::uint64_t NO_CONTEXT = 0;
+
+std::int64_t to_unix_milliseconds(const DateTime& dt) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(dt.to_time_point().time_since_epoch()).count();
+}
+
+DateTime from_unix_milliseconds(std::int64_t ms_since_epoch) {
+    return DateTime(date::utc_clock::time_point(std::chrono::milliseconds(ms_since_epoch)));
+}
+
+void write_varint(std::vector<std::uint8_t>& record, std::uint64_t value) {
+    while (value >= 0x80) {
+        record.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    record.push_back(static_cast<std::uint8_t>(value));
+}
+
+void write_zigzag(std::vector<std::uint8_t>& record, std::int64_t value) {
+    write_varint(record, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void write_float(std::vector<std::uint8_t>& record, float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; i++) {
+        record.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+class RecordReader {
+public:
+    explicit RecordReader(const std::vector<std::uint8_t>& record) : record(record) {
+    }
+
+    std::uint64_t read_varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const auto byte = this->read_byte();
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw std::runtime_error("Malformed meter value record: varint too long");
+    }
+
+    std::int64_t read_zigzag() {
+        const auto value = this->read_varint();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    float read_float() {
+        std::uint32_t bits = 0;
+        for (int i = 0; i < 4; i++) {
+            bits |= static_cast<std::uint32_t>(this->read_byte()) << (8 * i);
+        }
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string read_string(std::uint64_t length) {
+        if (length > this->record.size() - this->pos) {
+            throw std::runtime_error("Malformed meter value record: unexpected end");
+        }
+        std::string value(this->record.begin() + this->pos, this->record.begin() + this->pos + length);
+        this->pos += length;
+        return value;
+    }
+
+    bool at_end() const {
+        return this->pos == this->record.size();
+    }
+
+private:
+    std::uint8_t read_byte() {
+        if (this->pos >= this->record.size()) {
+            throw std::runtime_error("Malformed meter value record: unexpected end");
+        }
+        return this->record[this->pos++];
+    }
+
+    const std::vector<std::uint8_t>& record;
+    std::size_t pos{0};
+};
+} // namespace
+
+std::vector<std::uint8_t> MeterValueCodec::encode(const MeterValue& meter_value) {
+    std::optional<ReadingContextEnum> context;
+    if (not meter_value.sampledValue.empty()) {
+        context = meter_value.sampledValue.front().context;
+    }
+    for (const auto& sampled_value : meter_value.sampledValue) {
+        if (sampled_value.context != context) {
+            throw std::invalid_argument("All metervalues must have the same context");
+        }
+    }
+
+    std::vector<std::uint8_t> record;
+    record.reserve(8 + meter_value.sampledValue.size() * 6);
+
+    const auto timestamp = to_unix_milliseconds(meter_value.timestamp);
+    write_zigzag(record, timestamp - this->previous_timestamp);
+    write_varint(record, context.has_value() ? static_cast<std::uint64_t>(context.value()) + 1 : NO_CONTEXT);
+    write_varint(record, meter_value.sampledValue.size());
+
+    for (const auto& sampled_value : meter_value.sampledValue) {
+        json descriptor = sampled_value;
+        descriptor.erase("value");
+        descriptor.erase("context");
+        descriptor.erase("signedMeterValue");
+        auto text = descriptor.dump();
+        // the lowest bit of the index marks a signed meter value following the value
+        const std::uint64_t has_signed_meter_value = sampled_value.signedMeterValue.has_value() ? 1 : 0;
+
+        const auto known = this->descriptor_indices.find(text);
+        if (known != this->descriptor_indices.end()) {
+            write_varint(record, (known->second << 1) | has_signed_meter_value);
+        } else {
+            // an index one past the known descriptors announces a new descriptor
+            const std::uint64_t index = this->descriptors.size();
+            write_varint(record, (index << 1) | has_signed_meter_value);
+            write_varint(record, text.size());
+            record.insert(record.end(), text.begin(), text.end());
+
+            auto& stored = this->descriptors.emplace_back(sampled_value);
+            stored.value = 0;
+            stored.context.reset();
+            stored.signedMeterValue.reset();
+            this->descriptor_indices.emplace(std::move(text), index);
+        }
+        write_float(record, sampled_value.value);
+
+        if (sampled_value.signedMeterValue.has_value()) {
+            const auto signed_meter_value = json(sampled_value.signedMeterValue.value()).dump();
+            write_varint(record, signed_meter_value.size());
+            record.insert(record.end(), signed_meter_value.begin(), signed_meter_value.end());
+        }
+    }
+
+    this->previous_timestamp = timestamp;
+    return record;
+}
+
+MeterValue MeterValueCodec::decode(const std::vector<std::uint8_t>& record) {
+    RecordReader reader(record);
+
+    const auto timestamp = this->previous_timestamp + reader.read_zigzag();
+    const auto stored_context = reader.read_varint();
+    std::optional<ReadingContextEnum> context;
+    if (stored_context != NO_CONTEXT) {
+        context = static_cast<ReadingContextEnum>(stored_context - 1);
+    }
+
+    MeterValue meter_value;
+    meter_value.timestamp = from_unix_milliseconds(timestamp);
+
+    const auto number_of_sampled_values = reader.read_varint();
+    for (std::uint64_t i = 0; i < number_of_sampled_values; i++) {
+        const auto tagged_index = reader.read_varint();
+        const auto index = tagged_index >> 1;
+        if (index == this->descriptors.size()) {
+            auto text = reader.read_string(reader.read_varint());
+            try {
+                auto descriptor = json::parse(text);
+                descriptor["value"] = 0;
+                this->descriptors.push_back(descriptor.get<SampledValue>());
+            } catch (const json::exception& e) {
+                throw std::runtime_error(std::string("Malformed meter value record: ") + e.what());
+            }
+            this->descriptor_indices.emplace(std::move(text), index);
+        } else if (index > this->descriptors.size()) {
+            throw std::runtime_error("Malformed meter value record: unknown descriptor");
+        }
+
+        auto sampled_value = this->descriptors[index];
+        sampled_value.value = reader.read_float();
+        sampled_value.context = context;
+        if ((tagged_index & 1) != 0) {
+            try {
+                sampled_value.signedMeterValue = json::parse(reader.read_string(reader.read_varint()));
+            } catch (const json::exception& e) {
+                throw std::runtime_error(std::string("Malformed meter value record: ") + e.what());
+            }
+        }
+        meter_value.sampledValue.push_back(std::move(sampled_value));
+    }
+
+    if (not reader.at_end()) {
+        throw std::runtime_error("Malformed meter value record: trailing data");
+    }
+
+    this->previous_timestamp = timestamp;
+    return meter_value;
+}
+
+} // namespace v2
+} // namespace ocpp
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <everest/logging.hpp>
+#include <ocpp/v2/notify_report_streamer.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+const std::string NotifyReportStreamer::MESSAGE_TYPE = conversions::messagetype_to_string(MessageType::NotifyReport);
+
+NotifyReportStreamer::NotifyReportStreamer(int request_id, size_t max_size, size_t max_items,
+                                           std::function<MessageId()>&& message_id_generator_callback,
+                                           CallCallback&& call_callback) :
+    request_id(request_id),
+    generated_at(ocpp::DateTime()),
+    max_size(max_size),
+    max_items(max_items),
+    message_id_generator_callback{std::move(message_id_generator_callback)},
+    call_callback{std::move(call_callback)} {
+    this->start_call();
+}
+
+void NotifyReportStreamer::add(const ReportData& report_data) {
+    json current_json = report_data;
+    auto current = current_json.dump();
+
+    if (!this->report_data_json.empty()) {
+        // another report data object increases the size by its serialization + 1 (caused by the separating comma)
+        const auto items_left = this->max_items == 0 or this->report_data_json.size() < this->max_items;
+        if (items_left and this->report_data_buffer.size() + current.size() + 1 <= this->report_data_max_size) {
+            this->report_data_buffer += ',';
+            this->report_data_buffer += current;
+            this->report_data_json.emplace_back(std::move(current_json));
+            return;
+        }
+        this->send_call(true);
+        this->start_call();
+    }
+
+    // the first report data object of a call is always added, even if it exceeds the maximum size on its own
+    this->report_data_buffer = std::move(current);
+    this->report_data_json.emplace_back(std::move(current_json));
+}
+
+void NotifyReportStreamer::finish() {
+    this->send_call(false);
+
+    if (this->seq_no > 1) {
+        EVLOG_info << "Split NotifyReportRequest '" << this->request_id << "' into " << this->seq_no << " messages.";
+    }
+}
+
+int NotifyReportStreamer::get_call_count() const {
+    return this->seq_no;
+}
+
+NotifyReportRequest NotifyReportStreamer::create_request(std::optional<bool> tbc) const {
+    NotifyReportRequest req;
+    req.requestId = this->request_id;
+    req.generatedAt = this->generated_at;
+    req.seqNo = this->seq_no;
+    req.tbc = tbc;
+    return req;
+}
+
+void NotifyReportStreamer::start_call() {
+    this->message_id = this->message_id_generator_callback();
+    this->report_data_json = json::array();
+    this->report_data_buffer.clear();
+
+    // [MessageTypeId::CALL, "<messageId>", "NotifyReport", {<json of request without tbc and reportData> without the
+    // closing "}]", tbc and reportData are appended by send_call
+    this->call_head =
+        json{MessageTypeId::CALL, this->message_id.get(), MESSAGE_TYPE, this->create_request(std::nullopt)}.dump();
+    this->call_head.resize(this->call_head.size() - 2);
+
+    // tbc=false is the longer representation
+    const auto skeleton_size = this->call_head.size() + std::string{R"(,"tbc":false,"reportData":[]}])"}.size();
+    this->report_data_max_size = this->max_size >= skeleton_size ? this->max_size - skeleton_size : 0;
+}
+
+void NotifyReportStreamer::send_call(bool tbc) {
+    json request_json = this->create_request(tbc);
+    std::string serialized_call = std::move(this->call_head);
+    serialized_call += tbc ? R"(,"tbc":true)" : R"(,"tbc":false)";
+    // reportData has a minimum of one item, so an empty report is sent without it
+    if (!this->report_data_json.empty()) {
+        request_json["reportData"] = std::move(this->report_data_json);
+        serialized_call += R"(,"reportData":[)";
+        serialized_call += this->report_data_buffer;
+        serialized_call += ']';
+    }
+    serialized_call += "}]";
+
+    this->call_callback(json{MessageTypeId::CALL, this->message_id.get(), MESSAGE_TYPE, std::move(request_json)},
+                        std::move(serialized_call));
+
+    this->seq_no++;
+}
+
+} // namespace v2
+} // namespace ocpp
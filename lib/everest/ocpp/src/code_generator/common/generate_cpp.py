@@ -69,6 +69,8 @@ enums_hpp_template = env.get_template('ocpp_enums.hpp.jinja')
 enums_cpp_template = env.get_template('ocpp_enums.cpp.jinja')
 ocpp_types_hpp_template = env.get_template('ocpp_types.hpp.jinja')
 ocpp_types_cpp_template = env.get_template('ocpp_types.cpp.jinja')
+json_stream_hpp_template = env.get_template('ocpp_json_stream.hpp.jinja')
+json_stream_cpp_template = env.get_template('ocpp_json_stream.cpp.jinja')
 
 # global variables, should go into a class
 parsed_types: List = []
@@ -196,6 +198,13 @@ v21_messages = ['AFRRSignal',
 
 send_messages = ['NotifyPeriodicEventStream']
 
+# messages sent or received often enough to get a JsonWriter/JsonReader implementation that does not build a json
+# object first, see ocpp/common/json_stream.hpp
+json_stream_messages = {
+    'v16': ['MeterValues', 'StopTransaction'],
+    'v2': ['GetVariables', 'MeterValues', 'NotifyReport', 'SetVariables', 'TransactionEvent'],
+}
+
 
 def object_exists(name: str) -> bool:
     """Check if an object (i.e. dataclass) already exists."""
@@ -429,6 +438,7 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
 
     message_files = []
     message_files_v21 = []
+    json_stream_types = []
     first = True
     for action, type_of_action in schemas.items():
         if action in v21_messages:
@@ -551,6 +561,14 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
                             if field['name'] == 'eventNotificationType':
                                 sorted_types[i]['properties'][j]['required'] = False
 
+            if action in json_stream_messages[version]:
+                for parsed_type in sorted_types:
+                    if parsed_type['name'] == 'CustomData' and version == 'v2':
+                        # CustomData is a json object in OCPP 2.x
+                        continue
+                    if parsed_type['name'] not in [t['name'] for t in json_stream_types]:
+                        json_stream_types.append(parsed_type)
+
             with open(generated_class_hpp_fn, writemode[type_key]) as out:
                 out.write(message_hpp_template.render({
                     'types': sorted_types,
@@ -643,6 +661,19 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
         out.write(messages_cmakelists_txt_template.render({
             'messages': sorted(message_files)
         }))
+    json_stream_hpp_fn = Path(generated_header_dir, 'json_stream.hpp')
+    json_stream_cpp_fn = Path(generated_source_dir, 'json_stream.cpp')
+    with open(json_stream_hpp_fn, 'w') as out:
+        out.write(json_stream_hpp_template.render({
+            'types': json_stream_types,
+            'actions': json_stream_messages[version],
+            'namespace': version_path
+        }))
+    with open(json_stream_cpp_fn, 'w') as out:
+        out.write(json_stream_cpp_template.render({
+            'types': json_stream_types,
+            'namespace': version_path
+        }))
     with open(enums_hpp_fn, 'a+') as out:
         out.write(enums_hpp_template.render({
             'last': True,
@@ -674,9 +705,9 @@ def parse_schemas(version: str, schema_dir: Path = Path('schemas/json/'),
     subprocess.run(["sh", "-c", "find {} -regex '.*\\.\\(cpp\\|hpp\\)' -exec clang-format -style=file -i {{}} \\;".format(
         messages_source_dir_v21)], cwd=messages_source_dir_v21)
     subprocess.run(["clang-format", "-style=file",  "-i",
-                   enums_hpp_fn, ocpp_types_hpp_fn], cwd=generated_header_dir)
+                   enums_hpp_fn, ocpp_types_hpp_fn, json_stream_hpp_fn], cwd=generated_header_dir)
     subprocess.run(["clang-format", "-style=file",  "-i",
-                   enums_cpp_fn, ocpp_types_cpp_fn], cwd=generated_source_dir)
+                   enums_cpp_fn, ocpp_types_cpp_fn, json_stream_cpp_fn], cwd=generated_source_dir)
     subprocess.run(["clang-format", "-style=file",  "-i",
                    enums_cpp_fn], cwd=generated_source_dir)
 
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+#include <fstream>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
@@ -280,6 +282,42 @@ TEST_F(MessageQueueTest, test_non_transactional_message_is_sent) {
     wait_for_calls();
 }
 
+// \brief Test a message pushed with its serialization is sent as serialized, without dumping it again
+TEST_F(MessageQueueTest, test_serialized_message_is_sent) {
+    testing::MockFunction<bool(const std::string& message)> send_serialized_callback_mock;
+    message_queue->set_send_serialized_callback(send_serialized_callback_mock.AsStdFunction());
+
+    // deliberately differs from a dump of the json to tell them apart
+    const std::string serialized = R"([2, "0", "non_transactional", {"data": "test_data"}])";
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    EXPECT_CALL(send_serialized_callback_mock, Call(serialized)).WillOnce(testing::Invoke([this](const std::string&) {
+        this->mark_call_sent();
+        return true;
+    }));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+    call.msg.data = "test_data";
+    call.uniqueId = "0";
+    message_queue->push_serialized_call(call, serialized);
+
+    wait_for_calls();
+}
+
+// \brief Test a message pushed with its serialization is sent as json if no callback for serialized messages is set
+TEST_F(MessageQueueTest, test_serialized_message_without_callback_is_sent_as_json) {
+    EXPECT_CALL(send_callback_mock, Call(json{2, "0", "non_transactional", json{{"data", "test_data"}}}))
+        .WillOnce(MarkAndReturn(true));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+    call.msg.data = "test_data";
+    call.uniqueId = "0";
+    message_queue->push_serialized_call(call, R"([2,"0","non_transactional",{"data":"test_data"}])");
+
+    wait_for_calls();
+}
+
 // \brief Test transactional messages that are sent while being offline are sent afterwards
 TEST_F(MessageQueueTest, test_queuing_up_of_transactional_messages) {
 
@@ -834,4 +872,25 @@ TEST_F(MessageQueueTest, test_boot_notification_survives_when_only_message_in_no
     EXPECT_TRUE(boot_sent) << "BootNotification was dropped from the queue!";
 }
 
+// \brief Test that received calls are validated against their message schema
+TEST_F(MessageQueueTest, test_received_call_is_validated) {
+    const auto schemas_path = fs::temp_directory_path() / "libocpp_message_queue_schemas";
+    fs::create_directories(schemas_path);
+    std::ofstream(schemas_path / "non_transactionalRequest.json")
+        << R"({"type": "object", "properties": {"data": {"type": "string"}}, "required": ["data"]})";
+
+    message_queue->stop();
+    config.message_validator = std::make_shared<MessageValidator>(schemas_path);
+    init_message_queue();
+
+    const auto valid = message_queue->receive(json{2, "1", "non_transactional", json{{"data", "test_data"}}}.dump());
+    EXPECT_FALSE(valid.validation_error.has_value());
+    const auto invalid = message_queue->receive(json{2, "2", "non_transactional", json{{"data", 42}}}.dump());
+    EXPECT_TRUE(invalid.validation_error.has_value());
+    const auto without_schema = message_queue->receive(json{2, "3", "transactional", json{{"data", 42}}}.dump());
+    EXPECT_FALSE(without_schema.validation_error.has_value());
+
+    fs::remove_all(schemas_path);
+}
+
 } // namespace ocpp
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <ocpp/common/message_validator.hpp>
+
+namespace ocpp {
+
+class MessageValidatorTest : public ::testing::Test {
+protected:
+    fs::path schemas_path = fs::temp_directory_path() / "libocpp_message_validator_test";
+
+    void write_schema(const std::string& name, const json& schema) {
+        std::ofstream(schemas_path / (name + ".json")) << schema.dump();
+    }
+
+    void SetUp() override {
+        fs::remove_all(schemas_path);
+        fs::create_directories(schemas_path);
+        write_schema("BootNotificationRequest",
+                     {{"type", "object"},
+                      {"properties", {{"reason", {{"type", "string"}, {"enum", {"PowerUp"}}}}}},
+                      {"required", {"reason"}}});
+        write_schema("BootNotificationResponse", {{"type", "object"},
+                                                  {"properties", {{"interval", {{"type", "integer"}}}}},
+                                                  {"required", {"interval"}}});
+        // OCPP 1.6 schema names have no Request suffix
+        write_schema("Heartbeat", {{"type", "object"}, {"additionalProperties", false}});
+        std::ofstream(schemas_path / "README.md") << "not a schema";
+    }
+
+    void TearDown() override {
+        fs::remove_all(schemas_path);
+    }
+};
+
+TEST_F(MessageValidatorTest, ValidatesRequestsAndResponses) {
+    MessageValidator validator(schemas_path);
+
+    EXPECT_FALSE(validator.validate_request("BootNotification", {{"reason", "PowerUp"}}).has_value());
+    EXPECT_TRUE(validator.validate_request("BootNotification", {{"reason", "Unknown"}}).has_value());
+    EXPECT_TRUE(validator.validate_request("BootNotification", json::object()).has_value());
+
+    EXPECT_FALSE(validator.validate_response("BootNotification", {{"interval", 300}}).has_value());
+    EXPECT_TRUE(validator.validate_response("BootNotification", {{"interval", "300"}}).has_value());
+}
+
+TEST_F(MessageValidatorTest, SchemaWithoutSuffixIsARequest) {
+    MessageValidator validator(schemas_path);
+
+    EXPECT_FALSE(validator.validate_request("Heartbeat", json::object()).has_value());
+    EXPECT_TRUE(validator.validate_request("Heartbeat", {{"unexpected", true}}).has_value());
+}
+
+TEST_F(MessageValidatorTest, ActionsWithoutSchemaAreValid) {
+    MessageValidator validator(schemas_path);
+
+    EXPECT_FALSE(validator.validate_request("Authorize", {{"anything", 1}}).has_value());
+    EXPECT_FALSE(validator.validate_response("Heartbeat", {{"anything", 1}}).has_value());
+}
+
+TEST_F(MessageValidatorTest, CountsValidations) {
+    MessageValidator validator(schemas_path);
+    validator.validate_request("BootNotification", {{"reason", "PowerUp"}});
+    validator.validate_request("BootNotification", {{"reason", "Unknown"}});
+    validator.validate_response("BootNotification", {{"interval", 300}});
+
+    const auto statistics = validator.get_statistics();
+    EXPECT_EQ(statistics.at("BootNotificationRequest").validations, 2);
+    EXPECT_EQ(statistics.at("BootNotificationRequest").failures, 1);
+    EXPECT_GE(statistics.at("BootNotificationRequest").total_time, statistics.at("BootNotificationRequest").max_time);
+    EXPECT_EQ(statistics.at("BootNotificationResponse").validations, 1);
+    EXPECT_EQ(statistics.at("BootNotificationResponse").failures, 0);
+    EXPECT_EQ(statistics.at("HeartbeatRequest").validations, 0);
+}
+
+TEST_F(MessageValidatorTest, SummarizesUsedSchemas) {
+    MessageValidator validator(schemas_path);
+    EXPECT_EQ(validator.get_statistics_summary(), "no messages validated");
+
+    validator.validate_request("BootNotification", {{"reason", "PowerUp"}});
+    validator.validate_request("BootNotification", {{"reason", "Unknown"}});
+
+    const auto summary = validator.get_statistics_summary();
+    EXPECT_EQ(summary.rfind("BootNotificationRequest: 2 validations, 1 failed, average ", 0), 0) << summary;
+    EXPECT_EQ(summary.find("Heartbeat"), std::string::npos) << summary;
+    EXPECT_EQ(summary.find('\n'), std::string::npos) << summary;
+}
+
+TEST_F(MessageValidatorTest, SharedValidatorIsReused) {
+    auto validator = MessageValidator::get_shared(schemas_path);
+    EXPECT_EQ(validator, MessageValidator::get_shared(schemas_path / "."));
+
+    // schemas are loaded again once the last user released the validator
+    validator.reset();
+    write_schema("Authorize", {{"type", "object"}, {"required", {"idTag"}}});
+    validator = MessageValidator::get_shared(schemas_path);
+    EXPECT_TRUE(validator->validate_request("Authorize", json::object()).has_value());
+}
+
+TEST_F(MessageValidatorTest, MissingDirectoryThrows) {
+    EXPECT_THROW(MessageValidator(schemas_path / "missing"), std::runtime_error);
+}
+
+TEST_F(MessageValidatorTest, InvalidSchemaThrows) {
+    std::ofstream(schemas_path / "Broken.json") << "{";
+    EXPECT_THROW(MessageValidator validator(schemas_path), std::runtime_error);
+}
+
+} // namespace ocpp
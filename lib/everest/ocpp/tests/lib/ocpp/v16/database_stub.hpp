@@ -67,6 +67,14 @@ struct SQLiteStatementTest : public StatementInterface {
     virtual int bind_null(const std::string& param) {
         return 0;
     }
+    virtual int bind_blob(const int idx, const std::vector<std::uint8_t>& val,
+                          SQLiteString lifetime = SQLiteString::Static) {
+        return 0;
+    }
+    virtual int bind_blob(const std::string& param, const std::vector<std::uint8_t>& val,
+                          SQLiteString lifetime = SQLiteString::Static) {
+        return 0;
+    }
     virtual int get_number_of_rows() override {
         return 0;
     }
@@ -88,6 +96,9 @@ struct SQLiteStatementTest : public StatementInterface {
     virtual double column_double(const int idx) {
         return 0.0;
     }
+    virtual std::vector<std::uint8_t> column_blob(const int idx) {
+        return {};
+    }
     virtual SqliteVariant column_variant(const std::string& name) {
         return 0;
     }
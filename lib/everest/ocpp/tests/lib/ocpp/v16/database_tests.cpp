@@ -183,6 +183,39 @@ TEST_F(DatabaseTest, test_clear_authorization_list) {
     ASSERT_EQ(std::nullopt, id_tag_info);
 }
 
+TEST_F(DatabaseTest, test_replace_authorization_list) {
+
+    const auto previous_id_tag = CiString<20>("PREVIOUS");
+
+    IdTagInfo id_tag_info;
+    id_tag_info.status = AuthorizationStatus::Accepted;
+    id_tag_info.parentIdTag = CiString<20>("PARENT");
+
+    this->db_handler->insert_or_update_local_authorization_list_entry(previous_id_tag, id_tag_info);
+
+    std::vector<LocalAuthorizationList> local_authorization_list;
+    for (int i = 0; i < 100; i++) {
+        LocalAuthorizationList entry;
+        entry.idTag = CiString<20>("TAG" + std::to_string(i));
+        entry.idTagInfo = id_tag_info;
+        local_authorization_list.push_back(entry);
+    }
+
+    this->db_handler->replace_local_authorization_list(local_authorization_list);
+
+    ASSERT_EQ(std::nullopt, this->db_handler->get_local_authorization_list_entry(previous_id_tag));
+    ASSERT_EQ(100, this->db_handler->get_local_authorization_list_number_of_entries());
+    auto received_id_tag_info = this->db_handler->get_local_authorization_list_entry(CiString<20>("TAG99"));
+    ASSERT_EQ(id_tag_info.status, received_id_tag_info.value().status);
+    ASSERT_EQ(id_tag_info.parentIdTag.value().get(), received_id_tag_info.value().parentIdTag.value().get());
+
+    // a second replace swaps the tables again
+    local_authorization_list.resize(1);
+    this->db_handler->replace_local_authorization_list(local_authorization_list);
+    ASSERT_EQ(1, this->db_handler->get_local_authorization_list_number_of_entries());
+    ASSERT_EQ(std::nullopt, this->db_handler->get_local_authorization_list_entry(CiString<20>("TAG99")));
+}
+
 TEST_F(DatabaseTest, test_authorization_cache_entry) {
 
     const auto id_tag = CiString<20>("DEADBEEF");
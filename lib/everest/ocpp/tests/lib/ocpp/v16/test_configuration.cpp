@@ -151,4 +151,67 @@ TEST_F(ConfigurationTester, DefaultPriceText) {
     EXPECT_EQ(set_result, ConfigurationStatus::Accepted);
 }
 
+TEST_F(ConfigurationTester, UserConfigIsWrittenOnDestruction) {
+    EXPECT_EQ(config->set("MeterValueSampleInterval", "17"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("MeterValuesSampledData", "Energy.Active.Import.Register,Voltage"),
+              ConfigurationStatus::Accepted);
+
+    // typed values are updated immediately
+    EXPECT_EQ(config->getMeterValueSampleInterval(), 17);
+    const auto measurands = config->getMeterValuesSampledDataVector();
+    ASSERT_FALSE(measurands.empty());
+    EXPECT_EQ(measurands.front().measurand, Measurand::Energy_Active_Import_Register);
+    EXPECT_EQ(measurands.back().measurand, Measurand::Voltage);
+
+    // pending changes are written in one batch at the latest when the configuration is destroyed
+    config.reset();
+    std::ifstream ifs(USER_CONFIG_FILE_LOCATION_V16);
+    const auto user_config = json::parse(ifs);
+    EXPECT_EQ(user_config["Core"]["MeterValueSampleInterval"], 17);
+    EXPECT_EQ(user_config["Core"]["MeterValuesSampledData"], "Energy.Active.Import.Register,Voltage");
+}
+
+TEST_F(ConfigurationTester, TypedValuesFollowChangeConfiguration) {
+    EXPECT_EQ(config->set("HeartbeatInterval", "42"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("TransactionMessageAttempts", "7"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("TransactionMessageRetryInterval", "11"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("LocalPreAuthorize", "true"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("LocalAuthorizeOffline", "false"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(config->set("StopTransactionOnInvalidId", "false"), ConfigurationStatus::Accepted);
+
+    EXPECT_EQ(config->getHeartbeatInterval(), 42);
+    EXPECT_EQ(config->getHeartbeatIntervalKeyValue().value, "42");
+    EXPECT_EQ(config->getTransactionMessageAttempts(), 7);
+    EXPECT_EQ(config->getTransactionMessageRetryInterval(), 11);
+    EXPECT_TRUE(config->getLocalPreAuthorize());
+    EXPECT_FALSE(config->getLocalAuthorizeOffline());
+    EXPECT_FALSE(config->getStopTransactionOnInvalidId());
+
+    // not settable, so it keeps its configured value
+    const auto number_of_connectors = config->getNumberOfConnectors();
+    EXPECT_EQ(config->set("NumberOfConnectors", "99"), std::nullopt);
+    EXPECT_EQ(config->getNumberOfConnectors(), number_of_connectors);
+}
+
+TEST(ChargePointConfiguration, CorruptUserConfigIsNotReplaced) {
+    fs::path cfg{CONFIG_DIR_V16};
+    cfg /= "config-full.json";
+    std::ifstream ifs(cfg);
+    const std::string config_file((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+
+    const auto user_config_path = fs::temp_directory_path() / "corrupt-user-config.json";
+    const std::string corrupt = R"({"Internal": {"AuthorizationKey": "secret")";
+    {
+        std::ofstream ofs(user_config_path);
+        ofs << corrupt;
+    }
+
+    EXPECT_THROW(ChargePointConfiguration(config_file, CONFIG_DIR_V16, user_config_path), json::parse_error);
+
+    std::ifstream user_ifs(user_config_path);
+    const std::string content((std::istreambuf_iterator<char>(user_ifs)), (std::istreambuf_iterator<char>()));
+    EXPECT_EQ(content, corrupt);
+    fs::remove(user_config_path);
+}
+
 } // namespace
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <ocpp/v16/json_stream.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+TEST(JsonStreamTest, StopTransactionRoundTrip) {
+    SampledValue energy;
+    energy.value = "1234.5";
+    energy.measurand = Measurand::Energy_Active_Import_Register;
+    energy.unit = UnitOfMeasure::kWh;
+
+    StopTransactionRequest req;
+    req.meterStop = 1234;
+    req.timestamp = ocpp::DateTime("2024-01-01T12:00:00.000Z");
+    req.transactionId = 42;
+    req.reason = Reason::EVDisconnected;
+    req.transactionData = {TransactionData{ocpp::DateTime("2024-01-01T12:00:00.000Z"), {energy}}};
+
+    std::string buffer;
+    JsonWriter writer(buffer);
+    write_json(writer, req);
+    EXPECT_EQ(json::parse(buffer), json(req));
+
+    JsonReader reader(buffer);
+    StopTransactionRequest read_req;
+    read_json(reader, read_req);
+    reader.end();
+    EXPECT_EQ(json(read_req), json(req));
+}
+
+TEST(JsonStreamTest, ReadsEmptyMeterValuesResponse) {
+    JsonReader reader(R"([3, "message-1", {}])");
+    CallResult<MeterValuesResponse> call_result;
+    EXPECT_NO_THROW(read_json(reader, call_result));
+    EXPECT_EQ(call_result.uniqueId.get(), "message-1");
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -731,6 +731,15 @@ TEST_P(Configuration, MessageTypesDiscardForQueueing) {
     ASSERT_FALSE(kv.has_value());
 }
 
+TEST_P(Configuration, MessageSchemasPath) {
+    ASSERT_NE(get(), nullptr);
+    // initial values are from the JSON unit test config files
+
+    EXPECT_FALSE(get()->getMessageSchemasPath().has_value());
+    auto kv = get()->getMessageSchemasPathKeyValue();
+    ASSERT_FALSE(kv.has_value());
+}
+
 TEST_P(Configuration, MessageQueueSizeThreshold) {
     ASSERT_NE(get(), nullptr);
     // initial values are from the JSON unit test config files
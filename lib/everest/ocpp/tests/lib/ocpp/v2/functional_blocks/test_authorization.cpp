@@ -1208,10 +1208,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list) {
     const auto request = create_send_local_list_request(
         33, UpdateEnum::Full, this->create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list is inserted, therefor the list is first cleared and then the new list is inserted. The
-    // list version is also updated.
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list);
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_));
+    // Local authorization list is replaced by the new list. The list version is also updated.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_));
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list_version(33));
 
     // The number of entries is requested from the database after storing the new list, and stored in the device model.
@@ -1239,10 +1237,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_get_entries_excep
     const auto request = create_send_local_list_request(
         33, UpdateEnum::Full, this->create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list is inserted, therefor the list is first cleared and then the new list is inserted. The
-    // list version is also updated.
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list);
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_));
+    // Local authorization list is replaced by the new list. The list version is also updated.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_));
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list_version(33));
 
     // The number of entries is requested from the database after storing the new list, and stored in the device model.
@@ -1272,10 +1268,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_get_entries_excep
     const auto request = create_send_local_list_request(
         33, UpdateEnum::Full, this->create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list is inserted, therefor the list is first cleared and then the new list is inserted. The
-    // list version is also updated.
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list);
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_));
+    // Local authorization list is replaced by the new list. The list version is also updated.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_));
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list_version(33));
 
     // The number of entries is requested from the database after storing the new list, and stored in the device model.
@@ -1305,10 +1299,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_get_entries_excep
     const auto request = create_send_local_list_request(
         33, UpdateEnum::Full, this->create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list is inserted, therefor the list is first cleared and then the new list is inserted. The
-    // list version is also updated.
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list);
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_));
+    // Local authorization list is replaced by the new list. The list version is also updated.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_));
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list_version(33));
 
     // The number of entries is requested from the database after storing the new list, and stored in the device model.
@@ -1332,9 +1324,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_set_version_excep
     const auto request = create_send_local_list_request(
         33, UpdateEnum::Full, this->create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list is inserted, therefor the list is first cleared and then the new list is inserted.
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list);
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_));
+    // Local authorization list is replaced by the new list.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_));
 
     // When trying to update the authorization list version, an exception is thrown.
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list_version(33))
@@ -1475,6 +1466,7 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_duplicate) {
 
     // There are duplicates in the list, so the request has failed. Nothing is inserted.
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_)).Times(0);
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_)).Times(0);
 
     // The authorization list should now be cleared and is accepted.
     EXPECT_CALL(mock_dispatcher, dispatch_call_result(_)).WillOnce(Invoke([](const json& call_result) {
@@ -1494,6 +1486,7 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_no_token_info) {
 
     // There is at least one token without id token info, so the request has failed. Nothing is inserted.
     EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_)).Times(0);
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_)).Times(0);
 
     // The authorization list should now be cleared and is accepted.
     EXPECT_CALL(mock_dispatcher, dispatch_call_result(_)).WillOnce(Invoke([](const json& call_result) {
@@ -1503,7 +1496,7 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_no_token_info) {
     authorization->handle_message(request);
 }
 
-TEST_F(AuthorizationTest, handle_send_local_authorization_list_clear_list_exception) {
+TEST_F(AuthorizationTest, handle_send_local_authorization_list_replace_list_exception) {
     // Enable auth list ctrlr.
     this->set_local_auth_list_ctrlr_enabled(this->device_model, true);
 
@@ -1511,9 +1504,8 @@ TEST_F(AuthorizationTest, handle_send_local_authorization_list_clear_list_except
     const auto request =
         create_send_local_list_request(1, UpdateEnum::Full, create_example_authorization_data_local_list(false, true));
 
-    // Local authorization list must be inserted, but clearing it throws an exception.
-    EXPECT_CALL(this->database_handler_mock, insert_or_update_local_authorization_list(_)).Times(0);
-    EXPECT_CALL(this->database_handler_mock, clear_local_authorization_list)
+    // Local authorization list must be replaced, but replacing it throws an exception.
+    EXPECT_CALL(this->database_handler_mock, replace_local_authorization_list(_))
         .WillRepeatedly(Throw(everest::db::Exception("exception :(")));
 
     // The authorization list should now be cleared and is accepted.
@@ -37,6 +37,8 @@ public:
                 (const IdToken& id_token, const IdTokenInfo& id_token_info));
     MOCK_METHOD(void, insert_or_update_local_authorization_list,
                 (const std::vector<AuthorizationData>& local_authorization_list));
+    MOCK_METHOD(void, replace_local_authorization_list,
+                (const std::vector<AuthorizationData>& local_authorization_list));
     MOCK_METHOD(void, delete_local_authorization_list_entry, (const IdToken& id_token));
     MOCK_METHOD(std::optional<IdTokenInfo>, get_local_authorization_list_entry, (const IdToken& id_token));
     MOCK_METHOD(void, clear_local_authorization_list, ());
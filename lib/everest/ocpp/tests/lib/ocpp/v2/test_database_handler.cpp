@@ -13,6 +13,7 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <everest/database/sqlite/schema_updater.hpp>
 #include <ocpp/v2/database_handler.hpp>
 #include <optional>
 
@@ -1293,3 +1294,178 @@ TEST_F(DatabaseHandlerTest, GetChargingProfilesMatchingCriteria_OnlyEVSEIDSet_Re
     EXPECT_THAT(
         sut, testing::Contains(testing::FieldsAre(profile1, DEFAULT_EVSE_ID, ChargingLimitSourceEnumStringType::CSO)));
 }
+
+TEST_F(DatabaseHandlerTest, LocalAuthorizationList_UpdateInsertsAndDeletesEntries) {
+    const IdToken token_1{"TOKEN_1", "ISO14443"};
+    const IdToken token_2{"TOKEN_2", "ISO14443"};
+    IdTokenInfo accepted{AuthorizationStatusEnum::Accepted};
+    accepted.groupIdToken = IdToken{"GROUP", "Central"};
+    this->database_handler.insert_or_update_local_authorization_list_entry(token_2, accepted);
+
+    this->database_handler.insert_or_update_local_authorization_list(
+        {AuthorizationData{token_1, accepted}, AuthorizationData{token_2, std::nullopt}});
+
+    const auto entry = this->database_handler.get_local_authorization_list_entry(token_1);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(json(entry.value()), json(accepted));
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry(token_2).has_value());
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_number_of_entries(), 1);
+}
+
+TEST_F(DatabaseHandlerTest, LocalAuthorizationList_ReplaceSwapsCompleteList) {
+    const IdToken previous_token{"PREVIOUS", "ISO14443"};
+    this->database_handler.insert_or_update_local_authorization_list_entry(
+        previous_token, IdTokenInfo{AuthorizationStatusEnum::Accepted});
+
+    std::vector<AuthorizationData> list;
+    for (int i = 0; i < 1000; i++) {
+        list.push_back(AuthorizationData{IdToken{"TOKEN_" + std::to_string(i), "ISO14443"},
+                                         IdTokenInfo{i % 2 == 0 ? AuthorizationStatusEnum::Accepted
+                                                                : AuthorizationStatusEnum::Blocked}});
+    }
+    this->database_handler.replace_local_authorization_list(list);
+
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_number_of_entries(), 1000);
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry(previous_token).has_value());
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_entry(IdToken{"TOKEN_7", "ISO14443"})->status,
+              AuthorizationStatusEnum::Blocked);
+
+    // the staging table is emptied after the swap and a second replacement starts from scratch
+    {
+        // scoped, the open statement would otherwise keep the shared table locked
+        auto count_staging = this->database->new_statement("SELECT COUNT(*) FROM AUTH_LIST_STAGING");
+        ASSERT_EQ(count_staging->step(), SQLITE_ROW);
+        EXPECT_EQ(count_staging->column_int(0), 0);
+    }
+
+    this->database_handler.replace_local_authorization_list(
+        {AuthorizationData{previous_token, IdTokenInfo{AuthorizationStatusEnum::Accepted}}});
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_number_of_entries(), 1);
+    EXPECT_TRUE(this->database_handler.get_local_authorization_list_entry(previous_token).has_value());
+}
+
+TEST_F(DatabaseHandlerTest, LocalAuthorizationList_FailedReplaceKeepsPreviousList) {
+    const IdToken previous_token{"PREVIOUS", "ISO14443"};
+    this->database_handler.insert_or_update_local_authorization_list_entry(
+        previous_token, IdTokenInfo{AuthorizationStatusEnum::Accepted});
+
+    // without staging table the new list can not be written
+    ASSERT_TRUE(this->database->execute_statement("DROP TABLE AUTH_LIST_STAGING"));
+    EXPECT_THROW(this->database_handler.replace_local_authorization_list(
+                     {AuthorizationData{IdToken{"NEW", "ISO14443"}, IdTokenInfo{AuthorizationStatusEnum::Accepted}}}),
+                 everest::db::QueryExecutionException);
+
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_number_of_entries(), 1);
+    EXPECT_TRUE(this->database_handler.get_local_authorization_list_entry(previous_token).has_value());
+}
+
+namespace {
+MeterValue periodic_meter_value(const std::string& timestamp, float energy, ReadingContextEnum context) {
+    MeterValue meter_value;
+    meter_value.timestamp = DateTime(timestamp);
+    for (const auto phase : {PhaseEnum::L1, PhaseEnum::L2, PhaseEnum::L3}) {
+        SampledValue sampled_value;
+        sampled_value.value = energy;
+        sampled_value.measurand = MeasurandEnum::Energy_Active_Import_Register;
+        sampled_value.phase = phase;
+        sampled_value.context = context;
+        sampled_value.unitOfMeasure = UnitOfMeasure{CiString<20>("Wh"), std::nullopt, std::nullopt};
+        meter_value.sampledValue.push_back(sampled_value);
+    }
+    return meter_value;
+}
+} // namespace
+
+TEST_F(DatabaseHandlerTest, TransactionMeterValues_InsertGetAllAndClear) {
+    std::vector<MeterValue> expected;
+    expected.push_back(periodic_meter_value("2024-07-15T08:00:00Z", 0.0f, ReadingContextEnum::Transaction_Begin));
+    for (int i = 1; i <= 100; i++) {
+        expected.push_back(
+            periodic_meter_value("2024-07-15T08:00:00Z", i * 10.0f, ReadingContextEnum::Sample_Periodic));
+        expected.back().timestamp = DateTime(expected.front().timestamp.to_time_point() + std::chrono::seconds(10 * i));
+    }
+    for (const auto& meter_value : expected) {
+        this->database_handler.transaction_metervalues_insert("txId", meter_value);
+    }
+    this->database_handler.transaction_metervalues_insert(
+        "otherTxId", periodic_meter_value("2024-07-15T09:00:00Z", 1.0f, ReadingContextEnum::Transaction_Begin));
+
+    const auto meter_values = this->database_handler.transaction_metervalues_get_all("txId");
+    ASSERT_EQ(meter_values.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(json(meter_values.at(i)), json(expected.at(i)));
+    }
+
+    this->database_handler.transaction_metervalues_clear("txId");
+    EXPECT_TRUE(this->database_handler.transaction_metervalues_get_all("txId").empty());
+    EXPECT_EQ(this->database_handler.transaction_metervalues_get_all("otherTxId").size(), 1);
+}
+
+TEST_F(DatabaseHandlerTest, TransactionMeterValues_InsertContinuesStoredTransaction) {
+    const auto first = periodic_meter_value("2024-07-15T08:00:00Z", 1.0f, ReadingContextEnum::Transaction_Begin);
+    const auto second = periodic_meter_value("2024-07-15T08:00:10Z", 2.0f, ReadingContextEnum::Sample_Periodic);
+    this->database_handler.transaction_insert(*default_transaction(), DEFAULT_EVSE_ID);
+    this->database_handler.transaction_metervalues_insert("txId", first);
+
+    // a second handler on the same database, e.g. after a restart with an ongoing transaction, appends to the records
+    // written by the first one
+    DatabaseHandler restarted_handler{std::make_unique<everest::db::sqlite::Connection>("file::memory:?cache=shared"),
+                                      std::filesystem::path(MIGRATION_FILES_LOCATION_V2)};
+    restarted_handler.open_connection();
+    restarted_handler.transaction_metervalues_insert("txId", second);
+
+    const auto meter_values = this->database_handler.transaction_metervalues_get_all("txId");
+    ASSERT_EQ(meter_values.size(), 2);
+    EXPECT_EQ(json(meter_values.at(0)), json(first));
+    EXPECT_EQ(json(meter_values.at(1)), json(second));
+}
+
+TEST_F(DatabaseHandlerTest, TransactionMeterValues_InsertIgnoresMeterValuesWithoutContext) {
+    auto meter_value = periodic_meter_value("2024-07-15T08:00:00Z", 1.0f, ReadingContextEnum::Sample_Periodic);
+    meter_value.sampledValue.at(0).context.reset();
+    this->database_handler.transaction_metervalues_insert("txId", meter_value);
+    this->database_handler.transaction_metervalues_insert("txId", MeterValue{});
+    EXPECT_TRUE(this->database_handler.transaction_metervalues_get_all("txId").empty());
+
+    meter_value.sampledValue.at(0).context = ReadingContextEnum::Trigger;
+    EXPECT_THROW(this->database_handler.transaction_metervalues_insert("txId", meter_value), std::invalid_argument);
+}
+
+TEST_F(DatabaseHandlerTest, TransactionMeterValues_ConvertsLegacyMeterValues) {
+    const std::string uri = "file:legacy_meter_values?mode=memory&cache=shared";
+    everest::db::sqlite::Connection legacy_database{uri};
+    ASSERT_TRUE(legacy_database.open_connection());
+    everest::db::sqlite::SchemaUpdater updater{&legacy_database};
+    ASSERT_TRUE(updater.apply_migration_files(MIGRATION_FILES_LOCATION_V2, 7));
+
+    // meter values of an ongoing transaction as stored before the compact_meter_values migration
+    ASSERT_TRUE(legacy_database.execute_statement(
+        "INSERT INTO TRANSACTIONS VALUES ('txId', 1, 1, 1721030400000, 0, 'Charging', 1)"));
+    ASSERT_TRUE(legacy_database.execute_statement(
+        "INSERT INTO METER_VALUES VALUES (1, 'txId', 1721030400000, " +
+        std::to_string(static_cast<int>(ReadingContextEnum::Sample_Periodic)) + ", NULL)"));
+    ASSERT_TRUE(legacy_database.execute_statement(
+        "INSERT INTO METER_VALUE_ITEMS VALUES (1, 12.5, " +
+        std::to_string(static_cast<int>(MeasurandEnum::Energy_Active_Import_Register)) +
+        ", NULL, NULL, NULL, NULL, 'Wh', NULL, 'data', 'method', 'encoding', 'key')"));
+
+    DatabaseHandler upgraded_handler{std::make_unique<everest::db::sqlite::Connection>(uri),
+                                     std::filesystem::path(MIGRATION_FILES_LOCATION_V2)};
+    upgraded_handler.open_connection();
+
+    const auto meter_values = upgraded_handler.transaction_metervalues_get_all("txId");
+    ASSERT_EQ(meter_values.size(), 1);
+    EXPECT_EQ(meter_values.at(0).timestamp, DateTime("2024-07-15T08:00:00Z"));
+    ASSERT_EQ(meter_values.at(0).sampledValue.size(), 1);
+    const auto& sampled_value = meter_values.at(0).sampledValue.at(0);
+    EXPECT_EQ(sampled_value.value, 12.5f);
+    EXPECT_EQ(sampled_value.context, ReadingContextEnum::Sample_Periodic);
+    EXPECT_EQ(sampled_value.measurand, MeasurandEnum::Energy_Active_Import_Register);
+    ASSERT_TRUE(sampled_value.unitOfMeasure.has_value());
+    EXPECT_EQ(sampled_value.unitOfMeasure->unit.value().get(), "Wh");
+    ASSERT_TRUE(sampled_value.signedMeterValue.has_value());
+    EXPECT_EQ(sampled_value.signedMeterValue->signedMeterData.get(), "data");
+
+    auto stmt = legacy_database.new_statement("SELECT name FROM sqlite_master WHERE name LIKE 'LEGACY_%'");
+    EXPECT_EQ(stmt->step(), SQLITE_DONE);
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <ocpp/v2/json_stream.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+namespace {
+TransactionEventRequest create_transaction_event() {
+    SampledValue energy;
+    energy.value = 1234.5f;
+    energy.measurand = MeasurandEnum::Energy_Active_Import_Register;
+    energy.context = ReadingContextEnum::Sample_Periodic;
+    energy.unitOfMeasure = UnitOfMeasure{CiString<20>("kWh"), 3, std::nullopt};
+    SampledValue current;
+    current.value = 16.0f;
+    current.phase = PhaseEnum::L1;
+    current.customData = json{{"vendorId", "EVerest"}, {"raw", {1, 2, 3}}};
+
+    TransactionEventRequest req;
+    req.eventType = TransactionEventEnum::Updated;
+    req.timestamp = ocpp::DateTime("2024-01-01T12:00:00.000Z");
+    req.triggerReason = TriggerReasonEnum::MeterValuePeriodic;
+    req.seqNo = 7;
+    req.transactionInfo.transactionId = "c0ffee \"quoted\"";
+    req.transactionInfo.chargingState = ChargingStateEnum::Charging;
+    req.meterValue = {MeterValue{{energy, current}, ocpp::DateTime("2024-01-01T12:00:00.000Z"), std::nullopt}};
+    req.offline = false;
+    req.evse = EVSE{1, 1, std::nullopt};
+    req.idToken = IdToken{"DEADBEEF", "ISO14443", std::vector<AdditionalInfo>{{"extra", "type", std::nullopt}},
+                          std::nullopt};
+    return req;
+}
+} // namespace
+
+TEST(JsonStreamTest, WriterMatchesToJson) {
+    const auto req = create_transaction_event();
+    std::string buffer;
+    JsonWriter writer(buffer);
+    write_json(writer, req);
+    EXPECT_EQ(json::parse(buffer), json(req));
+}
+
+TEST(JsonStreamTest, ReaderMatchesFromJson) {
+    const auto text = json(create_transaction_event()).dump();
+    JsonReader reader(text);
+    TransactionEventRequest req;
+    read_json(reader, req);
+    reader.end();
+    EXPECT_EQ(json(req), json::parse(text));
+}
+
+TEST(JsonStreamTest, CallRoundTrip) {
+    const Call<TransactionEventRequest> call(create_transaction_event(), MessageId("message-1"));
+    std::string buffer;
+    JsonWriter writer(buffer);
+    write_json(writer, call);
+    EXPECT_EQ(json::parse(buffer), json(call));
+
+    JsonReader reader(buffer);
+    Call<TransactionEventRequest> read_call;
+    read_json(reader, read_call);
+    EXPECT_EQ(read_call.uniqueId, call.uniqueId);
+    EXPECT_EQ(json(read_call.msg), json(call.msg));
+}
+
+TEST(JsonStreamTest, ReadsTransactionEventResponse) {
+    const std::string text =
+        R"([3, "message-1", {"totalCost": 1.25, "unknownKey": [{"x": 1}],
+            "idTokenInfo": {"status": "Accepted", "evseId": [1, 2],
+                            "groupIdToken": {"idToken": "GROUP", "type": "Central"}}}])";
+    JsonReader reader(text);
+    CallResult<TransactionEventResponse> call_result;
+    read_json(reader, call_result);
+    reader.end();
+
+    EXPECT_EQ(call_result.uniqueId.get(), "message-1");
+    EXPECT_EQ(call_result.msg.totalCost, 1.25f);
+    ASSERT_TRUE(call_result.msg.idTokenInfo.has_value());
+    EXPECT_EQ(call_result.msg.idTokenInfo->status, AuthorizationStatusEnum::Accepted);
+    EXPECT_EQ(call_result.msg.idTokenInfo->evseId, (std::vector<std::int32_t>{1, 2}));
+    EXPECT_EQ(call_result.msg.idTokenInfo->groupIdToken->idToken.get(), "GROUP");
+}
+
+TEST(JsonStreamTest, ReadsVariableAttributeValuesLikeFromJson) {
+    const std::string text = R"({"value": true, "type": "Actual"})";
+    JsonReader reader(text);
+    VariableAttribute attribute;
+    read_json(reader, attribute);
+    EXPECT_EQ(attribute.value->get(), "true");
+    EXPECT_EQ(json(attribute), json(json::parse(text).get<VariableAttribute>()));
+}
+
+TEST(JsonStreamTest, ReaderRejectsInvalidPayloads) {
+    const auto read = [](const std::string& text) {
+        JsonReader reader(text);
+        IdTokenInfo info;
+        read_json(reader, info);
+    };
+    EXPECT_NO_THROW(read(R"({"status": "Accepted"})"));
+    EXPECT_THROW(read(R"({"chargingPriority": 1})"), JsonStreamException);
+    EXPECT_THROW(read(R"({"status": "NoSuchStatus"})"), EnumConversionException);
+    EXPECT_THROW(read(R"({"status": "Accepted", "language1": "too long string"})"), StringConversionException);
+}
+
+} // namespace v2
+} // namespace ocpp
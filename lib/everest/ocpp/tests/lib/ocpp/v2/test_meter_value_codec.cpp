@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/v2/meter_value_codec.hpp>
+
+using namespace ocpp;
+using namespace ocpp::v2;
+
+namespace {
+
+SampledValue sampled_value(float value, MeasurandEnum measurand, std::optional<PhaseEnum> phase,
+                           ReadingContextEnum context = ReadingContextEnum::Sample_Periodic) {
+    SampledValue sampled_value;
+    sampled_value.value = value;
+    sampled_value.measurand = measurand;
+    sampled_value.phase = phase;
+    sampled_value.context = context;
+    return sampled_value;
+}
+
+MeterValue periodic_meter_value(const std::string& timestamp, float energy) {
+    MeterValue meter_value;
+    meter_value.timestamp = DateTime(timestamp);
+    meter_value.sampledValue.push_back(
+        sampled_value(energy, MeasurandEnum::Energy_Active_Import_Register, std::nullopt));
+    for (const auto phase : {PhaseEnum::L1, PhaseEnum::L2, PhaseEnum::L3}) {
+        meter_value.sampledValue.push_back(sampled_value(16.25f, MeasurandEnum::Current_Import, phase));
+        meter_value.sampledValue.push_back(sampled_value(230.5f, MeasurandEnum::Voltage, phase));
+    }
+    return meter_value;
+}
+
+} // namespace
+
+TEST(MeterValueCodecTest, RoundTripKeepsAllFields) {
+    MeterValue meter_value;
+    meter_value.timestamp = DateTime("2024-01-01T12:00:00.123Z");
+
+    auto signed_value = sampled_value(1234.5f, MeasurandEnum::Energy_Active_Import_Register, std::nullopt,
+                                      ReadingContextEnum::Transaction_Begin);
+    signed_value.location = LocationEnum::Outlet;
+    signed_value.unitOfMeasure = UnitOfMeasure{CiString<20>("kWh"), 3, std::nullopt};
+    signed_value.signedMeterValue = SignedMeterValue{"data", "OCMF", "ECDSA", "key", std::nullopt};
+    meter_value.sampledValue.push_back(signed_value);
+    meter_value.sampledValue.push_back(
+        sampled_value(-0.0f, MeasurandEnum::Current_Export, PhaseEnum::L2_N, ReadingContextEnum::Transaction_Begin));
+
+    MeterValueCodec encoder;
+    MeterValueCodec decoder;
+    const auto decoded = decoder.decode(encoder.encode(meter_value));
+
+    EXPECT_EQ(json(decoded), json(meter_value));
+}
+
+TEST(MeterValueCodecTest, RepeatedMeasurandsAreEncodedCompactly) {
+    MeterValueCodec encoder;
+    const auto first = encoder.encode(periodic_meter_value("2024-01-01T12:00:00Z", 1000.0f));
+    const auto second = encoder.encode(periodic_meter_value("2024-01-01T12:00:10Z", 1010.0f));
+
+    // the second record only holds the timestamp difference, context, count and an index and value per sample
+    EXPECT_GT(first.size(), second.size());
+    EXPECT_LE(second.size(), 3u + 3u + 7u * 5u);
+
+    MeterValueCodec decoder;
+    EXPECT_EQ(json(decoder.decode(first)), json(periodic_meter_value("2024-01-01T12:00:00Z", 1000.0f)));
+    EXPECT_EQ(json(decoder.decode(second)), json(periodic_meter_value("2024-01-01T12:00:10Z", 1010.0f)));
+}
+
+TEST(MeterValueCodecTest, SignedMeterValuesDoNotAddDescriptors) {
+    const auto signed_meter_value = [](const std::string& timestamp, int sample) {
+        MeterValue meter_value;
+        meter_value.timestamp = DateTime(timestamp);
+        auto energy = sampled_value(1000.0f + sample, MeasurandEnum::Energy_Active_Import_Register, std::nullopt);
+        energy.signedMeterValue =
+            SignedMeterValue{"signed-data-" + std::to_string(sample), "OCMF", "ECDSA", "key", std::nullopt};
+        meter_value.sampledValue.push_back(energy);
+        return meter_value;
+    };
+
+    MeterValueCodec encoder;
+    MeterValueCodec decoder;
+    std::vector<std::size_t> sizes;
+    for (int sample = 1; sample <= 3; sample++) {
+        const auto meter_value = signed_meter_value("2024-01-01T12:00:" + std::to_string(10 * sample) + "Z", sample);
+        const auto record = encoder.encode(meter_value);
+        EXPECT_EQ(json(decoder.decode(record)), json(meter_value));
+        sizes.push_back(record.size());
+    }
+
+    // only the first record holds the descriptor, the following ones just their own signed meter value
+    EXPECT_GT(sizes.at(0), sizes.at(1));
+    EXPECT_EQ(sizes.at(1), sizes.at(2));
+}
+
+TEST(MeterValueCodecTest, DecodingRestoresEncoderState) {
+    MeterValueCodec encoder;
+    std::vector<std::vector<std::uint8_t>> records;
+    for (int i = 0; i < 3; i++) {
+        records.push_back(encoder.encode(periodic_meter_value("2024-01-01T12:00:0" + std::to_string(i) + "Z", i)));
+    }
+
+    // a codec that decoded the existing records continues exactly like the original one
+    MeterValueCodec restored;
+    for (const auto& record : records) {
+        restored.decode(record);
+    }
+    const auto next = periodic_meter_value("2024-01-01T11:59:00Z", 3.0f);
+    EXPECT_EQ(restored.encode(next), encoder.encode(next));
+}
+
+TEST(MeterValueCodecTest, MeterValuesWithoutSamplesOrContext) {
+    MeterValue empty;
+    empty.timestamp = DateTime("2024-01-01T12:00:00Z");
+    MeterValue without_context = periodic_meter_value("2024-01-01T12:00:00Z", 1.0f);
+    for (auto& sampled_value : without_context.sampledValue) {
+        sampled_value.context.reset();
+    }
+
+    MeterValueCodec encoder;
+    MeterValueCodec decoder;
+    EXPECT_EQ(json(decoder.decode(encoder.encode(empty))), json(empty));
+    EXPECT_EQ(json(decoder.decode(encoder.encode(without_context))), json(without_context));
+}
+
+TEST(MeterValueCodecTest, MixedContextsAreRejected) {
+    auto meter_value = periodic_meter_value("2024-01-01T12:00:00Z", 1.0f);
+    meter_value.sampledValue.back().context = ReadingContextEnum::Trigger;
+
+    MeterValueCodec encoder;
+    EXPECT_THROW(encoder.encode(meter_value), std::invalid_argument);
+}
+
+TEST(MeterValueCodecTest, MalformedRecordsAreRejected) {
+    MeterValueCodec encoder;
+    auto record = encoder.encode(periodic_meter_value("2024-01-01T12:00:00Z", 1.0f));
+
+    auto truncated = record;
+    truncated.pop_back();
+    EXPECT_THROW(MeterValueCodec().decode(truncated), std::runtime_error);
+
+    auto trailing = record;
+    trailing.push_back(0);
+    EXPECT_THROW(MeterValueCodec().decode(trailing), std::runtime_error);
+
+    // the second record refers to descriptors of the first one
+    const auto second = encoder.encode(periodic_meter_value("2024-01-01T12:00:10Z", 2.0f));
+    EXPECT_THROW(MeterValueCodec().decode(second), std::runtime_error);
+}
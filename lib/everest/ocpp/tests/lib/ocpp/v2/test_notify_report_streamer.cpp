@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <ocpp/v2/notify_report_streamer.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+class NotifyReportStreamerTest : public ::testing::Test {
+    int message_count = 0;
+
+protected:
+    std::vector<json> calls{};
+    std::vector<std::string> serialized_calls{};
+
+    NotifyReportStreamer create_streamer(size_t max_size, size_t max_items = 0) {
+        return NotifyReportStreamer{42, max_size, max_items,
+                                    [this]() {
+                                        std::stringstream s;
+                                        s << "test_message_" << message_count;
+                                        message_count++;
+                                        return MessageId{s.str()};
+                                    },
+                                    [this](const json& call, std::string serialized_call) {
+                                        this->calls.push_back(call);
+                                        this->serialized_calls.push_back(std::move(serialized_call));
+                                    }};
+    }
+
+    static std::vector<ReportData> create_report_data(int count) {
+        std::vector<ReportData> report_data;
+        for (int i = 0; i < count; i++) {
+            report_data.push_back(
+                ReportData{{"component_" + std::to_string(i)}, {"variable_" + std::to_string(i)}, {}, {}, {}});
+        }
+        return report_data;
+    }
+
+    // verify the calls are serializations of Call<NotifyReportRequest> with consecutive seqNo and tbc set on all but
+    // the last one, and that the serialized calls match them
+    void check_calls() {
+        ASSERT_EQ(serialized_calls.size(), calls.size());
+        for (size_t i = 0; i < calls.size(); i++) {
+            ASSERT_EQ(json::parse(serialized_calls[i]), calls[i]);
+            ASSERT_EQ(calls[i].size(), 4);
+            ASSERT_EQ(calls[i][MESSAGE_TYPE_ID], MessageTypeId::CALL);
+            ASSERT_EQ(calls[i][MESSAGE_ID], "test_message_" + std::to_string(i));
+            ASSERT_EQ(calls[i][CALL_ACTION], "NotifyReport");
+            Call<NotifyReportRequest> call{};
+            from_json(calls[i], call);
+            ASSERT_EQ(call.msg.requestId, 42);
+            ASSERT_EQ(call.msg.seqNo, i);
+            ASSERT_EQ(call.msg.tbc, i + 1 < calls.size());
+        }
+    }
+
+    // reportData of all calls
+    json collect_report_data() {
+        json report_data = json::array();
+        for (const auto& call : calls) {
+            if (call[CALL_PAYLOAD].contains("reportData")) {
+                for (const auto& item : call[CALL_PAYLOAD]["reportData"]) {
+                    report_data.push_back(item);
+                }
+            }
+        }
+        return report_data;
+    }
+};
+
+/// \brief Test an empty report results into a single call without reportData
+TEST_F(NotifyReportStreamerTest, test_empty_report) {
+    auto streamer = create_streamer(1000);
+    streamer.finish();
+
+    ASSERT_EQ(calls.size(), 1);
+    check_calls();
+    ASSERT_FALSE(calls[0][CALL_PAYLOAD].contains("reportData"));
+    ASSERT_EQ(streamer.get_call_count(), 1);
+}
+
+/// \brief Test a report that fits exactly the provided bound is not split
+TEST_F(NotifyReportStreamerTest, test_report_fitting_exactly) {
+    const auto report_data = create_report_data(5);
+
+    NotifyReportRequest req{};
+    req.requestId = 42;
+    req.reportData = report_data;
+    req.tbc = false;
+    req.seqNo = 0;
+    const auto full_size = json{2, "test_message_0", "NotifyReport", req}.dump().size();
+
+    auto streamer = create_streamer(full_size);
+    for (const auto& item : report_data) {
+        streamer.add(item);
+    }
+    streamer.finish();
+
+    ASSERT_EQ(calls.size(), 1);
+    check_calls();
+    ASSERT_EQ(serialized_calls[0].size(), full_size);
+    ASSERT_EQ(collect_report_data(), json(report_data));
+}
+
+/// \brief Test calls are handed over while the report is produced and respect the maximum size
+TEST_F(NotifyReportStreamerTest, test_report_is_streamed) {
+    const auto report_data = create_report_data(100);
+    const size_t max_size = 1000;
+
+    auto streamer = create_streamer(max_size);
+    for (size_t i = 0; i < report_data.size(); i++) {
+        streamer.add(report_data[i]);
+        // only the ReportData of the pending call is buffered
+        ASSERT_LE(i - collect_report_data().size(), max_size / json(report_data[i]).dump().size());
+    }
+    streamer.finish();
+
+    ASSERT_GT(calls.size(), 1);
+    check_calls();
+    for (const auto& serialized_call : serialized_calls) {
+        ASSERT_LE(serialized_call.size(), max_size);
+    }
+    ASSERT_EQ(collect_report_data(), json(report_data));
+    ASSERT_EQ(streamer.get_call_count(), calls.size());
+}
+
+/// \brief Test a ReportData that exceeds the maximum size on its own is sent in a call of its own
+TEST_F(NotifyReportStreamerTest, test_oversized_report_data) {
+    const auto report_data = create_report_data(3);
+
+    auto streamer = create_streamer(10);
+    for (const auto& item : report_data) {
+        streamer.add(item);
+    }
+    streamer.finish();
+
+    ASSERT_EQ(calls.size(), 3);
+    check_calls();
+    ASSERT_EQ(collect_report_data(), json(report_data));
+}
+
+/// \brief Test calls are split when they reach the maximum number of items, even if more would fit
+TEST_F(NotifyReportStreamerTest, test_max_items) {
+    const auto report_data = create_report_data(7);
+
+    auto streamer = create_streamer(100000, 3);
+    for (const auto& item : report_data) {
+        streamer.add(item);
+    }
+    streamer.finish();
+
+    ASSERT_EQ(calls.size(), 3);
+    check_calls();
+    ASSERT_EQ(calls[0][CALL_PAYLOAD]["reportData"].size(), 3);
+    ASSERT_EQ(calls[1][CALL_PAYLOAD]["reportData"].size(), 3);
+    ASSERT_EQ(calls[2][CALL_PAYLOAD]["reportData"].size(), 1);
+    ASSERT_EQ(collect_report_data(), json(report_data));
+}
+
+} // namespace v2
+} // namespace ocpp
@@ -51,6 +51,7 @@ set(LIBOCPP_TEST_DEFAULT_LINK_LIBRARIES
         everest::log
         everest::evse_security
         everest::sqlite
+        everest::util_json_stream
 )
 
 # If the test is not linked against the ocpp library, those default sources can be linked against, they will often
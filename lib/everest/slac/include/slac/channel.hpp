@@ -3,8 +3,11 @@
 #ifndef SLAC_CHANNEL_HPP
 #define SLAC_CHANNEL_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2021 Pionix GmbH and Contributors to EVerest
@@ -22,13 +25,24 @@ namespace slac {
 //  - channel could own the interface handle and pass it to the packet
 //    socket
 
+struct ChannelOptions {
+    // let the kernel drop frames that are neither addressed to the interface nor broadcast before they are copied
+    // to user space
+    bool kernel_filter{false};
+    // if kernel_filter is set and this list is not empty, only frames with these MMTYPEs (mode bits are ignored)
+    // are passed
+    std::vector<uint16_t> mmtypes;
+    // number of frames received per system call, 1 disables batching
+    std::size_t rx_batch_size{1};
+};
+
 class Channel {
 public:
     Channel();
     // Channel(const std::string& interface_name);
     ~Channel();
 
-    bool open(const std::string& interface_name);
+    bool open(const std::string& interface_name, const ChannelOptions& options = {});
     bool read(slac::messages::HomeplugMessage& msg, int timeout);
     bool write(slac::messages::HomeplugMessage& msg, int timeout);
 
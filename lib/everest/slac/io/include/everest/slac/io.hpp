@@ -14,7 +14,7 @@
 class SlacIO {
 public:
     using InputHandlerFnType = void(slac::messages::HomeplugMessage&);
-    void init(const std::string& if_name);
+    void init(const std::string& if_name, const slac::ChannelOptions& options = {});
 
     void run(std::function<InputHandlerFnType> callback);
     void send(slac::messages::HomeplugMessage& msg);
@@ -5,8 +5,8 @@
 #include <stdexcept>
 #include <thread>
 
-void SlacIO::init(const std::string& if_name) {
-    if (!slac_channel.open(if_name)) {
+void SlacIO::init(const std::string& if_name, const slac::ChannelOptions& options) {
+    if (!slac_channel.open(if_name, options)) {
         throw std::runtime_error(slac_channel.get_error());
     }
 }
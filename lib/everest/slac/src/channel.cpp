@@ -12,7 +12,7 @@ namespace slac {
 
 Channel::Channel() : socket(nullptr){};
 
-bool Channel::open(const std::string& interface_name) {
+bool Channel::open(const std::string& interface_name, const ChannelOptions& options) {
     did_timeout = false;
 
     auto if_info = ::utils::InterfaceInfo(interface_name);
@@ -29,6 +29,15 @@ bool Channel::open(const std::string& interface_name) {
         socket.reset();
         return false;
     }
+
+    if (options.kernel_filter and not socket->set_filter(orig_if_mac, options.mmtypes)) {
+        error = socket->get_error();
+        socket.reset();
+        return false;
+    }
+
+    socket->set_rx_batch_size(options.rx_batch_size);
+
     return true;
 }
 
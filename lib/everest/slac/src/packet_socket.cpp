@@ -6,6 +6,7 @@
 
 #include <arpa/inet.h>
 #include <ifaddrs.h>
+#include <linux/filter.h>
 #include <linux/if_packet.h>
 #include <poll.h>
 #include <sys/socket.h>
@@ -13,6 +14,74 @@
 #include <unistd.h>
 
 namespace utils {
+
+namespace {
+// offsets into the raw frame, see slac::messages::homeplug_message
+const uint32_t FRAME_OFFSET_DESTINATION_MAC = 0;
+const uint32_t FRAME_OFFSET_MMTYPE = ETH_HLEN + 1;
+const uint16_t MMTYPE_MODE_MASK = 0x0003;
+// BPF jump offsets are 8 bit wide
+const size_t MAX_FILTER_MMTYPES = 200;
+// MMTYPE is transmitted in little endian, BPF loads are big endian, so the mode bits end up in bits 8 and 9
+const uint32_t BPF_MMTYPE_MODE_MASK = 0xFCFF;
+const uint32_t BPF_ACCEPT_FRAME = 0xFFFF;
+const uint32_t BPF_DROP_FRAME = 0;
+
+uint32_t mmtype_as_loaded_by_bpf(uint16_t mmtype) {
+    return ((mmtype & 0xFFu) << 8) | (mmtype >> 8);
+}
+
+std::vector<struct sock_filter> build_homeplug_filter(const uint8_t* destination_mac,
+                                                      const std::vector<uint16_t>& mmtypes) {
+    const uint32_t mac_high = (static_cast<uint32_t>(destination_mac[0]) << 24) |
+                              (static_cast<uint32_t>(destination_mac[1]) << 16) |
+                              (static_cast<uint32_t>(destination_mac[2]) << 8) | destination_mac[3];
+    const uint32_t mac_low = (static_cast<uint32_t>(destination_mac[4]) << 8) | destination_mac[5];
+
+    // layout:
+    //   0: A = dst[0..3]
+    //   1: A == mac_high ? 2 : 4
+    //   2: A = dst[4..5]
+    //   3: A == mac_low ? pass : drop
+    //   4: A == ff:ff:ff:ff ? 5 : drop
+    //   5: A = dst[4..5]
+    //   6: A == ff:ff ? pass : drop
+    //   7: optional mmtype checks, jumping to accept on match
+    //   drop, accept
+    const uint8_t mmtype_check_index = 7;
+    const uint8_t drop_index = mmtype_check_index + (mmtypes.empty() ? 0 : 2 + mmtypes.size());
+    const uint8_t accept_index = drop_index + 1;
+    const uint8_t pass_index = mmtypes.empty() ? accept_index : mmtype_check_index;
+    const auto jump_to = [](uint8_t from, uint8_t to) { return static_cast<uint8_t>(to - from - 1); };
+
+    std::vector<struct sock_filter> program = {
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, FRAME_OFFSET_DESTINATION_MAC),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, mac_high, 0, 2),
+        BPF_STMT(BPF_LD | BPF_H | BPF_ABS, FRAME_OFFSET_DESTINATION_MAC + 4),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, mac_low, jump_to(3, pass_index), jump_to(3, drop_index)),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0xFFFFFFFF, 0, jump_to(4, drop_index)),
+        BPF_STMT(BPF_LD | BPF_H | BPF_ABS, FRAME_OFFSET_DESTINATION_MAC + 4),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0xFFFF, jump_to(6, pass_index), jump_to(6, drop_index)),
+    };
+
+    if (not mmtypes.empty()) {
+        program.push_back(BPF_STMT(BPF_LD | BPF_H | BPF_ABS, FRAME_OFFSET_MMTYPE));
+        program.push_back(BPF_STMT(BPF_ALU | BPF_AND | BPF_K, BPF_MMTYPE_MODE_MASK));
+        for (const auto mmtype : mmtypes) {
+            const auto index = static_cast<uint8_t>(program.size());
+            const auto base_mmtype = static_cast<uint16_t>(mmtype & ~MMTYPE_MODE_MASK);
+            program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, mmtype_as_loaded_by_bpf(base_mmtype),
+                                       jump_to(index, accept_index), 0));
+        }
+    }
+
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, BPF_DROP_FRAME));
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, BPF_ACCEPT_FRAME));
+
+    return program;
+}
+} // namespace
+
 InterfaceInfo::InterfaceInfo(const std::string& interface_name) {
     // fetch all interfaces
     struct ifaddrs* if_addrs;
@@ -77,7 +146,69 @@ PacketSocket::PacketSocket(const InterfaceInfo& if_info, int protocol) {
     valid = true;
 }
 
+bool PacketSocket::set_filter(const uint8_t* destination_mac, const std::vector<uint16_t>& mmtypes) {
+    if (mmtypes.size() > MAX_FILTER_MMTYPES) {
+        error = "Too many MMTYPEs for the packet filter";
+        return false;
+    }
+
+    auto program = build_homeplug_filter(destination_mac, mmtypes);
+    struct sock_fprog filter = {
+        static_cast<unsigned short>(program.size()), // len
+        program.data()                               // filter
+    };
+
+    if (-1 == setsockopt(socket_fd, SOL_SOCKET, SO_ATTACH_FILTER, &filter, sizeof(filter))) {
+        error = std::string("Failed to attach packet filter: ") + strerror(errno);
+        return false;
+    }
+
+    // frames received between bind() and attaching the filter have not been filtered, drop them
+    uint8_t discard_buffer[MIN_BUFFER_SIZE];
+    while (::recv(socket_fd, discard_buffer, sizeof(discard_buffer), MSG_DONTWAIT) >= 0) {
+    }
+    rx_batch_count = 0;
+    rx_batch_next = 0;
+
+    return true;
+}
+
+void PacketSocket::set_rx_batch_size(size_t batch_size) {
+    if (batch_size <= 1) {
+        rx_batch_buffer.clear();
+        rx_batch_iovecs.clear();
+        rx_batch_headers.clear();
+        rx_batch_count = 0;
+        rx_batch_next = 0;
+        return;
+    }
+
+    rx_batch_buffer.assign(batch_size * MIN_BUFFER_SIZE, 0);
+    rx_batch_iovecs.resize(batch_size);
+    rx_batch_headers.assign(batch_size, {});
+    for (size_t i = 0; i < batch_size; ++i) {
+        rx_batch_iovecs[i].iov_base = rx_batch_buffer.data() + i * MIN_BUFFER_SIZE;
+        rx_batch_iovecs[i].iov_len = MIN_BUFFER_SIZE;
+        rx_batch_headers[i].msg_hdr.msg_iov = &rx_batch_iovecs[i];
+        rx_batch_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+    rx_batch_count = 0;
+    rx_batch_next = 0;
+}
+
+PacketSocket::IOResult PacketSocket::read_from_batch(uint8_t* buffer) {
+    const auto& header = rx_batch_headers[rx_batch_next];
+    bytes_read = static_cast<int>(header.msg_len);
+    memcpy(buffer, rx_batch_iovecs[rx_batch_next].iov_base, bytes_read);
+    ++rx_batch_next;
+    return IOResult::Ok;
+}
+
 PacketSocket::IOResult PacketSocket::read(uint8_t* buffer, int timeout) {
+    if (rx_batch_next < rx_batch_count) {
+        return read_from_batch(buffer);
+    }
+
     struct pollfd poll_fd = {
         socket_fd, // file descriptor
         POLLIN,    // requested event
@@ -98,6 +229,20 @@ PacketSocket::IOResult PacketSocket::read(uint8_t* buffer, int timeout) {
         return IOResult::Failure;
     }
 
+    if (not rx_batch_headers.empty()) {
+        const auto received = recvmmsg(socket_fd, rx_batch_headers.data(), rx_batch_headers.size(), 0, nullptr);
+        if (received == -1) {
+            error = std::string("recvmmsg() failed with: ") + strerror(errno);
+            return IOResult::Failure;
+        }
+        rx_batch_count = received;
+        rx_batch_next = 0;
+        if (received == 0) {
+            return IOResult::Timeout;
+        }
+        return read_from_batch(buffer);
+    }
+
     bytes_read = ::read(socket_fd, buffer, MIN_BUFFER_SIZE);
     if (bytes_read == -1) {
         error = std::string("read() failed with: ") + strerror(errno);
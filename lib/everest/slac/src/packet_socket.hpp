@@ -3,10 +3,14 @@
 #ifndef SRC_PACKET_SOCKET_HPP
 #define SRC_PACKET_SOCKET_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <linux/if_ether.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 
 namespace utils {
 class InterfaceInfo {
@@ -59,13 +63,31 @@ public:
 
     IOResult write(const void* buf, size_t count, int timeout);
 
+    // attaches a classic BPF program to the socket, so that the kernel only passes frames addressed to
+    // destination_mac or to the broadcast address and, if mmtypes is not empty, only frames whose MMTYPE without the
+    // mode bits is contained in mmtypes
+    bool set_filter(const uint8_t* destination_mac, const std::vector<uint16_t>& mmtypes);
+
+    // receive up to batch_size frames with a single recvmmsg() call, following reads are served from this batch
+    // until it is consumed, a batch_size of 1 disables batching
+    void set_rx_batch_size(size_t batch_size);
+
     static const int MIN_BUFFER_SIZE = ETH_FRAME_LEN;
 
 private:
+    IOResult read_from_batch(uint8_t* buffer);
+
     int bytes_read{-1};
     bool valid{false};
     std::string error;
     int socket_fd{-1};
+
+    // batched receive
+    std::vector<uint8_t> rx_batch_buffer;
+    std::vector<struct iovec> rx_batch_iovecs;
+    std::vector<struct mmsghdr> rx_batch_headers;
+    size_t rx_batch_count{0};
+    size_t rx_batch_next{0};
 };
 } // namespace utils
 
@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+// Replays a pcap capture of HomePlug traffic over a veth pair and measures how many frames reach user space and how
+// much CPU time the receiving side spends with and without the kernel packet filter and batched receive.
+//
+// setup (as root):
+//   ip link add veth0 type veth peer name veth1
+//   ip link set veth0 up && ip link set veth1 up
+//   replay_bench veth0 veth1 capture.pcap [repeat] [local mac in capture]
+//
+// If the mac address of the EVSE in the capture is given, frames addressed to it are rewritten to the mac address
+// of the receiving interface, so that the destination filter behaves as on the real device.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <linux/if_packet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <slac/channel.hpp>
+#include <slac/slac.hpp>
+
+namespace {
+
+using Frame = std::vector<uint8_t>;
+
+const uint32_t PCAP_MAGIC = 0xA1B2C3D4;
+const uint32_t PCAP_MAGIC_NANOSECONDS = 0xA1B23C4D;
+const uint32_t PCAP_LINKTYPE_ETHERNET = 1;
+
+uint32_t swap_bytes(uint32_t value) {
+    return __builtin_bswap32(value);
+}
+
+bool read_pcap(const std::string& path, std::vector<Frame>& frames) {
+    std::ifstream input(path, std::ios::binary);
+    if (not input) {
+        fprintf(stderr, "Could not open %s\n", path.c_str());
+        return false;
+    }
+
+    uint32_t global_header[6];
+    if (not input.read(reinterpret_cast<char*>(global_header), sizeof(global_header))) {
+        fprintf(stderr, "%s is too short for a pcap file\n", path.c_str());
+        return false;
+    }
+
+    bool swapped = false;
+    if (global_header[0] == swap_bytes(PCAP_MAGIC) or global_header[0] == swap_bytes(PCAP_MAGIC_NANOSECONDS)) {
+        swapped = true;
+    } else if (global_header[0] != PCAP_MAGIC and global_header[0] != PCAP_MAGIC_NANOSECONDS) {
+        fprintf(stderr, "%s is not a pcap file (pcapng is not supported)\n", path.c_str());
+        return false;
+    }
+
+    const auto link_type = swapped ? swap_bytes(global_header[5]) : global_header[5];
+    if ((link_type & 0xFFFF) != PCAP_LINKTYPE_ETHERNET) {
+        fprintf(stderr, "Unsupported pcap link type %u\n", link_type);
+        return false;
+    }
+
+    uint32_t record_header[4];
+    while (input.read(reinterpret_cast<char*>(record_header), sizeof(record_header))) {
+        const auto captured_length = swapped ? swap_bytes(record_header[2]) : record_header[2];
+        Frame frame(captured_length);
+        if (not input.read(reinterpret_cast<char*>(frame.data()), captured_length)) {
+            break;
+        }
+        if (captured_length < ETH_HLEN or captured_length > ETH_FRAME_LEN) {
+            continue;
+        }
+        frames.push_back(std::move(frame));
+    }
+
+    return true;
+}
+
+bool parse_mac(const std::string& text, uint8_t* mac) {
+    unsigned int bytes[ETH_ALEN];
+    if (ETH_ALEN != sscanf(text.c_str(), "%x:%x:%x:%x:%x:%x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4],
+                           &bytes[5])) {
+        return false;
+    }
+    for (int i = 0; i < ETH_ALEN; ++i) {
+        mac[i] = static_cast<uint8_t>(bytes[i]);
+    }
+    return true;
+}
+
+int open_sender(const std::string& interface_name) {
+    const int fd = socket(AF_PACKET, SOCK_RAW, htons(slac::defs::ETH_P_HOMEPLUG_GREENPHY));
+    if (fd == -1) {
+        perror("socket()");
+        return -1;
+    }
+
+    struct sockaddr_ll sock_addr {};
+    sock_addr.sll_family = AF_PACKET;
+    sock_addr.sll_protocol = htons(slac::defs::ETH_P_HOMEPLUG_GREENPHY);
+    sock_addr.sll_ifindex = static_cast<int>(if_nametoindex(interface_name.c_str()));
+    if (sock_addr.sll_ifindex == 0 or
+        -1 == bind(fd, reinterpret_cast<struct sockaddr*>(&sock_addr), sizeof(sock_addr))) {
+        fprintf(stderr, "Could not bind to %s: %s\n", interface_name.c_str(), strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+std::chrono::microseconds thread_cpu_time() {
+    struct rusage usage {};
+    getrusage(RUSAGE_THREAD, &usage);
+    const auto to_us = [](const struct timeval& tv) {
+        return std::chrono::seconds(tv.tv_sec) + std::chrono::microseconds(tv.tv_usec);
+    };
+    return to_us(usage.ru_utime) + to_us(usage.ru_stime);
+}
+
+struct RunResult {
+    size_t frames_delivered{0};
+    std::chrono::microseconds cpu_time{0};
+};
+
+bool run(const std::string& tx_interface, const std::string& rx_interface, const std::vector<Frame>& frames,
+         int repeat, const slac::ChannelOptions& options, RunResult& result) {
+    slac::Channel channel;
+    if (not channel.open(rx_interface, options)) {
+        fprintf(stderr, "Could not open %s: %s\n", rx_interface.c_str(), channel.get_error().c_str());
+        return false;
+    }
+
+    const int sender = open_sender(tx_interface);
+    if (sender == -1) {
+        return false;
+    }
+
+    std::atomic_bool sending_done{false};
+    std::thread receiver([&]() {
+        slac::messages::HomeplugMessage message;
+        const auto cpu_start = thread_cpu_time();
+        while (true) {
+            if (channel.read(message, 50)) {
+                ++result.frames_delivered;
+            } else if (channel.got_timeout() and sending_done) {
+                break;
+            }
+        }
+        // the final timeout is part of the measurement for every configuration, so it doesn't skew the comparison
+        result.cpu_time = thread_cpu_time() - cpu_start;
+    });
+
+    for (int i = 0; i < repeat; ++i) {
+        for (const auto& frame : frames) {
+            if (-1 == send(sender, frame.data(), frame.size(), 0)) {
+                perror("send()");
+            }
+        }
+    }
+    sending_done = true;
+
+    receiver.join();
+    close(sender);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <tx interface> <rx interface> <capture.pcap> [repeat] [local mac in capture]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string tx_interface = argv[1];
+    const std::string rx_interface = argv[2];
+    const int repeat = (argc > 4) ? std::atoi(argv[4]) : 1;
+
+    std::vector<Frame> frames;
+    if (not read_pcap(argv[3], frames)) {
+        return EXIT_FAILURE;
+    }
+
+    if (argc > 5) {
+        uint8_t capture_mac[ETH_ALEN];
+        if (not parse_mac(argv[5], capture_mac)) {
+            fprintf(stderr, "Invalid mac address %s\n", argv[5]);
+            return EXIT_FAILURE;
+        }
+
+        slac::Channel channel;
+        if (not channel.open(rx_interface)) {
+            fprintf(stderr, "Could not open %s: %s\n", rx_interface.c_str(), channel.get_error().c_str());
+            return EXIT_FAILURE;
+        }
+        for (auto& frame : frames) {
+            if (0 == memcmp(frame.data(), capture_mac, ETH_ALEN)) {
+                memcpy(frame.data(), channel.get_mac_addr(), ETH_ALEN);
+            }
+        }
+    }
+
+    printf("replaying %zu frames %d times from %s to %s\n", frames.size(), repeat, tx_interface.c_str(),
+           rx_interface.c_str());
+
+    // frames of the state machine of the evse, see modules/EVSE/EvseSlac
+    const std::vector<uint16_t> evse_mmtypes = {
+        slac::defs::MMTYPE_CM_SLAC_PARAM,
+        slac::defs::MMTYPE_CM_START_ATTEN_CHAR,
+        slac::defs::MMTYPE_CM_MNBC_SOUND,
+        slac::defs::MMTYPE_CM_ATTEN_PROFILE,
+        slac::defs::MMTYPE_CM_ATTEN_CHAR,
+        slac::defs::MMTYPE_CM_SLAC_MATCH,
+        slac::defs::MMTYPE_CM_VALIDATE,
+        slac::defs::MMTYPE_CM_SET_KEY,
+        slac::defs::qualcomm::MMTYPE_CM_RESET_DEVICE,
+        slac::defs::qualcomm::MMTYPE_LINK_STATUS,
+        slac::defs::qualcomm::MMTYPE_OP_ATTR,
+    };
+
+    struct Configuration {
+        const char* name;
+        slac::ChannelOptions options;
+    };
+
+    const Configuration configurations[] = {
+        {"plain", {false, {}, 1}},
+        {"filter", {true, evse_mmtypes, 1}},
+        {"batch", {false, {}, 16}},
+        {"filter+batch", {true, evse_mmtypes, 16}},
+    };
+
+    printf("%-14s %12s %12s %14s\n", "configuration", "delivered", "cpu [us]", "cpu/frame [ns]");
+    for (const auto& configuration : configurations) {
+        RunResult result;
+        if (not run(tx_interface, rx_interface, frames, repeat, configuration.options, result)) {
+            return EXIT_FAILURE;
+        }
+        const auto cpu_us = result.cpu_time.count();
+        const auto sent = frames.size() * repeat;
+        printf("%-14s %12zu %12lld %14.1f\n", configuration.name, result.frames_delivered,
+               static_cast<long long>(cpu_us), sent ? 1000.0 * cpu_us / sent : 0.0);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -7,6 +7,7 @@
 #include <optional>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include <sqlite3.h>
 
@@ -42,6 +43,10 @@ public:
     virtual int bind_double(const std::string& param, const double val) = 0;
     virtual int bind_null(const int idx) = 0;
     virtual int bind_null(const std::string& param) = 0;
+    virtual int bind_blob(const int idx, const std::vector<std::uint8_t>& val,
+                          SQLiteString lifetime = SQLiteString::Static) = 0;
+    virtual int bind_blob(const std::string& param, const std::vector<std::uint8_t>& val,
+                          SQLiteString lifetime = SQLiteString::Static) = 0;
 
     virtual int get_number_of_rows() = 0;
     virtual int column_type(const int idx) = 0;
@@ -51,6 +56,7 @@ public:
     virtual int column_int(const int idx) = 0;
     virtual int64_t column_int64(const int idx) = 0;
     virtual double column_double(const int idx) = 0;
+    virtual std::vector<std::uint8_t> column_blob(const int idx) = 0;
 };
 
 /// \brief RAII wrapper class that handles finalization, step, binding and column access of sqlite3_stmt
@@ -78,6 +84,10 @@ public:
     int bind_int64(const std::string& param, const int64_t val) override;
     int bind_null(const int idx) override;
     int bind_null(const std::string& param) override;
+    int bind_blob(const int idx, const std::vector<std::uint8_t>& val,
+                  SQLiteString lifetime = SQLiteString::Static) override;
+    int bind_blob(const std::string& param, const std::vector<std::uint8_t>& val,
+                  SQLiteString lifetime = SQLiteString::Static) override;
 
     int get_number_of_rows() override;
     int column_type(const int idx) override;
@@ -87,6 +97,7 @@ public:
     int column_int(const int idx) override;
     int64_t column_int64(const int idx) override;
     double column_double(const int idx) override;
+    std::vector<std::uint8_t> column_blob(const int idx) override;
 };
 
 } // namespace everest::db::sqlite
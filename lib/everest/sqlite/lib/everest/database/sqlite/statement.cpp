@@ -100,6 +100,23 @@ int Statement::bind_null(const std::string& param) {
     return bind_null(index);
 }
 
+int Statement::bind_blob(const int idx, const std::vector<std::uint8_t>& val, SQLiteString lifetime) {
+    if (val.empty()) {
+        // sqlite binds NULL instead of an empty blob for a null pointer
+        return sqlite3_bind_zeroblob(this->stmt, idx, 0);
+    }
+    return sqlite3_bind_blob(this->stmt, idx, val.data(), clamp_to<int>(val.size()),
+                             lifetime == SQLiteString::Static ? SQLITE_STATIC : SQLITE_TRANSIENT);
+}
+
+int Statement::bind_blob(const std::string& param, const std::vector<std::uint8_t>& val, SQLiteString lifetime) {
+    const int index = sqlite3_bind_parameter_index(this->stmt, param.c_str());
+    if (index <= 0) {
+        throw std::out_of_range("Parameter not found in SQL query");
+    }
+    return bind_blob(index, val, lifetime);
+}
+
 int Statement::get_number_of_rows() {
     return sqlite3_data_count(this->stmt);
 }
@@ -164,4 +181,14 @@ double Statement::column_double(const int idx) {
     return sqlite3_column_double(this->stmt, idx);
 }
 
+std::vector<std::uint8_t> Statement::column_blob(const int idx) {
+    const auto* data = static_cast<const std::uint8_t*>(sqlite3_column_blob(this->stmt, idx));
+    // sqlite3_column_bytes has to be called after sqlite3_column_blob, which might convert the value
+    const auto size = sqlite3_column_bytes(this->stmt, idx);
+    if (data == nullptr or size <= 0) {
+        return {};
+    }
+    return {data, data + size};
+}
+
 } // namespace everest::db::sqlite
@@ -22,8 +22,8 @@ protected:
         db = std::make_unique<Connection>(db_path);
         ASSERT_TRUE(db->open_connection());
 
-        ASSERT_TRUE(db->execute_statement(
-            "CREATE TABLE test_table (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT, value INTEGER, score REAL);"));
+        ASSERT_TRUE(db->execute_statement("CREATE TABLE test_table (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT, "
+                                          "value INTEGER, score REAL, data BLOB);"));
     }
 
     void TearDown() override {
@@ -196,4 +196,26 @@ TEST_F(SQLiteStatementTest, ResetPreservesPreparedStatement) {
     ASSERT_EQ(stmt->step(), SQLITE_DONE);
 }
 
+TEST_F(SQLiteStatementTest, BindBlobAndReadBack) {
+    const std::vector<std::uint8_t> data{0x00, 0x01, 0xff, 0x00, 0x7f};
+
+    auto insert_stmt = db->new_statement("INSERT INTO test_table (name, data) VALUES (:name, :data);");
+    insert_stmt->bind_text(":name", "blob");
+    insert_stmt->bind_blob(":data", data);
+    ASSERT_EQ(insert_stmt->step(), SQLITE_DONE);
+    ASSERT_EQ(insert_stmt->reset(), SQLITE_OK);
+
+    insert_stmt->bind_text(":name", "empty_blob");
+    insert_stmt->bind_blob(":data", {}, SQLiteString::Transient);
+    ASSERT_EQ(insert_stmt->step(), SQLITE_DONE);
+
+    auto select_stmt = db->new_statement("SELECT data FROM test_table ORDER BY id;");
+    ASSERT_EQ(select_stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(select_stmt->column_type(0), SQLITE_BLOB);
+    EXPECT_EQ(select_stmt->column_blob(0), data);
+    ASSERT_EQ(select_stmt->step(), SQLITE_ROW);
+    EXPECT_EQ(select_stmt->column_type(0), SQLITE_BLOB);
+    EXPECT_TRUE(select_stmt->column_blob(0).empty());
+}
+
 } // namespace everest::db::sqlite
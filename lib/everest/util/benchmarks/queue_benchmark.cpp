@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+// Throughput and latency of the thread safe queues under producer contention.
+//
+// usage: everest_util_queue_benchmark [items per producer]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <everest/util/queue/lock_free_mpsc_queue.hpp>
+#include <everest/util/queue/lock_free_spsc_queue.hpp>
+#include <everest/util/queue/thread_safe_bounded_queue.hpp>
+#include <everest/util/queue/thread_safe_queue.hpp>
+
+using namespace everest::lib::util;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+constexpr std::size_t queue_capacity = 1024;
+
+struct item {
+    int producer;
+    clock_type::time_point arrival; ///< also required by thread_safe_bounded_queue::oldest_arrival
+};
+
+template <class Queue> Queue make_queue() {
+    if constexpr (std::is_constructible_v<Queue, std::size_t>) {
+        return Queue(queue_capacity);
+    } else {
+        return Queue();
+    }
+}
+
+struct result {
+    double items_per_second;
+    double p50_ns;
+    double p99_ns;
+};
+
+/**
+ * @brief Run \p producers threads pushing \p count items each as fast as possible into one consumer
+ * @param[in] pace Pause between two pushes of a producer, zero for a throughput run. Latencies are only meaningful
+ * for paced runs, otherwise they are dominated by the time items spend in a full queue.
+ */
+template <class Queue> result run(int producers, int count, std::chrono::nanoseconds pace) {
+    auto queue = make_queue<Queue>();
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(static_cast<std::size_t>(producers) * count);
+
+    const auto start = clock_type::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p, count, pace] {
+            for (int i = 0; i < count; ++i) {
+                if (pace.count() > 0) {
+                    const auto until = clock_type::now() + pace;
+                    while (clock_type::now() < until) {
+                    }
+                }
+                queue.push(item{p, clock_type::now()});
+            }
+        });
+    }
+
+    for (int i = 0; i < producers * count; ++i) {
+        const auto popped = queue.pop();
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - popped.arrival)
+                                .count());
+    }
+    const auto elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+        return static_cast<double>(latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]);
+    };
+    return {producers * count / elapsed, percentile(0.5), percentile(0.99)};
+}
+
+template <class Queue> void report(const std::string& name, int producers, int count) {
+    const auto throughput = run<Queue>(producers, count, std::chrono::nanoseconds(0));
+    const auto latency = run<Queue>(producers, std::max(count / 20, 1), std::chrono::microseconds(2));
+    printf("%-28s %9d %14.0f %12.0f %12.0f\n", name.c_str(), producers, throughput.items_per_second, latency.p50_ns,
+           latency.p99_ns);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int count = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    printf("%-28s %9s %14s %12s %12s\n", "queue", "producers", "items/s", "p50 [ns]", "p99 [ns]");
+    report<thread_safe_queue<item>>("thread_safe_queue", 1, count);
+    report<thread_safe_bounded_queue<item>>("thread_safe_bounded_queue", 1, count);
+    report<lock_free_spsc_queue<item>>("lock_free_spsc_queue", 1, count);
+    report<lock_free_mpsc_queue<item>>("lock_free_mpsc_queue", 1, count);
+
+    const auto cores = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+    for (const auto producers : {2, 4, cores}) {
+        const auto per_producer = count / producers;
+        report<thread_safe_queue<item>>("thread_safe_queue", producers, per_producer);
+        report<thread_safe_bounded_queue<item>>("thread_safe_bounded_queue", producers, per_producer);
+        report<lock_free_mpsc_queue<item>>("lock_free_mpsc_queue", producers, per_producer);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+// Throughput and scheduling latency of the thread pools for many small tasks, tasks of mixed duration and tasks
+// spawning subtasks from within the pool. The latency is the time from submitting a task until it starts.
+//
+// usage: everest_util_thread_pool_benchmark [tasks]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <everest/util/async/thread_pool.hpp>
+#include <everest/util/async/thread_pool_scaling.hpp>
+#include <everest/util/async/thread_pool_work_stealing.hpp>
+
+using namespace everest::lib::util;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+struct workload {
+    std::string name;
+    std::chrono::nanoseconds (*duration)(int task); ///< busy time of a task
+    std::chrono::nanoseconds mean_duration;
+    int fanout; ///< subtasks every externally submitted task spawns from within the pool
+};
+
+const std::vector<workload> workloads{
+    {"small", [](int) { return std::chrono::nanoseconds(0); }, std::chrono::nanoseconds(0), 0},
+    // one in twenty tasks is a hundred times longer
+    {"mixed",
+     [](int task) -> std::chrono::nanoseconds {
+         return (task % 20 == 0) ? std::chrono::microseconds(200) : std::chrono::microseconds(2);
+     },
+     std::chrono::nanoseconds(11900), 0},
+    {"fork-join", [](int) -> std::chrono::nanoseconds { return std::chrono::microseconds(1); },
+     std::chrono::microseconds(1), 8},
+};
+
+struct result {
+    double tasks_per_second;
+    double p50_us;
+    double p99_us;
+};
+
+void busy_wait(std::chrono::nanoseconds duration) {
+    const auto until = clock_type::now() + duration;
+    while (clock_type::now() < until) {
+    }
+}
+
+/**
+ * @brief Submit \p count tasks of \p load from one thread into the pool created by \p make_pool
+ * @param[in] pace Pause between two submissions, zero for a throughput run. Latencies are only meaningful for paced
+ * runs, otherwise they are dominated by the backlog.
+ */
+template <class MakePool>
+result run(MakePool make_pool, const workload& load, int count, std::chrono::nanoseconds pace) {
+    auto pool = make_pool();
+    const int total = count * (1 + load.fanout);
+    std::vector<std::int64_t> latencies(total);
+    std::atomic<int> done{0};
+    std::promise<void> finished;
+
+    std::function<void(int, clock_type::time_point)> execute = [&](int task, clock_type::time_point submitted) {
+        latencies[task] = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - submitted).count();
+        if (task < count) {
+            for (int child = 0; child < load.fanout; ++child) {
+                pool->run(execute, count + task * load.fanout + child, clock_type::now());
+            }
+        }
+        busy_wait(load.duration(task));
+        if (done.fetch_add(1) + 1 == total) {
+            finished.set_value();
+        }
+    };
+
+    const auto start = clock_type::now();
+    for (int task = 0; task < count; ++task) {
+        if (pace.count() > 0) {
+            busy_wait(pace);
+        }
+        pool->run(execute, task, clock_type::now());
+    }
+    finished.get_future().wait();
+    const auto elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+        return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))] / 1e3;
+    };
+    return {total / elapsed, percentile(0.5), percentile(0.99)};
+}
+
+template <class MakePool>
+void report(const std::string& name, MakePool make_pool, const workload& load, unsigned int threads, int count) {
+    const auto throughput = run(make_pool, load, count, std::chrono::nanoseconds(0));
+    // half of the pool's capacity, but not faster than the submitting thread can sustain
+    const auto pace = std::max<std::chrono::nanoseconds>(load.mean_duration * (1 + load.fanout) * 2 / threads,
+                                                         std::chrono::microseconds(2));
+    const auto latency = run(make_pool, load, std::max(count / 20, 1), pace);
+    printf("%-28s %-10s %8u %14.0f %12.1f %12.1f\n", name.c_str(), load.name.c_str(), threads,
+           throughput.tasks_per_second, latency.p50_us, latency.p99_us);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int count = (argc > 1) ? std::atoi(argv[1]) : 100000;
+
+    printf("%-28s %-10s %8s %14s %12s %12s\n", "pool", "workload", "threads", "tasks/s", "p50 [us]", "p99 [us]");
+    const auto cores = std::max(2u, std::thread::hardware_concurrency());
+    for (const auto threads : {2u, 4u, cores}) {
+        for (const auto& load : workloads) {
+            // the small tasks are cheap enough to run many more of them
+            const auto tasks = (load.name == "small") ? count : std::max(count / (10 * (1 + load.fanout)), 1);
+            report(
+                "thread_pool", [threads] { return std::make_unique<thread_pool>(threads); }, load, threads, tasks);
+            report(
+                "thread_pool_scaling",
+                [threads] {
+                    return std::make_unique<thread_pool_scaling<GreedyScaling>>(threads, threads,
+                                                                               std::chrono::seconds(60));
+                },
+                load, threads, tasks);
+            report(
+                "thread_pool_work_stealing",
+                [threads] { return std::make_unique<thread_pool_work_stealing>(threads); }, load, threads, tasks);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
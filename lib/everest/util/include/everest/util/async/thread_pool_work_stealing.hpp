@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+/**
+ * @file thread_pool_work_stealing.hpp
+ * @brief Fixed-size thread pool with per-worker task queues, work stealing and task priorities.
+ */
+
+#pragma once
+
+#include <everest/util/queue/detail/lock_free_queue_support.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace everest::lib::util {
+
+/**
+ * @brief Priority of a task in a \ref thread_pool_work_stealing
+ */
+enum class task_priority {
+    low,
+    normal,
+    high,
+};
+
+/**
+ * @brief A thread safe fixed-size pool with one task queue per worker.
+ * @details Tasks submitted by a worker of the pool are queued at this worker, all other tasks are distributed
+ * round-robin. Every worker runs its own tasks in submission order and steals the oldest task of another worker
+ * once its own queue is empty, so workers rarely contend on the same lock. Higher priority tasks of any worker are
+ * run before lower priority ones. Idle workers park on a \ref detail::queue_waiter. <br>
+ * The submission interface matches \ref thread_pool: operator() for tasks requiring a return value (via
+ * std::future) and run() for fire-and-forget tasks, both with normal priority.
+ */
+class thread_pool_work_stealing {
+public:
+    /** @brief Type definition for the tasks held in the queues. */
+    using action = std::function<void()>;
+
+    /**
+     * @brief Constructs the thread pool and spawns worker threads.
+     * @param[in] thread_count The number of worker threads to maintain, at least one.
+     * @param[in] cpu_affinity CPUs the workers are pinned to, worker i to cpu_affinity[i % size]. Empty to not pin
+     * the workers. Pinning is best effort, workers stay unpinned if a CPU is not available.
+     */
+    explicit thread_pool_work_stealing(unsigned int thread_count, const std::vector<int>& cpu_affinity = {}) :
+        m_worker_count(std::max(thread_count, 1u)), m_workers(std::make_unique<worker[]>(m_worker_count)) {
+        for (std::size_t i = 0; i < m_worker_count; ++i) {
+            m_workers[i].thread = std::thread([this, i] { worker_loop(i); });
+            if (not cpu_affinity.empty()) {
+                pin(m_workers[i].thread, cpu_affinity[i % cpu_affinity.size()]);
+            }
+        }
+    }
+
+    /**
+     * @brief Destructor. Runs the remaining tasks, then stops and joins all workers.
+     * @details Tasks submitted during destruction are dropped.
+     */
+    ~thread_pool_work_stealing() {
+        m_stop.store(true, std::memory_order_seq_cst);
+        m_waiter.notify_all();
+        for (std::size_t i = 0; i < m_worker_count; ++i) {
+            if (m_workers[i].thread.joinable()) {
+                m_workers[i].thread.join();
+            }
+        }
+    }
+
+    thread_pool_work_stealing(const thread_pool_work_stealing&) = delete;
+    thread_pool_work_stealing& operator=(const thread_pool_work_stealing&) = delete;
+
+    /**
+     * @brief Submits a task to the pool and returns a future for its result.
+     * @param f The callable to execute.
+     * @param args The arguments to pass to the callable.
+     * @return A std::future that will eventually contain the result of the callable.
+     */
+    template <typename F, typename... Args>
+    auto operator()(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+        return call_with_priority(task_priority::normal, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Submits a "fire-and-forget" task to the pool.
+     * @param f The callable to execute.
+     * @param args The arguments to pass to the callable.
+     */
+    template <typename F, typename... Args> void run(F&& f, Args&&... args) {
+        run_with_priority(task_priority::normal, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Submits a task with the given \p priority and returns a future for its result.
+     * @copydetails operator()
+     */
+    template <typename F, typename... Args>
+    auto call_with_priority(task_priority priority, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>> {
+        using R = std::invoke_result_t<F, Args...>;
+        auto prom = std::make_shared<std::promise<R>>();
+        auto fut = prom->get_future();
+
+        push(priority, [prom, bound_f = std::bind(std::forward<F>(f), std::forward<Args>(args)...)]() mutable {
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    bound_f();
+                    prom->set_value();
+                } else {
+                    prom->set_value(bound_f());
+                }
+            } catch (...) {
+                prom->set_exception(std::current_exception());
+            }
+        });
+        return fut;
+    }
+
+    /**
+     * @brief Submits a "fire-and-forget" task with the given \p priority.
+     * @copydetails run
+     */
+    template <typename F, typename... Args> void run_with_priority(task_priority priority, F&& f, Args&&... args) {
+        push(priority, std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Number of worker threads
+     */
+    std::size_t size() const {
+        return m_worker_count;
+    }
+
+private:
+    static constexpr std::size_t priority_count = static_cast<std::size_t>(task_priority::high) + 1;
+
+    /**
+     * @brief Task queues of a single worker, one per priority.
+     */
+    struct alignas(detail::lock_free_queue_cache_line) worker {
+        std::mutex mtx;
+        std::array<std::deque<action>, priority_count> tasks;
+        std::thread thread;
+    };
+
+    /**
+     * @brief Identifies the pool and worker the current thread belongs to, if any.
+     */
+    struct worker_identity {
+        const thread_pool_work_stealing* pool;
+        std::size_t index;
+    };
+    static inline thread_local worker_identity t_current{nullptr, 0};
+
+    static void pin(std::thread& thread, int cpu) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        (void)pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+    }
+
+    void push(task_priority priority, action&& task) {
+        if (m_stop.load(std::memory_order_acquire)) {
+            return;
+        }
+        const auto level = static_cast<std::size_t>(priority);
+        const auto index = (t_current.pool == this)
+                               ? t_current.index
+                               : m_next_worker.fetch_add(1, std::memory_order_relaxed) % m_worker_count;
+        {
+            auto& target = m_workers[index];
+            std::lock_guard lock(target.mtx);
+            target.tasks[level].push_back(std::move(task));
+            // counted under the lock, so a worker never sees a count without the task being visible
+            m_pending[level].fetch_add(1, std::memory_order_seq_cst);
+        }
+        m_waiter.notify_one();
+    }
+
+    std::optional<action> pop_from(std::size_t index, std::size_t level) {
+        auto& source = m_workers[index];
+        std::lock_guard lock(source.mtx);
+        auto& tasks = source.tasks[level];
+        if (tasks.empty()) {
+            return std::nullopt;
+        }
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        m_pending[level].fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    std::optional<action> take(std::size_t index) {
+        for (std::size_t level = priority_count; level-- > 0;) {
+            if (m_pending[level].load(std::memory_order_acquire) == 0) {
+                continue;
+            }
+            // own tasks first, then steal from the following workers
+            for (std::size_t offset = 0; offset < m_worker_count; ++offset) {
+                if (auto task = pop_from((index + offset) % m_worker_count, level)) {
+                    return task;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool has_pending() const {
+        return std::any_of(m_pending.begin(), m_pending.end(),
+                           [](const auto& pending) { return pending.load(std::memory_order_acquire) > 0; });
+    }
+
+    void worker_loop(std::size_t index) {
+        t_current = worker_identity{this, index};
+        while (true) {
+            if (auto task = take(index)) {
+                try {
+                    task.value()();
+                } catch (...) {
+                    // Keep the worker alive even if the task fails.
+                    // Exceptions for operator() are handled in the promise wrapper.
+                }
+                continue;
+            }
+            if (m_stop.load(std::memory_order_acquire)) {
+                return;
+            }
+            m_waiter.wait(-1, [this]() { return has_pending() or m_stop.load(std::memory_order_acquire); });
+        }
+    }
+
+    const std::size_t m_worker_count;
+    std::unique_ptr<worker[]> m_workers;
+    std::array<std::atomic<std::size_t>, priority_count> m_pending{};
+    std::atomic<std::size_t> m_next_worker{0};
+    std::atomic<bool> m_stop{false};
+    detail::queue_waiter m_waiter;
+};
+
+} // namespace everest::lib::util
@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+/**
+ * @file json_stream.hpp
+ * @brief Streaming JSON writer and pull parser that work without building a nlohmann::json first.
+ * @details Types are (de)serialized by write_json() and read_json() overloads. The overloads for the standard types are
+ * provided here, libraries add the ones for their own types in the namespace of these types, where they are found by
+ * argument dependent lookup.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace everest::lib::util {
+
+/**
+ * @brief Thrown by \ref JsonReader on malformed JSON, values of unexpected type and missing keys
+ */
+class JsonStreamException : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Writes JSON text directly into a caller provided buffer.
+ * @details The buffer is only appended to, so a buffer that is cleared and reused for every message keeps its
+ * capacity. Numbers and strings are written exactly like nlohmann::json::dump() writes them. Object members are
+ * written in the order they are written, so writing them in sorted key order produces the same text as dump().
+ */
+class JsonWriter {
+public:
+    /**
+     * @brief Creates a writer appending to \p buffer
+     */
+    explicit JsonWriter(std::string& buffer);
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    /**
+     * @brief Writes the \p key of the next object member
+     */
+    void key(std::string_view key);
+
+    void value(std::string_view value);
+    void value(const char* value);
+    void value(bool value);
+    void value(std::int32_t value);
+    void value(std::int64_t value);
+    void value(double value);
+    void null();
+
+    /**
+     * @brief Writes \p value as serialized by nlohmann::json::dump()
+     */
+    void dump(const nlohmann::json& value);
+
+private:
+    void separate();
+    void write_string(std::string_view value);
+
+    std::string& buffer;
+    bool needs_separator{false};
+};
+
+/**
+ * @brief Pull parser reading JSON text directly into C++ types.
+ * @details The reader only validates the parts of the text it is asked to read or skip. Object keys are decoded into
+ * a buffer owned by the reader, which is reused for every key.
+ */
+class JsonReader {
+public:
+    /**
+     * @brief Creates a reader for \p text, which has to outlive the reader
+     */
+    explicit JsonReader(std::string_view text);
+
+    void begin_object();
+    /**
+     * @brief Reads the key of the next object member
+     * @return false if the end of the object was reached instead
+     */
+    bool next_key();
+    /**
+     * @brief The key read by the last call to next_key()
+     */
+    const std::string& key() const;
+
+    void begin_array();
+    /**
+     * @return true if another array element follows, false if the end of the array was reached
+     */
+    bool next_element();
+
+    void read_string(std::string& value);
+    std::string read_string();
+    bool read_bool();
+    /**
+     * @brief Reads an integer, numbers with fraction or exponent are accepted if their value is integral
+     * @throws JsonStreamException if the value is no integer or out of the range of std::int32_t
+     */
+    std::int32_t read_int32();
+    double read_number();
+
+    /**
+     * @brief Reads a value of any type into a nlohmann::json
+     */
+    nlohmann::json read_value();
+    /**
+     * @brief Reads a value of any type as string: strings are returned unquoted, other values as JSON text
+     */
+    std::string read_value_as_string();
+    /**
+     * @brief Skips a value of any type, e.g. of an unknown key
+     */
+    void skip_value();
+
+    /**
+     * @brief Checks that nothing but whitespace follows the last value
+     */
+    void end();
+
+    /**
+     * @brief Throws a \ref JsonStreamException if a \p required key was not read
+     */
+    void require(bool read, const char* key) const;
+
+private:
+    char peek();
+    void expect(char c);
+    std::string_view scalar_token();
+    [[noreturn]] void error(const std::string& message) const;
+
+    std::string_view text;
+    std::size_t pos{0};
+    std::string current_key;
+    bool first_in_container{false};
+};
+
+inline void write_json(JsonWriter& writer, bool value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, std::int32_t value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, float value) {
+    writer.value(static_cast<double>(value));
+}
+
+inline void write_json(JsonWriter& writer, double value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, const std::string& value) {
+    writer.value(value);
+}
+
+/**
+ * @brief Writes a nlohmann::json. Restricted to nlohmann::json itself since most types convert to it.
+ */
+template <class T, std::enable_if_t<std::is_same_v<T, nlohmann::json>, bool> = true>
+void write_json(JsonWriter& writer, const T& value) {
+    writer.dump(value);
+}
+
+template <class T> void write_json(JsonWriter& writer, const std::vector<T>& values) {
+    writer.begin_array();
+    for (const auto& value : values) {
+        write_json(writer, value);
+    }
+    writer.end_array();
+}
+
+/**
+ * @brief Writes the object member \p key with \p value
+ */
+template <class T> void write_member(JsonWriter& writer, std::string_view key, const T& value) {
+    writer.key(key);
+    write_json(writer, value);
+}
+
+/**
+ * @brief Writes the object member \p key if \p value is set, like the json codecs do for optional members
+ */
+template <class T> void write_member(JsonWriter& writer, std::string_view key, const std::optional<T>& value) {
+    if (value) {
+        write_member(writer, key, value.value());
+    }
+}
+
+inline void read_json(JsonReader& reader, bool& value) {
+    value = reader.read_bool();
+}
+
+inline void read_json(JsonReader& reader, std::int32_t& value) {
+    value = reader.read_int32();
+}
+
+inline void read_json(JsonReader& reader, float& value) {
+    value = static_cast<float>(reader.read_number());
+}
+
+inline void read_json(JsonReader& reader, double& value) {
+    value = reader.read_number();
+}
+
+inline void read_json(JsonReader& reader, std::string& value) {
+    reader.read_string(value);
+}
+
+void read_json(JsonReader& reader, nlohmann::json& value);
+
+template <class T> void read_json(JsonReader& reader, std::optional<T>& value) {
+    read_json(reader, value.emplace());
+}
+
+template <class T> void read_json(JsonReader& reader, std::vector<T>& values) {
+    values.clear();
+    reader.begin_array();
+    while (reader.next_element()) {
+        read_json(reader, values.emplace_back());
+    }
+}
+
+} // namespace everest::lib::util
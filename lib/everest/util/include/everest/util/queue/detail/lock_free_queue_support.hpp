@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+/** \file */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace everest::lib::util::detail {
+
+/**
+ * @brief Size used to keep independently written members of lock-free queues on separate cache lines
+ */
+constexpr std::size_t lock_free_queue_cache_line = 64;
+
+/**
+ * @brief Rounds \p value up to the next power of two, at least 1
+ */
+inline std::size_t lock_free_queue_capacity(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * Blocking slow path of the lock-free queues. <br>
+ * Waiting threads spin shortly and then park on a condition variable. Notifying threads only touch the mutex if
+ * there is a parked waiter, so the fast path of push and pop stays free of locks and system calls.
+ */
+class queue_waiter {
+public:
+    /**
+     * @brief Wait until \p ready returns true
+     * @param[in] timeout_ms Timeout in milliseconds. -1 for infinite wait, 0 for immediate return.
+     * @param[in] ready Predicate, must be safe to evaluate concurrently to the notifying threads
+     * @return The result of the last evaluation of \p ready
+     */
+    template <class Predicate> bool wait(int timeout_ms, Predicate ready) {
+        for (int i = 0; i < spin_iterations; ++i) {
+            if (ready()) {
+                return true;
+            }
+            if (timeout_ms == 0) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+
+        std::unique_lock lock(m_mtx);
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        // pairs with the fence in notify: either the notifier sees the waiter or the waiter sees the new state
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool result = true;
+        if (timeout_ms < 0) {
+            m_cv.wait(lock, ready);
+        } else {
+            result = m_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+        }
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+     * @brief Wake up one parked waiter, if any
+     */
+    void notify_one() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) > 0) {
+            // taking the mutex ensures that the waiter is either still before its predicate check or already waiting
+            { std::lock_guard lock(m_mtx); }
+            m_cv.notify_one();
+        }
+    }
+
+    /**
+     * @brief Wake up all parked waiters
+     */
+    void notify_all() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) > 0) {
+            { std::lock_guard lock(m_mtx); }
+            m_cv.notify_all();
+        }
+    }
+
+private:
+    static constexpr int spin_iterations = 16;
+
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    std::atomic<int> m_waiters{0};
+};
+
+/**
+ * Optional <a href="https://man7.org/linux/man-pages/man2/eventfd.2.html">eventfd</a> that becomes readable when
+ * data is pushed into a lock-free queue. <br>
+ * The eventfd is only written once until it is acknowledged, so a burst of pushes costs a single system call.
+ */
+class queue_event_fd {
+public:
+    /**
+     * @brief Create the eventfd if \p enabled
+     * @throws std::runtime_error if the eventfd cannot be created
+     */
+    explicit queue_event_fd(bool enabled) {
+        if (enabled) {
+            m_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (m_fd == -1) {
+                throw std::runtime_error("Failed to create eventfd for queue");
+            }
+        }
+    }
+
+    ~queue_event_fd() {
+        if (m_fd != -1) {
+            ::close(m_fd);
+        }
+    }
+
+    queue_event_fd(const queue_event_fd&) = delete;
+    queue_event_fd& operator=(const queue_event_fd&) = delete;
+
+    /**
+     * @brief The eventfd, -1 if disabled
+     */
+    int get() const {
+        return m_fd;
+    }
+
+    /**
+     * @brief Make the eventfd readable, if it is not already
+     */
+    void signal() {
+        if (m_fd == -1) {
+            return;
+        }
+        if (not m_signaled.exchange(true, std::memory_order_acq_rel)) {
+            const std::uint64_t one = 1;
+            (void)::write(m_fd, &one, sizeof(one));
+        }
+    }
+
+    /**
+     * @brief Reset the eventfd, data pushed after this call signals it again
+     */
+    void acknowledge() {
+        if (m_fd == -1) {
+            return;
+        }
+        std::uint64_t value;
+        (void)::read(m_fd, &value, sizeof(value));
+        // synchronizes with signal, so everything pushed before the last signal is visible to the caller
+        m_signaled.exchange(false, std::memory_order_acq_rel);
+    }
+
+private:
+    int m_fd{-1};
+    std::atomic<bool> m_signaled{false};
+};
+
+/**
+ * Blocking push/pop API shared by the lock-free queues, mirroring \ref thread_safe_bounded_queue. <br>
+ * \p Derived provides the non-blocking primitives \p try_push_impl, \p try_pop_impl, \p size and \p capacity.
+ * @tparam Derived The concrete queue
+ * @tparam T Datatype held by the queue
+ */
+template <class Derived, class T> class lock_free_blocking_queue {
+public:
+    /**
+     * @var value_type
+     * @brief Datatype held by the queue
+     */
+    using value_type = T;
+
+    /**
+     * @var size_type
+     * @brief Size type of the queue
+     */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Push new data into the queue
+     * @details Blocks the caller while the queue is full.
+     * @param[in] value data
+     * @return The size of the queue after push. Returns 0 if the queue is stopped.
+     */
+    size_type push(const value_type& value) {
+        return push_impl(value);
+    }
+
+    /**
+     * @copydoc push(const value_type&)
+     */
+    size_type push(value_type&& value) {
+        return push_impl(std::move(value));
+    }
+
+    /**
+     * @brief Push new data into the queue if there is space
+     * @details Returns immediately.
+     * @param[in] value data
+     * @return True if \p value was pushed, false if the queue is full or stopped
+     */
+    bool try_push(const value_type& value) {
+        return try_push_and_notify(value);
+    }
+
+    /**
+     * @copydoc try_push(const value_type&)
+     */
+    bool try_push(value_type&& value) {
+        return try_push_and_notify(std::move(value));
+    }
+
+    /**
+     * @brief Try to get an element from the queue.
+     * @details Returns immediately.
+     * @return An element from the queue, if one is available. \p std::nullopt otherwise
+     */
+    std::optional<value_type> try_pop() {
+        return pop_impl(0);
+    }
+
+    /**
+     * @brief Try to get an element from the queue.
+     * @details Returns as soon as data is availble or after timeout.
+     * @param[in] timeout as <a href="https://en.cppreference.com/w/cpp/chrono/duration">std::chrono::duration</a>.
+     * Smallest unit acceptable is milliseconds.
+     * @return An element from the queue, if one is available. \p std::nullopt otherwise
+     */
+    template <class Rep, class Period> std::optional<value_type> try_pop(std::chrono::duration<Rep, Period> timeout) {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(timeout);
+        return pop_impl(ms.count());
+    }
+
+    /**
+     * @brief Get an element from the queue
+     * @details Only returns, when data is available. Implicitly throws on stop().
+     * @return An element from the queue.
+     */
+    value_type pop() {
+        return pop_impl(-1).value();
+    }
+
+    /**
+     * @brief Get an element from the queue
+     * @details Only returns, when data is available, or the queue is stopped.
+     * @return An element from the queue. Empty optional if stopped.
+     */
+    std::optional<value_type> wait_and_pop() {
+        return pop_impl(-1);
+    }
+
+    /**
+     * @brief Signals that no more items will be pushed and unblocks all waiting consumers and producers.
+     * @details Remaining items in the queue can still be popped until it is empty.
+     */
+    void stop() {
+        m_stop.store(true, std::memory_order_seq_cst);
+        m_not_empty.notify_all();
+        m_not_full.notify_all();
+        m_event_fd.signal();
+    }
+
+    /**
+     * @brief The eventfd that becomes readable when data is pushed or the queue is stopped
+     * @details Only available if the queue was created with an eventfd, -1 otherwise. The fd can be registered with
+     * an fd_event_handler. The handler has to call \ref acknowledge_event before draining the queue with
+     * \ref try_pop.
+     */
+    int get_event_fd() const {
+        return m_event_fd.get();
+    }
+
+    /**
+     * @brief Reset the eventfd before draining the queue
+     */
+    void acknowledge_event() {
+        m_event_fd.acknowledge();
+    }
+
+protected:
+    explicit lock_free_blocking_queue(bool with_event_fd) : m_event_fd(with_event_fd) {
+    }
+
+private:
+    Derived& derived() {
+        return static_cast<Derived&>(*this);
+    }
+
+    template <class U> bool try_push_and_notify(U&& value) {
+        if (m_stop.load(std::memory_order_acquire) or not derived().try_push_impl(std::forward<U>(value))) {
+            return false;
+        }
+        m_not_empty.notify_one();
+        m_event_fd.signal();
+        return true;
+    }
+
+    template <class U> size_type push_impl(U&& value) {
+        while (true) {
+            if (m_stop.load(std::memory_order_acquire)) {
+                return 0;
+            }
+            if (derived().try_push_impl(std::forward<U>(value))) {
+                m_not_empty.notify_one();
+                m_event_fd.signal();
+                return derived().size();
+            }
+            m_not_full.wait(-1, [this]() {
+                return derived().size() < derived().capacity() or m_stop.load(std::memory_order_acquire);
+            });
+        }
+    }
+
+    std::optional<value_type> pop_impl(int timeout_ms) {
+        auto result = derived().try_pop_impl();
+        if (not result.has_value() and timeout_ms != 0) {
+            m_not_empty.wait(timeout_ms, [this, &result]() {
+                if (not result.has_value()) {
+                    result = derived().try_pop_impl();
+                }
+                return result.has_value() or m_stop.load(std::memory_order_acquire);
+            });
+            if (not result.has_value()) {
+                // data pushed right before stop
+                result = derived().try_pop_impl();
+            }
+        }
+        if (result.has_value()) {
+            m_not_full.notify_one();
+        }
+        return result;
+    }
+
+    std::atomic<bool> m_stop{false};
+    queue_waiter m_not_empty;
+    queue_waiter m_not_full;
+    queue_event_fd m_event_fd;
+};
+
+} // namespace everest::lib::util::detail
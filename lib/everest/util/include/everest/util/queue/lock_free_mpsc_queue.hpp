@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+/** \file */
+
+#pragma once
+
+#include "detail/lock_free_queue_support.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+namespace everest::lib::util {
+
+/**
+ * A bounded lock-free multi-producer/single-consumer queue. <br>
+ * Elements are stored in a ring buffer of slots carrying a sequence number (D. Vyukov's bounded queue). Producers
+ * claim a slot with a single compare-and-swap on the tail index and publish it through the slot's sequence number,
+ * the consumer needs no read-modify-write operation at all. The blocking API is the one of
+ * \ref thread_safe_bounded_queue; blocking calls spin shortly before parking on a condition variable. <br>
+ * Any number of threads may push, only one thread may pop at any time.
+ * @tparam T Datatype held by the queue
+ */
+template <class T>
+class lock_free_mpsc_queue : public detail::lock_free_blocking_queue<lock_free_mpsc_queue<T>, T> {
+    using base = detail::lock_free_blocking_queue<lock_free_mpsc_queue<T>, T>;
+    friend base;
+
+public:
+    using typename base::size_type;
+    using typename base::value_type;
+
+    /**
+     * @brief Constructor for the queue.
+     * @param[in] capacity The minimum number of elements the queue can hold, rounded up to a power of two of at
+     * least 2. The slot sequence numbers cannot distinguish a full from an empty slot with a single slot.
+     * @param[in] with_event_fd Create an eventfd signalling new data, see \ref get_event_fd
+     */
+    explicit lock_free_mpsc_queue(size_type capacity, bool with_event_fd = false) :
+        base(with_event_fd),
+        m_capacity(detail::lock_free_queue_capacity(std::max<size_type>(capacity, 2))),
+        m_mask(m_capacity - 1),
+        m_slots(new slot[m_capacity]) {
+        for (size_type i = 0; i < m_capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~lock_free_mpsc_queue() {
+        while (try_pop_impl().has_value()) {
+        }
+    }
+
+    lock_free_mpsc_queue(const lock_free_mpsc_queue&) = delete;
+    lock_free_mpsc_queue& operator=(const lock_free_mpsc_queue&) = delete;
+
+    /**
+     * @brief The current number of elements in the queue, including elements that are being pushed.
+     */
+    size_type size() const {
+        const auto head = m_head.load(std::memory_order_acquire);
+        const auto tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /**
+     * @brief The maximum number of elements in the queue.
+     */
+    size_type capacity() const {
+        return m_capacity;
+    }
+
+private:
+    struct slot {
+        std::atomic<size_type> sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+        T* get() {
+            return std::launder(reinterpret_cast<T*>(&storage));
+        }
+    };
+
+    template <class U> bool try_push_impl(U&& value) {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        slot* target = nullptr;
+        while (true) {
+            target = &m_slots[tail & m_mask];
+            const auto sequence = target->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(tail);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the slot still holds the element of the previous round
+                return false;
+            } else {
+                tail = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+        new (&target->storage) T(std::forward<U>(value));
+        target->sequence.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<value_type> try_pop_impl() {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        slot& source = m_slots[head & m_mask];
+        if (source.sequence.load(std::memory_order_acquire) != head + 1) {
+            return std::nullopt;
+        }
+        T* element = source.get();
+        std::optional<value_type> result(std::move(*element));
+        element->~T();
+        source.sequence.store(head + m_capacity, std::memory_order_release);
+        m_head.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    const size_type m_capacity;
+    const size_type m_mask;
+    std::unique_ptr<slot[]> m_slots;
+
+    alignas(detail::lock_free_queue_cache_line) std::atomic<size_type> m_tail{0}; ///< Claimed by producers
+    alignas(detail::lock_free_queue_cache_line) std::atomic<size_type> m_head{0}; ///< Written by the consumer
+};
+
+} // namespace everest::lib::util
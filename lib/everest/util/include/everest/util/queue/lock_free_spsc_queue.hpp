@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+/** \file */
+
+#pragma once
+
+#include "detail/lock_free_queue_support.hpp"
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+namespace everest::lib::util {
+
+/**
+ * A bounded lock-free single-producer/single-consumer queue. <br>
+ * Elements are stored in a ring buffer. Producer and consumer each own one index and only read the other one when
+ * their cached copy says the queue is full or empty, so in the common case push and pop touch no shared cache line
+ * but the slot itself. The blocking API is the one of \ref thread_safe_bounded_queue; blocking calls spin shortly
+ * before parking on a condition variable. <br>
+ * Only one thread may push and only one thread may pop at any time.
+ * @tparam T Datatype held by the queue
+ */
+template <class T>
+class lock_free_spsc_queue : public detail::lock_free_blocking_queue<lock_free_spsc_queue<T>, T> {
+    using base = detail::lock_free_blocking_queue<lock_free_spsc_queue<T>, T>;
+    friend base;
+
+public:
+    using typename base::size_type;
+    using typename base::value_type;
+
+    /**
+     * @brief Constructor for the queue.
+     * @param[in] capacity The minimum number of elements the queue can hold, rounded up to a power of two.
+     * @param[in] with_event_fd Create an eventfd signalling new data, see \ref get_event_fd
+     */
+    explicit lock_free_spsc_queue(size_type capacity, bool with_event_fd = false) :
+        base(with_event_fd),
+        m_capacity(detail::lock_free_queue_capacity(capacity)),
+        m_mask(m_capacity - 1),
+        m_slots(new slot[m_capacity]) {
+    }
+
+    ~lock_free_spsc_queue() {
+        while (try_pop_impl().has_value()) {
+        }
+    }
+
+    lock_free_spsc_queue(const lock_free_spsc_queue&) = delete;
+    lock_free_spsc_queue& operator=(const lock_free_spsc_queue&) = delete;
+
+    /**
+     * @brief The current number of elements in the queue.
+     */
+    size_type size() const {
+        const auto head = m_head.load(std::memory_order_acquire);
+        const auto tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /**
+     * @brief The maximum number of elements in the queue.
+     */
+    size_type capacity() const {
+        return m_capacity;
+    }
+
+private:
+    struct slot {
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+        T* get() {
+            return std::launder(reinterpret_cast<T*>(&storage));
+        }
+    };
+
+    template <class U> bool try_push_impl(U&& value) {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head_cache == m_capacity) {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (tail - m_head_cache == m_capacity) {
+                return false;
+            }
+        }
+        new (&m_slots[tail & m_mask].storage) T(std::forward<U>(value));
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<value_type> try_pop_impl() {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail_cache) {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_cache) {
+                return std::nullopt;
+            }
+        }
+        T* element = m_slots[head & m_mask].get();
+        std::optional<value_type> result(std::move(*element));
+        element->~T();
+        m_head.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    const size_type m_capacity;
+    const size_type m_mask;
+    std::unique_ptr<slot[]> m_slots;
+
+    alignas(detail::lock_free_queue_cache_line) std::atomic<size_type> m_tail{0}; ///< Written by the producer
+    size_type m_head_cache{0}; ///< Producer's copy of m_head
+    alignas(detail::lock_free_queue_cache_line) std::atomic<size_type> m_head{0}; ///< Written by the consumer
+    size_type m_tail_cache{0}; ///< Consumer's copy of m_tail
+};
+
+} // namespace everest::lib::util
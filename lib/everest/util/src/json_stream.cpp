@@ -0,0 +1,451 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include <everest/util/json/json_stream.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+#include <nlohmann/json.hpp>
+
+namespace everest::lib::util {
+
+using json = nlohmann::json;
+
+namespace {
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+bool is_whitespace(char c) {
+    return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+}
+
+void append_utf8(std::string& out, std::uint32_t code_point) {
+    if (code_point < 0x80) {
+        out.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+} // namespace
+
+JsonWriter::JsonWriter(std::string& buffer) : buffer(buffer) {
+}
+
+void JsonWriter::separate() {
+    if (this->needs_separator) {
+        this->buffer.push_back(',');
+    }
+    this->needs_separator = true;
+}
+
+void JsonWriter::begin_object() {
+    this->separate();
+    this->buffer.push_back('{');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_object() {
+    this->buffer.push_back('}');
+    this->needs_separator = true;
+}
+
+void JsonWriter::begin_array() {
+    this->separate();
+    this->buffer.push_back('[');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_array() {
+    this->buffer.push_back(']');
+    this->needs_separator = true;
+}
+
+void JsonWriter::key(std::string_view key) {
+    this->separate();
+    this->write_string(key);
+    this->buffer.push_back(':');
+    this->needs_separator = false;
+}
+
+void JsonWriter::value(std::string_view value) {
+    this->separate();
+    this->write_string(value);
+}
+
+void JsonWriter::value(const char* value) {
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(bool value) {
+    this->separate();
+    this->buffer.append(value ? "true" : "false");
+}
+
+void JsonWriter::value(std::int32_t value) {
+    this->value(static_cast<std::int64_t>(value));
+}
+
+void JsonWriter::value(std::int64_t value) {
+    this->separate();
+    char digits[24];
+    const auto result = std::to_chars(std::begin(digits), std::end(digits), value);
+    this->buffer.append(digits, result.ptr);
+}
+
+void JsonWriter::value(double value) {
+    if (!std::isfinite(value)) {
+        // json::dump() writes null for NaN and infinity as well
+        this->null();
+        return;
+    }
+    this->separate();
+    // Same conversion as json::dump(), which does not always produce the shortest representation. This is the only
+    // use of the nlohmann::detail namespace, it has to follow the serializer of json::dump() on library updates.
+    char digits[64];
+    const auto end = nlohmann::detail::to_chars(std::begin(digits), std::end(digits), value);
+    this->buffer.append(std::begin(digits), end);
+}
+
+void JsonWriter::null() {
+    this->separate();
+    this->buffer.append("null");
+}
+
+void JsonWriter::dump(const json& value) {
+    this->separate();
+    this->buffer.append(value.dump());
+}
+
+void JsonWriter::write_string(std::string_view value) {
+    this->buffer.push_back('"');
+    auto unescaped_begin = value.begin();
+    for (auto it = value.begin(); it != value.end(); ++it) {
+        const auto c = static_cast<unsigned char>(*it);
+        if (c >= 0x20 and c != '"' and c != '\\') {
+            continue;
+        }
+        this->buffer.append(unescaped_begin, it);
+        unescaped_begin = it + 1;
+        switch (c) {
+        case '"':
+            this->buffer.append("\\\"");
+            break;
+        case '\\':
+            this->buffer.append("\\\\");
+            break;
+        case '\b':
+            this->buffer.append("\\b");
+            break;
+        case '\f':
+            this->buffer.append("\\f");
+            break;
+        case '\n':
+            this->buffer.append("\\n");
+            break;
+        case '\r':
+            this->buffer.append("\\r");
+            break;
+        case '\t':
+            this->buffer.append("\\t");
+            break;
+        default:
+            this->buffer.append("\\u00");
+            this->buffer.push_back(HEX_DIGITS[c >> 4]);
+            this->buffer.push_back(HEX_DIGITS[c & 0xF]);
+            break;
+        }
+    }
+    this->buffer.append(unescaped_begin, value.end());
+    this->buffer.push_back('"');
+}
+
+JsonReader::JsonReader(std::string_view text) : text(text) {
+}
+
+char JsonReader::peek() {
+    while (this->pos < this->text.size() and is_whitespace(this->text[this->pos])) {
+        ++this->pos;
+    }
+    if (this->pos >= this->text.size()) {
+        this->error("unexpected end of input");
+    }
+    return this->text[this->pos];
+}
+
+void JsonReader::expect(char c) {
+    if (this->peek() != c) {
+        this->error(std::string("expected '") + c + "'");
+    }
+    ++this->pos;
+}
+
+void JsonReader::error(const std::string& message) const {
+    throw JsonStreamException("JSON parse error at offset " + std::to_string(this->pos) + ": " + message);
+}
+
+void JsonReader::begin_object() {
+    this->expect('{');
+    this->first_in_container = true;
+}
+
+bool JsonReader::next_key() {
+    const bool first = this->first_in_container;
+    this->first_in_container = false;
+    if (this->peek() == '}') {
+        ++this->pos;
+        return false;
+    }
+    if (!first) {
+        this->expect(',');
+    }
+    this->read_string(this->current_key);
+    this->expect(':');
+    return true;
+}
+
+const std::string& JsonReader::key() const {
+    return this->current_key;
+}
+
+void JsonReader::begin_array() {
+    this->expect('[');
+    this->first_in_container = true;
+}
+
+bool JsonReader::next_element() {
+    const bool first = this->first_in_container;
+    this->first_in_container = false;
+    if (this->peek() == ']') {
+        ++this->pos;
+        return false;
+    }
+    if (!first) {
+        this->expect(',');
+    }
+    return true;
+}
+
+void JsonReader::read_string(std::string& value) {
+    this->expect('"');
+    value.clear();
+    auto unescaped_begin = this->pos;
+    while (true) {
+        if (this->pos >= this->text.size()) {
+            this->error("unterminated string");
+        }
+        const auto c = static_cast<unsigned char>(this->text[this->pos]);
+        if (c == '"') {
+            value.append(this->text, unescaped_begin, this->pos - unescaped_begin);
+            ++this->pos;
+            return;
+        }
+        if (c < 0x20) {
+            this->error("control character in string");
+        }
+        if (c != '\\') {
+            ++this->pos;
+            continue;
+        }
+
+        value.append(this->text, unescaped_begin, this->pos - unescaped_begin);
+        if (this->pos + 1 >= this->text.size()) {
+            this->error("unterminated string");
+        }
+        const auto escaped = this->text[this->pos + 1];
+        this->pos += 2;
+        switch (escaped) {
+        case '"':
+        case '\\':
+        case '/':
+            value.push_back(escaped);
+            break;
+        case 'b':
+            value.push_back('\b');
+            break;
+        case 'f':
+            value.push_back('\f');
+            break;
+        case 'n':
+            value.push_back('\n');
+            break;
+        case 'r':
+            value.push_back('\r');
+            break;
+        case 't':
+            value.push_back('\t');
+            break;
+        case 'u': {
+            const auto read_hex = [this]() {
+                std::uint32_t code_unit = 0;
+                if (this->pos + 4 > this->text.size() or
+                    std::from_chars(&this->text[this->pos], &this->text[this->pos] + 4, code_unit, 16).ptr !=
+                        &this->text[this->pos] + 4) {
+                    this->error("invalid unicode escape");
+                }
+                this->pos += 4;
+                return code_unit;
+            };
+            auto code_point = read_hex();
+            if (code_point >= 0xD800 and code_point < 0xDC00) {
+                if (this->text.substr(this->pos, 2) != "\\u") {
+                    this->error("unpaired surrogate");
+                }
+                this->pos += 2;
+                const auto low = read_hex();
+                if (low < 0xDC00 or low > 0xDFFF) {
+                    this->error("unpaired surrogate");
+                }
+                code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+            } else if (code_point >= 0xDC00 and code_point <= 0xDFFF) {
+                this->error("unpaired surrogate");
+            }
+            append_utf8(value, code_point);
+            break;
+        }
+        default:
+            this->error("invalid escape sequence");
+        }
+        unescaped_begin = this->pos;
+    }
+}
+
+std::string JsonReader::read_string() {
+    std::string value;
+    this->read_string(value);
+    return value;
+}
+
+std::string_view JsonReader::scalar_token() {
+    this->peek();
+    const auto begin = this->pos;
+    while (this->pos < this->text.size()) {
+        const auto c = this->text[this->pos];
+        if (c == ',' or c == '}' or c == ']' or is_whitespace(c)) {
+            break;
+        }
+        ++this->pos;
+    }
+    return this->text.substr(begin, this->pos - begin);
+}
+
+bool JsonReader::read_bool() {
+    const auto token = this->scalar_token();
+    if (token == "true") {
+        return true;
+    }
+    if (token == "false") {
+        return false;
+    }
+    this->error("expected boolean");
+}
+
+std::int32_t JsonReader::read_int32() {
+    const auto token = this->scalar_token();
+    std::int32_t value = 0;
+    const auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (result.ec == std::errc() and result.ptr == token.data() + token.size()) {
+        return value;
+    }
+    // numbers with exponent or fraction are accepted as long as they are integral, e.g. 1e3 or 2.0
+    this->pos -= token.size();
+    const auto number = this->read_number();
+    if (std::trunc(number) != number) {
+        this->error("expected integer");
+    }
+    if (number < std::numeric_limits<std::int32_t>::min() or number > std::numeric_limits<std::int32_t>::max()) {
+        this->error("integer out of range");
+    }
+    return static_cast<std::int32_t>(number);
+}
+
+double JsonReader::read_number() {
+    const auto token = this->scalar_token();
+    double value = 0;
+    // from_chars accepts neither a leading '+' nor hex numbers, which are invalid JSON as well
+    const auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (token.empty() or result.ec != std::errc() or result.ptr != token.data() + token.size() or
+        token.find_first_of("iInN") != std::string_view::npos) {
+        this->error("expected number");
+    }
+    return value;
+}
+
+void JsonReader::skip_value() {
+    std::string closing;
+    do {
+        const auto c = this->peek();
+        if (c == '{' or c == '[') {
+            closing.push_back(c == '{' ? '}' : ']');
+            ++this->pos;
+        } else if (c == '}' or c == ']') {
+            if (closing.empty() or closing.back() != c) {
+                this->error("unbalanced brackets");
+            }
+            closing.pop_back();
+            ++this->pos;
+        } else if (c == ',' or c == ':') {
+            if (closing.empty()) {
+                this->error("unexpected separator");
+            }
+            ++this->pos;
+        } else if (c == '"') {
+            this->read_string(this->current_key);
+        } else if (this->scalar_token().empty()) {
+            this->error("expected value");
+        }
+    } while (!closing.empty());
+}
+
+json JsonReader::read_value() {
+    this->peek();
+    const auto begin = this->pos;
+    this->skip_value();
+    try {
+        return json::parse(this->text.substr(begin, this->pos - begin));
+    } catch (const json::exception& e) {
+        throw JsonStreamException(e.what());
+    }
+}
+
+std::string JsonReader::read_value_as_string() {
+    const auto c = this->peek();
+    if (c == '"') {
+        return this->read_string();
+    }
+    if (c == 't' or c == 'f') {
+        return this->read_bool() ? "true" : "false";
+    }
+    return this->read_value().dump();
+}
+
+void JsonReader::end() {
+    while (this->pos < this->text.size() and is_whitespace(this->text[this->pos])) {
+        ++this->pos;
+    }
+    if (this->pos != this->text.size()) {
+        this->error("unexpected trailing characters");
+    }
+}
+
+void JsonReader::require(bool read, const char* key) const {
+    if (!read) {
+        throw JsonStreamException(std::string("required key '") + key + "' is missing");
+    }
+}
+
+void read_json(JsonReader& reader, json& value) {
+    value = reader.read_value();
+}
+
+} // namespace everest::lib::util
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <everest/util/async/thread_pool_work_stealing.hpp>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace everest::lib::util;
+using namespace std::chrono_literals;
+
+class ThreadPoolWorkStealingTest : public ::testing::Test {
+protected:
+    const unsigned int POOL_SIZE = 4;
+    std::unique_ptr<thread_pool_work_stealing> pool;
+
+    void SetUp() override {
+        pool = std::make_unique<thread_pool_work_stealing>(POOL_SIZE);
+    }
+
+    void TearDown() override {
+        pool.reset();
+    }
+};
+
+TEST_F(ThreadPoolWorkStealingTest, ReturnsValueWithArguments) {
+    auto fut = (*pool)([](int a, int b) { return a + b; }, 5, 7);
+    EXPECT_EQ(fut.get(), 12);
+}
+
+TEST_F(ThreadPoolWorkStealingTest, VoidTask) {
+    std::atomic<bool> executed{false};
+    auto fut = (*pool)([&executed]() { executed = true; });
+    fut.get();
+    EXPECT_TRUE(executed);
+}
+
+TEST_F(ThreadPoolWorkStealingTest, ExceptionIsPropagated) {
+    auto fut = (*pool)([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(fut.get(), std::runtime_error);
+
+    // the worker survives the exception
+    EXPECT_EQ((*pool)([]() { return 1; }).get(), 1);
+}
+
+TEST_F(ThreadPoolWorkStealingTest, RunSwallowsExceptions) {
+    pool->run([]() { throw std::runtime_error("fire and forget"); });
+    EXPECT_EQ((*pool)([]() { return 2; }).get(), 2);
+}
+
+TEST_F(ThreadPoolWorkStealingTest, ManyTasksFromOutside) {
+    const int task_count = 10000;
+    std::atomic<int> counter{0};
+    std::vector<std::future<void>> futures;
+    futures.reserve(task_count);
+    for (int i = 0; i < task_count; ++i) {
+        futures.push_back((*pool)([&counter]() { counter++; }));
+    }
+    for (auto& fut : futures) {
+        fut.get();
+    }
+    EXPECT_EQ(counter, task_count);
+}
+
+TEST_F(ThreadPoolWorkStealingTest, NestedSubmissionsAreStolen) {
+    // a single task spawns all subtasks into its own worker queue and blocks its worker until all subtasks ran,
+    // which only completes if the other workers steal them
+    const int subtask_count = 1000;
+    std::atomic<int> counter{0};
+    std::promise<void> done;
+    auto root = (*pool)([this, &counter, &done, subtask_count]() {
+        for (int i = 0; i < subtask_count; ++i) {
+            pool->run([&counter, &done, subtask_count]() {
+                if (++counter == subtask_count) {
+                    done.set_value();
+                }
+            });
+        }
+        return done.get_future().wait_for(5s) == std::future_status::ready;
+    });
+    EXPECT_TRUE(root.get());
+    EXPECT_EQ(counter, subtask_count);
+}
+
+TEST(ThreadPoolWorkStealing, HigherPriorityRunsFirst) {
+    thread_pool_work_stealing pool(1);
+
+    // keep the single worker busy until all tasks are queued
+    std::promise<void> release;
+    auto blocker = pool([gate = release.get_future().share()]() { gate.wait(); });
+
+    std::mutex mtx;
+    std::vector<std::string> order;
+    const auto record = [&mtx, &order](const std::string& name) {
+        std::lock_guard lock(mtx);
+        order.push_back(name);
+    };
+    pool.run_with_priority(task_priority::low, record, "low");
+    pool.run_with_priority(task_priority::normal, record, "normal");
+    auto last = pool.call_with_priority(task_priority::high, record, "high");
+    release.set_value();
+
+    blocker.get();
+    last.get();
+    // low priority runs after high, wait for it as well
+    pool([]() {}).get();
+    pool.call_with_priority(task_priority::low, []() {}).get();
+
+    const std::vector<std::string> expected{"high", "normal", "low"};
+    EXPECT_EQ(order, expected);
+}
+
+TEST(ThreadPoolWorkStealing, DestructorRunsQueuedTasks) {
+    std::atomic<int> counter{0};
+    {
+        thread_pool_work_stealing pool(2);
+        for (int i = 0; i < 100; ++i) {
+            pool.run([&counter]() {
+                std::this_thread::sleep_for(100us);
+                counter++;
+            });
+        }
+    }
+    EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolWorkStealing, ZeroThreadsUsesOneWorker) {
+    thread_pool_work_stealing pool(0);
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool([]() { return 3; }).get(), 3);
+}
+
+TEST(ThreadPoolWorkStealing, CpuAffinityIsBestEffort) {
+    // CPU 0 always exists, the large index does not and leaves the worker unpinned
+    thread_pool_work_stealing pool(2, {0, 1023});
+    std::atomic<int> counter{0};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(pool([&counter]() { counter++; }));
+    }
+    for (auto& fut : futures) {
+        fut.get();
+    }
+    EXPECT_EQ(counter, 100);
+}
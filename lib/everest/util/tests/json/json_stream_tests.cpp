@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include <everest/util/json/json_stream.hpp>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+namespace everest::lib::util {
+
+using json = nlohmann::json;
+
+TEST(JsonWriterTest, WritesLikeDump) {
+    std::string buffer;
+    JsonWriter writer(buffer);
+    writer.begin_object();
+    writer.key("string");
+    writer.value("quote \" backslash \\ newline \n control \x01 unicode \xc3\xa4");
+    writer.key("integer");
+    writer.value(std::int32_t{-42});
+    writer.key("float");
+    writer.value(static_cast<double>(230.1f));
+    writer.key("whole");
+    writer.value(1.0);
+    writer.key("array");
+    writer.begin_array();
+    writer.value(true);
+    writer.value(false);
+    writer.null();
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    writer.key("json");
+    writer.dump(json{{"vendorId", "EVerest"}});
+    writer.end_object();
+
+    const json expected = {{"string", "quote \" backslash \\ newline \n control \x01 unicode \xc3\xa4"},
+                           {"integer", -42},
+                           {"float", 230.1f},
+                           {"whole", 1.0},
+                           {"array", {true, false, nullptr, json::object()}},
+                           {"json", {{"vendorId", "EVerest"}}}};
+    EXPECT_EQ(json::parse(buffer), expected);
+    EXPECT_NE(buffer.find(expected.at("float").dump()), std::string::npos);
+    EXPECT_NE(buffer.find("\"whole\":1.0"), std::string::npos);
+    EXPECT_NE(buffer.find("\\u0001"), std::string::npos);
+}
+
+TEST(JsonWriterTest, AppendsToBuffer) {
+    std::string buffer = "prefix";
+    JsonWriter writer(buffer);
+    writer.begin_array();
+    writer.value(std::int32_t{1});
+    writer.end_array();
+    EXPECT_EQ(buffer, "prefix[1]");
+}
+
+TEST(JsonReaderTest, ReadsValues) {
+    JsonReader reader(R"( {"s": "a\"b\\cä😀", "i": 7, "f": 1.5e1, "b": true,
+                           "arr": [1, 2], "empty": {}, "unknown": {"x": [null, "]"]}} )");
+    std::vector<std::int32_t> arr;
+    reader.begin_object();
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_EQ(reader.key(), "s");
+    EXPECT_EQ(reader.read_string(), "a\"b\\c\xc3\xa4\xf0\x9f\x98\x80");
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_EQ(reader.read_int32(), 7);
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_EQ(reader.read_number(), 15.0);
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_TRUE(reader.read_bool());
+    ASSERT_TRUE(reader.next_key());
+    read_json(reader, arr);
+    EXPECT_EQ(arr, (std::vector<std::int32_t>{1, 2}));
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_EQ(reader.read_value(), json::object());
+    ASSERT_TRUE(reader.next_key());
+    EXPECT_EQ(reader.key(), "unknown");
+    reader.skip_value();
+    EXPECT_FALSE(reader.next_key());
+    EXPECT_NO_THROW(reader.end());
+}
+
+TEST(JsonReaderTest, ReadsInt32InRange) {
+    const auto read_int32 = [](const std::string& text) {
+        JsonReader reader(text);
+        const auto value = reader.read_int32();
+        reader.end();
+        return value;
+    };
+    EXPECT_EQ(read_int32("2147483647"), 2147483647);
+    EXPECT_EQ(read_int32("-2147483648"), -2147483647 - 1);
+    EXPECT_EQ(read_int32("2.0"), 2);
+    EXPECT_EQ(read_int32("1e3"), 1000);
+    EXPECT_EQ(read_int32("-2.147483648e9"), -2147483647 - 1);
+
+    EXPECT_THROW(read_int32("2147483648"), JsonStreamException);
+    EXPECT_THROW(read_int32("-2147483649"), JsonStreamException);
+    EXPECT_THROW(read_int32("1e10"), JsonStreamException);
+    EXPECT_THROW(read_int32("99999999999999999999"), JsonStreamException);
+    EXPECT_THROW(read_int32("1.5"), JsonStreamException);
+    EXPECT_THROW(read_int32("-0.1"), JsonStreamException);
+    EXPECT_THROW(read_int32("1e-1"), JsonStreamException);
+    EXPECT_THROW(read_int32("true"), JsonStreamException);
+}
+
+TEST(JsonReaderTest, ReadsValuesAsString) {
+    JsonReader reader(R"(["text", true, 1.5, {"a": 1}])");
+    reader.begin_array();
+    std::vector<std::string> values;
+    while (reader.next_element()) {
+        values.push_back(reader.read_value_as_string());
+    }
+    EXPECT_EQ(values, (std::vector<std::string>{"text", "true", "1.5", R"({"a":1})"}));
+}
+
+TEST(JsonReaderTest, RejectsMalformedInput) {
+    const auto read_object = [](const std::string& text) {
+        JsonReader reader(text);
+        reader.begin_object();
+        while (reader.next_key()) {
+            reader.read_int32();
+        }
+        reader.end();
+    };
+    EXPECT_NO_THROW(read_object(R"({"a": 1, "b": 2})"));
+    EXPECT_THROW(read_object(R"({"a": 1 "b": 2})"), JsonStreamException);
+    EXPECT_THROW(read_object(R"({"a": 1,})"), JsonStreamException);
+    EXPECT_THROW(read_object(R"({"a": "1"})"), JsonStreamException);
+    EXPECT_THROW(read_object(R"({"a": 1)"), JsonStreamException);
+    EXPECT_THROW(read_object(R"({"a": 1} x)"), JsonStreamException);
+
+    JsonReader reader(R"([1, {"a": [}])");
+    reader.begin_array();
+    reader.next_element();
+    reader.skip_value();
+    reader.next_element();
+    EXPECT_THROW(reader.skip_value(), JsonStreamException);
+}
+
+} // namespace everest::lib::util
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2026 Pionix GmbH and Contributors to EVerest
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <everest/util/queue/lock_free_mpsc_queue.hpp>
+#include <everest/util/queue/lock_free_spsc_queue.hpp>
+#include <memory>
+#include <optional>
+#include <poll.h>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace everest::lib::util;
+
+template <class Queue> class LockFreeQueueTest : public ::testing::Test {};
+
+template <class T> struct spsc {
+    using type = lock_free_spsc_queue<T>;
+};
+
+template <class T> struct mpsc {
+    using type = lock_free_mpsc_queue<T>;
+};
+
+using QueueKinds = ::testing::Types<spsc<int>, mpsc<int>>;
+TYPED_TEST_SUITE(LockFreeQueueTest, QueueKinds);
+
+// =================================================================
+// 1. Basic Functionality
+// =================================================================
+
+TYPED_TEST(LockFreeQueueTest, PushPopIsFifo) {
+    typename TypeParam::type queue(8);
+    EXPECT_EQ(queue.push(1), 1u);
+    EXPECT_EQ(queue.push(2), 2u);
+    EXPECT_EQ(queue.push(3), 3u);
+
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.try_pop(), 2);
+    EXPECT_EQ(queue.wait_and_pop(), 3);
+    EXPECT_FALSE(queue.try_pop().has_value());
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TYPED_TEST(LockFreeQueueTest, CapacityIsRoundedUpToPowerOfTwo) {
+    typename TypeParam::type queue(5);
+    EXPECT_EQ(queue.capacity(), 8u);
+}
+
+TYPED_TEST(LockFreeQueueTest, TryPushFailsWhenFull) {
+    typename TypeParam::type queue(2);
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_push(2));
+    EXPECT_FALSE(queue.try_push(3));
+
+    EXPECT_EQ(queue.try_pop(), 1);
+    EXPECT_TRUE(queue.try_push(3));
+    EXPECT_EQ(queue.try_pop(), 2);
+    EXPECT_EQ(queue.try_pop(), 3);
+}
+
+TYPED_TEST(LockFreeQueueTest, WrapsAroundManyTimes) {
+    typename TypeParam::type queue(4);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+        ASSERT_EQ(queue.try_pop(), i);
+    }
+}
+
+// =================================================================
+// 2. Blocking Behavior
+// =================================================================
+
+TYPED_TEST(LockFreeQueueTest, PushBlocksWhenFull) {
+    typename TypeParam::type queue(2);
+    queue.push(1);
+    queue.push(2);
+
+    std::atomic<bool> push_completed{false};
+    std::thread producer([&] {
+        queue.push(3);
+        push_completed = true;
+    });
+
+    std::this_thread::sleep_for(50ms);
+    ASSERT_FALSE(push_completed.load());
+
+    EXPECT_EQ(queue.try_pop(100ms), 1);
+
+    producer.join();
+    ASSERT_TRUE(push_completed.load());
+    EXPECT_EQ(queue.try_pop(), 2);
+    EXPECT_EQ(queue.try_pop(), 3);
+}
+
+TYPED_TEST(LockFreeQueueTest, TryPopTimesOut) {
+    typename TypeParam::type queue(2);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.try_pop(50ms).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+}
+
+TYPED_TEST(LockFreeQueueTest, PopWakesUpOnPush) {
+    typename TypeParam::type queue(2);
+    std::thread producer([&] {
+        std::this_thread::sleep_for(50ms);
+        queue.push(42);
+    });
+    EXPECT_EQ(queue.pop(), 42);
+    producer.join();
+}
+
+// =================================================================
+// 3. Stop Behavior
+// =================================================================
+
+TYPED_TEST(LockFreeQueueTest, StopUnblocksConsumer) {
+    typename TypeParam::type queue(2);
+    std::thread consumer([&] { EXPECT_FALSE(queue.wait_and_pop().has_value()); });
+    std::this_thread::sleep_for(50ms);
+    queue.stop();
+    consumer.join();
+}
+
+TYPED_TEST(LockFreeQueueTest, StopUnblocksProducer) {
+    typename TypeParam::type queue(2);
+    queue.push(1);
+    queue.push(2);
+    std::thread producer([&] { EXPECT_EQ(queue.push(3), 0u); });
+    std::this_thread::sleep_for(50ms);
+    queue.stop();
+    producer.join();
+}
+
+TYPED_TEST(LockFreeQueueTest, RemainingItemsCanBePoppedAfterStop) {
+    typename TypeParam::type queue(4);
+    queue.push(1);
+    queue.stop();
+    EXPECT_EQ(queue.push(2), 0u);
+    EXPECT_FALSE(queue.try_push(3));
+    EXPECT_EQ(queue.wait_and_pop(), 1);
+    EXPECT_FALSE(queue.wait_and_pop().has_value());
+    EXPECT_THROW(queue.pop(), std::bad_optional_access);
+}
+
+// =================================================================
+// 4. Event fd
+// =================================================================
+
+TYPED_TEST(LockFreeQueueTest, EventFdIsDisabledByDefault) {
+    typename TypeParam::type queue(2);
+    EXPECT_EQ(queue.get_event_fd(), -1);
+}
+
+TYPED_TEST(LockFreeQueueTest, EventFdSignalsPush) {
+    typename TypeParam::type queue(4, true);
+    ASSERT_NE(queue.get_event_fd(), -1);
+
+    pollfd pfd{queue.get_event_fd(), POLLIN, 0};
+    EXPECT_EQ(poll(&pfd, 1, 0), 0);
+
+    queue.push(1);
+    queue.push(2);
+    EXPECT_EQ(poll(&pfd, 1, 0), 1);
+
+    queue.acknowledge_event();
+    EXPECT_EQ(poll(&pfd, 1, 0), 0);
+    EXPECT_EQ(queue.try_pop(), 1);
+    EXPECT_EQ(queue.try_pop(), 2);
+
+    queue.push(3);
+    EXPECT_EQ(poll(&pfd, 1, 0), 1);
+}
+
+// =================================================================
+// 5. Element Lifetime
+// =================================================================
+
+TEST(LockFreeQueueLifetimeTest, MoveOnlyTypes) {
+    lock_free_spsc_queue<std::unique_ptr<int>> spsc_queue(2);
+    spsc_queue.push(std::make_unique<int>(1));
+    EXPECT_EQ(*spsc_queue.pop(), 1);
+
+    lock_free_mpsc_queue<std::unique_ptr<int>> mpsc_queue(2);
+    mpsc_queue.push(std::make_unique<int>(2));
+    EXPECT_EQ(*mpsc_queue.pop(), 2);
+}
+
+TEST(LockFreeQueueLifetimeTest, DestructorDestroysRemainingElements) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        lock_free_spsc_queue<std::shared_ptr<int>> spsc_queue(4);
+        lock_free_mpsc_queue<std::shared_ptr<int>> mpsc_queue(4);
+        spsc_queue.push(tracker);
+        mpsc_queue.push(tracker);
+        EXPECT_EQ(tracker.use_count(), 3);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+// =================================================================
+// 6. Concurrency
+// =================================================================
+
+TEST(LockFreeSpscQueueTest, ConcurrentProducerConsumerKeepsOrder) {
+    constexpr int count = 200000;
+    lock_free_spsc_queue<int> queue(64);
+
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.push(i);
+        }
+    });
+
+    for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(queue.pop(), i);
+    }
+    producer.join();
+}
+
+TEST(LockFreeMpscQueueTest, ConcurrentProducersKeepPerProducerOrder) {
+    constexpr int producers = 4;
+    constexpr int count = 50000;
+    lock_free_mpsc_queue<std::pair<int, int>> queue(64);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (int i = 0; i < count; ++i) {
+                queue.push({p, i});
+            }
+        });
+    }
+
+    std::vector<int> next(producers, 0);
+    for (int i = 0; i < producers * count; ++i) {
+        const auto [producer, value] = queue.pop();
+        ASSERT_EQ(value, next[producer]);
+        ++next[producer];
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(queue.try_pop().has_value());
+}
@@ -31,7 +31,8 @@ void RpcApi::init() {
 
     if (config.websocket_enabled) {
         m_websocket_server = std::make_unique<server::WebSocketServer>(
-            config.websocket_tls_enabled, config.websocket_port, config.websocket_interface);
+            config.websocket_tls_enabled, config.websocket_port, config.websocket_interface,
+            static_cast<size_t>(config.websocket_send_queue_size));
         transport_interfaces.push_back(std::shared_ptr<server::TransportInterface>(std::move(m_websocket_server)));
     }
 
@@ -39,8 +40,9 @@ void RpcApi::init() {
         throw std::runtime_error("No other transports currently available, please enable websocket transport");
     }
 
-    m_rpc_handler = std::make_unique<rpc::RpcHandler>(std::move(transport_interfaces), data,
-                                                      std::move(m_request_handler), config.max_decimal_places_other);
+    m_rpc_handler = std::make_unique<rpc::RpcHandler>(
+        std::move(transport_interfaces), data, std::move(m_request_handler), config.max_decimal_places_other,
+        std::chrono::milliseconds(config.notification_min_interval_ms));
 
     subscribe_global_errors();
 }
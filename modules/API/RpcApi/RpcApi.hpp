@@ -31,8 +31,10 @@ struct Conf {
     bool websocket_enabled;
     int websocket_port;
     std::string websocket_interface;
+    int websocket_send_queue_size;
     bool websocket_tls_enabled;
     bool authentication_required;
+    int notification_min_interval_ms;
     int max_decimal_places_other;
 };
 
@@ -416,4 +416,18 @@ std::optional<RPCDataTypes::DCChargeParametersObj> EVSEStatusStore::get_dc_charg
     return this->dataobj.dc_charge_param;
 }
 
+void DataStoreCharger::set_notification_interval(std::chrono::milliseconds interval) {
+    // status changes are notified immediately, see send_status_changed
+    for (const auto& evse : evses) {
+        evse->meterdata.set_notification_interval(interval);
+    }
+}
+
+void DataStoreCharger::flush_pending_notifications() {
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& evse : evses) {
+        evse->meterdata.flush_pending_notification(now);
+    }
+}
+
 } // namespace data
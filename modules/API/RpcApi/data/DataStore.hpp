@@ -160,6 +160,11 @@ struct DataStoreCharger {
         EVLOG_error << "EVSE index " << evse_index << " not found in data store.";
         return nullptr;
     }
+
+    // set the minimum time between two notifications of the high-rate meter data stores
+    void set_notification_interval(std::chrono::milliseconds interval);
+    // notify the coalesced changes of all stores whose notification interval has passed
+    void flush_pending_notifications();
 };
 
 } // namespace data
@@ -4,6 +4,7 @@
 #define GENERICINFOSTORE_HPP
 
 #include <atomic>
+#include <chrono>
 #include <functional> // for std::function
 #include <mutex>
 #include <nlohmann/json.hpp>
@@ -29,6 +30,11 @@ protected:
     virtual void init_data(){};
     // whether the non-optional values are valid, so that the RPC interface can generate an error
     std::atomic<bool> data_is_valid{false};
+    // minimum time between two notifications, changes in between are coalesced. 0 notifies every change.
+    std::chrono::milliseconds notification_interval{0};
+    std::chrono::steady_clock::time_point last_notification;
+    // whether a coalesced change still has to be notified
+    bool notification_pending{false};
 
 public:
     explicit GenericInfoStore() {
@@ -63,6 +69,16 @@ public:
     void notify_data_changed() {
         std::unique_lock<std::mutex> data_lock(this->data_mutex);
         if (this->notification_callback && this->data_is_valid) {
+            if (this->notification_interval.count() > 0) {
+                const auto now = std::chrono::steady_clock::now();
+                if (now - this->last_notification < this->notification_interval) {
+                    // only the latest data is sent by flush_pending_notification
+                    this->notification_pending = true;
+                    return;
+                }
+                this->last_notification = now;
+            }
+            this->notification_pending = false;
             // create a copy of the data object
             T data_copy = this->dataobj;
             // unlock explicitly before entering callback
@@ -71,6 +87,28 @@ public:
         }
     }
 
+    // notify a coalesced change once the notification interval has passed. Needs to be called periodically if a
+    // notification interval is set.
+    void flush_pending_notification(std::chrono::steady_clock::time_point now) {
+        std::unique_lock<std::mutex> data_lock(this->data_mutex);
+        if (!this->notification_pending || now - this->last_notification < this->notification_interval) {
+            return;
+        }
+        this->notification_pending = false;
+        this->last_notification = now;
+        if (this->notification_callback && this->data_is_valid) {
+            T data_copy = this->dataobj;
+            data_lock.unlock();
+            this->notification_callback(data_copy);
+        }
+    }
+
+    // set the minimum time between two notifications
+    void set_notification_interval(std::chrono::milliseconds interval) {
+        std::unique_lock<std::mutex> data_lock(this->data_mutex);
+        this->notification_interval = interval;
+    }
+
     // register a callback which is triggered when any data in the associated data store changes
     void register_notification_callback(const std::function<void(const T&)>& callback) {
         this->notification_callback = callback;
@@ -25,6 +25,17 @@ static const std::chrono::milliseconds
 // Helper functions
 template <typename T> struct is_optional<std::optional<T>> : std::true_type {};
 
+// Delta notifications are negotiated per client, so API.Hello itself does not know about them. Confirm them in the
+// response of a successful API.Hello instead.
+static std::string acknowledge_delta_notifications(const std::string& hello_response) {
+    auto response = nlohmann::json::parse(hello_response, nullptr, false);
+    if (response.is_discarded() || !response.contains("result") || !response["result"].is_object()) {
+        return hello_response;
+    }
+    response["result"]["delta_notifications"] = true;
+    return response.dump();
+}
+
 template <typename T> auto extract_param(const nlohmann::json& j) {
     if constexpr (is_optional<T>::value) {
         using InnerT = typename T::value_type;
@@ -102,14 +113,17 @@ MethodHandle get_handle(ReturnType (T::*method)(ParamTypes...), T& instance, int
 
 RpcHandler::RpcHandler(std::vector<std::shared_ptr<server::TransportInterface>> transport_interfaces,
                        DataStoreCharger& dataobj,
-                       std::unique_ptr<request_interface::RequestHandlerInterface> request_handler, int precision) :
+                       std::unique_ptr<request_interface::RequestHandlerInterface> request_handler, int precision,
+                       std::chrono::milliseconds notification_interval) :
     m_transport_interfaces(std::move(transport_interfaces)),
     m_data_store(dataobj),
     m_methods_api(dataobj),
     m_methods_chargepoint(dataobj),
     m_methods_evse(dataobj, std::move(request_handler)),
-    m_conn(m_transport_interfaces, m_api_hello_received, m_mtx),
-    m_precision(precision) {
+    m_conn(m_transport_interfaces, m_api_hello_received, m_delta_notification_clients, m_mtx),
+    m_precision(precision),
+    m_notification_interval(notification_interval) {
+    m_data_store.set_notification_interval(m_notification_interval);
     init_rpc_api();
     init_transport_interfaces();
     m_notifications_evse = std::make_unique<notifications::Evse>(m_rpc_server, dataobj, m_precision);
@@ -215,6 +229,7 @@ void RpcHandler::client_disconnected(const std::shared_ptr<server::TransportInte
     if (transport_interface) {
         std::lock_guard<std::mutex> lock(m_mtx);
         m_api_hello_received.erase(client_id);
+        m_delta_notification_clients.erase(client_id);
     } else {
         // Log the error instead of throwing an exception in a detached thread
         // to avoid undefined behavior.
@@ -262,6 +277,11 @@ void RpcHandler::data_available(const std::shared_ptr<server::TransportInterface
 
 void RpcHandler::process_client_requests() {
     while (m_is_running) {
+        if (m_notification_interval.count() > 0) {
+            // This loop runs at least every REQ_PROCESSING_TIMEOUT, which bounds the delay of coalesced notifications.
+            // It must not hold m_mtx, since sending notifications locks it.
+            m_data_store.flush_pending_notifications();
+        }
         std::unique_lock<std::mutex> lock(m_mtx);
         // Wait for data to be available or timeout
         m_cv_data_available.wait_for(lock, REQ_PROCESSING_TIMEOUT, [this]() {
@@ -300,7 +320,10 @@ void RpcHandler::process_client_requests() {
                 }
 
                 // Check if the request is an API.Hello request
-                if (is_api_hello_req(client_id, request)) {
+                const bool is_hello = is_api_hello_req(client_id, request);
+                const bool delta_notifications =
+                    is_hello && m_delta_notification_clients.find(client_id) != m_delta_notification_clients.end();
+                if (is_hello) {
                     // Notify condition variable to unblock the waiting thread
                     m_cv_api_hello.notify_all();
                     EVLOG_info << "API.Hello request received from client " << client_id;
@@ -317,9 +340,12 @@ void RpcHandler::process_client_requests() {
 
                 // Process the request in a detached thread, because HandleRequest is blocking until the response is
                 // received
-                std::thread([this, transport_interface, client_id, request]() {
+                std::thread([this, transport_interface, client_id, request, delta_notifications]() {
                     // Call the RPC server with the request
                     std::string res = m_rpc_server->HandleRequest(request.dump());
+                    if (delta_notifications) {
+                        res = acknowledge_delta_notifications(res);
+                    }
                     // Send the response back to the client
                     transport_interface->send_data(client_id, res);
                     EVLOG_debug << "Sent response to client " << client_id << ": " << res;
@@ -17,6 +17,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "../helpers/LimitDecimalPlaces.hpp"
@@ -45,11 +46,21 @@ class ClientConnector : public jsonrpccxx::IClientConnector {
 public:
     explicit ClientConnector(std::vector<std::shared_ptr<TransportInterface>>& interfaces,
                              std::unordered_map<TransportInterface::ClientId, bool>& api_hello_received,
+                             std::unordered_set<TransportInterface::ClientId>& delta_notification_clients,
                              std::mutex& api_hello_mutex) :
-        hello_received(api_hello_received), transport_interfaces(interfaces), hello_mutex(api_hello_mutex) {
+        hello_received(api_hello_received),
+        delta_clients(delta_notification_clients),
+        transport_interfaces(interfaces),
+        hello_mutex(api_hello_mutex) {
     }
     std::string Send(const std::string& notification) override {
-        const std::vector<uint8_t> notif_char_array{notification.begin(), notification.end()};
+        send_notification(notification, std::nullopt);
+        return "";
+    }
+
+    // Send a notification to all clients that sent API.Hello. Notifications with a coalesce key carry the latest
+    // state of something, so a transport may replace a not yet sent notification with the same key.
+    void send_notification(const std::string& notification, const std::optional<std::string>& coalesce_key) {
         std::vector<TransportInterface::ClientId> recipients;
         {
             std::lock_guard<std::mutex> lock(hello_mutex);
@@ -60,26 +71,106 @@ public:
                 }
             }
         }
+        send_to_clients(recipients, notification, coalesce_key);
+    }
 
-        for (const auto& interface : transport_interfaces) {
-            for (const auto& client_id : recipients) {
-                interface->send_data(client_id, notif_char_array);
+    // Send a notification that carries the latest state identified by state_key.
+    // Clients that negotiated delta notifications in API.Hello receive the full params once and afterwards only
+    // the key_fields plus a JSON patch (RFC 6902) against the params they received before. Delta notifications are
+    // never coalesced, since every patch builds on the previous one.
+    void send_state_notification(const std::string& method, const nlohmann::json& params, const std::string& state_key,
+                                 const nlohmann::json& key_fields, bool coalesce) {
+        std::vector<TransportInterface::ClientId> full_recipients;
+        std::vector<TransportInterface::ClientId> delta_recipients;
+        {
+            std::lock_guard<std::mutex> lock(hello_mutex);
+            for (const auto& rec : hello_received) {
+                if (!rec.second) {
+                    continue;
+                }
+                if (delta_clients.find(rec.first) != delta_clients.end()) {
+                    delta_recipients.push_back(rec.first);
+                } else {
+                    full_recipients.push_back(rec.first);
+                }
             }
         }
-        return "";
+
+        const auto notification = make_notification(method, params);
+
+        // serializes the notifications of one state, so that full and delta clients receive the changes in the same
+        // order and the patches in the order they were computed
+        std::lock_guard<std::mutex> lock(delta_mutex);
+        send_to_clients(full_recipients, notification, coalesce ? std::optional<std::string>{state_key} : std::nullopt);
+        if (delta_recipients.empty()) {
+            delta_states.erase(state_key);
+            return;
+        }
+
+        auto& state = delta_states[state_key];
+        std::vector<TransportInterface::ClientId> synced_recipients;
+        std::vector<TransportInterface::ClientId> new_recipients;
+        for (const auto& client_id : delta_recipients) {
+            if (state.synced_clients.find(client_id) != state.synced_clients.end()) {
+                synced_recipients.push_back(client_id);
+            } else {
+                new_recipients.push_back(client_id);
+            }
+        }
+
+        if (!synced_recipients.empty()) {
+            const auto patch = nlohmann::json::diff(state.params, params);
+            if (!patch.empty()) {
+                auto delta_params = key_fields;
+                delta_params["patch"] = patch;
+                send_to_clients(synced_recipients, make_notification(method, delta_params), std::nullopt);
+            }
+        }
+        send_to_clients(new_recipients, notification, std::nullopt);
+
+        state.params = params;
+        // this also forgets disconnected clients
+        state.synced_clients = {delta_recipients.begin(), delta_recipients.end()};
+    }
+
+    // same as the JSON-RPC 2.0 notification created by JsonRpcClient::CallNotificationNamed
+    static std::string make_notification(const std::string& method, const nlohmann::json& params) {
+        const nlohmann::json notification{{"jsonrpc", "2.0"}, {"method", method}, {"params", params}};
+        return notification.dump();
     }
 
 private:
+    // the state last sent to the delta notification clients
+    struct DeltaState {
+        nlohmann::json params;
+        std::unordered_set<TransportInterface::ClientId> synced_clients;
+    };
+
+    void send_to_clients(const std::vector<TransportInterface::ClientId>& recipients, const std::string& notification,
+                         const std::optional<std::string>& coalesce_key) {
+        if (recipients.empty()) {
+            return;
+        }
+        const std::vector<uint8_t> notif_char_array{notification.begin(), notification.end()};
+        for (const auto& interface : transport_interfaces) {
+            interface->send_data_to_clients(recipients, notif_char_array, coalesce_key);
+        }
+    }
+
     std::unordered_map<TransportInterface::ClientId, bool>& hello_received;
+    std::unordered_set<TransportInterface::ClientId>& delta_clients;
     std::vector<std::shared_ptr<TransportInterface>>& transport_interfaces;
     std::mutex& hello_mutex;
+    std::mutex delta_mutex;
+    std::unordered_map<std::string, DeltaState> delta_states;
 };
 // Members
 
 class JsonRpc2ServerWithClient : public JsonRpc2Server, public JsonRpcClient {
 public:
     JsonRpc2ServerWithClient() = delete;
-    explicit JsonRpc2ServerWithClient(ClientConnector& i) : JsonRpc2Server(), JsonRpcClient(i, version::v2){};
+    explicit JsonRpc2ServerWithClient(ClientConnector& i) :
+        JsonRpc2Server(), JsonRpcClient(i, version::v2), m_connector(i){};
     // helper to be able to put data object into caller
     // which is something which json-rpc-cxx should be doing
     template <typename T> void CallNotificationWithObject(const std::string& name, const T& in, int precision = 3) {
@@ -88,6 +179,20 @@ public:
         helpers::round_floats_in_json(j, precision);
         CallNotificationNamed(name, j);
     }
+    // Same as CallNotificationWithObject, for notifications that carry the latest state identified by state_key.
+    // key_fields are the fields of the object that identify the state, e.g. the EVSE index, and are part of every
+    // delta notification. If coalesce is set, clients that are behind only receive the latest notification.
+    template <typename T>
+    void CallStateNotificationWithObject(const std::string& name, const T& in, const std::string& state_key,
+                                         const nlohmann::json& key_fields, bool coalesce, int precision = 3) {
+        nlohmann::json j;
+        nlohmann::to_json(j, in);
+        helpers::round_floats_in_json(j, precision);
+        m_connector.send_state_notification(name, j, state_key, key_fields, coalesce);
+    }
+
+private:
+    ClientConnector& m_connector;
 };
 
 class RpcHandler {
@@ -95,8 +200,11 @@ public:
     // Constructor and Destructor
     RpcHandler() = delete;
     // RpcHandler just needs a transport interface array
+    // Changes of the high-rate data stores are coalesced to at most one notification per notification_interval,
+    // 0 notifies every change
     RpcHandler(std::vector<std::shared_ptr<server::TransportInterface>> transport_interfaces, DataStoreCharger& dataobj,
-               std::unique_ptr<request_interface::RequestHandlerInterface> request_handler, int precision = 3);
+               std::unique_ptr<request_interface::RequestHandlerInterface> request_handler, int precision = 3,
+               std::chrono::milliseconds notification_interval = std::chrono::milliseconds(0));
 
     ~RpcHandler() = default;
 
@@ -119,6 +227,15 @@ private:
             // If it's a API.Hello request, we set the api_hello_received flag to true
             // and notify the condition variable to unblock the waiting thread
             m_api_hello_received[client_id] = true;
+            // The client may request delta notifications with the optional API.Hello parameter
+            // "delta_notifications"
+            const auto params = request.find("params");
+            if (params != request.end() && params->is_object() &&
+                params->value("delta_notifications", json()) == true) {
+                m_delta_notification_clients.insert(client_id);
+            } else {
+                m_delta_notification_clients.erase(client_id);
+            }
             return true;
         }
         return false;
@@ -131,6 +248,8 @@ private:
     std::condition_variable m_cv_api_hello;
     std::condition_variable m_cv_data_available;
     std::unordered_map<TransportInterface::ClientId, bool> m_api_hello_received;
+    // clients that negotiated delta notifications in API.Hello
+    std::unordered_set<TransportInterface::ClientId> m_delta_notification_clients;
     std::shared_ptr<JsonRpc2ServerWithClient> m_rpc_server;
     std::unordered_map<TransportInterface::ClientId, ClientReq> messages;
     std::chrono::steady_clock::time_point m_last_req_notification; // Last tick time
@@ -144,6 +263,7 @@ private:
     std::unique_ptr<notifications::ChargePoint> m_notifications_chargepoint;
     std::unique_ptr<notifications::Evse> m_notifications_evse;
     int m_precision = 3;
+    std::chrono::milliseconds m_notification_interval{0};
 };
 } // namespace rpc
 
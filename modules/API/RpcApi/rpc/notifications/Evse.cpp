@@ -9,6 +9,11 @@ static const std::string NOTIFICATION_EVSE_HWCAPS_CHANGED = "EVSE.HardwareCapabi
 static const std::string NOTIFICATION_EVSE_STATUS_CHANGED = "EVSE.StatusChanged";
 static const std::string NOTIFICATION_EVSE_METER_DATA_CHANGED = "EVSE.MeterDataChanged";
 
+// fields that identify the EVSE in delta notifications
+static nlohmann::json evse_key_fields(int32_t evse_index) {
+    return {{"evse_index", evse_index}};
+}
+
 Evse::Evse(std::shared_ptr<rpc::JsonRpc2ServerWithClient> rpc_server, data::DataStoreCharger& dataobj, int precision) :
     m_dataobj(dataobj), m_rpc_server(std::move(rpc_server)), m_precision(precision) {
     for (const auto& evse : m_dataobj.evses) {
@@ -30,19 +35,26 @@ void Evse::send_hardware_capabilities_changed(int32_t evse_index, const RPCDataT
     RPCDataTypes::EVSEHardwareCapabilitiesChangedObj hwcap_changed;
     hwcap_changed.evse_index = evse_index;
     hwcap_changed.hardware_capabilities = hwcap;
-    m_rpc_server->CallNotificationWithObject(NOTIFICATION_EVSE_HWCAPS_CHANGED, hwcap_changed, m_precision);
+    m_rpc_server->CallStateNotificationWithObject(NOTIFICATION_EVSE_HWCAPS_CHANGED, hwcap_changed,
+                                                  NOTIFICATION_EVSE_HWCAPS_CHANGED + std::to_string(evse_index),
+                                                  evse_key_fields(evse_index), true, m_precision);
 }
 void Evse::send_status_changed(int32_t evse_index, const RPCDataTypes::EVSEStatusObj& status) {
     RPCDataTypes::EVSEStatusChangedObj status_changed;
     status_changed.evse_index = evse_index;
     status_changed.evse_status = status;
-    m_rpc_server->CallNotificationWithObject(NOTIFICATION_EVSE_STATUS_CHANGED, status_changed, m_precision);
+    // state changes must not be skipped, so status notifications are not coalesced
+    m_rpc_server->CallStateNotificationWithObject(NOTIFICATION_EVSE_STATUS_CHANGED, status_changed,
+                                                  NOTIFICATION_EVSE_STATUS_CHANGED + std::to_string(evse_index),
+                                                  evse_key_fields(evse_index), false, m_precision);
 }
 void Evse::send_meterdata_changed(int32_t evse_index, const RPCDataTypes::MeterDataObj& meter) {
     RPCDataTypes::EVSEMeterDataChangedObj meter_changed;
     meter_changed.evse_index = evse_index;
     meter_changed.meter_data = meter;
-    m_rpc_server->CallNotificationWithObject(NOTIFICATION_EVSE_METER_DATA_CHANGED, meter_changed, m_precision);
+    m_rpc_server->CallStateNotificationWithObject(NOTIFICATION_EVSE_METER_DATA_CHANGED, meter_changed,
+                                                  NOTIFICATION_EVSE_METER_DATA_CHANGED + std::to_string(evse_index),
+                                                  evse_key_fields(evse_index), true, m_precision);
 }
 
 } // namespace notifications
@@ -29,6 +29,15 @@ public:
     inline void send_data(const ClientId& clientId, const std::string& data) {
         send_data(clientId, std::vector<uint8_t>(data.begin(), data.end()));
     };
+    // Send the same data to several clients. Data with a coalesce key only carries the latest state of something,
+    // e.g. the meter data of an EVSE, so a transport may replace data with the same key that was not sent yet.
+    // The default implementation sends the data to each client on its own.
+    virtual void send_data_to_clients(const std::vector<ClientId>& clientIds, const Data& data,
+                                      [[maybe_unused]] const std::optional<std::string>& coalesceKey = std::nullopt) {
+        for (const auto& clientId : clientIds) {
+            send_data(clientId, data);
+        }
+    };
     virtual void kill_client_connection(const ClientId& clientId, const std::string& killReason) = 0;
 
     virtual uint32_t connections_count() const = 0;
@@ -45,7 +45,7 @@ int WebSocketServer::callback_ws(struct lws* wsi, enum lws_callback_reasons reas
     case LWS_CALLBACK_ESTABLISHED: {
         // Generate a random UUID for the client
         std::string client_id = everest::helpers::get_uuid();
-        server->m_clients[client_id] = wsi;
+        server->m_clients[client_id] = Client{wsi, {}, false};
 
         char ip_address_buf[INET6_ADDRSTRLEN]{0};
         if (lws_get_peer_simple(wsi, ip_address_buf, sizeof(ip_address_buf)) == NULL) {
@@ -63,7 +63,7 @@ int WebSocketServer::callback_ws(struct lws* wsi, enum lws_callback_reasons reas
     }
     case LWS_CALLBACK_CLOSED: {
         auto it = std::find_if(server->m_clients.begin(), server->m_clients.end(),
-                               [wsi](const auto& client) { return client.second == wsi; });
+                               [wsi](const auto& client) { return client.second.wsi == wsi; });
         if (it != server->m_clients.end()) {
             const auto client_id = it->first;
             lock.unlock(); // Unlock before calling the callback
@@ -76,7 +76,7 @@ int WebSocketServer::callback_ws(struct lws* wsi, enum lws_callback_reasons reas
     }
     case LWS_CALLBACK_RECEIVE: {
         auto it = std::find_if(server->m_clients.begin(), server->m_clients.end(),
-                               [wsi](const auto& client) { return client.second == wsi; });
+                               [wsi](const auto& client) { return client.second.wsi == wsi; });
         if (it != server->m_clients.end()) {
             const auto client_id = it->first;
             auto* data = static_cast<unsigned char*>(in);
@@ -87,6 +87,52 @@ int WebSocketServer::callback_ws(struct lws* wsi, enum lws_callback_reasons reas
         }
         break;
     }
+    case LWS_CALLBACK_SERVER_WRITEABLE: {
+        auto it = std::find_if(server->m_clients.begin(), server->m_clients.end(),
+                               [wsi](const auto& client) { return client.second.wsi == wsi; });
+        if (it == server->m_clients.end()) {
+            break;
+        }
+        auto& client = it->second;
+        if (client.overflowed) {
+            static const std::string close_reason = "Client does not keep up with the sent data";
+            lws_close_reason(wsi, LWS_CLOSE_STATUS_POLICY_VIOLATION,
+                             reinterpret_cast<unsigned char*>(const_cast<char*>(close_reason.data())),
+                             close_reason.size());
+            return -1; // Close the connection
+        }
+        if (client.send_queue.empty()) {
+            break;
+        }
+
+        // Only one message per callback, as recommended by libwebsockets
+        const auto message = std::move(client.send_queue.front());
+        client.send_queue.pop_front();
+
+        // libwebsockets only writes the frame header into the LWS_PRE headroom and leaves the payload untouched,
+        // so a buffer can be shared between clients. All writes happen on the service thread one after another.
+        const auto payload_size = message.buffer->size() - LWS_PRE;
+        if (lws_write(wsi, message.buffer->data() + LWS_PRE, payload_size, LWS_WRITE_BINARY) <
+            static_cast<int>(payload_size)) {
+            EVLOG_error << "Failed to send data to client " << it->first;
+            return -1; // Close the connection
+        }
+
+        if (!client.send_queue.empty()) {
+            lws_callback_on_writable(wsi);
+        }
+        break;
+    }
+    case LWS_CALLBACK_EVENT_WAIT_CANCELLED: {
+        // Woken up by wake_service_thread(): request write callbacks for all clients with queued data. This has to
+        // happen on the service thread, since libwebsockets is not thread safe
+        for (const auto& client : server->m_clients) {
+            if (!client.second.send_queue.empty() or client.second.overflowed) {
+                lws_callback_on_writable(client.second.wsi);
+            }
+        }
+        break;
+    }
     default:
         break;
     }
@@ -97,7 +143,8 @@ int WebSocketServer::callback_ws(struct lws* wsi, enum lws_callback_reasons reas
     return 0;
 }
 
-WebSocketServer::WebSocketServer(bool ssl_enabled, int port, const std::string& iface) : m_ssl_enabled(ssl_enabled) {
+WebSocketServer::WebSocketServer(bool ssl_enabled, int port, const std::string& iface, size_t send_queue_size) :
+    m_ssl_enabled(ssl_enabled), m_send_queue_size(std::max<size_t>(send_queue_size, 1)) {
     // Constructor implementation
     memset(&m_info, 0, sizeof(m_info));
     lws_set_log_level(LLL_ERR | LLL_WARN | LLL_NOTICE | LLL_INFO | LLL_DEBUG, log_callback);
@@ -139,46 +186,83 @@ bool WebSocketServer::running() const {
     return m_running;
 }
 
-// send data to all connected clients
-void WebSocketServer::send_data(const std::vector<uint8_t>& data) {
-    std::lock_guard<std::mutex> lock(m_clients_mutex);
+WebSocketServer::SendBuffer WebSocketServer::make_send_buffer(const Data& data) {
+    auto buffer = std::make_shared<std::vector<unsigned char>>(LWS_PRE + data.size());
+    memcpy(buffer->data() + LWS_PRE, data.data(), data.size());
+    return buffer;
+}
+
+bool WebSocketServer::enqueue(const ClientId& client_id, Client& client, const SendBuffer& buffer,
+                              const std::optional<std::string>& coalesce_key) {
+    if (client.overflowed) {
+        return false;
+    }
+
+    if (coalesce_key.has_value()) {
+        // Replace the not yet sent state, the client only needs the latest one
+        auto it = std::find_if(client.send_queue.begin(), client.send_queue.end(),
+                               [&coalesce_key](const auto& message) { return message.coalesce_key == coalesce_key; });
+        if (it != client.send_queue.end()) {
+            it->buffer = buffer;
+            return true;
+        }
+    }
 
-    for (const auto& client : m_clients) {
-        struct lws* wsi = client.second;
-        send_data(wsi, data);
+    if (client.send_queue.size() >= m_send_queue_size) {
+        // The client does not keep up. Close its connection instead of letting it hold back the other clients or
+        // silently dropping responses
+        EVLOG_warning << "Send queue of client " << client_id << " overflowed, closing connection";
+        client.send_queue.clear();
+        client.overflowed = true;
+        return false;
     }
+
+    client.send_queue.push_back(OutboundMessage{buffer, coalesce_key});
+    return true;
 }
 
-// send data to client identified by ClientId
-void WebSocketServer::send_data(const ClientId& client_id, const std::vector<uint8_t>& data) {
-    try {
-        std::lock_guard<std::mutex> lock(m_clients_mutex);
+void WebSocketServer::wake_service_thread() {
+    if (m_running and m_context) {
+        lws_cancel_service(m_context);
+    }
+}
 
-        auto it = m_clients.find(client_id);
-        if (it == m_clients.end()) {
-            EVLOG_error << "Client " << client_id << " not found";
-            return;
+// send data to all connected clients
+void WebSocketServer::send_data(const std::vector<uint8_t>& data) {
+    const auto buffer = make_send_buffer(data);
+    {
+        std::lock_guard<std::mutex> lock(m_clients_mutex);
+        for (auto& client : m_clients) {
+            enqueue(client.first, client.second, buffer, std::nullopt);
         }
-
-        struct lws* wsi = it->second;
-        send_data(wsi, data);
-    } catch (const std::exception& e) {
-        EVLOG_error << "Exception occurred while sending data to client " << client_id << ": " << e.what();
     }
+    wake_service_thread();
 }
 
-// send data to client identified by libwebsockets wsi
-void WebSocketServer::send_data(struct lws* wsi, const std::vector<uint8_t>& data) {
-    try {
-        std::vector<unsigned char> buf(LWS_PRE + data.size());
-        memcpy(buf.data() + LWS_PRE, data.data(), data.size());
+// send data to client identified by ClientId
+void WebSocketServer::send_data(const ClientId& client_id, const std::vector<uint8_t>& data) {
+    send_data_to_clients({client_id}, data);
+}
 
-        if (lws_write(wsi, buf.data() + LWS_PRE, data.size(), LWS_WRITE_BINARY) < 0) {
-            EVLOG_error << "Failed to send data to client";
+// send data to several clients, sharing one buffer
+void WebSocketServer::send_data_to_clients(const std::vector<ClientId>& client_ids, const Data& data,
+                                           const std::optional<std::string>& coalesce_key) {
+    try {
+        const auto buffer = make_send_buffer(data);
+        {
+            std::lock_guard<std::mutex> lock(m_clients_mutex);
+            for (const auto& client_id : client_ids) {
+                auto it = m_clients.find(client_id);
+                if (it == m_clients.end()) {
+                    EVLOG_error << "Client " << client_id << " not found";
+                    continue;
+                }
+                enqueue(client_id, it->second, buffer, coalesce_key);
+            }
         }
+        wake_service_thread();
     } catch (const std::exception& e) {
-        // Note: the code in the try{} block probably cannot throw an exception
-        EVLOG_error << "Exception occurred while sending data to client: " << e.what();
+        EVLOG_error << "Exception occurred while sending data to clients: " << e.what();
     }
 }
 
@@ -187,7 +271,7 @@ void WebSocketServer::kill_client_connection(const ClientId& client_id, const st
 
     auto it = m_clients.find(client_id);
     if (it != m_clients.end()) {
-        struct lws* wsi = it->second;
+        struct lws* wsi = it->second.wsi;
         std::string close_reason = kill_reason.empty() ? "Connection closed by server" : kill_reason;
         lws_close_reason(wsi, LWS_CLOSE_STATUS_PROTOCOL_ERR,
                          reinterpret_cast<unsigned char*>(const_cast<char*>(close_reason.data())), close_reason.size());
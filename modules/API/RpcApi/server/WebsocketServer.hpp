@@ -5,8 +5,10 @@
 
 #include <atomic>
 #include <boost/asio.hpp>
+#include <deque>
 #include <libwebsockets.h>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -16,17 +18,22 @@
 
 namespace server {
 
+static const size_t DEFAULT_SEND_QUEUE_SIZE{256};
+
 class WebSocketServer : public TransportInterface {
 public:
     // Constructor and Destructor
-    explicit WebSocketServer(bool ssl_enabled, int port, const std::string& iface);
+    // send_queue_size: maximum number of messages queued per client before the client is considered too slow
+    explicit WebSocketServer(bool ssl_enabled, int port, const std::string& iface,
+                             size_t send_queue_size = DEFAULT_SEND_QUEUE_SIZE);
     ~WebSocketServer() override;
 
     // Methods
     bool running() const override;
     void send_data(const std::vector<uint8_t>& data) override;
     void send_data(const ClientId& client_id, const Data& data) override;
-    void send_data(struct lws* wsi, const std::vector<uint8_t>& data);
+    void send_data_to_clients(const std::vector<ClientId>& client_ids, const Data& data,
+                              const std::optional<std::string>& coalesce_key = std::nullopt) override;
     void kill_client_connection(const ClientId& client_id, const std::string& kill_reason) override;
     uint connections_count() const override;
 
@@ -34,19 +41,40 @@ public:
     bool stop_server() override;
 
 private:
+    // Payload with LWS_PRE bytes of headroom for libwebsockets. A broadcast shares one buffer between all clients.
+    using SendBuffer = std::shared_ptr<std::vector<unsigned char>>;
+
+    struct OutboundMessage {
+        SendBuffer buffer;
+        std::optional<std::string> coalesce_key;
+    };
+
+    struct Client {
+        struct lws* wsi;
+        std::deque<OutboundMessage> send_queue; // drained from LWS_CALLBACK_SERVER_WRITEABLE
+        bool overflowed{false};                 // send queue ran full, the connection is being closed
+    };
+
     // Members
     bool m_ssl_enabled;
+    size_t m_send_queue_size;
     std::shared_ptr<char> m_iface;
     struct lws_context_creation_info m_info {};
     struct lws_protocols m_lws_protocols[2];
     std::atomic<bool> m_running{false};
     struct lws_context* m_context = nullptr;
     std::thread m_server_thread;
-    std::unordered_map<ClientId, struct lws*> m_clients; // Client-Mapping
+    std::unordered_map<ClientId, Client> m_clients; // Client-Mapping
     mutable std::mutex m_clients_mutex;
 
     // Methods
     static int callback_ws(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len);
+    static SendBuffer make_send_buffer(const Data& data);
+    // Queue a message for the client, m_clients_mutex must be held. Returns false if the client can not keep up
+    bool enqueue(const ClientId& client_id, Client& client, const SendBuffer& buffer,
+                 const std::optional<std::string>& coalesce_key);
+    // Wake up the service thread to request write callbacks for the queued messages
+    void wake_service_thread();
 };
 
 } // namespace server
@@ -57,6 +57,7 @@ int WebSocketTestClient::callback(struct lws* wsi, enum lws_callback_reasons rea
         std::lock_guard<std::mutex> lock(client->m_cv_mutex);
         try {
             client->m_received_data.assign(static_cast<char*>(in), len);
+            client->m_received_messages.push_back(client->m_received_data);
             client->m_cv.notify_all();
         } catch (const std::exception& e) {
             EVLOG_error << "Exception occurred while handling data available: " << e.what();
@@ -65,7 +66,11 @@ int WebSocketTestClient::callback(struct lws* wsi, enum lws_callback_reasons rea
     }
     case LWS_CALLBACK_CLIENT_CLOSED:
     case LWS_CALLBACK_CLOSED_CLIENT_HTTP: {
-        client->m_connected = false;
+        {
+            std::lock_guard<std::mutex> lock(client->m_cv_mutex);
+            client->m_connected = false;
+        }
+        client->m_cv.notify_all();
         EVLOG_info << "Client closed connection: " << (in ? static_cast<const char*>(in) : "(null)")
                    << " reason: " << reason;
         break;
@@ -59,6 +59,22 @@ public:
         return data;
     }
 
+    // All messages received since the connection was established, in the order of arrival
+    std::vector<std::string> get_received_messages() {
+        std::lock_guard<std::mutex> lock(m_cv_mutex);
+        return m_received_messages;
+    }
+
+    bool wait_for_messages(size_t count, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_cv_mutex);
+        return m_cv.wait_for(lock, timeout, [this, count] { return m_received_messages.size() >= count; });
+    }
+
+    bool wait_until_disconnected(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_cv_mutex);
+        return m_cv.wait_for(lock, timeout, [this] { return !m_connected.load(); });
+    }
+
     bool wait_for_response(std::chrono::milliseconds timeout) {
         std::unique_lock<std::mutex> lock(m_cv_mutex);
         return m_cv.wait_for(lock, timeout, [this] { return !m_received_data.empty(); });
@@ -84,6 +100,7 @@ private:
     std::atomic<bool> m_lws_service_running{false};
     std::thread m_lws_service_thread;
     std::string m_received_data;
+    std::vector<std::string> m_received_messages;
 
 public:
     // Condition variable to wait for response
@@ -2,6 +2,8 @@
 // Copyright chargebyte GmbH and Contributors to EVerest
 
 #include <gtest/gtest.h>
+#include <functional>
+#include <mutex>
 #include <thread>
 
 #include "../data/DataStore.hpp"
@@ -875,3 +877,201 @@ TEST_F(RpcHandlerTest, InvalidRequest) {
     nlohmann::json response = nlohmann::json::parse(received_data);
     ASSERT_EQ(response, expected_response);
 }
+
+// Test: API.Hello confirms requested delta notifications
+TEST_F(RpcHandlerTest, ApiHelloReqWithDeltaNotifications) {
+    WebSocketTestClient client("localhost", test_port);
+    ASSERT_TRUE(client.connect());
+    ASSERT_TRUE(client.wait_until_connected(std::chrono::milliseconds(100)));
+
+    nlohmann::json api_hello_req = create_json_rpc_request("API.Hello", {{"delta_notifications", true}}, 1);
+    client.send(api_hello_req.dump());
+    std::string data = client.wait_for_data(std::chrono::seconds(1));
+    ASSERT_FALSE(data.empty());
+    nlohmann::json response = nlohmann::json::parse(data);
+    ASSERT_EQ(response["result"]["delta_notifications"], true);
+    ASSERT_EQ(response["result"]["api_version"], API_VERSION);
+}
+
+// Transport that records the data sent to each client
+class RecordingTransport : public TransportInterface {
+public:
+    void send_data(const Data& data) override {
+        static_cast<void>(data);
+    }
+    void send_data(const ClientId& client_id, const Data& data) override {
+        const auto message = nlohmann::json::parse(data.begin(), data.end());
+        {
+            std::lock_guard<std::mutex> lock(sent_mutex);
+            sent[client_id].push_back(message);
+        }
+        if (on_sent) {
+            on_sent(client_id, message);
+        }
+    }
+    void kill_client_connection(const ClientId& client_id, const std::string& kill_reason) override {
+        static_cast<void>(client_id);
+        static_cast<void>(kill_reason);
+    }
+    uint32_t connections_count() const override {
+        return static_cast<uint32_t>(sent.size());
+    }
+    bool running() const override {
+        return true;
+    }
+    bool start_server() override {
+        return true;
+    }
+    bool stop_server() override {
+        return true;
+    }
+
+    // called after a message was recorded, e.g. to delay the sender
+    std::function<void(const ClientId&, const nlohmann::json&)> on_sent;
+    std::mutex sent_mutex;
+    std::unordered_map<ClientId, std::vector<nlohmann::json>> sent;
+};
+
+// Test: Delta clients receive the full state once and JSON patches afterwards, other clients the full state
+TEST(ClientConnectorTest, StateNotificationsAreSentAsDeltas) {
+    auto transport = std::make_shared<RecordingTransport>();
+    std::vector<std::shared_ptr<TransportInterface>> transports{transport};
+    std::unordered_map<TransportInterface::ClientId, bool> hello_received{{"full", true}, {"delta", true}};
+    std::unordered_set<TransportInterface::ClientId> delta_clients{"delta"};
+    std::mutex mtx;
+    ClientConnector connector(transports, hello_received, delta_clients, mtx);
+
+    const nlohmann::json key_fields = {{"evse_index", 1}};
+    nlohmann::json state = {{"evse_index", 1}, {"meter_data", {{"power_W", 100.0}, {"voltage_V", 230.0}}}};
+    connector.send_state_notification("EVSE.MeterDataChanged", state, "meter1", key_fields, true);
+    // unchanged state is not sent to delta clients again
+    connector.send_state_notification("EVSE.MeterDataChanged", state, "meter1", key_fields, true);
+    state["meter_data"]["power_W"] = 200.0;
+    connector.send_state_notification("EVSE.MeterDataChanged", state, "meter1", key_fields, true);
+
+    ASSERT_EQ(transport->sent["full"].size(), 3u);
+    ASSERT_EQ(transport->sent["full"].back()["params"], state);
+
+    const auto& delta = transport->sent["delta"];
+    ASSERT_EQ(delta.size(), 2u);
+    ASSERT_EQ(delta[0]["method"], "EVSE.MeterDataChanged");
+    ASSERT_EQ(delta[0]["params"]["meter_data"]["power_W"], 100.0);
+    ASSERT_EQ(delta[1]["params"]["evse_index"], 1);
+    ASSERT_EQ(delta[1]["params"]["patch"].size(), 1u);
+    ASSERT_EQ(delta[0]["params"].patch(delta[1]["params"]["patch"]), state);
+
+    // a client that negotiates delta notifications later starts with the full state
+    delta_clients.insert("full");
+    state["meter_data"]["voltage_V"] = 231.0;
+    connector.send_state_notification("EVSE.MeterDataChanged", state, "meter1", key_fields, true);
+    ASSERT_EQ(transport->sent["full"].back()["params"], state);
+    ASSERT_EQ(transport->sent["delta"].back()["params"]["patch"].size(), 1u);
+}
+
+// Test: Concurrent changes of a state reach full and delta clients in the same order
+TEST(ClientConnectorTest, ConcurrentStateNotificationsKeepTheirOrder) {
+    auto transport = std::make_shared<RecordingTransport>();
+    std::vector<std::shared_ptr<TransportInterface>> transports{transport};
+    std::unordered_map<TransportInterface::ClientId, bool> hello_received{{"full", true}, {"delta", true}};
+    std::unordered_set<TransportInterface::ClientId> delta_clients{"delta"};
+    std::mutex mtx;
+    ClientConnector connector(transports, hello_received, delta_clients, mtx);
+
+    // the first sender pauses between sending to the full and to the delta client, so that the second one overtakes
+    // it unless both sends are serialized
+    transport->on_sent = [](const TransportInterface::ClientId& client_id, const nlohmann::json& message) {
+        if (client_id == "full" and message["params"]["meter_data"]["power_W"].get<int>() % 2 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    const nlohmann::json key_fields = {{"evse_index", 1}};
+    std::vector<std::thread> senders;
+    for (int t = 0; t < 2; t++) {
+        senders.emplace_back([&connector, &key_fields, t] {
+            for (int i = 0; i < 50; i++) {
+                const nlohmann::json state = {{"evse_index", 1}, {"meter_data", {{"power_W", 2 * i + t}}}};
+                connector.send_state_notification("EVSE.MeterDataChanged", state, "meter1", key_fields, false);
+            }
+        });
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+
+    const auto& full = transport->sent["full"];
+    const auto& delta = transport->sent["delta"];
+    ASSERT_EQ(full.size(), 100u);
+    ASSERT_EQ(delta.size(), 100u);
+    auto delta_state = delta[0]["params"];
+    ASSERT_EQ(full[0]["params"], delta_state);
+    for (std::size_t i = 1; i < delta.size(); i++) {
+        delta_state = delta_state.patch(delta[i]["params"]["patch"]);
+        ASSERT_EQ(full[i]["params"], delta_state);
+    }
+}
+
+// Test: Changes within the notification interval are coalesced into one notification with the latest data
+TEST(GenericInfoStoreTest, NotificationsAreCoalescedWithinInterval) {
+    data::MeterDataStore store;
+    std::vector<RPCDataTypes::MeterDataObj> notifications;
+    store.register_notification_callback(
+        [&notifications](const RPCDataTypes::MeterDataObj& data) { notifications.push_back(data); });
+    store.set_notification_interval(std::chrono::milliseconds(100));
+
+    RPCDataTypes::MeterDataObj meter_data;
+    for (int i = 1; i <= 3; ++i) {
+        meter_data.energy_Wh_import.total = static_cast<float>(i);
+        store.set_data(meter_data);
+    }
+    ASSERT_EQ(notifications.size(), 1u);
+
+    const auto now = std::chrono::steady_clock::now();
+    store.flush_pending_notification(now);
+    ASSERT_EQ(notifications.size(), 1u);
+    store.flush_pending_notification(now + std::chrono::milliseconds(100));
+    ASSERT_EQ(notifications.size(), 2u);
+    ASSERT_EQ(notifications.back().energy_Wh_import.total, 3.0f);
+    // nothing changed since
+    store.flush_pending_notification(now + std::chrono::milliseconds(300));
+    ASSERT_EQ(notifications.size(), 2u);
+}
+
+// Test: The notification interval of the charger only coalesces meter data, every EVSE status change is notified
+TEST(DataStoreChargerTest, NotificationIntervalOnlyAppliesToMeterData) {
+    data::DataStoreCharger charger;
+    charger.evses.push_back(std::make_unique<data::DataStoreEvse>());
+    auto& evse = *charger.evses.back();
+
+    std::vector<types::json_rpc_api::EVSEStateEnum> states;
+    evse.evsestatus.register_notification_callback(
+        [&states](const RPCDataTypes::EVSEStatusObj& data) { states.push_back(data.state); });
+    std::size_t meter_notifications = 0;
+    evse.meterdata.register_notification_callback(
+        [&meter_notifications](const RPCDataTypes::MeterDataObj&) { ++meter_notifications; });
+    charger.set_notification_interval(std::chrono::milliseconds(100));
+
+    RPCDataTypes::EVSEStatusObj evse_status;
+    evse_status.charged_energy_wh = 0;
+    evse_status.discharged_energy_wh = 0;
+    evse_status.charging_duration_s = 0;
+    evse_status.charging_allowed = true;
+    evse_status.available = true;
+    evse_status.active_connector_index = 1;
+    evse_status.error_present = false;
+    evse_status.charge_protocol = types::json_rpc_api::ChargeProtocolEnum::IEC61851;
+    evse_status.state = types::json_rpc_api::EVSEStateEnum::Unplugged;
+    evse.evsestatus.set_data(evse_status);
+    evse.evsestatus.set_state(types::json_rpc_api::EVSEStateEnum::Charging);
+    evse.evsestatus.set_state(types::json_rpc_api::EVSEStateEnum::Finished);
+    ASSERT_EQ(states, (std::vector<types::json_rpc_api::EVSEStateEnum>{types::json_rpc_api::EVSEStateEnum::Unplugged,
+                                                                        types::json_rpc_api::EVSEStateEnum::Charging,
+                                                                        types::json_rpc_api::EVSEStateEnum::Finished}));
+
+    RPCDataTypes::MeterDataObj meter_data;
+    for (int i = 1; i <= 3; ++i) {
+        meter_data.energy_Wh_import.total = static_cast<float>(i);
+        evse.meterdata.set_data(meter_data);
+    }
+    ASSERT_EQ(meter_notifications, 1u);
+}
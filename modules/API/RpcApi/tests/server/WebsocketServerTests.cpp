@@ -44,13 +44,20 @@ protected:
         ws_server->on_data_available = [this](const TransportInterface::ClientId& client_id,
                                               const server::TransportInterface::Data& data) {
             // Handle data available logic here
-            std::lock_guard<std::mutex> lock(cv_mutex);
+            std::unique_lock<std::mutex> lock(cv_mutex);
             try {
                 received_data[client_id] = std::string(data.begin(), data.end());
                 cv.notify_all();
             } catch (const std::exception& e) {
                 EVLOG_error << "Exception occurred while handling data available: " << e.what();
             }
+            // Called on the service thread of the server, which does not send anything while it waits here
+            if (block_next_receive) {
+                block_next_receive = false;
+                service_thread_blocked = true;
+                cv.notify_all();
+                cv.wait(lock, [this] { return !service_thread_blocked; });
+            }
         };
 
         ws_server->start_server();
@@ -61,6 +68,32 @@ protected:
         return connected_clients;
     }
 
+    // Blocks the service thread of the server with a message of the client, so that sent data stays queued
+    bool block_service_thread(WebSocketTestClient& client) {
+        {
+            std::lock_guard<std::mutex> lock(cv_mutex);
+            block_next_receive = true;
+        }
+        client.send("block");
+        std::unique_lock<std::mutex> lock(cv_mutex);
+        return cv.wait_for(lock, std::chrono::seconds(1), [this] { return service_thread_blocked; });
+    }
+
+    void release_service_thread() {
+        {
+            std::lock_guard<std::mutex> lock(cv_mutex);
+            block_next_receive = false;
+            service_thread_blocked = false;
+        }
+        cv.notify_all();
+    }
+
+    void send_to_client(const TransportInterface::ClientId& client_id, const std::string& message,
+                        const std::optional<std::string>& coalesce_key = std::nullopt) {
+        ws_server->send_data_to_clients({client_id}, std::vector<uint8_t>(message.begin(), message.end()),
+                                        coalesce_key);
+    }
+
     // Connected client id's
     std::vector<TransportInterface::ClientId> connected_clients;
 
@@ -71,7 +104,12 @@ protected:
     // Received data with client id
     std::unordered_map<TransportInterface::ClientId, std::string> received_data;
 
+    // See block_service_thread()
+    bool block_next_receive{false};
+    bool service_thread_blocked{false};
+
     void TearDown() override {
+        release_service_thread();
         ws_server->stop_server();
     }
 };
@@ -161,3 +199,92 @@ TEST_F(WebSocketServerTest, ServerCanKillClientConnection) {
     ASSERT_EQ(ws_server->connections_count(), 0);
     ASSERT_FALSE(client.is_connected());
 }
+
+// Test: Server sends the same data to several clients, clients end up with the latest state
+TEST_F(WebSocketServerTest, ServerSendsLatestStateToSeveralClients) {
+    WebSocketTestClient client1("localhost", test_port);
+    WebSocketTestClient client2("localhost", test_port);
+    ASSERT_TRUE(client1.connect());
+    ASSERT_TRUE(client2.connect());
+    ASSERT_TRUE(client1.wait_until_connected(std::chrono::milliseconds(100)));
+    ASSERT_TRUE(client2.wait_until_connected(std::chrono::milliseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(ws_server->connections_count(), 2);
+
+    // A burst of states with the same coalesce key, not yet sent states may be replaced by newer ones
+    const auto clients = get_connected_clients();
+    for (int i = 0; i < 100; i++) {
+        const std::string message = "state " + std::to_string(i);
+        ws_server->send_data_to_clients(clients, std::vector<uint8_t>(message.begin(), message.end()), "state");
+    }
+
+    for (auto* client : {&client1, &client2}) {
+        std::unique_lock<std::mutex> lock(client->m_cv_mutex);
+        client->m_cv.wait_for(lock, std::chrono::seconds(1), [client] { return client->receive() == "state 99"; });
+    }
+    ASSERT_EQ(client1.receive(), "state 99");
+    ASSERT_EQ(client2.receive(), "state 99");
+}
+
+// Test: Queued messages with the same coalesce key are replaced in place, other messages keep their order
+TEST_F(WebSocketServerTest, ServerCoalescesQueuedMessages) {
+    WebSocketTestClient client("localhost", test_port);
+    ASSERT_TRUE(client.connect());
+    ASSERT_TRUE(client.wait_until_connected(std::chrono::milliseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto client_id = get_connected_clients()[0];
+
+    ASSERT_TRUE(block_service_thread(client));
+    send_to_client(client_id, "state a 0", "a");
+    send_to_client(client_id, "state b", "b");
+    // More states than fit into the send queue, they all replace the first one
+    for (size_t i = 1; i <= 2 * DEFAULT_SEND_QUEUE_SIZE; i++) {
+        send_to_client(client_id, "state a " + std::to_string(i), "a");
+    }
+    send_to_client(client_id, "response");
+    send_to_client(client_id, "state a last", "a");
+    release_service_thread();
+
+    ASSERT_TRUE(client.wait_for_messages(3, std::chrono::seconds(1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(client.get_received_messages(), (std::vector<std::string>{"state a last", "state b", "response"}));
+    EXPECT_TRUE(client.is_connected());
+}
+
+// Test: A client whose send queue overflows is disconnected, other clients are not affected
+TEST_F(WebSocketServerTest, ServerDisconnectsClientOnSendQueueOverflow) {
+    WebSocketTestClient slow_client("localhost", test_port);
+    ASSERT_TRUE(slow_client.connect());
+    ASSERT_TRUE(slow_client.wait_until_connected(std::chrono::milliseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto slow_client_id = get_connected_clients()[0];
+
+    WebSocketTestClient client("localhost", test_port);
+    ASSERT_TRUE(client.connect());
+    ASSERT_TRUE(client.wait_until_connected(std::chrono::milliseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(ws_server->connections_count(), 2);
+    const auto client_id = get_connected_clients()[1];
+
+    ASSERT_TRUE(block_service_thread(slow_client));
+    // Exactly fills the queue of one client and overflows the queue of the other one
+    for (size_t i = 0; i < DEFAULT_SEND_QUEUE_SIZE; i++) {
+        send_to_client(client_id, "message " + std::to_string(i));
+        send_to_client(slow_client_id, "message " + std::to_string(i));
+    }
+    send_to_client(slow_client_id, "overflow");
+    release_service_thread();
+
+    ASSERT_TRUE(slow_client.wait_until_disconnected(std::chrono::seconds(1)));
+    ASSERT_TRUE(client.wait_for_messages(DEFAULT_SEND_QUEUE_SIZE, std::chrono::seconds(2)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_TRUE(slow_client.get_received_messages().empty());
+    const auto messages = client.get_received_messages();
+    ASSERT_EQ(messages.size(), DEFAULT_SEND_QUEUE_SIZE);
+    for (size_t i = 0; i < DEFAULT_SEND_QUEUE_SIZE; i++) {
+        EXPECT_EQ(messages[i], "message " + std::to_string(i));
+    }
+    EXPECT_TRUE(client.is_connected());
+    EXPECT_EQ(ws_server->connections_count(), 1);
+}
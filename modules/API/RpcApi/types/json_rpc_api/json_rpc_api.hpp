@@ -1980,6 +1980,7 @@ struct HelloResObj {
     std::string everest_version;                      ///< The version of the running EVerest instance
     types::json_rpc_api::ChargerInfoObj charger_info; ///< Charger information
     std::optional<bool> authenticated;                ///< Whether the client is properly authenticated
+    std::optional<bool> delta_notifications;          ///< Whether notifications are sent as JSON patch deltas
 
     /// \brief Conversion from a given HelloResObj \p k to a given json object \p j
     friend void to_json(json& j, const HelloResObj& k) {
@@ -1994,6 +1995,9 @@ struct HelloResObj {
         if (k.authenticated) {
             j["authenticated"] = k.authenticated.value();
         }
+        if (k.delta_notifications) {
+            j["delta_notifications"] = k.delta_notifications.value();
+        }
     }
 
     /// \brief Conversion from a given json object \p j to a given HelloResObj \p k
@@ -2008,14 +2012,17 @@ struct HelloResObj {
         if (j.contains("authenticated")) {
             k.authenticated.emplace(j.at("authenticated"));
         }
+        if (j.contains("delta_notifications")) {
+            k.delta_notifications.emplace(j.at("delta_notifications"));
+        }
     }
 
     /// \brief Compares objects of type HelloResObj for equality
     friend constexpr bool operator==(const HelloResObj& k, const HelloResObj& l) {
-        const auto& lhs_tuple =
-            std::tie(k.authentication_required, k.api_version, k.everest_version, k.charger_info, k.authenticated);
-        const auto& rhs_tuple =
-            std::tie(l.authentication_required, l.api_version, l.everest_version, l.charger_info, l.authenticated);
+        const auto& lhs_tuple = std::tie(k.authentication_required, k.api_version, k.everest_version, k.charger_info,
+                                         k.authenticated, k.delta_notifications);
+        const auto& rhs_tuple = std::tie(l.authentication_required, l.api_version, l.everest_version, l.charger_info,
+                                         l.authenticated, l.delta_notifications);
         return lhs_tuple == rhs_tuple;
     }
 
@@ -127,21 +127,25 @@ void Auth::ready() {
         });
     this->auth_handler->register_withdraw_authorization_callback(
         [this](const int32_t evse_index) { this->r_evse_manager.at(evse_index)->call_withdraw_authorization(); });
+    // the validators are owned by r_token_validator, validation_fan_out is destroyed first and awaits its pending calls
+    std::vector<ValidationFanOut::Validator> validators;
+    for (const auto& token_validator : this->r_token_validator) {
+        auto* validator = token_validator.get();
+        validators.push_back([validator](const ProvidedIdToken& provided_token) {
+            return validator->call_validate_token(provided_token);
+        });
+    }
+    const auto validator_timeouts = conversions::string_to_validator_timeouts(this->config.validator_timeouts_ms);
+    if (validator_timeouts.size() > validators.size()) {
+        EVLOG_warning << "validator_timeouts_ms lists " << validator_timeouts.size() << " timeouts for "
+                      << validators.size() << " token validators, the remaining ones are ignored";
+    }
+    this->validation_fan_out = std::make_unique<ValidationFanOut>(
+        std::move(validators), conversions::string_to_validation_strategy(this->config.validation_strategy),
+        validator_timeouts);
     this->auth_handler->register_validate_token_callback([this](const ProvidedIdToken& provided_token) {
-        std::vector<ValidationResult> validation_results;
-        for (const auto& token_validator : this->r_token_validator) {
-            try {
-                const auto result = token_validator->call_validate_token(provided_token);
-                validation_results.push_back(result);
-                // TODO: This is very broad catch, make it more narrow when the everest-framework error handling will be
-                // established
-            } catch (const std::exception& e) {
-                EVLOG_warning << "Exception during validating token: " << e.what();
-                ValidationResult validation_result;
-                validation_result.authorization_status = AuthorizationStatus::Unknown;
-                validation_results.push_back(validation_result);
-            }
-        }
+        const auto validation_results = this->validation_fan_out->validate(provided_token);
+        this->publish_validation_latency();
         return validation_results;
     });
     this->auth_handler->register_stop_transaction_callback(
@@ -228,6 +232,16 @@ void Auth::set_master_pass_group_id(const std::string& master_pass_group_id) {
     this->auth_handler->set_master_pass_group_id(master_pass_group_id);
 }
 
+void Auth::publish_validation_latency() {
+    const auto statistics = this->validation_fan_out->get_latency_statistics();
+    this->telemetry.publish("auth", "token_validation",
+                            {{"samples", static_cast<uint64_t>(statistics.samples)},
+                             {"latency_p50_ms", static_cast<int64_t>(statistics.p50.count())},
+                             {"latency_p90_ms", static_cast<int64_t>(statistics.p90.count())},
+                             {"latency_p99_ms", static_cast<int64_t>(statistics.p99.count())},
+                             {"latency_max_ms", static_cast<int64_t>(statistics.max.count())}});
+}
+
 WithdrawAuthorizationResult Auth::handle_withdraw_authorization(const WithdrawAuthorizationRequest& request) {
     return this->auth_handler->handle_withdraw_authorization(request);
 }
@@ -23,6 +23,7 @@
 // ev@4bf81b14-a215-475c-a1d3-0a484ae48918:v1
 // insert your custom include headers here
 #include <AuthHandler.hpp>
+#include <ValidationFanOut.hpp>
 #include <everest/util/async/monitor.hpp>
 #include <memory>
 #include <queue>
@@ -64,18 +65,21 @@ struct Conf {
     bool prioritize_authorization_over_stopping_transaction;
     bool ignore_connector_faults;
     bool plug_in_timeout_enabled;
+    std::string validation_strategy;
+    std::string validator_timeouts_ms;
 };
 
 class Auth : public Everest::ModuleBase {
 public:
     Auth() = delete;
-    Auth(const ModuleInfo& info, std::unique_ptr<authImplBase> p_main,
+    Auth(const ModuleInfo& info, Everest::TelemetryProvider& telemetry, std::unique_ptr<authImplBase> p_main,
          std::unique_ptr<reservationImplBase> p_reservation,
          std::vector<std::unique_ptr<auth_token_providerIntf>> r_token_provider,
          std::vector<std::unique_ptr<auth_token_validatorIntf>> r_token_validator,
          std::vector<std::unique_ptr<evse_managerIntf>> r_evse_manager, std::vector<std::unique_ptr<kvsIntf>> r_kvs,
          Conf& config) :
         ModuleBase(info),
+        telemetry(telemetry),
         p_main(std::move(p_main)),
         p_reservation(std::move(p_reservation)),
         r_token_provider(std::move(r_token_provider)),
@@ -84,6 +88,7 @@ public:
         r_kvs(std::move(r_kvs)),
         config(config){};
 
+    Everest::TelemetryProvider& telemetry;
     const std::unique_ptr<authImplBase> p_main;
     const std::unique_ptr<reservationImplBase> p_reservation;
     const std::vector<std::unique_ptr<auth_token_providerIntf>> r_token_provider;
@@ -126,6 +131,14 @@ private:
     // ev@211cfdbe-f69a-4cd6-a4ec-f8aaa3d1b6c8:v1
     // insert your private definitions here
     everest::lib::util::monitor<EventQueueState> event_state;
+    // calls the validators of r_token_validator, declared after it so that its pending calls are awaited before the
+    // validators are destroyed
+    std::unique_ptr<ValidationFanOut> validation_fan_out;
+
+    /**
+     * @brief Publishes the latency statistics of the token validations as telemetry
+     */
+    void publish_validation_latency();
     // ev@211cfdbe-f69a-4cd6-a4ec-f8aaa3d1b6c8:v1
 };
 
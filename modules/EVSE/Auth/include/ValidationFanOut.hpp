@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#ifndef _VALIDATION_FAN_OUT_HPP_
+#define _VALIDATION_FAN_OUT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <everest/util/async/thread_pool.hpp>
+
+#include <generated/types/authorization.hpp>
+
+namespace module {
+
+/// \brief Checks if \p status decides the validation, which is every status except Unknown
+bool is_conclusive(types::authorization::AuthorizationStatus status);
+
+/// \brief Defines how the configured token validators are invoked for a provided token
+enum class ValidationStrategy {
+    Sequential,             ///< validators are called one after another in the order of their connections
+    Parallel,               ///< validators are called concurrently, all results are awaited
+    ParallelFirstConclusive ///< validators are called concurrently, results of lower priority validators are not
+                            ///< awaited once a validator returned a status other than Unknown and all validators of
+                            ///< higher priority responded
+};
+
+namespace conversions {
+ValidationStrategy string_to_validation_strategy(const std::string& strategy);
+/// \brief Converts a comma separated list of timeouts in milliseconds, e.g. "500,2000"
+/// \throws std::invalid_argument if an entry is no positive number or 0
+std::vector<std::chrono::milliseconds> string_to_validator_timeouts(const std::string& timeouts);
+} // namespace conversions
+
+/// \brief Percentiles of the most recent token validation latencies
+struct ValidationLatencyStatistics {
+    std::size_t samples{0}; ///< number of validations the percentiles are calculated from
+    std::chrono::milliseconds p50{0};
+    std::chrono::milliseconds p90{0};
+    std::chrono::milliseconds p99{0};
+    std::chrono::milliseconds max{0};
+};
+
+/// \brief Keeps the latencies of the last \p window token validations
+class ValidationLatencyRecorder {
+public:
+    explicit ValidationLatencyRecorder(std::size_t window);
+
+    void record(std::chrono::milliseconds latency);
+    ValidationLatencyStatistics get_statistics() const;
+
+private:
+    mutable std::mutex mutex;
+    std::size_t window;
+    std::size_t next{0};
+    std::vector<std::chrono::milliseconds> latencies;
+};
+
+/**
+ * @brief Invokes the token validators for a provided token according to the configured ValidationStrategy. The
+ * position of a validator defines its priority, the first validator has the highest priority.
+ *
+ * The parallel strategies call the validators on a thread pool owned by the fan out. Calls of a validator that did not
+ * respond before its deadline keep running, at most MAX_PENDING_CALLS_PER_VALIDATOR of them per validator. While a
+ * validator is at this limit it is not called and its result is Unknown. The destructor waits for all pending calls.
+ *
+ * A validator that fails with an Everest::CmdError, e.g. because it timed out or is not ready, returns Unknown. Other
+ * exceptions are passed on to the caller of validate.
+ */
+class ValidationFanOut {
+public:
+    using Validator =
+        std::function<types::authorization::ValidationResult(const types::authorization::ProvidedIdToken&)>;
+
+    /// \brief Maximum number of concurrent calls of a single validator in the parallel strategies
+    static constexpr std::size_t MAX_PENDING_CALLS_PER_VALIDATOR = 2;
+
+    /**
+     * @brief Creates a fan out for the given \p validators
+     *
+     * @param validators    The validators ordered by priority
+     * @param strategy      The strategy used to invoke the validators
+     * @param validator_timeouts Time the parallel strategies wait for the validator at the same position before its
+     * result is treated as Unknown. Validators without a timeout or a timeout of 0 are awaited until they responded.
+     * The sequential strategy does not apply them.
+     */
+    ValidationFanOut(std::vector<Validator> validators, ValidationStrategy strategy,
+                     const std::vector<std::chrono::milliseconds>& validator_timeouts);
+
+    /**
+     * @brief Validates the given \p provided_token
+     *
+     * @param provided_token
+     * @return The validation results ordered by validator priority. Results of validators that did not respond in
+     * time are Unknown. With ValidationStrategy::ParallelFirstConclusive the results end with the first conclusive
+     * result.
+     */
+    std::vector<types::authorization::ValidationResult>
+    validate(const types::authorization::ProvidedIdToken& provided_token);
+
+    /**
+     * @brief Returns the latency statistics of the most recent calls to validate
+     */
+    ValidationLatencyStatistics get_latency_statistics() const;
+
+private:
+    std::vector<types::authorization::ValidationResult>
+    validate_sequential(const types::authorization::ProvidedIdToken& provided_token);
+    std::vector<types::authorization::ValidationResult>
+    validate_parallel(const types::authorization::ProvidedIdToken& provided_token);
+
+    /// \brief A validator and the number of its calls that are still running, shared with the calls
+    struct ValidatorSlot {
+        Validator validator;
+        std::chrono::milliseconds timeout{0};
+        std::atomic<std::size_t> pending_calls{0};
+    };
+
+    std::vector<std::shared_ptr<ValidatorSlot>> validators;
+    ValidationStrategy strategy;
+    ValidationLatencyRecorder latency_recorder;
+    // one worker for every call that may be pending, so a call never waits for a worker. Declared last to be destroyed
+    // first, which waits for the pending calls while the validators are still alive.
+    std::unique_ptr<everest::lib::util::thread_pool> executor;
+};
+
+} // namespace module
+
+#endif // _VALIDATION_FAN_OUT_HPP_
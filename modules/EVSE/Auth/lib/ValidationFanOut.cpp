@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <ValidationFanOut.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <everest/logging.hpp>
+#include <utils/exceptions.hpp>
+
+using namespace types::authorization;
+
+namespace module {
+
+namespace {
+// number of validations the latency statistics are calculated from
+constexpr std::size_t LATENCY_WINDOW = 1000;
+
+ValidationResult call_validator(const ValidationFanOut::Validator& validator, const ProvidedIdToken& provided_token) {
+    try {
+        return validator(provided_token);
+    } catch (const Everest::CmdError& e) {
+        EVLOG_warning << "Token validator failed: " << e.what();
+        ValidationResult validation_result;
+        validation_result.authorization_status = AuthorizationStatus::Unknown;
+        return validation_result;
+    }
+}
+
+/// \brief State shared between a call to validate_parallel and the calls of the validators. The calls own it as well,
+/// since validators that did not respond in time are not awaited.
+struct PendingValidation {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::optional<ValidationResult>> results;
+    // exceptions other than Everest::CmdError, passed on to the caller
+    std::vector<std::exception_ptr> errors;
+    // validators whose deadline passed before they responded
+    std::vector<bool> expired;
+};
+
+/// \brief Checks if the awaited validators responded or their deadline passed
+bool is_decided(const PendingValidation& pending, ValidationStrategy strategy) {
+    for (std::size_t i = 0; i < pending.results.size(); i++) {
+        if (pending.errors.at(i) != nullptr) {
+            return true;
+        }
+        const auto& result = pending.results.at(i);
+        if (not result.has_value()) {
+            if (pending.expired.at(i)) {
+                continue;
+            }
+            return false;
+        }
+        if (strategy == ValidationStrategy::ParallelFirstConclusive and is_conclusive(result->authorization_status)) {
+            return true;
+        }
+    }
+    return true;
+}
+
+std::chrono::milliseconds percentile(const std::vector<std::chrono::milliseconds>& sorted, std::size_t percent) {
+    const auto rank = (sorted.size() * percent + 99) / 100;
+    return sorted.at(std::max<std::size_t>(rank, 1) - 1);
+}
+} // namespace
+
+bool is_conclusive(AuthorizationStatus status) {
+    return status != AuthorizationStatus::Unknown;
+}
+
+namespace conversions {
+ValidationStrategy string_to_validation_strategy(const std::string& strategy) {
+    if (strategy == "Sequential") {
+        return ValidationStrategy::Sequential;
+    }
+    if (strategy == "Parallel") {
+        return ValidationStrategy::Parallel;
+    }
+    if (strategy == "ParallelFirstConclusive") {
+        return ValidationStrategy::ParallelFirstConclusive;
+    }
+    throw std::out_of_range("Provided string " + strategy +
+                            " could not be converted to enum of type ValidationStrategy");
+}
+
+std::vector<std::chrono::milliseconds> string_to_validator_timeouts(const std::string& timeouts) {
+    std::vector<std::chrono::milliseconds> result;
+    if (timeouts.empty()) {
+        return result;
+    }
+    std::size_t start = 0;
+    while (start <= timeouts.size()) {
+        const auto end = std::min(timeouts.find(',', start), timeouts.size());
+        const auto entry = timeouts.substr(start, end - start);
+        const auto first = entry.find_first_not_of(' ');
+        const auto last = entry.find_last_not_of(' ');
+        const auto digits = first == std::string::npos ? std::string() : entry.substr(first, last - first + 1);
+        if (digits.empty() or digits.find_first_not_of("0123456789") != std::string::npos or digits.size() > 9) {
+            throw std::invalid_argument("Provided validator timeout \"" + entry + "\" is no number of milliseconds");
+        }
+        result.emplace_back(std::stoi(digits));
+        start = end + 1;
+    }
+    return result;
+}
+} // namespace conversions
+
+ValidationLatencyRecorder::ValidationLatencyRecorder(std::size_t window) : window(std::max<std::size_t>(window, 1)) {
+    this->latencies.reserve(this->window);
+}
+
+void ValidationLatencyRecorder::record(std::chrono::milliseconds latency) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (this->latencies.size() < this->window) {
+        this->latencies.push_back(latency);
+    } else {
+        this->latencies.at(this->next) = latency;
+    }
+    this->next = (this->next + 1) % this->window;
+}
+
+ValidationLatencyStatistics ValidationLatencyRecorder::get_statistics() const {
+    std::vector<std::chrono::milliseconds> sorted;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        sorted = this->latencies;
+    }
+    ValidationLatencyStatistics statistics;
+    if (sorted.empty()) {
+        return statistics;
+    }
+    std::sort(sorted.begin(), sorted.end());
+    statistics.samples = sorted.size();
+    statistics.p50 = percentile(sorted, 50);
+    statistics.p90 = percentile(sorted, 90);
+    statistics.p99 = percentile(sorted, 99);
+    statistics.max = sorted.back();
+    return statistics;
+}
+
+ValidationFanOut::ValidationFanOut(std::vector<Validator> validators, ValidationStrategy strategy,
+                                   const std::vector<std::chrono::milliseconds>& validator_timeouts) :
+    strategy(strategy), latency_recorder(LATENCY_WINDOW) {
+    for (std::size_t i = 0; i < validators.size(); i++) {
+        auto slot = std::make_shared<ValidatorSlot>();
+        slot->validator = std::move(validators.at(i));
+        if (i < validator_timeouts.size()) {
+            slot->timeout = validator_timeouts.at(i);
+        }
+        this->validators.push_back(std::move(slot));
+    }
+    if (this->strategy != ValidationStrategy::Sequential and not this->validators.empty()) {
+        this->executor = std::make_unique<everest::lib::util::thread_pool>(
+            static_cast<unsigned int>(this->validators.size() * MAX_PENDING_CALLS_PER_VALIDATOR));
+    }
+}
+
+std::vector<ValidationResult> ValidationFanOut::validate(const ProvidedIdToken& provided_token) {
+    const auto start = std::chrono::steady_clock::now();
+    auto validation_results = this->strategy == ValidationStrategy::Sequential
+                                  ? this->validate_sequential(provided_token)
+                                  : this->validate_parallel(provided_token);
+    this->latency_recorder.record(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start));
+    return validation_results;
+}
+
+ValidationLatencyStatistics ValidationFanOut::get_latency_statistics() const {
+    return this->latency_recorder.get_statistics();
+}
+
+std::vector<ValidationResult> ValidationFanOut::validate_sequential(const ProvidedIdToken& provided_token) {
+    std::vector<ValidationResult> validation_results;
+    for (const auto& slot : this->validators) {
+        validation_results.push_back(call_validator(slot->validator, provided_token));
+    }
+    return validation_results;
+}
+
+std::vector<ValidationResult> ValidationFanOut::validate_parallel(const ProvidedIdToken& provided_token) {
+    const auto start = std::chrono::steady_clock::now();
+    auto pending = std::make_shared<PendingValidation>();
+    pending->results.resize(this->validators.size());
+    pending->errors.resize(this->validators.size());
+    pending->expired.resize(this->validators.size(), false);
+
+    // The validators can not be cancelled, e.g. a validation request to the CSMS runs until it is answered or times
+    // out. Calls of validators that are not awaited therefore finish on their own and their results are discarded.
+    for (std::size_t i = 0; i < this->validators.size(); i++) {
+        const auto& slot = this->validators.at(i);
+        if (slot->pending_calls.fetch_add(1) >= MAX_PENDING_CALLS_PER_VALIDATOR) {
+            slot->pending_calls--;
+            EVLOG_warning << "Token validator #" << i << " still has " << MAX_PENDING_CALLS_PER_VALIDATOR
+                          << " calls pending, not calling it";
+            ValidationResult validation_result;
+            validation_result.authorization_status = AuthorizationStatus::Unknown;
+            std::lock_guard<std::mutex> lk(pending->mutex);
+            pending->results.at(i) = validation_result;
+            continue;
+        }
+        this->executor->run([pending, slot, provided_token, i]() {
+            std::optional<ValidationResult> result;
+            std::exception_ptr error;
+            try {
+                result = call_validator(slot->validator, provided_token);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            slot->pending_calls--;
+            std::lock_guard<std::mutex> lk(pending->mutex);
+            pending->results.at(i) = std::move(result);
+            pending->errors.at(i) = error;
+            pending->cv.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> lk(pending->mutex);
+    while (true) {
+        // validators whose deadline passed are not awaited anymore, the next deadline is the earliest of the others
+        const auto now = std::chrono::steady_clock::now();
+        std::optional<std::chrono::steady_clock::time_point> next_deadline;
+        for (std::size_t i = 0; i < this->validators.size(); i++) {
+            const auto timeout = this->validators.at(i)->timeout;
+            if (timeout.count() <= 0 or pending->results.at(i).has_value()) {
+                continue;
+            }
+            const auto deadline = start + timeout;
+            if (deadline <= now) {
+                pending->expired.at(i) = true;
+            } else if (not next_deadline.has_value() or deadline < next_deadline.value()) {
+                next_deadline = deadline;
+            }
+        }
+
+        if (is_decided(*pending, this->strategy)) {
+            break;
+        }
+        if (next_deadline.has_value()) {
+            pending->cv.wait_until(lk, next_deadline.value());
+        } else {
+            pending->cv.wait(lk);
+        }
+    }
+
+    std::vector<ValidationResult> validation_results;
+    for (std::size_t i = 0; i < pending->results.size(); i++) {
+        if (pending->errors.at(i) != nullptr) {
+            std::rethrow_exception(pending->errors.at(i));
+        }
+        const auto& result = pending->results.at(i);
+        if (not result.has_value()) {
+            EVLOG_warning << "Token validator #" << i << " did not respond within "
+                          << this->validators.at(i)->timeout.count() << "ms";
+            ValidationResult validation_result;
+            validation_result.authorization_status = AuthorizationStatus::Unknown;
+            validation_results.push_back(validation_result);
+            continue;
+        }
+        validation_results.push_back(result.value());
+        if (this->strategy == ValidationStrategy::ParallelFirstConclusive and
+            is_conclusive(result->authorization_status)) {
+            break;
+        }
+    }
+    return validation_results;
+}
+
+} // namespace module
@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <ValidationFanOut.hpp>
+#include <utils/exceptions.hpp>
+
+using namespace std::chrono_literals;
+using namespace types::authorization;
+
+namespace module {
+
+namespace {
+
+ProvidedIdToken get_provided_token() {
+    ProvidedIdToken provided_token;
+    provided_token.id_token = {"VALID_RFID_1", IdTokenType::ISO14443};
+    provided_token.authorization_type = AuthorizationType::RFID;
+    return provided_token;
+}
+
+ValidationFanOut::Validator responds_with(AuthorizationStatus status, std::chrono::milliseconds delay = 0ms) {
+    return [status, delay](const ProvidedIdToken&) {
+        std::this_thread::sleep_for(delay);
+        ValidationResult result;
+        result.authorization_status = status;
+        return result;
+    };
+}
+
+std::vector<AuthorizationStatus> statuses(const std::vector<ValidationResult>& results) {
+    std::vector<AuthorizationStatus> statuses;
+    for (const auto& result : results) {
+        statuses.push_back(result.authorization_status);
+    }
+    return statuses;
+}
+
+template <class Function> std::chrono::milliseconds measure(Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+}
+
+} // namespace
+
+TEST(ValidationFanOutTest, test_sequential_validation) {
+    std::atomic<int> calls{0};
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Invalid),
+                              [&calls](const ProvidedIdToken&) -> ValidationResult {
+                                  calls++;
+                                  throw Everest::CmdTimeout("validator not reachable");
+                              },
+                              responds_with(AuthorizationStatus::Accepted),
+                              responds_with(AuthorizationStatus::Blocked)},
+                             ValidationStrategy::Sequential, {});
+
+    const auto results = fan_out.validate(get_provided_token());
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Invalid, AuthorizationStatus::Unknown,
+                                                AuthorizationStatus::Accepted, AuthorizationStatus::Blocked}));
+}
+
+TEST(ValidationFanOutTest, test_parallel_validation_calls_validators_concurrently) {
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Invalid, 200ms),
+                              responds_with(AuthorizationStatus::Accepted, 200ms),
+                              responds_with(AuthorizationStatus::Blocked, 200ms)},
+                             ValidationStrategy::Parallel, {});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_LT(elapsed, 500ms);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Invalid, AuthorizationStatus::Accepted,
+                                                AuthorizationStatus::Blocked}));
+}
+
+TEST(ValidationFanOutTest, test_first_conclusive_does_not_await_lower_priority_validators) {
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Unknown),
+                              responds_with(AuthorizationStatus::Accepted, 50ms),
+                              responds_with(AuthorizationStatus::Blocked, 2s)},
+                             ValidationStrategy::ParallelFirstConclusive, {});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown, AuthorizationStatus::Accepted}));
+}
+
+TEST(ValidationFanOutTest, test_first_conclusive_stops_on_rejection) {
+    // a higher priority validator blocking the token decides, even if a lower priority one accepts it
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Blocked, 50ms),
+                              responds_with(AuthorizationStatus::Accepted),
+                              responds_with(AuthorizationStatus::Accepted, 2s)},
+                             ValidationStrategy::ParallelFirstConclusive, {});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_EQ(statuses(results), (std::vector<AuthorizationStatus>{AuthorizationStatus::Blocked}));
+
+    for (const auto status : {AuthorizationStatus::Expired, AuthorizationStatus::Invalid}) {
+        ValidationFanOut rejecting_fan_out({responds_with(status), responds_with(AuthorizationStatus::Accepted, 2s)},
+                                           ValidationStrategy::ParallelFirstConclusive, {});
+        EXPECT_EQ(statuses(rejecting_fan_out.validate(get_provided_token())),
+                  (std::vector<AuthorizationStatus>{status}));
+    }
+}
+
+TEST(ValidationFanOutTest, test_first_conclusive_awaits_higher_priority_validators) {
+    ValidationFanOut fan_out(
+        {responds_with(AuthorizationStatus::Unknown, 200ms), responds_with(AuthorizationStatus::Accepted)},
+        ValidationStrategy::ParallelFirstConclusive, {});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_GE(elapsed, 200ms);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown, AuthorizationStatus::Accepted}));
+
+    // without a conclusive result all results are awaited
+    ValidationFanOut unknown_fan_out(
+        {responds_with(AuthorizationStatus::Unknown), responds_with(AuthorizationStatus::Unknown, 100ms)},
+        ValidationStrategy::ParallelFirstConclusive, {});
+    EXPECT_EQ(statuses(unknown_fan_out.validate(get_provided_token())),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown, AuthorizationStatus::Unknown}));
+}
+
+TEST(ValidationFanOutTest, test_validator_timeout) {
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Accepted, 2s),
+                              responds_with(AuthorizationStatus::Accepted, 10ms),
+                              responds_with(AuthorizationStatus::Invalid, 2s)},
+                             ValidationStrategy::ParallelFirstConclusive, {100ms, 100ms, 100ms});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_GE(elapsed, 100ms);
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown, AuthorizationStatus::Accepted}));
+}
+
+TEST(ValidationFanOutTest, test_validator_timeouts_per_validator) {
+    // the fast local validator has a short deadline, the slower one is awaited longer
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Accepted, 2s),
+                              responds_with(AuthorizationStatus::Accepted, 300ms),
+                              responds_with(AuthorizationStatus::Accepted, 2s)},
+                             ValidationStrategy::Parallel, {50ms, 1s, 100ms});
+
+    std::vector<ValidationResult> results;
+    const auto elapsed = measure([&]() { results = fan_out.validate(get_provided_token()); });
+
+    EXPECT_GE(elapsed, 300ms);
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_EQ(statuses(results),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown, AuthorizationStatus::Accepted,
+                                                AuthorizationStatus::Unknown}));
+}
+
+TEST(ValidationFanOutTest, test_unexpected_exceptions_are_passed_on) {
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Accepted, 100ms),
+                              [](const ProvidedIdToken&) -> ValidationResult { throw std::logic_error("bug"); }},
+                             ValidationStrategy::Parallel, {});
+    EXPECT_THROW(fan_out.validate(get_provided_token()), std::logic_error);
+
+    ValidationFanOut failing_fan_out(
+        {[](const ProvidedIdToken&) -> ValidationResult { throw Everest::NotReady("not ready"); }},
+        ValidationStrategy::Parallel, {});
+    EXPECT_EQ(statuses(failing_fan_out.validate(get_provided_token())),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown}));
+}
+
+TEST(ValidationFanOutTest, test_pending_calls_per_validator_are_bounded) {
+    std::atomic<int> calls{0};
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    ValidationFanOut fan_out({[&](const ProvidedIdToken&) {
+                                 calls++;
+                                 const auto now_running = ++running;
+                                 auto expected = max_running.load();
+                                 while (now_running > expected and
+                                        not max_running.compare_exchange_weak(expected, now_running)) {
+                                 }
+                                 std::this_thread::sleep_for(500ms);
+                                 running--;
+                                 ValidationResult result;
+                                 result.authorization_status = AuthorizationStatus::Accepted;
+                                 return result;
+                             }},
+                             ValidationStrategy::Parallel, {20ms});
+
+    // every validation times out, only the first calls reach the slow validator
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(statuses(fan_out.validate(get_provided_token())),
+                  (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown}));
+    }
+    EXPECT_EQ(calls, static_cast<int>(ValidationFanOut::MAX_PENDING_CALLS_PER_VALIDATOR));
+    EXPECT_LE(max_running, static_cast<int>(ValidationFanOut::MAX_PENDING_CALLS_PER_VALIDATOR));
+
+    // once the pending calls finished the validator is called again
+    std::this_thread::sleep_for(600ms);
+    EXPECT_EQ(statuses(fan_out.validate(get_provided_token())),
+              (std::vector<AuthorizationStatus>{AuthorizationStatus::Unknown}));
+    EXPECT_EQ(calls, static_cast<int>(ValidationFanOut::MAX_PENDING_CALLS_PER_VALIDATOR) + 1);
+}
+
+TEST(ValidationFanOutTest, test_destruction_awaits_pending_calls) {
+    auto finished = std::make_shared<std::atomic<bool>>(false);
+    {
+        ValidationFanOut fan_out({[finished](const ProvidedIdToken&) {
+                                     std::this_thread::sleep_for(200ms);
+                                     *finished = true;
+                                     return ValidationResult{};
+                                 }},
+                                 ValidationStrategy::Parallel, {10ms});
+        fan_out.validate(get_provided_token());
+        EXPECT_FALSE(*finished);
+    }
+    EXPECT_TRUE(*finished);
+}
+
+TEST(ValidationFanOutTest, test_latency_statistics) {
+    ValidationLatencyRecorder recorder(100);
+    EXPECT_EQ(recorder.get_statistics().samples, 0u);
+
+    // the first 100 samples are replaced by the following ones
+    for (int i = 0; i < 100; i++) {
+        recorder.record(10s);
+    }
+    for (int i = 100; i > 0; i--) {
+        recorder.record(std::chrono::milliseconds(i));
+    }
+
+    const auto statistics = recorder.get_statistics();
+    EXPECT_EQ(statistics.samples, 100u);
+    EXPECT_EQ(statistics.p50, 50ms);
+    EXPECT_EQ(statistics.p90, 90ms);
+    EXPECT_EQ(statistics.p99, 99ms);
+    EXPECT_EQ(statistics.max, 100ms);
+
+    ValidationFanOut fan_out({responds_with(AuthorizationStatus::Accepted, 20ms)}, ValidationStrategy::Parallel, {});
+    fan_out.validate(get_provided_token());
+    EXPECT_EQ(fan_out.get_latency_statistics().samples, 1u);
+    EXPECT_GE(fan_out.get_latency_statistics().max, 20ms);
+}
+
+TEST(ValidationFanOutTest, test_validation_strategy_conversion) {
+    EXPECT_EQ(conversions::string_to_validation_strategy("Sequential"), ValidationStrategy::Sequential);
+    EXPECT_EQ(conversions::string_to_validation_strategy("Parallel"), ValidationStrategy::Parallel);
+    EXPECT_EQ(conversions::string_to_validation_strategy("ParallelFirstConclusive"),
+              ValidationStrategy::ParallelFirstConclusive);
+    EXPECT_THROW(conversions::string_to_validation_strategy("FirstAccepted"), std::out_of_range);
+}
+
+TEST(ValidationFanOutTest, test_validator_timeouts_conversion) {
+    EXPECT_TRUE(conversions::string_to_validator_timeouts("").empty());
+    EXPECT_EQ(conversions::string_to_validator_timeouts("500"), (std::vector<std::chrono::milliseconds>{500ms}));
+    EXPECT_EQ(conversions::string_to_validator_timeouts("500, 3000,0"),
+              (std::vector<std::chrono::milliseconds>{500ms, 3000ms, 0ms}));
+    EXPECT_THROW(conversions::string_to_validator_timeouts("500,,3000"), std::invalid_argument);
+    EXPECT_THROW(conversions::string_to_validator_timeouts("-1"), std::invalid_argument);
+    EXPECT_THROW(conversions::string_to_validator_timeouts("5s"), std::invalid_argument);
+}
+
+} // namespace module
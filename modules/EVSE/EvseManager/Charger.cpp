@@ -104,7 +104,7 @@ void Charger::main_thread() {
         }
 
         {
-            Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_mainloop);
+            StateMachineLock lock(*this, Everest::MutexDescription::Charger_mainloop);
             // update power limits
             power_available();
             // Run our own state machine update (i.e. run everything that needs
@@ -121,7 +121,7 @@ void Charger::error_thread() {
         }
         auto events = error_handling_event_queue.wait();
         if (!events.empty()) {
-            Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_signal_loop);
+            StateMachineLock lock(*this, Everest::MutexDescription::Charger_signal_loop);
             for (auto& event : events) {
                 switch (event) {
                 case ErrorHandlingEvents::ForceErrorShutdown:
@@ -1033,7 +1033,7 @@ void Charger::process_event(CPEvent cp_event) {
         break;
     }
 
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_process_event);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_process_event);
 
     run_state_machine();
 
@@ -1235,8 +1235,7 @@ bool Charger::set_max_current(float c, std::chrono::time_point<std::chrono::stea
         // is it still valid?
         if (validUntil > std::chrono::steady_clock::now()) {
             {
-                Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                                  Everest::MutexDescription::Charger_set_max_current);
+                StateMachineLock lock(*this, Everest::MutexDescription::Charger_set_max_current);
                 shared_context.max_current = c_abs;
                 shared_context.max_current_valid_until = validUntil;
             }
@@ -1273,7 +1272,7 @@ bool Charger::resume_charging() {
 
 // Cancel transaction/charging from external EvseManager interface (e.g. via OCPP)
 bool Charger::cancel_transaction(const types::evse_manager::StopTransactionRequest& request) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_cancel_transaction);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_cancel_transaction);
 
     if (shared_context.flag_transaction_active) {
 
@@ -1441,8 +1440,7 @@ std::optional<types::units_signed::SignedMeterValue> Charger::get_start_signed_m
 }
 
 bool Charger::switch_three_phases_while_charging(bool n) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_switch_three_phases_while_charging);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_switch_three_phases_while_charging);
 
     if (shared_context.hlc_charging_active) {
         return false;
@@ -1474,7 +1472,7 @@ void Charger::setup(bool has_ventilation, const ChargeMode _charge_mode, bool _a
     // set up board support package
     bsp->setup(has_ventilation);
 
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_setup);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_setup);
     // cache our config variables
     config_context.charge_mode = _charge_mode;
     ac_hlc_enabled_current_session = config_context.ac_hlc_enabled = _ac_hlc_enabled;
@@ -1501,39 +1499,36 @@ void Charger::setup(bool has_ventilation, const ChargeMode _charge_mode, bool _a
 }
 
 Charger::EvseState Charger::get_current_state() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_get_current_state);
-    return shared_context.current_state;
+    return state_snapshot.load().current_state;
 }
 
 bool Charger::get_authorized_pnc() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_get_authorized_pnc);
-    return (shared_context.flag_authorized and shared_context.authorized_pnc);
+    const auto snapshot = state_snapshot.load();
+    return (snapshot.authorized and snapshot.authorized_pnc);
 }
 
 bool Charger::get_authorized_eim() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_get_authorized_eim);
-    return (shared_context.flag_authorized and not shared_context.authorized_pnc);
+    const auto snapshot = state_snapshot.load();
+    return (snapshot.authorized and not snapshot.authorized_pnc);
 }
 
 bool Charger::get_authorized_pnc_ready_for_hlc() {
     bool auth = false, ready = false;
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_get_authorized_pnc_ready_for_hlc);
-    auth = (shared_context.flag_authorized and shared_context.authorized_pnc);
-    ready = (shared_context.current_state == EvseState::ChargingPausedEV) or
-            (shared_context.current_state == EvseState::ChargingPausedEVSE) or
-            (shared_context.current_state == EvseState::Charging);
+    const auto snapshot = state_snapshot.load();
+    auth = (snapshot.authorized and snapshot.authorized_pnc);
+    ready = (snapshot.current_state == EvseState::ChargingPausedEV) or
+            (snapshot.current_state == EvseState::ChargingPausedEVSE) or
+            (snapshot.current_state == EvseState::Charging);
     return (auth and ready);
 }
 
 bool Charger::get_authorized_eim_ready_for_hlc() {
     bool auth = false, ready = false;
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_get_authorized_eim_ready_for_hlc);
-    auth = (shared_context.flag_authorized and not shared_context.authorized_pnc);
-    ready = (shared_context.current_state == EvseState::ChargingPausedEV) or
-            (shared_context.current_state == EvseState::ChargingPausedEVSE) or
-            (shared_context.current_state == EvseState::Charging);
+    const auto snapshot = state_snapshot.load();
+    auth = (snapshot.authorized and not snapshot.authorized_pnc);
+    ready = (snapshot.current_state == EvseState::ChargingPausedEV) or
+            (snapshot.current_state == EvseState::ChargingPausedEVSE) or
+            (snapshot.current_state == EvseState::Charging);
     return (auth and ready);
 }
 
@@ -1543,7 +1538,7 @@ std::string Charger::get_session_id() const {
 
 void Charger::authorize(bool a, const types::authorization::ProvidedIdToken& token,
                         const types::authorization::ValidationResult& result) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_authorize);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_authorize);
     if (a) {
         if (shared_context.flag_externally_cancelled) {
             EVLOG_warning
@@ -1572,7 +1567,7 @@ void Charger::authorize(bool a, const types::authorization::ProvidedIdToken& tok
 }
 
 bool Charger::deauthorize() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_deauthorize);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_deauthorize);
     return deauthorize_internal();
 }
 
@@ -1602,7 +1597,7 @@ bool Charger::deauthorize_internal() {
 }
 
 void Charger::enable_disable_initial_state_publish() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_disable);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_disable);
     types::evse_manager::EnableDisableSource source{types::evse_manager::Enable_source::Unspecified,
                                                     types::evse_manager::Enable_state::Unassigned, 10000};
 
@@ -1621,7 +1616,7 @@ void Charger::enable_disable_initial_state_publish() {
 }
 
 bool Charger::enable_disable(int connector_id, const types::evse_manager::EnableDisableSource& source) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_disable);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_disable);
 
     const auto last = active_enable_disable_source;
 
@@ -1836,8 +1831,7 @@ float Charger::get_max_current_signalled_to_ev_internal() {
 }
 
 void Charger::set_current_drawn_by_vehicle(float l1, float l2, float l3) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_set_current_drawn_by_vehicle);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_set_current_drawn_by_vehicle);
     shared_context.current_drawn_by_vehicle[0] = l1;
     shared_context.current_drawn_by_vehicle[1] = l2;
     shared_context.current_drawn_by_vehicle[2] = l3;
@@ -1901,7 +1895,7 @@ bool Charger::power_available() {
 }
 
 void Charger::request_error_sequence() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_request_error_sequence);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_request_error_sequence);
     if (shared_context.current_state == EvseState::WaitingForAuthentication or
         shared_context.current_state == EvseState::PrepareCharging) {
         internal_context.t_step_EF_return_state = shared_context.current_state;
@@ -1917,7 +1911,7 @@ void Charger::request_error_sequence() {
 }
 
 void Charger::set_matching_started(bool m) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_set_matching_started);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_set_matching_started);
     shared_context.matching_started = m;
 }
 
@@ -1926,38 +1920,33 @@ void Charger::reset_dc_enforce_target_limits_timer() {
 }
 
 void Charger::notify_currentdemand_started() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_notify_currentdemand_started);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_notify_currentdemand_started);
     if (shared_context.current_state == EvseState::PrepareCharging) {
         shared_context.current_state = EvseState::Charging;
     }
 }
 
 void Charger::inform_new_evse_max_hlc_limits(const types::iso15118::DcEvseMaximumLimits& _currentEvseMaxLimits) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_inform_new_evse_max_hlc_limits);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_inform_new_evse_max_hlc_limits);
     shared_context.current_evse_max_limits = _currentEvseMaxLimits;
 }
 
 types::iso15118::DcEvseMaximumLimits Charger::get_evse_max_hlc_limits() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_get_evse_max_hlc_limits);
-    return shared_context.current_evse_max_limits;
+    return state_snapshot.load().evse_max_limits;
 }
 
 void Charger::inform_new_evse_min_hlc_limits(const types::iso15118::DcEvseMinimumLimits& limits) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_inform_new_evse_min_hlc_limits);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_inform_new_evse_min_hlc_limits);
     shared_context.current_evse_min_limits = limits;
 }
 
 types::iso15118::DcEvseMinimumLimits Charger::get_evse_min_hlc_limits() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_get_evse_min_hlc_limits);
-    return shared_context.current_evse_min_limits;
+    return state_snapshot.load().evse_min_limits;
 }
 
 // HLC stack signalled a pause request for the lower layers.
 void Charger::dlink_pause() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_dlink_pause);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_dlink_pause);
     shared_context.hlc_allow_close_contactor = false;
     cp_state_X1();
     shared_context.hlc_charging_terminate_pause = HlcTerminatePause::Pause;
@@ -1965,14 +1954,14 @@ void Charger::dlink_pause() {
 
 // HLC requested end of charging session, so we can stop the 5% PWM
 void Charger::dlink_terminate() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_dlink_terminate);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_dlink_terminate);
     shared_context.hlc_allow_close_contactor = false;
     cp_state_X1();
     shared_context.hlc_charging_terminate_pause = HlcTerminatePause::Terminate;
 }
 
 void Charger::dlink_error() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_dlink_error);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_dlink_error);
 
     shared_context.hlc_allow_close_contactor = false;
 
@@ -2020,19 +2009,17 @@ void Charger::dlink_error() {
 }
 
 void Charger::set_hlc_charging_active() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_set_hlc_charging_active);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_set_hlc_charging_active);
     shared_context.hlc_charging_active = true;
 }
 
 void Charger::set_hlc_allow_close_contactor(bool on) {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_set_hlc_allow_close_contactor);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_set_hlc_allow_close_contactor);
     shared_context.hlc_allow_close_contactor = on;
 }
 
 std::optional<types::evse_manager::StopTransactionReason> Charger::get_last_stop_transaction_reason() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex,
-                                      Everest::MutexDescription::Charger_get_last_stop_transaction);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_get_last_stop_transaction);
     return shared_context.last_stop_transaction_reason;
 }
 
@@ -2095,7 +2082,7 @@ bool Charger::bcb_toggle_detected() {
 }
 
 bool Charger::stop_charging_on_fatal_error() {
-    Everest::scoped_lock_timeout lock(state_machine_mutex, Everest::MutexDescription::Charger_errors_prevent_charging);
+    StateMachineLock lock(*this, Everest::MutexDescription::Charger_errors_prevent_charging);
     return stop_charging_on_fatal_error_internal();
 }
 
@@ -2188,4 +2175,31 @@ void Charger::set_state(EvseState s) {
     shared_context.current_state = s;
 }
 
+void Charger::publish_state_snapshot() {
+    StateSnapshot snapshot;
+    snapshot.current_state = shared_context.current_state;
+    snapshot.authorized = shared_context.flag_authorized;
+    snapshot.authorized_pnc = shared_context.authorized_pnc;
+    snapshot.evse_max_limits = shared_context.current_evse_max_limits;
+    snapshot.evse_min_limits = shared_context.current_evse_min_limits;
+
+    // most locked sections do not change any of these values, avoid publishing them again
+    const auto published = state_snapshot.load();
+    if (published.current_state == snapshot.current_state and published.authorized == snapshot.authorized and
+        published.authorized_pnc == snapshot.authorized_pnc and
+        published.evse_max_limits == snapshot.evse_max_limits and
+        published.evse_min_limits == snapshot.evse_min_limits) {
+        return;
+    }
+    state_snapshot.publish(std::move(snapshot));
+}
+
+Charger::Statistics Charger::take_statistics() {
+    Statistics statistics;
+    statistics.state_machine_lock = state_machine_mutex.take_statistics();
+    statistics.max_bsp_event_latency = bsp_event_queue.take_max_latency();
+    statistics.max_error_event_latency = error_handling_event_queue.take_max_latency();
+    return statistics;
+}
+
 } // namespace module
@@ -46,6 +46,7 @@
 #include "EventQueue.hpp"
 #include "IECStateMachine.hpp"
 #include "PersistentStore.hpp"
+#include "Snapshot.hpp"
 #include "scoped_lock_timeout.hpp"
 #include "utils.hpp"
 
@@ -226,6 +227,14 @@ public:
     void cleanup_transactions_on_startup();
     EventQueue<CPEvent> bsp_event_queue;
 
+    // Lock and event latencies since the last call
+    struct Statistics {
+        Everest::LockStatistics state_machine_lock;
+        std::chrono::microseconds max_bsp_event_latency{0};
+        std::chrono::microseconds max_error_event_latency{0};
+    };
+    Statistics take_statistics();
+
 private:
     utils::Stopwatch stopwatch;
 
@@ -281,6 +290,33 @@ private:
     // This mutex locks all variables related to the state machine
     Everest::timed_mutex_traceable state_machine_mutex;
 
+    // Locks the state machine mutex and publishes the state snapshot before releasing it again
+    class StateMachineLock {
+    public:
+        StateMachineLock(Charger& charger, Everest::MutexDescription description) :
+            charger(charger), lock(charger.state_machine_mutex, description) {
+        }
+        ~StateMachineLock() {
+            charger.publish_state_snapshot();
+        }
+
+    private:
+        Charger& charger;
+        Everest::scoped_lock_timeout<Everest::timed_mutex_traceable> lock;
+    };
+
+    // Copy of the shared context values returned by the getters, so they do not contend for the state machine mutex
+    struct StateSnapshot {
+        EvseState current_state{EvseState::Idle};
+        bool authorized{false};
+        bool authorized_pnc{false};
+        types::iso15118::DcEvseMaximumLimits evse_max_limits;
+        types::iso15118::DcEvseMinimumLimits evse_min_limits;
+    };
+    Snapshot<StateSnapshot> state_snapshot;
+    // must be called with the state machine mutex held
+    void publish_state_snapshot();
+
     // used by different threads, complete main loop must be locked for write access
     struct SharedContext {
         // As per IEC61851-1 A.5.3
@@ -302,7 +338,7 @@ private:
         std::atomic_bool flag_paused_by_evse{false};
         std::atomic_bool flag_ev_plugged_in{false};
         // set to true if auth is from PnC, otherwise to false (EIM)
-        bool authorized_pnc;
+        bool authorized_pnc{false};
         bool matching_started;
         float max_current;
         std::chrono::time_point<std::chrono::steady_clock> max_current_valid_until;
@@ -3,10 +3,12 @@
 #ifndef EVENTQUEUE_HPP
 #define EVENTQUEUE_HPP
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace module {
@@ -19,11 +21,27 @@ private:
     events_t pending;
     std::mutex mux;
     std::condition_variable cv;
+    // time the oldest pending event was pushed and the longest time an event waited to be taken
+    std::chrono::steady_clock::time_point oldest_pending;
+    std::chrono::microseconds max_latency{0};
+
+    events_t take_pending() {
+        events_t active;
+        if (!pending.empty()) {
+            const auto latency = std::chrono::steady_clock::now() - oldest_pending;
+            max_latency = std::max(max_latency, std::chrono::duration_cast<std::chrono::microseconds>(latency));
+        }
+        pending.swap(active);
+        return active;
+    }
 
 public:
     void push(const E& event) {
         {
             std::lock_guard<std::mutex> lock(mux);
+            if (pending.empty()) {
+                oldest_pending = std::chrono::steady_clock::now();
+            }
             pending.push_back(event);
         }
         cv.notify_all();
@@ -31,16 +49,13 @@ public:
 
     events_t get_events() {
         std::lock_guard<std::mutex> lock(mux);
-        events_t active;
-        pending.swap(active);
-        return active;
+        return take_pending();
     }
 
     events_t wait() {
         std::unique_lock<std::mutex> ul(mux);
         cv.wait(ul, [this]() { return !pending.empty(); });
-        events_t active;
-        pending.swap(active);
+        auto active = take_pending();
         ul.unlock();
         return active;
     }
@@ -50,9 +65,13 @@ public:
         if (!cv.wait_for(ul, rel_time, [this]() { return !pending.empty(); })) {
             return {};
         }
-        events_t active;
-        pending.swap(active);
-        return active;
+        return take_pending();
+    }
+
+    // Returns the longest time an event waited in the queue since the last call
+    std::chrono::microseconds take_max_latency() {
+        std::lock_guard<std::mutex> lock(mux);
+        return std::exchange(max_latency, std::chrono::microseconds{0});
     }
 };
 
@@ -233,6 +233,7 @@ void EvseManager::init() {
 
     // apply sane defaults capabilities settings once on boot
     powersupply_capabilities = get_sane_default_power_supply_capabilities();
+    powersupply_capabilities_snapshot.publish(powersupply_capabilities);
 
     if (hlc_enabled) {
         if (config.charge_mode == "DC") {
@@ -477,7 +478,7 @@ void EvseManager::ready() {
                 // FIXME send only on change / throttle messages
                 Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_subscribe_ac_eamount);
                 ev_info.remaining_energy_needed = e;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_max_voltage([this](double v) {
@@ -485,7 +486,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_ac_ev_max_voltage);
                 ev_info.maximum_voltage_limit = v;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_max_current([this](double c) {
@@ -493,7 +494,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_ac_ev_max_current);
                 ev_info.maximum_current_limit = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_min_current([this](double c) {
@@ -501,7 +502,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_ac_ev_min_current);
                 ev_info.minimum_current_limit = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_power_limits([this](types::iso15118::AcEvPowerLimits const& l) {
@@ -519,7 +520,7 @@ void EvseManager::ready() {
                 if (l.min_discharge_power.has_value()) {
                     ev_info.ac_min_discharge_power = l.min_discharge_power.value().total;
                 }
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_present_powers([this](types::iso15118::AcEvPresentPowerValues const& values) {
@@ -529,7 +530,7 @@ void EvseManager::ready() {
                 if (values.present_reactive_power.has_value()) {
                     ev_info.ac_present_reactive_power = values.present_reactive_power.value().total;
                 }
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_ac_ev_dynamic_control_mode(
@@ -544,7 +545,7 @@ void EvseManager::ready() {
                         // ev_info.departure_time = values.departure_time.value();
                     }
                     // TODO(SL): Missing max_v2x_energy_request & min_v2x_energy_request
-                    p_evse->publish_ev_info(ev_info);
+                    publish_ev_info();
                 });
 
         } else if (config.charge_mode == "DC") {
@@ -740,7 +741,7 @@ void EvseManager::ready() {
                         Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_set_ev_info);
                         ev_info.present_voltage = present_values.evse_present_voltage;
                         ev_info.present_current = present_values.evse_present_current;
-                        // p_evse->publish_ev_info(ev_info);
+                        ev_info_snapshot.publish(ev_info);
                     }
                 });
             }
@@ -875,7 +876,7 @@ void EvseManager::ready() {
                 ev_info.maximum_current_limit = l.dc_ev_maximum_current_limit;
                 ev_info.maximum_power_limit = l.dc_ev_maximum_power_limit;
                 ev_info.maximum_voltage_limit = l.dc_ev_maximum_voltage_limit;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
 
                 // Update limits for over voltage monitoring
                 if (not r_over_voltage_monitor.empty()) {
@@ -898,7 +899,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_departure_time);
                 ev_info.departure_time = t;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_ev_energy_capacity([this](double c) {
@@ -906,7 +907,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_dc_ev_energy_capacity);
                 ev_info.battery_capacity = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_ev_energy_request([this](double c) {
@@ -914,21 +915,21 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_dc_ev_energy_request);
                 ev_info.remaining_energy_needed = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_full_soc([this](double c) {
                 // FIXME send only on change / throttle messages
                 Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_subscribe_dc_full_soc);
                 ev_info.battery_full_soc = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_bulk_soc([this](double c) {
                 // FIXME send only on change / throttle messages
                 Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_subscribe_dc_bulk_soc);
                 ev_info.battery_bulk_soc = c;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_ev_remaining_time([this](types::iso15118::DcEvRemainingTime const& t) {
@@ -937,7 +938,7 @@ void EvseManager::ready() {
                                                   Everest::MutexDescription::EVSE_subscribe_dc_ev_remaining_time);
                 ev_info.estimated_time_full = t.ev_remaining_time_to_full_soc;
                 ev_info.estimated_time_bulk = t.ev_remaining_time_to_full_bulk_soc;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             r_hlc[0]->subscribe_dc_ev_status([this](types::iso15118::DcEvStatus const& s) {
@@ -945,7 +946,7 @@ void EvseManager::ready() {
                 Everest::scoped_lock_timeout lock(ev_info_mutex,
                                                   Everest::MutexDescription::EVSE_subscribe_dc_ev_status);
                 ev_info.soc = s.dc_ev_ress_soc;
-                p_evse->publish_ev_info(ev_info);
+                publish_ev_info();
             });
 
             // SAE J2847/2 Bidi
@@ -1047,7 +1048,7 @@ void EvseManager::ready() {
                 {
                     Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_subscribe_evcc_id);
                     ev_info.evcc_id = token;
-                    p_evse->publish_ev_info(ev_info);
+                    publish_ev_info();
                 }
             });
         }
@@ -1195,44 +1196,19 @@ void EvseManager::ready() {
             }
 
             // Store local cache
-            {
-                Everest::scoped_lock_timeout lock(power_mutex, Everest::MutexDescription::EVSE_subscribe_powermeter);
-                latest_powermeter_data_billing = p;
-            }
-
-            {
-                std::scoped_lock<std::mutex> lk(powermeter_mutex);
-                initial_powermeter_value_received = true;
-            }
-            powermeter_cv.notify_one();
-
-            // External Nodered interface
-            if (p.phase_seq_error) {
-                mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter/phaseSeqError", config.connector_id),
-                             p.phase_seq_error.value());
-            }
+            latest_powermeter_data_billing.publish(p);
 
-            mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter/time_stamp", config.connector_id),
-                         p.timestamp);
-
-            if (p.power_W) {
-                mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter/totalKw", config.connector_id),
-                             p.power_W.value().total / 1000., 1);
+            if (not initial_powermeter_value_received) {
+                {
+                    std::scoped_lock<std::mutex> lk(powermeter_mutex);
+                    initial_powermeter_value_received = true;
+                }
+                powermeter_cv.notify_one();
             }
 
-            mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter/totalKWattHr", config.connector_id),
-                         p.energy_Wh_import.total / 1000.);
-
-            if (p.energy_Wh_export.has_value()) {
-                mqtt.publish(
-                    fmt::format("everest_external/nodered/{}/powermeter/totalExportKWattHr", config.connector_id),
-                    p.energy_Wh_export.value().total / 1000.);
+            if (config.nodered_debug_topics) {
+                publish_nodered_powermeter(p);
             }
-
-            json j;
-            to_json(j, p);
-            mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter_json", config.connector_id), j.dump());
-            // /External Nodered interface
         });
     }
 
@@ -1294,8 +1270,9 @@ void EvseManager::ready() {
     charger->signal_simple_event.connect([this](types::evse_manager::SessionEventEnum s) {
         if (s == types::evse_manager::SessionEventEnum::SessionFinished) {
             // Reset EV information on Session start and end
+            Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_set_ev_info);
             ev_info = types::evse_manager::EVInfo();
-            p_evse->publish_ev_info(ev_info);
+            publish_ev_info();
         }
 
         if (not hlc_enabled) {
@@ -1336,9 +1313,12 @@ void EvseManager::ready() {
     charger->signal_session_started_event.connect(
         [this](types::evse_manager::StartSessionReason start_reason,
                const std::optional<types::authorization::ProvidedIdToken>& provided_id_token) {
-            // Reset EV information on Session start and end
-            ev_info = types::evse_manager::EVInfo();
-            p_evse->publish_ev_info(ev_info);
+            {
+                // Reset EV information on Session start and end
+                Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_set_ev_info);
+                ev_info = types::evse_manager::EVInfo();
+                publish_ev_info();
+            }
 
             if (not hlc_enabled) {
                 return;
@@ -1488,6 +1468,18 @@ void EvseManager::ready() {
 
             // Publish as external telemetry data
             telemetry.publish("livedata", "power_meter", telemetry_data);
+
+            const auto charger_statistics = charger->take_statistics();
+            const auto& lock_statistics = charger_statistics.state_machine_lock;
+            telemetry.publish(
+                "livedata", "charger_latency",
+                {{"state_machine_locks", lock_statistics.locks},
+                 {"state_machine_lock_max_wait_us", static_cast<int64_t>(lock_statistics.max_wait.count())},
+                 {"state_machine_lock_max_hold_us", static_cast<int64_t>(lock_statistics.max_hold.count())},
+                 {"state_machine_lock_max_hold_by", Everest::to_string(lock_statistics.max_hold_description)},
+                 {"bsp_event_max_latency_us", static_cast<int64_t>(charger_statistics.max_bsp_event_latency.count())},
+                 {"error_event_max_latency_us",
+                  static_cast<int64_t>(charger_statistics.max_error_event_latency.count())}});
         }
     });
 
@@ -1495,7 +1487,7 @@ void EvseManager::ready() {
         // wait for first powermeter value
         std::unique_lock<std::mutex> lk(powermeter_mutex);
         this->powermeter_cv.wait_for(lk, std::chrono::milliseconds(this->config.initial_meter_value_timeout_ms),
-                                     [this] { return initial_powermeter_value_received; });
+                                     [this] { return initial_powermeter_value_received.load(); });
     }
 
     // Resuming left-over transaction from e.g. powerloss. This information allows other modules like to OCPP to be
@@ -1544,8 +1536,25 @@ void EvseManager::ready_to_start_charging() {
 }
 
 types::powermeter::Powermeter EvseManager::get_latest_powermeter_data_billing() {
-    Everest::scoped_lock_timeout lock(power_mutex, Everest::MutexDescription::EVSE_get_latest_powermeter_data_billing);
-    return latest_powermeter_data_billing;
+    return latest_powermeter_data_billing.load();
+}
+
+void EvseManager::publish_nodered_powermeter(const types::powermeter::Powermeter& p) {
+    // External Nodered interface: all values of a sample are published as one object
+    json j;
+    j["time_stamp"] = p.timestamp;
+    j["totalKWattHr"] = p.energy_Wh_import.total / 1000.;
+    if (p.energy_Wh_export.has_value()) {
+        j["totalExportKWattHr"] = p.energy_Wh_export.value().total / 1000.;
+    }
+    if (p.power_W) {
+        j["totalKw"] = p.power_W.value().total / 1000.;
+    }
+    if (p.phase_seq_error) {
+        j["phaseSeqError"] = p.phase_seq_error.value();
+    }
+    j["powermeter"] = p;
+    mqtt.publish(fmt::format("everest_external/nodered/{}/powermeter", config.connector_id), j.dump());
 }
 
 types::evse_board_support::HardwareCapabilities EvseManager::get_hw_capabilities() {
@@ -2557,8 +2566,12 @@ void EvseManager::fail_cable_check(const std::string& reason) {
 }
 
 types::evse_manager::EVInfo EvseManager::get_ev_info() {
-    Everest::scoped_lock_timeout l(ev_info_mutex, Everest::MutexDescription::EVSE_get_ev_info);
-    return ev_info;
+    return ev_info_snapshot.load();
+}
+
+void EvseManager::publish_ev_info() {
+    ev_info_snapshot.publish(ev_info);
+    p_evse->publish_ev_info(ev_info);
 }
 
 void EvseManager::process_dc_ev_target_voltage_current(const types::iso15118::DcEvseMaximumLimits& hlc_limits) {
@@ -2571,14 +2584,14 @@ void EvseManager::process_dc_ev_target_voltage_current(const types::iso15118::Dc
     }
 
     // Limit voltage/current for broken EV implementations
-    const auto ev_info_snapshot = get_ev_info();
-    if (ev_info_snapshot.maximum_current_limit.has_value() and
-        clamped_current > ev_info_snapshot.maximum_current_limit.value()) {
-        clamped_current = ev_info_snapshot.maximum_current_limit.value();
+    const auto published_ev_info = get_ev_info();
+    if (published_ev_info.maximum_current_limit.has_value() and
+        clamped_current > published_ev_info.maximum_current_limit.value()) {
+        clamped_current = published_ev_info.maximum_current_limit.value();
     }
-    if (ev_info_snapshot.maximum_voltage_limit.has_value() and
-        clamped_voltage > ev_info_snapshot.maximum_voltage_limit.value()) {
-        clamped_voltage = ev_info_snapshot.maximum_voltage_limit.value();
+    if (published_ev_info.maximum_voltage_limit.has_value() and
+        clamped_voltage > published_ev_info.maximum_voltage_limit.value()) {
+        clamped_voltage = published_ev_info.maximum_voltage_limit.value();
     }
 
     bool car_breaks_limit{false};
@@ -2601,7 +2614,7 @@ void EvseManager::process_dc_ev_target_voltage_current(const types::iso15118::Dc
     }
 
     const auto actual_voltage =
-        ev_info_snapshot.present_voltage.has_value() ? ev_info_snapshot.present_voltage.value() : clamped_voltage;
+        published_ev_info.present_voltage.has_value() ? published_ev_info.present_voltage.value() : clamped_voltage;
 
     const auto target_power = clamped_current * actual_voltage;
     if (target_power > hlc_limits.evse_maximum_power_limit) {
@@ -2633,7 +2646,7 @@ void EvseManager::process_dc_ev_target_voltage_current(const types::iso15118::Dc
             Everest::scoped_lock_timeout lock(ev_info_mutex, Everest::MutexDescription::EVSE_publish_ev_info);
             ev_info.target_voltage = latest_target_voltage;
             ev_info.target_current = latest_target_current;
-            p_evse->publish_ev_info(ev_info);
+            publish_ev_info();
         }
     }
 }
@@ -2678,17 +2691,8 @@ bool EvseManager::session_is_iso_d20_dc_bpt() {
 }
 
 types::power_supply_DC::Capabilities EvseManager::get_powersupply_capabilities() {
-    types::power_supply_DC::Capabilities caps;
-    types::dc_external_derate::ExternalDerating derate;
-
-    {
-        std::scoped_lock lock(powersupply_capabilities_mutex);
-        caps = powersupply_capabilities;
-    }
-    {
-        std::scoped_lock lock(dc_external_derate_mutex);
-        derate = get_dc_external_derate(this->ev_info.present_voltage, dc_external_derate);
-    }
+    auto caps = powersupply_capabilities_snapshot.load();
+    const auto derate = get_dc_external_derate(ev_info_snapshot.load().present_voltage, dc_external_derate.load());
 
     // Apply external derating if set
     caps.max_export_current_A = min_optional(caps.max_export_current_A, derate.max_export_current_A);
@@ -2700,8 +2704,7 @@ types::power_supply_DC::Capabilities EvseManager::get_powersupply_capabilities()
 }
 
 void EvseManager::set_external_derating(types::dc_external_derate::ExternalDerating d) {
-    std::scoped_lock lock(dc_external_derate_mutex);
-    dc_external_derate = d;
+    dc_external_derate.publish(std::move(d));
 }
 
 } // namespace module
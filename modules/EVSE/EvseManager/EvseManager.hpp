@@ -46,6 +46,7 @@
 #include "ErrorHandling.hpp"
 #include "PersistentStore.hpp"
 #include "SessionLog.hpp"
+#include "Snapshot.hpp"
 #include "VarContainer.hpp"
 #include "over_voltage/OverVoltageMonitor.hpp"
 #include "scoped_lock_timeout.hpp"
@@ -124,6 +125,7 @@ struct Conf {
     std::string bpt_grid_code_island_method;
     int hlc_charge_loop_without_energy_timeout_s;
     int dc_ramp_ampere_per_second;
+    bool nodered_debug_topics;
 };
 
 class EvseManager : public Everest::ModuleBase {
@@ -267,6 +269,7 @@ public:
         }
 
         powersupply_capabilities = caps;
+        powersupply_capabilities_snapshot.publish(caps);
 
         // Inform HLC layer about update of physical values
         types::iso15118::SetupPhysicalValues setup_physical_values;
@@ -305,11 +308,12 @@ private:
     // insert your private definitions here
     std::mutex powersupply_capabilities_mutex;
     types::power_supply_DC::Capabilities powersupply_capabilities;
-    std::mutex dc_external_derate_mutex;
-    types::dc_external_derate::ExternalDerating dc_external_derate;
-
-    Everest::timed_mutex_traceable power_mutex;
-    types::powermeter::Powermeter latest_powermeter_data_billing;
+    // Copies of the capabilities, the external derating and the latest billing powermeter value that are read
+    // without locks from the energy management and HLC callbacks
+    Snapshot<types::power_supply_DC::Capabilities> powersupply_capabilities_snapshot;
+    Snapshot<types::dc_external_derate::ExternalDerating> dc_external_derate;
+    Snapshot<types::powermeter::Powermeter> latest_powermeter_data_billing;
+    void publish_nodered_powermeter(const types::powermeter::Powermeter& p);
 
     Everest::Thread energyThreadHandle;
     everest::lib::util::monitor<types::evse_board_support::HardwareCapabilities> hw_capabilities;
@@ -390,6 +394,10 @@ private:
     // EV information
     Everest::timed_mutex_traceable ev_info_mutex;
     types::evse_manager::EVInfo ev_info;
+    // Copy of ev_info for get_ev_info(), updated whenever ev_info changes while ev_info_mutex is held
+    Snapshot<types::evse_manager::EVInfo> ev_info_snapshot;
+    // Must be called with ev_info_mutex held
+    void publish_ev_info();
     types::evse_manager::CarManufacturer car_manufacturer{types::evse_manager::CarManufacturer::Unknown};
 
     void imd_stop();
@@ -413,7 +421,7 @@ private:
     std::atomic_bool slac_unmatched{false};
     std::mutex powermeter_mutex;
     std::condition_variable powermeter_cv;
-    bool initial_powermeter_value_received{false};
+    std::atomic_bool initial_powermeter_value_received{false};
 
     std::optional<types::iso15118::ServiceCategory> selected_d20_energy_service{std::nullopt};
 
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace module {
+
+// Holds a copy of a value that is published by writers and read by other threads without locks.
+//
+// Left-right scheme: the value is kept twice. Readers announce themselves in one of two read indicators and copy the
+// instance that is active at that moment. A writer updates the inactive instance, switches the readers over to it and
+// waits until no reader is left on the previous instance before updating that one as well. load() never waits and
+// takes no lock, publish() serializes writers with a mutex and waits for at most one copy per reader in progress.
+// std::atomic_load on a std::shared_ptr would not do: libstdc++ implements it with a pool of mutexes.
+template <typename T> class Snapshot {
+public:
+    explicit Snapshot(T initial = T{}) : instances{initial, std::move(initial)} {
+    }
+
+    T load() const {
+        const auto version = version_index.load();
+        readers[version].fetch_add(1);
+        T value = instances[active_instance.load()];
+        readers[version].fetch_sub(1);
+        return value;
+    }
+
+    void publish(T value) {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        const auto previous_instance = active_instance.load();
+        instances[1 - previous_instance] = value;
+        active_instance.store(1 - previous_instance);
+
+        // readers that may still copy the previous instance are registered in either read indicator
+        const auto previous_version = version_index.load();
+        wait_for_readers(1 - previous_version);
+        version_index.store(1 - previous_version);
+        wait_for_readers(previous_version);
+
+        instances[previous_instance] = std::move(value);
+    }
+
+private:
+    void wait_for_readers(int version) const {
+        while (readers[version].load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    T instances[2];
+    std::atomic<int> active_instance{0};
+    std::atomic<int> version_index{0};
+    mutable std::atomic<int> readers[2]{{0}, {0}};
+    std::mutex writer_mutex;
+};
+
+} // namespace module
+#endif
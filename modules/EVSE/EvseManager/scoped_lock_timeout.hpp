@@ -5,8 +5,12 @@
 
 #include "everest/exceptions.hpp"
 #include "everest/logging.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <signal.h>
+#include <utility>
 
 #include "backtrace.hpp"
 
@@ -25,11 +29,6 @@ enum class MutexDescription {
     Charger_waiting_for_power,
     Charger_cancel_transaction,
     Charger_setup,
-    Charger_get_current_state,
-    Charger_get_authorized_pnc,
-    Charger_get_authorized_eim,
-    Charger_get_authorized_pnc_ready_for_hlc,
-    Charger_get_authorized_eim_ready_for_hlc,
     Charger_authorize,
     Charger_deauthorize,
     Charger_disable,
@@ -41,9 +40,7 @@ enum class MutexDescription {
     Charger_set_matching_started,
     Charger_notify_currentdemand_started,
     Charger_inform_new_evse_max_hlc_limits,
-    Charger_get_evse_max_hlc_limits,
     Charger_inform_new_evse_min_hlc_limits,
-    Charger_get_evse_min_hlc_limits,
     Charger_dlink_pause,
     Charger_dlink_terminate,
     Charger_dlink_error,
@@ -80,13 +77,10 @@ enum class MutexDescription {
     EVSE_subscribe_dc_ev_remaining_time,
     EVSE_subscribe_dc_ev_status,
     EVSE_subscribe_evcc_id,
-    EVSE_subscribe_powermeter,
-    EVSE_get_latest_powermeter_data_billing,
     EVSE_get_reservation_id,
     EVSE_reserve,
     EVSE_cancel_reservation,
-    EVSE_is_reserved,
-    EVSE_get_ev_info
+    EVSE_is_reserved
 };
 
 static std::string to_string(MutexDescription d) {
@@ -109,16 +103,6 @@ static std::string to_string(MutexDescription d) {
         return "Charger.cpp: cancel_transaction";
     case MutexDescription::Charger_setup:
         return "Charger.cpp: setup";
-    case MutexDescription::Charger_get_current_state:
-        return "Charger.cpp: get_current_state";
-    case MutexDescription::Charger_get_authorized_pnc:
-        return "Charger.cpp: get_authorized_pnc";
-    case MutexDescription::Charger_get_authorized_eim:
-        return "Charger.cpp: get_authorized_eim";
-    case MutexDescription::Charger_get_authorized_pnc_ready_for_hlc:
-        return "Charger.cpp: get_authorized_pnc_ready_for_hlc";
-    case MutexDescription::Charger_get_authorized_eim_ready_for_hlc:
-        return "Charger.cpp: get_authorized_eim_ready_for_hlc";
     case MutexDescription::Charger_authorize:
         return "Charger.cpp: authorize";
     case MutexDescription::Charger_deauthorize:
@@ -141,12 +125,8 @@ static std::string to_string(MutexDescription d) {
         return "Charger.cpp: notify_currentdemand_started";
     case MutexDescription::Charger_inform_new_evse_max_hlc_limits:
         return "Charger.cpp: inform_new_evse_max_hlc_limits";
-    case MutexDescription::Charger_get_evse_max_hlc_limits:
-        return "Charger.cpp: get_evse_max_hlc_limits";
     case MutexDescription::Charger_inform_new_evse_min_hlc_limits:
         return "Charger.cpp: inform_new_evse_min_hlc_limits";
-    case MutexDescription::Charger_get_evse_min_hlc_limits:
-        return "Charger.cpp: get_evse_min_hlc_limits";
     case MutexDescription::Charger_dlink_pause:
         return "Charger.cpp: dlink_pause";
     case MutexDescription::Charger_dlink_terminate:
@@ -219,10 +199,6 @@ static std::string to_string(MutexDescription d) {
         return "EvseManager.cpp subscribe_dc_ev_status";
     case MutexDescription::EVSE_subscribe_evcc_id:
         return "EvseManager.cpp: subscribe_evcc_id";
-    case MutexDescription::EVSE_subscribe_powermeter:
-        return "EvseManager.cpp: subscribe_powermeter";
-    case MutexDescription::EVSE_get_latest_powermeter_data_billing:
-        return "EvseManager.cpp: get_latest_powermeter_data_billing";
     case MutexDescription::EVSE_get_reservation_id:
         return "EvseManager.cpp: get_reservation_id";
     case MutexDescription::EVSE_reserve:
@@ -231,23 +207,52 @@ static std::string to_string(MutexDescription d) {
         return "EvseManager.cpp: cancel_reservation";
     case MutexDescription::EVSE_is_reserved:
         return "EvseManager.cpp: is_reserved";
-    case MutexDescription::EVSE_get_ev_info:
-        return "EvseManager.cpp: get_ev_info";
     }
     return "Undefined";
 }
 
+// Wait and hold times of the locks taken through scoped_lock_timeout since the statistics were last taken
+struct LockStatistics {
+    std::uint64_t locks{0};
+    std::chrono::microseconds max_wait{0};
+    std::chrono::microseconds max_hold{0};
+    MutexDescription max_hold_description{MutexDescription::Undefined};
+};
+
 class timed_mutex_traceable : public std::timed_mutex {
-#ifdef EVEREST_USE_BACKTRACES
 public:
+#ifdef EVEREST_USE_BACKTRACES
     MutexDescription description;
     pthread_t p_id;
 #endif
+
+    void record_lock(MutexDescription lock_description, std::chrono::microseconds wait,
+                     std::chrono::microseconds hold) {
+        std::lock_guard<std::mutex> lock(statistics_mutex);
+        statistics.locks++;
+        statistics.max_wait = std::max(statistics.max_wait, wait);
+        if (hold >= statistics.max_hold) {
+            statistics.max_hold = hold;
+            statistics.max_hold_description = lock_description;
+        }
+    }
+
+    LockStatistics take_statistics() {
+        std::lock_guard<std::mutex> lock(statistics_mutex);
+        return std::exchange(statistics, LockStatistics{});
+    }
+
+private:
+    // separate from the traced mutex, so statistics can be taken while it is locked
+    std::mutex statistics_mutex;
+    LockStatistics statistics;
 };
 
 template <typename mutex_type> class scoped_lock_timeout {
 public:
-    explicit scoped_lock_timeout(mutex_type& __m, MutexDescription description) : mutex(__m) {
+    explicit scoped_lock_timeout(mutex_type& __m, MutexDescription description) :
+        mutex(__m), description(description) {
+        const auto lock_requested = std::chrono::steady_clock::now();
         if (not mutex.try_lock_for(deadlock_timeout)) {
 #ifdef EVEREST_USE_BACKTRACES
             request_backtrace(pthread_self());
@@ -267,6 +272,8 @@ public:
 #endif
         } else {
             locked = true;
+            locked_since = std::chrono::steady_clock::now();
+            wait = std::chrono::duration_cast<std::chrono::microseconds>(locked_since - lock_requested);
 #ifdef EVEREST_USE_BACKTRACES
             mutex.description = description;
             mutex.p_id = pthread_self();
@@ -276,6 +283,9 @@ public:
 
     ~scoped_lock_timeout() {
         if (locked) {
+            mutex.record_lock(description, wait,
+                              std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                    locked_since));
             mutex.unlock();
         }
     }
@@ -286,6 +296,9 @@ public:
 private:
     bool locked{false};
     mutex_type& mutex;
+    MutexDescription description;
+    std::chrono::steady_clock::time_point locked_since;
+    std::chrono::microseconds wait{0};
 
     // This should be lower then command timeouts from framework (by default 300s)
     static constexpr auto deadlock_timeout = std::chrono::seconds(120);
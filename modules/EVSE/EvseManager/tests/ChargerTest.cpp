@@ -675,6 +675,51 @@ TEST_F(ChargerTest, DelayedAuthorizeAfterCancelTransactionIsIgnored) {
     EXPECT_TRUE(ctx.flag_externally_cancelled);
 }
 
+// tests for the getters reading the published state snapshot
+TEST_F(ChargerTest, GettersReturnStateOfLastLockedSection) {
+    EXPECT_EQ(charger->get_current_state(), Charger::EvseState::Idle);
+    EXPECT_FALSE(charger->get_authorized_eim());
+    EXPECT_FALSE(charger->get_authorized_pnc());
+
+    types::authorization::ProvidedIdToken token;
+    token.id_token.value = "TOKEN";
+    token.id_token.type = types::authorization::IdTokenType::ISO14443;
+    token.authorization_type = types::authorization::AuthorizationType::RFID;
+    types::authorization::ValidationResult validation_result;
+    validation_result.authorization_status = types::authorization::AuthorizationStatus::Accepted;
+
+    charger->authorize(true, token, validation_result);
+    EXPECT_TRUE(charger->get_authorized_eim());
+    EXPECT_FALSE(charger->get_authorized_pnc());
+    EXPECT_FALSE(charger->get_authorized_eim_ready_for_hlc());
+
+    types::iso15118::DcEvseMaximumLimits max_limits;
+    max_limits.evse_maximum_current_limit = 125.0;
+    max_limits.evse_maximum_power_limit = 50000.0;
+    max_limits.evse_maximum_voltage_limit = 500.0;
+    charger->inform_new_evse_max_hlc_limits(max_limits);
+    EXPECT_EQ(charger->get_evse_max_hlc_limits(), max_limits);
+
+    types::evse_manager::StopTransactionRequest stop_request;
+    stop_request.reason = types::evse_manager::StopTransactionReason::Remote;
+    charger->get_shared_context().flag_transaction_active = true;
+    EXPECT_TRUE(charger->cancel_transaction(stop_request));
+    EXPECT_FALSE(charger->get_authorized_eim());
+}
+
+TEST_F(ChargerTest, StatisticsCountStateMachineLocks) {
+    // discard the statistics of earlier locks
+    charger->take_statistics();
+
+    types::iso15118::DcEvseMinimumLimits min_limits;
+    charger->inform_new_evse_min_hlc_limits(min_limits);
+    charger->inform_new_evse_min_hlc_limits(min_limits);
+
+    const auto statistics = charger->take_statistics();
+    EXPECT_GE(statistics.state_machine_lock.locks, 2U);
+    EXPECT_EQ(charger->take_statistics().state_machine_lock.locks, 0U);
+}
+
 } // namespace
 
 // ----------------------------------------------------------------------------
@@ -91,4 +91,19 @@ TEST(EventQueue, wait) {
     wait_thread.join();
 }
 
+TEST(EventQueue, maxLatency) {
+    module::EventQueue<ErrorHandlingEvents> queue;
+    EXPECT_EQ(queue.take_max_latency().count(), 0);
+
+    queue.push(ErrorHandlingEvents::PreventCharging);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.push(ErrorHandlingEvents::AllErrorsCleared);
+    auto events = queue.get_events();
+    ASSERT_EQ(events.size(), 2);
+
+    // the latency is measured from the oldest event of the batch
+    EXPECT_GE(queue.take_max_latency(), std::chrono::milliseconds(20));
+    EXPECT_EQ(queue.take_max_latency().count(), 0);
+}
+
 } // namespace
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <Snapshot.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Sample {
+    int sequence{0};
+    std::string timestamp;
+};
+
+TEST(Snapshot, init) {
+    module::Snapshot<Sample> snapshot;
+    EXPECT_EQ(snapshot.load().sequence, 0);
+
+    module::Snapshot<Sample> initialized({7, "t7"});
+    EXPECT_EQ(initialized.load().sequence, 7);
+    EXPECT_EQ(initialized.load().timestamp, "t7");
+}
+
+TEST(Snapshot, loadedCopyStaysValid) {
+    module::Snapshot<Sample> snapshot;
+    snapshot.publish({1, "t1"});
+    const auto first = snapshot.load();
+
+    snapshot.publish({2, "t2"});
+    EXPECT_EQ(first.sequence, 1);
+    EXPECT_EQ(first.timestamp, "t1");
+    EXPECT_EQ(snapshot.load().sequence, 2);
+
+    // both instances are updated, not only the one that was active last
+    snapshot.publish({3, "t3"});
+    EXPECT_EQ(snapshot.load().sequence, 3);
+    EXPECT_EQ(snapshot.load().timestamp, "t3");
+}
+
+TEST(Snapshot, readersSeeConsistentValues) {
+    module::Snapshot<Sample> snapshot;
+    std::atomic_bool done{false};
+    std::atomic_int inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&] {
+            int last_sequence = 0;
+            while (not done) {
+                const auto s = snapshot.load();
+                if (s.sequence < last_sequence or (s.sequence > 0 and s.timestamp != std::to_string(s.sequence))) {
+                    inconsistent++;
+                }
+                last_sequence = s.sequence;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 10000; i++) {
+        snapshot.publish({i, std::to_string(i)});
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent, 0);
+    EXPECT_EQ(snapshot.load().sequence, 10000);
+}
+
+TEST(Snapshot, concurrentWritersPublishCompleteValues) {
+    module::Snapshot<Sample> snapshot;
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; w++) {
+        writers.emplace_back([&snapshot, w] {
+            for (int i = 1; i <= 5000; i++) {
+                const auto sequence = 2 * i + w;
+                snapshot.publish({sequence, std::to_string(sequence)});
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    const auto last = snapshot.load();
+    EXPECT_TRUE(last.sequence == 10000 or last.sequence == 10001);
+    EXPECT_EQ(last.timestamp, std::to_string(last.sequence));
+}
+
+} // namespace
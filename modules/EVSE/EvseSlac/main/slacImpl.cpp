@@ -10,6 +10,7 @@
 #include <fmt/core.h>
 #include <slac/channel.hpp>
 #include <thread>
+#include <vector>
 
 #include "fsm_controller.hpp"
 
@@ -27,6 +28,24 @@ static std::string mac_to_ascii(const std::string& mac_binary) {
                        mac_binary[3], mac_binary[4], mac_binary[5]);
 }
 
+// MMTYPEs handled by the evse state machine, used for the kernel packet filter
+static const std::vector<uint16_t> EVSE_HANDLED_MMTYPES = {
+    slac::defs::MMTYPE_CM_SLAC_PARAM,
+    slac::defs::MMTYPE_CM_START_ATTEN_CHAR,
+    slac::defs::MMTYPE_CM_MNBC_SOUND,
+    slac::defs::MMTYPE_CM_ATTEN_PROFILE,
+    slac::defs::MMTYPE_CM_ATTEN_CHAR,
+    slac::defs::MMTYPE_CM_SLAC_MATCH,
+    slac::defs::MMTYPE_CM_VALIDATE,
+    slac::defs::MMTYPE_CM_SET_KEY,
+    slac::defs::qualcomm::MMTYPE_CM_RESET_DEVICE,
+    slac::defs::qualcomm::MMTYPE_LINK_STATUS,
+    slac::defs::qualcomm::MMTYPE_OP_ATTR,
+    slac::defs::lumissil::MMTYPE_NSCM_RESET_DEVICE,
+    slac::defs::lumissil::MMTYPE_NSCM_GET_VERSION,
+    slac::defs::lumissil::MMTYPE_NSCM_GET_D_LINK_STATUS,
+};
+
 void slacImpl::init() {
     // setup evse fsm thread
     std::thread(&slacImpl::run, this).detach();
@@ -49,8 +68,12 @@ void slacImpl::run() {
 
     // initialize slac i/o
     SlacIO slac_io;
+    slac::ChannelOptions channel_options;
+    channel_options.kernel_filter = config.kernel_packet_filter;
+    channel_options.mmtypes = EVSE_HANDLED_MMTYPES;
+    channel_options.rx_batch_size = static_cast<std::size_t>(config.rx_batch_size);
     try {
-        slac_io.init(config.device);
+        slac_io.init(config.device, channel_options);
     } catch (const std::exception& e) {
         EVLOG_error << fmt::format("Couldn't open device {} for SLAC communication. Reason: {}", config.device,
                                    e.what());
@@ -13,7 +13,18 @@
 namespace module {
 namespace energy_grid {
 
+namespace {
+// interval of the publication statistics reported as telemetry
+constexpr std::chrono::seconds PUBLISH_STATISTICS_INTERVAL{60};
+} // namespace
+
 void energyImpl::init() {
+    publisher = std::make_unique<EnergyFlowPublisher>(
+        std::chrono::milliseconds(mod->config.coalescing_window_ms), PUBLISH_STATISTICS_INTERVAL,
+        [this]() { return build_complete_energy_object(); },
+        [this](const types::energy::EnergyFlowRequest& e) { publish_energy_flow_request(e); },
+        [this](const EnergyFlowPublishStatistics& statistics) { report_publish_statistics(statistics); });
+
     auto energy_state_handle = energy_state.handle();
 
     energy_state_handle->energy_flow_request.uuid = mod->info.id;
@@ -28,28 +39,31 @@ void energyImpl::init() {
     for (auto& entry : mod->r_energy_consumer) {
         entry->subscribe_energy_flow_request([this](types::energy::EnergyFlowRequest const& e) {
             // Received new energy_flow_request object from a child. Update in the cached object and republish.
-            auto energy_state_handle = energy_state.handle();
+            const auto priority = is_priority_request(e);
+            {
+                auto energy_state_handle = energy_state.handle();
 
-            auto& children = energy_state_handle->energy_flow_request.children;
-            auto children_it = std::find_if(children.begin(), children.end(), [&e](const auto& child) {
-                return std::string_view{child.uuid} == std::string_view{e.uuid};
-            });
-            if (children_it != children.end()) {
-                *children_it = e;
-            } else {
-                children.push_back(std::move(e));
+                auto& children = energy_state_handle->energy_flow_request.children;
+                auto children_it = std::find_if(children.begin(), children.end(), [&e](const auto& child) {
+                    return std::string_view{child.uuid} == std::string_view{e.uuid};
+                });
+                if (children_it != children.end()) {
+                    *children_it = e;
+                } else {
+                    children.push_back(std::move(e));
+                }
             }
 
-            publish_complete_energy_object(*energy_state_handle);
+            // priority requests need to reach the EnergyManager now, they are not delayed by the coalescing window
+            publisher->request_publish(priority);
         });
     }
 
     if (!mod->r_powermeter.empty()) {
         mod->r_powermeter[0]->subscribe_powermeter([this](types::powermeter::Powermeter const& p) {
             EVLOG_debug << "Incoming powermeter readings: " << p;
-            auto energy_state_handle = energy_state.handle();
-            energy_state_handle->energy_flow_request.energy_usage_root = p;
-            publish_complete_energy_object(*energy_state_handle);
+            energy_state.handle()->energy_flow_request.energy_usage_root = p;
+            publisher->request_publish();
         });
     }
 
@@ -57,9 +71,8 @@ void energyImpl::init() {
         mod->r_price_information[0]->subscribe_energy_pricing(
             [this](types::energy_price_information::EnergyPriceSchedule p) {
                 EVLOG_debug << "Incoming price schedule: " << p;
-                auto energy_state_handle = energy_state.handle();
-                energy_state_handle->energy_pricing = p;
-                publish_complete_energy_object(*energy_state_handle);
+                energy_state.handle()->energy_pricing = p;
+                publisher->request_publish();
             });
     }
 }
@@ -111,18 +124,24 @@ void energyImpl::set_external_limits(types::energy::ExternalLimits& l) {
     energy_state_handle->energy_flow_request.schedule_setpoints = l.schedule_setpoints;
 }
 
-void energyImpl::publish_complete_energy_object(const EnergyState& state) {
-    // This method is always called from contexts that already hold the energy_state lock
-    const auto& energy_flow_request = state.energy_flow_request;
-    const auto& energy_pricing_schedule_export = state.energy_pricing.schedule_export;
+types::energy::EnergyFlowRequest energyImpl::build_complete_energy_object() {
+    auto energy_state_handle = energy_state.handle();
+    types::energy::EnergyFlowRequest energy_complete = energy_state_handle->energy_flow_request;
+    const auto& energy_pricing_schedule_export = energy_state_handle->energy_pricing.schedule_export;
 
-    if (not energy_flow_request.schedule_export.empty() and not energy_pricing_schedule_export.empty()) {
-        types::energy::EnergyFlowRequest energy_complete = energy_flow_request;
+    if (not energy_complete.schedule_export.empty() and not energy_pricing_schedule_export.empty()) {
         merge_price_into_schedule(energy_complete.schedule_export, energy_pricing_schedule_export);
-        publish_energy_flow_request(energy_complete);
-    } else {
-        publish_energy_flow_request(energy_flow_request);
     }
+    return energy_complete;
+}
+
+void energyImpl::report_publish_statistics(const EnergyFlowPublishStatistics& statistics) {
+    mod->telemetry.publish("energy_node", "energy_flow_request",
+                           {{"levels", static_cast<int32_t>(statistics.levels)},
+                            {"published", statistics.published},
+                            {"suppressed", statistics.suppressed},
+                            {"bytes_published", statistics.bytes_published},
+                            {"bytes_per_second", statistics.bytes_per_second()}});
 }
 
 void energyImpl::merge_price_into_schedule(std::vector<types::energy::ScheduleReqEntry>& schedule,
@@ -171,9 +190,8 @@ void energyImpl::merge_price_into_schedule(std::vector<types::energy::ScheduleRe
 }
 
 void energyImpl::ready() {
-    auto energy_state_handle = energy_state.handle();
     // publish own limits at least once
-    publish_energy_flow_request(energy_state_handle->energy_flow_request);
+    publisher->request_publish();
     mod->signalExternalLimit.connect([this](types::energy::ExternalLimits& l) { set_external_limits(l); });
 }
 
@@ -14,7 +14,9 @@
 
 // ev@75ac1216-19eb-4182-a85c-820f1fc2c091:v1
 // insert your custom include headers here
+#include "energy_flow_publisher.hpp"
 #include <everest/util/async/monitor.hpp>
+#include <memory>
 // ev@75ac1216-19eb-4182-a85c-820f1fc2c091:v1
 
 namespace module {
@@ -59,10 +61,14 @@ private:
 
     everest::lib::util::monitor<EnergyState> energy_state;
 
+    // declared after energy_state, its worker thread builds the published object from the state
+    std::unique_ptr<EnergyFlowPublisher> publisher;
+
     types::energy::ScheduleReqEntry get_local_schedule_req_entry();
     std::vector<types::energy::ScheduleReqEntry> get_local_schedule();
 
-    void publish_complete_energy_object(const EnergyState& state);
+    types::energy::EnergyFlowRequest build_complete_energy_object();
+    void report_publish_statistics(const EnergyFlowPublishStatistics& statistics);
     void set_external_limits(types::energy::ExternalLimits& l);
     void merge_price_into_schedule(std::vector<types::energy::ScheduleReqEntry>& schedule,
                                    const std::vector<types::energy_price_information::PricePerkWh>& price);
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include "energy_flow_publisher.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+namespace module {
+namespace energy_grid {
+
+double EnergyFlowPublishStatistics::bytes_per_second() const {
+    const auto seconds = std::chrono::duration<double>(interval).count();
+    if (seconds <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(bytes_published) / seconds;
+}
+
+int count_levels(const types::energy::EnergyFlowRequest& energy_flow_request) {
+    int levels_below = 0;
+    for (const auto& child : energy_flow_request.children) {
+        levels_below = std::max(levels_below, count_levels(child));
+    }
+    return levels_below + 1;
+}
+
+bool is_priority_request(const types::energy::EnergyFlowRequest& energy_flow_request) {
+    if (energy_flow_request.priority_request.value_or(false)) {
+        return true;
+    }
+    return std::any_of(energy_flow_request.children.begin(), energy_flow_request.children.end(),
+                       [](const auto& child) { return is_priority_request(child); });
+}
+
+EnergyFlowPublisher::EnergyFlowPublisher(std::chrono::milliseconds coalescing_window,
+                                         std::chrono::milliseconds report_interval, BuildFunction build,
+                                         PublishFunction publish, ReportFunction report, NowFunction now) :
+    coalescing_window(coalescing_window),
+    report_interval(report_interval),
+    build(std::move(build)),
+    publish(std::move(publish)),
+    report(std::move(report)),
+    now(std::move(now)) {
+    if (this->report_interval.count() <= 0) {
+        throw std::invalid_argument("EnergyFlowPublisher: the report interval must be positive");
+    }
+    this->statistics_start = this->now();
+    this->next_report = this->statistics_start + this->report_interval;
+    this->worker = std::thread([this]() { this->run(); });
+}
+
+EnergyFlowPublisher::~EnergyFlowPublisher() {
+    {
+        std::lock_guard<std::mutex> lock(this->pending_mutex);
+        this->running = false;
+    }
+    this->pending_cv.notify_all();
+    this->worker.join();
+}
+
+void EnergyFlowPublisher::request_publish(bool priority) {
+    if (this->coalescing_window.count() == 0) {
+        this->publish_if_changed();
+        return;
+    }
+
+    bool publish_now = false;
+    {
+        std::lock_guard<std::mutex> lock(this->pending_mutex);
+        const auto now = this->now();
+        if (priority or (not this->pending and (not this->last_publish.has_value() or
+                                                 now >= this->last_publish.value() + this->coalescing_window))) {
+            // a pending request is published along, the publication carries the latest state
+            this->pending = false;
+            this->last_publish = now;
+            publish_now = true;
+        } else if (not this->pending) {
+            this->pending = true;
+            this->deadlines_changed = true;
+        }
+    }
+
+    if (publish_now) {
+        this->publish_if_changed();
+    } else {
+        this->pending_cv.notify_one();
+    }
+}
+
+void EnergyFlowPublisher::poll() {
+    std::lock_guard<std::mutex> poll_lock(this->poll_mutex);
+    const auto now = this->now();
+    bool publish_pending = false;
+    bool report_due = false;
+    {
+        std::lock_guard<std::mutex> lock(this->pending_mutex);
+        if (this->pending and now >= this->last_publish.value() + this->coalescing_window) {
+            this->pending = false;
+            this->last_publish = now;
+            publish_pending = true;
+        }
+        if (now >= this->next_report) {
+            this->next_report = now + this->report_interval;
+            report_due = true;
+        }
+    }
+
+    if (publish_pending) {
+        this->publish_if_changed();
+    }
+    if (report_due) {
+        this->report_statistics(now);
+    }
+}
+
+EnergyFlowPublisher::Clock::time_point EnergyFlowPublisher::next_deadline() const {
+    if (this->pending) {
+        return std::min(this->next_report, this->last_publish.value() + this->coalescing_window);
+    }
+    return this->next_report;
+}
+
+void EnergyFlowPublisher::run() {
+    std::unique_lock<std::mutex> lock(this->pending_mutex);
+    while (true) {
+        const auto timeout = this->next_deadline() - this->now();
+        this->pending_cv.wait_for(lock, timeout, [this]() { return this->deadlines_changed or not this->running; });
+        if (not this->running) {
+            return;
+        }
+        this->deadlines_changed = false;
+
+        lock.unlock();
+        this->poll();
+        lock.lock();
+    }
+}
+
+void EnergyFlowPublisher::publish_if_changed() {
+    // building under the lock keeps concurrent publications in the order of the states they were built from
+    std::lock_guard<std::mutex> lock(this->publish_mutex);
+    const auto energy_flow_request = this->build();
+    auto serialized = nlohmann::json(energy_flow_request).dump();
+    if (serialized == this->last_published) {
+        this->statistics.suppressed++;
+        return;
+    }
+
+    this->publish(energy_flow_request);
+    this->statistics.published++;
+    this->statistics.bytes_published += serialized.size();
+    this->statistics.levels = count_levels(energy_flow_request);
+    this->last_published = std::move(serialized);
+}
+
+void EnergyFlowPublisher::report_statistics(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(this->publish_mutex);
+    this->statistics.interval = now - this->statistics_start;
+    this->report(this->statistics);
+    const auto levels = this->statistics.levels;
+    this->statistics = EnergyFlowPublishStatistics{};
+    this->statistics.levels = levels;
+    this->statistics_start = now;
+}
+
+} // namespace energy_grid
+} // namespace module
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#ifndef ENERGY_FLOW_PUBLISHER_HPP
+#define ENERGY_FLOW_PUBLISHER_HPP
+
+#include <generated/types/energy.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace module {
+namespace energy_grid {
+
+/**
+ * @brief Publication statistics of an EnergyFlowPublisher for one reporting interval
+ */
+struct EnergyFlowPublishStatistics {
+    std::chrono::steady_clock::duration interval{}; ///< Duration the statistics were collected over
+    std::uint64_t published{0};                     ///< Number of published energy flow requests
+    std::uint64_t suppressed{0};                    ///< Number of energy flow requests not published as unchanged
+    std::uint64_t bytes_published{0};               ///< Serialized size of all published energy flow requests
+    int levels{0};                                  ///< Number of levels of the last published subtree
+
+    /**
+     * @brief Returns the published bytes per second over the interval
+     */
+    double bytes_per_second() const;
+};
+
+/**
+ * @brief Returns the number of levels of the subtree \p energy_flow_request, 1 for a node without children
+ */
+int count_levels(const types::energy::EnergyFlowRequest& energy_flow_request);
+
+/**
+ * @brief Returns true if \p energy_flow_request or any node of its subtree sets priority_request
+ */
+bool is_priority_request(const types::energy::EnergyFlowRequest& energy_flow_request);
+
+/**
+ * @brief Rate limits and deduplicates the publication of the energy flow request of a node
+ *
+ * Child requests, powermeter readings and price updates only call request_publish(). With a coalescing window of
+ * zero the energy flow request is built and published right away. Otherwise it is published at most once per window:
+ * the first request after a quiet period is published immediately, all requests arriving within the window are merged
+ * into one publication of the latest state at the end of the window. Priority requests are published immediately,
+ * they are never delayed by the window.
+ *
+ * A request that serializes to the same object as the previous publication is suppressed, so a subtree that did not
+ * change is not forwarded to the parent nodes.
+ *
+ * The statistics are reported every report interval, also if nothing was published. A worker thread calls poll() when
+ * a window ends or a report is due.
+ */
+class EnergyFlowPublisher {
+public:
+    using Clock = std::chrono::steady_clock;
+    using BuildFunction = std::function<types::energy::EnergyFlowRequest()>;
+    using PublishFunction = std::function<void(const types::energy::EnergyFlowRequest&)>;
+    using ReportFunction = std::function<void(const EnergyFlowPublishStatistics&)>;
+    using NowFunction = std::function<Clock::time_point()>;
+
+    /**
+     * @param coalescing_window Minimum time between two publications, zero publishes every request immediately
+     * @param report_interval Interval in which \p report is called with the statistics of the interval, must be
+     * positive
+     * @param build Returns the current energy flow request, it must not acquire locks that callers of request_publish()
+     * hold
+     * @param publish Publishes the energy flow request
+     * @param report Receives the publication statistics
+     * @param now Returns the current time, all windows and report intervals are measured with it
+     */
+    EnergyFlowPublisher(std::chrono::milliseconds coalescing_window, std::chrono::milliseconds report_interval,
+                        BuildFunction build, PublishFunction publish, ReportFunction report,
+                        NowFunction now = &Clock::now);
+    ~EnergyFlowPublisher();
+
+    EnergyFlowPublisher(const EnergyFlowPublisher&) = delete;
+    EnergyFlowPublisher& operator=(const EnergyFlowPublisher&) = delete;
+
+    /**
+     * @brief Requests the publication of the current energy flow request
+     * @param priority Publishes immediately, also within the coalescing window
+     */
+    void request_publish(bool priority = false);
+
+    /**
+     * @brief Publishes a pending request whose coalescing window ended and reports the statistics if they are due
+     *
+     * Called by the worker thread at these deadlines, calling it at any other time has no effect. Returns after the
+     * due publication and report are done, also if the worker thread handles them concurrently.
+     */
+    void poll();
+
+private:
+    void run();
+    void publish_if_changed();
+    void report_statistics(Clock::time_point now);
+    Clock::time_point next_deadline() const;
+
+    const std::chrono::milliseconds coalescing_window;
+    const std::chrono::milliseconds report_interval;
+    BuildFunction build;
+    PublishFunction publish;
+    ReportFunction report;
+    NowFunction now;
+
+    // serializes poll(), so it returns only after the publication or report that was due is done
+    std::mutex poll_mutex;
+
+    // serializes the publications and reports, guards last_published and the statistics
+    std::mutex publish_mutex;
+    std::string last_published;
+    EnergyFlowPublishStatistics statistics;
+    Clock::time_point statistics_start;
+
+    // guards the coalescing and reporting deadlines of the worker thread
+    std::mutex pending_mutex;
+    std::condition_variable pending_cv;
+    bool pending{false};
+    bool deadlines_changed{false};
+    bool running{true};
+    std::optional<Clock::time_point> last_publish;
+    Clock::time_point next_report;
+    std::thread worker;
+};
+
+} // namespace energy_grid
+} // namespace module
+
+#endif // ENERGY_FLOW_PUBLISHER_HPP
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <generated/types/energy.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "../energy_grid/energy_flow_publisher.hpp"
+
+using namespace module::energy_grid;
+using namespace std::chrono_literals;
+
+namespace {
+
+types::energy::EnergyFlowRequest create_node(const std::string& uuid) {
+    types::energy::EnergyFlowRequest node;
+    node.uuid = uuid;
+    node.node_type = types::energy::NodeType::Generic;
+    return node;
+}
+
+// Publisher of a node whose state, publications and clock are controlled by the fixture. The clock only advances
+// through advance(), which then calls poll() like the worker thread would at the deadlines.
+class EnergyFlowPublisherTest : public ::testing::Test {
+protected:
+    std::unique_ptr<EnergyFlowPublisher> create_publisher(std::chrono::milliseconds coalescing_window,
+                                                          std::chrono::milliseconds report_interval = 1h) {
+        return std::make_unique<EnergyFlowPublisher>(
+            coalescing_window, report_interval,
+            [this]() {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                return this->state;
+            },
+            [this](const types::energy::EnergyFlowRequest& e) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->published.push_back(e);
+            },
+            [this](const EnergyFlowPublishStatistics& statistics) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->reports.push_back(statistics);
+            },
+            [this]() {
+                std::lock_guard<std::mutex> lock(this->clock_mutex);
+                return this->now;
+            });
+    }
+
+    void advance(EnergyFlowPublisher& publisher, std::chrono::milliseconds duration) {
+        {
+            std::lock_guard<std::mutex> lock(this->clock_mutex);
+            this->now += duration;
+        }
+        publisher.poll();
+    }
+
+    void set_child_power(double power_W) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        types::powermeter::Powermeter powermeter;
+        powermeter.timestamp = "2024-01-01T00:00:00Z";
+        types::units::Power power;
+        power.total = static_cast<float>(power_W);
+        powermeter.power_W = power;
+        this->state.children.at(0).energy_usage_root = powermeter;
+    }
+
+    std::size_t number_of_publications() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->published.size();
+    }
+
+    std::size_t number_of_reports() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->reports.size();
+    }
+
+    std::mutex mutex;
+    types::energy::EnergyFlowRequest state{create_node("node")};
+    std::vector<types::energy::EnergyFlowRequest> published;
+    std::vector<EnergyFlowPublishStatistics> reports;
+
+    std::mutex clock_mutex;
+    EnergyFlowPublisher::Clock::time_point now{EnergyFlowPublisher::Clock::duration{0}};
+};
+
+} // namespace
+
+TEST(EnergyFlowPublisherLevels, CountsLevelsOfDeepestBranch) {
+    auto root = create_node("root");
+    EXPECT_EQ(count_levels(root), 1);
+
+    auto branch = create_node("branch");
+    branch.children.push_back(create_node("leaf"));
+    root.children.push_back(create_node("evse"));
+    root.children.push_back(branch);
+    EXPECT_EQ(count_levels(root), 3);
+}
+
+TEST(EnergyFlowPublisherPriority, FindsPriorityRequestsInSubtree) {
+    auto root = create_node("root");
+    auto branch = create_node("branch");
+    branch.children.push_back(create_node("leaf"));
+    root.children.push_back(branch);
+    EXPECT_FALSE(is_priority_request(root));
+
+    root.children.at(0).children.at(0).priority_request = false;
+    EXPECT_FALSE(is_priority_request(root));
+
+    root.children.at(0).children.at(0).priority_request = true;
+    EXPECT_TRUE(is_priority_request(root));
+}
+
+TEST_F(EnergyFlowPublisherTest, WithoutWindowEveryChangeIsPublishedImmediately) {
+    state.children.push_back(create_node("child"));
+    auto publisher = create_publisher(0ms);
+
+    publisher->request_publish();
+    set_child_power(1000.0);
+    publisher->request_publish();
+
+    ASSERT_EQ(number_of_publications(), 2u);
+    EXPECT_FALSE(published.at(0).children.at(0).energy_usage_root.has_value());
+    EXPECT_EQ(published.at(1).children.at(0).energy_usage_root.value().power_W.value().total, 1000.0f);
+}
+
+TEST_F(EnergyFlowPublisherTest, UnchangedSubtreeIsNotPublishedAgain) {
+    state.children.push_back(create_node("child"));
+    auto publisher = create_publisher(0ms);
+
+    publisher->request_publish();
+    publisher->request_publish();
+    set_child_power(1000.0);
+    publisher->request_publish();
+    publisher->request_publish();
+
+    EXPECT_EQ(number_of_publications(), 2u);
+}
+
+TEST_F(EnergyFlowPublisherTest, UpdatesWithinWindowAreCoalesced) {
+    state.children.push_back(create_node("child"));
+    auto publisher = create_publisher(200ms);
+
+    // the first update after a quiet period is published right away
+    publisher->request_publish();
+    EXPECT_EQ(number_of_publications(), 1u);
+
+    for (int i = 1; i <= 20; i++) {
+        set_child_power(i * 100.0);
+        publisher->request_publish();
+    }
+    advance(*publisher, 199ms);
+    EXPECT_EQ(number_of_publications(), 1u);
+
+    // the updates of the window are merged into one publication of the latest state
+    advance(*publisher, 1ms);
+    ASSERT_EQ(number_of_publications(), 2u);
+    EXPECT_EQ(published.at(1).children.at(0).energy_usage_root.value().power_W.value().total, 2000.0f);
+
+    // after a quiet period the next update is published right away again
+    advance(*publisher, 500ms);
+    set_child_power(50.0);
+    publisher->request_publish();
+    EXPECT_EQ(number_of_publications(), 3u);
+}
+
+TEST_F(EnergyFlowPublisherTest, PriorityRequestsBypassWindow) {
+    state.children.push_back(create_node("child"));
+    auto publisher = create_publisher(200ms);
+
+    publisher->request_publish();
+    set_child_power(100.0);
+    publisher->request_publish();
+    advance(*publisher, 10ms);
+    EXPECT_EQ(number_of_publications(), 1u);
+
+    set_child_power(200.0);
+    publisher->request_publish(true);
+    ASSERT_EQ(number_of_publications(), 2u);
+    EXPECT_EQ(published.at(1).children.at(0).energy_usage_root.value().power_W.value().total, 200.0f);
+
+    // the pending update was published along with the priority request
+    advance(*publisher, 1s);
+    EXPECT_EQ(number_of_publications(), 2u);
+}
+
+TEST_F(EnergyFlowPublisherTest, ReportsStatisticsEveryInterval) {
+    state.children.push_back(create_node("child"));
+    auto publisher = create_publisher(0ms, 60s);
+
+    publisher->request_publish();
+    publisher->request_publish();
+    advance(*publisher, 59s);
+    EXPECT_EQ(number_of_reports(), 0u);
+
+    advance(*publisher, 1s);
+    ASSERT_EQ(number_of_reports(), 1u);
+    EXPECT_EQ(reports.at(0).interval, 60s);
+    EXPECT_EQ(reports.at(0).published, 1u);
+    EXPECT_EQ(reports.at(0).suppressed, 1u);
+    EXPECT_EQ(reports.at(0).bytes_published, nlohmann::json(state).dump().size());
+    EXPECT_EQ(reports.at(0).levels, 2);
+
+    // statistics restart with every report and are reported also if nothing was published
+    advance(*publisher, 60s);
+    ASSERT_EQ(number_of_reports(), 2u);
+    EXPECT_EQ(reports.at(1).published, 0u);
+    EXPECT_EQ(reports.at(1).suppressed, 0u);
+    EXPECT_EQ(reports.at(1).bytes_published, 0u);
+    EXPECT_EQ(reports.at(1).bytes_per_second(), 0.0);
+    EXPECT_EQ(reports.at(1).levels, 2);
+}
+
+TEST_F(EnergyFlowPublisherTest, RejectsEmptyReportInterval) {
+    EXPECT_THROW(create_publisher(0ms, 0ms), std::invalid_argument);
+}
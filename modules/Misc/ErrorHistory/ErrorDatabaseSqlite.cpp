@@ -11,10 +11,39 @@
 
 #include <utils/date.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
 namespace module {
 
+namespace {
+// column order of all queries, see read_error
+const std::string ERROR_COLUMNS = "uuid, type, description, message, origin_module, origin_implementation, timestamp, "
+                                  "severity, state, sub_type, vendor_id";
+
+Everest::error::ErrorPtr read_error(everest::db::sqlite::StatementInterface& stmt) {
+    const Everest::error::ErrorHandle err_handle(stmt.column_text(0));
+    const Everest::error::ErrorType err_type(stmt.column_text(1));
+    const std::string err_description = stmt.column_text(2);
+    const std::string err_msg = stmt.column_text(3);
+    const ImplementationIdentifier err_origin(stmt.column_text(4), stmt.column_text(5));
+    const Everest::error::Error::time_point err_timestamp = Everest::Date::from_rfc3339(stmt.column_text(6));
+    const Everest::error::Severity err_severity = Everest::error::string_to_severity(stmt.column_text(7));
+    const Everest::error::State err_state = Everest::error::string_to_state(stmt.column_text(8));
+    const Everest::error::ErrorSubType err_sub_type(stmt.column_text(9));
+    const std::string err_vendor_id = stmt.column_text(10);
+    return std::make_shared<Everest::error::Error>(err_type, err_sub_type, err_msg, err_description, err_origin,
+                                                   err_vendor_id, err_severity, err_timestamp, err_handle, err_state);
+}
+
+void bind_condition_values(everest::db::sqlite::StatementInterface& stmt, const std::vector<std::string>& values) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        stmt.bind_text(static_cast<int>(i + 1), values[i]);
+    }
+}
+} // namespace
+
 ErrorDatabaseSqlite::ErrorDatabaseSqlite(const fs::path& db_path_, const bool reset_) :
     db_path(fs::absolute(db_path_)) {
     BOOST_LOG_FUNCTION();
@@ -34,6 +63,7 @@ ErrorDatabaseSqlite::ErrorDatabaseSqlite(const fs::path& db_path_, const bool re
             this->reset_database();
         }
     }
+    this->open_database();
 }
 
 void ErrorDatabaseSqlite::check_database() {
@@ -99,6 +129,9 @@ void ErrorDatabaseSqlite::reset_database() {
     if (fs::exists(this->db_path)) {
         fs::remove(this->db_path);
     }
+    // leftovers of the write-ahead log belong to the removed database
+    fs::remove(this->db_path.string() + "-wal");
+    fs::remove(this->db_path.string() + "-shm");
     try {
         everest::db::sqlite::Connection db(this->db_path);
         if (!db.open_connection()) {
@@ -127,164 +160,226 @@ void ErrorDatabaseSqlite::reset_database() {
     }
 }
 
-void ErrorDatabaseSqlite::add_error(Everest::error::ErrorPtr error) {
-    std::lock_guard<std::mutex> lock(this->db_mutex);
-    this->add_error_without_mutex(error);
-}
-
-void ErrorDatabaseSqlite::add_error_without_mutex(Everest::error::ErrorPtr error) {
+void ErrorDatabaseSqlite::open_database() {
     BOOST_LOG_FUNCTION();
     try {
-        everest::db::sqlite::Connection db(this->db_path);
-        if (!db.open_connection()) {
+        auto connection = std::make_unique<everest::db::sqlite::Connection>(this->db_path);
+        if (!connection->open_connection()) {
             EVLOG_error << "Error opening database";
-            throw everest::db::ConnectionException(db.get_error_message());
+            throw everest::db::ConnectionException(connection->get_error_message());
         }
-        std::string sql = "INSERT INTO errors(uuid, type, description, message, origin_module, origin_implementation, "
-                          "timestamp, severity, state, sub_type, vendor_id) VALUES(";
-        sql += "?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10, ?11);";
-        auto stmt = db.new_statement(sql);
-        stmt->bind_text(1, error->uuid.to_string(), everest::db::sqlite::SQLiteString::Transient);
-        stmt->bind_text(2, error->type);
-        stmt->bind_text(3, error->description);
-        stmt->bind_text(4, error->message);
-        stmt->bind_text(5, error->origin.module_id);
-        stmt->bind_text(6, error->origin.implementation_id);
-        stmt->bind_text(7, Everest::Date::to_rfc3339(error->timestamp), everest::db::sqlite::SQLiteString::Transient);
-        stmt->bind_text(8, Everest::error::severity_to_string(error->severity),
-                        everest::db::sqlite::SQLiteString::Transient);
-        stmt->bind_text(9, Everest::error::state_to_string(error->state), everest::db::sqlite::SQLiteString::Transient);
-        stmt->bind_text(10, error->sub_type);
-        stmt->bind_text(11, error->vendor_id);
-        if (stmt->step() != SQLITE_DONE) {
-            throw everest::db::QueryExecutionException(db.get_error_message());
+        // the write-ahead log avoids a sync of the whole database on each commit
+        if (!connection->execute_statement("PRAGMA journal_mode=WAL;") ||
+            !connection->execute_statement("PRAGMA synchronous=NORMAL;")) {
+            EVLOG_warning << "Could not enable the write-ahead log, using the default journal";
         }
+        // indexes for the common filters, also added to databases created by older versions
+        const std::string sql = "CREATE INDEX IF NOT EXISTS errors_origin ON errors(origin_module, "
+                                "origin_implementation);"
+                                "CREATE INDEX IF NOT EXISTS errors_type ON errors(type);"
+                                "CREATE INDEX IF NOT EXISTS errors_state ON errors(state);"
+                                "CREATE INDEX IF NOT EXISTS errors_timestamp ON errors(timestamp);";
+        if (!connection->execute_statement(sql)) {
+            throw everest::db::QueryExecutionException(connection->get_error_message());
+        }
+        this->db = std::move(connection);
+    } catch (const std::exception& e) {
+        EVLOG_error << "Error opening the database: " << e.what();
+    }
+}
+
+everest::db::sqlite::Connection& ErrorDatabaseSqlite::get_connection() const {
+    if (this->db == nullptr) {
+        throw everest::db::ConnectionException("Database is not open");
+    }
+    return *this->db;
+}
+
+void ErrorDatabaseSqlite::add_error(Everest::error::ErrorPtr error) {
+    std::lock_guard<std::mutex> lock(this->db_mutex);
+    try {
+        this->add_error_without_mutex(error);
     } catch (const std::exception& e) {
         EVLOG_error << "Error adding error to database: " << e.what();
     }
 }
 
-std::string ErrorDatabaseSqlite::filter_to_sql_condition(const Everest::error::ErrorFilter& filter) {
-    std::string condition{};
+void ErrorDatabaseSqlite::add_error_without_mutex(Everest::error::ErrorPtr error) {
+    BOOST_LOG_FUNCTION();
+    auto& db = this->get_connection();
+    std::string sql = "INSERT INTO errors(" + ERROR_COLUMNS + ") VALUES(";
+    sql += "?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10, ?11);";
+    auto stmt = db.new_statement(sql);
+    stmt->bind_text(1, error->uuid.to_string(), everest::db::sqlite::SQLiteString::Transient);
+    stmt->bind_text(2, error->type);
+    stmt->bind_text(3, error->description);
+    stmt->bind_text(4, error->message);
+    stmt->bind_text(5, error->origin.module_id);
+    stmt->bind_text(6, error->origin.implementation_id);
+    stmt->bind_text(7, Everest::Date::to_rfc3339(error->timestamp), everest::db::sqlite::SQLiteString::Transient);
+    stmt->bind_text(8, Everest::error::severity_to_string(error->severity),
+                    everest::db::sqlite::SQLiteString::Transient);
+    stmt->bind_text(9, Everest::error::state_to_string(error->state), everest::db::sqlite::SQLiteString::Transient);
+    stmt->bind_text(10, error->sub_type);
+    stmt->bind_text(11, error->vendor_id);
+    if (stmt->step() != SQLITE_DONE) {
+        throw everest::db::QueryExecutionException(db.get_error_message());
+    }
+}
+
+void ErrorDatabaseSqlite::append_filter_condition(const Everest::error::ErrorFilter& filter,
+                                                  SqlCondition& condition) {
+    auto& values = condition.values;
     switch (filter.get_filter_type()) {
     case Everest::error::FilterType::State: {
-        condition = "(state = '" + Everest::error::state_to_string(filter.get_state_filter()) + "')";
+        condition.sql += "(state = ?)";
+        values.push_back(Everest::error::state_to_string(filter.get_state_filter()));
     } break;
     case Everest::error::FilterType::Origin: {
-        condition = "(origin_module = '" + filter.get_origin_filter().module_id + "' AND " +
-                    "origin_implementation = '" + filter.get_origin_filter().implementation_id + "')";
+        condition.sql += "(origin_module = ? AND origin_implementation = ?)";
+        values.push_back(filter.get_origin_filter().module_id);
+        values.push_back(filter.get_origin_filter().implementation_id);
     } break;
     case Everest::error::FilterType::Type: {
-        condition = "(type = '" + filter.get_type_filter().value + "')";
+        condition.sql += "(type = ?)";
+        values.push_back(filter.get_type_filter().value);
     } break;
     case Everest::error::FilterType::Severity: {
+        std::vector<Everest::error::Severity> severities;
         switch (filter.get_severity_filter()) {
         case Everest::error::SeverityFilter::LOW_GE: {
-            condition = "(severity = '" + Everest::error::severity_to_string(Everest::error::Severity::Low) +
-                        "' OR severity = '" + Everest::error::severity_to_string(Everest::error::Severity::Medium) +
-                        "' OR severity = '" + Everest::error::severity_to_string(Everest::error::Severity::High) + "')";
+            severities = {Everest::error::Severity::Low, Everest::error::Severity::Medium,
+                          Everest::error::Severity::High};
         } break;
         case Everest::error::SeverityFilter::MEDIUM_GE: {
-            condition = "(severity = '" + Everest::error::severity_to_string(Everest::error::Severity::Medium) +
-                        "' OR severity = '" + Everest::error::severity_to_string(Everest::error::Severity::High) + "')";
+            severities = {Everest::error::Severity::Medium, Everest::error::Severity::High};
         } break;
         case Everest::error::SeverityFilter::HIGH_GE: {
-            condition = "(severity = '" + Everest::error::severity_to_string(Everest::error::Severity::High) + "')";
+            severities = {Everest::error::Severity::High};
         } break;
         }
+        condition.sql += "(severity IN (";
+        for (std::size_t i = 0; i < severities.size(); ++i) {
+            condition.sql += (i == 0) ? "?" : ", ?";
+            values.push_back(Everest::error::severity_to_string(severities[i]));
+        }
+        condition.sql += "))";
     } break;
     case Everest::error::FilterType::TimePeriod: {
-        condition = "(timestamp BETWEEN '" + Everest::Date::to_rfc3339(filter.get_time_period_filter().from) +
-                    "' AND '" + Everest::Date::to_rfc3339(filter.get_time_period_filter().to) + "')";
+        condition.sql += "(timestamp BETWEEN ? AND ?)";
+        values.push_back(Everest::Date::to_rfc3339(filter.get_time_period_filter().from));
+        values.push_back(Everest::Date::to_rfc3339(filter.get_time_period_filter().to));
     } break;
     case Everest::error::FilterType::Handle: {
-        condition = "(uuid = '" + filter.get_handle_filter().to_string() + "')";
+        condition.sql += "(uuid = ?)";
+        values.push_back(filter.get_handle_filter().to_string());
     } break;
     case Everest::error::FilterType::SubType: {
-        condition = "(sub_type = '" + filter.get_sub_type_filter().value + "')";
+        condition.sql += "(sub_type = ?)";
+        values.push_back(filter.get_sub_type_filter().value);
     } break;
     case Everest::error::FilterType::VendorId: {
-        condition = "(vendor_id = '" + filter.get_vendor_id_filter().value + "')";
+        condition.sql += "(vendor_id = ?)";
+        values.push_back(filter.get_vendor_id_filter().value);
     } break;
     }
-    return condition;
 }
 
-std::optional<std::string>
+std::optional<ErrorDatabaseSqlite::SqlCondition>
 ErrorDatabaseSqlite::filters_to_sql_condition(const std::list<Everest::error::ErrorFilter>& filters) {
-    std::optional<std::string> condition = std::nullopt;
-    if (!filters.empty()) {
-        auto it = filters.begin();
-        condition = filter_to_sql_condition(*it);
-        it++;
-        while (it != filters.end()) {
-            condition = condition.value() + " AND " + ErrorDatabaseSqlite::filter_to_sql_condition(*it);
-            it++;
+    if (filters.empty()) {
+        return std::nullopt;
+    }
+    SqlCondition condition;
+    for (auto it = filters.begin(); it != filters.end(); ++it) {
+        if (it != filters.begin()) {
+            condition.sql += " AND ";
         }
+        ErrorDatabaseSqlite::append_filter_condition(*it, condition);
     }
     return condition;
 }
 
 std::list<Everest::error::ErrorPtr>
 ErrorDatabaseSqlite::get_errors(const std::list<Everest::error::ErrorFilter>& filters) const {
-    std::lock_guard<std::mutex> lock(this->db_mutex);
-    return this->get_errors(ErrorDatabaseSqlite::filters_to_sql_condition(filters));
+    std::list<Everest::error::ErrorPtr> result;
+    this->visit_errors(filters, [&result](const Everest::error::ErrorPtr& error) {
+        result.push_back(error);
+        return true;
+    });
+    return result;
 }
 
-std::list<Everest::error::ErrorPtr> ErrorDatabaseSqlite::get_errors(const std::optional<std::string>& condition) const {
-    BOOST_LOG_FUNCTION();
+std::list<Everest::error::ErrorPtr>
+ErrorDatabaseSqlite::get_errors(const std::list<Everest::error::ErrorFilter>& filters, const ErrorPage& page) const {
     std::list<Everest::error::ErrorPtr> result;
-    try {
-        everest::db::sqlite::Connection db(this->db_path);
-        if (!db.open_connection()) {
-            EVLOG_error << "Error opening database";
-            throw everest::db::ConnectionException(db.get_error_message());
-        }
-        std::string sql = "SELECT * FROM errors";
-        if (condition.has_value()) {
-            sql += " WHERE " + condition.value();
-        }
-        EVLOG_debug << "Executing SQL statement: " << sql;
-        auto stmt = db.new_statement(sql);
-        int status;
-        while ((status = stmt->step()) == SQLITE_ROW) {
-            const Everest::error::ErrorType err_type(std::get<std::string>(stmt->column_variant("type")));
-            const std::string err_description = std::get<std::string>(stmt->column_variant("description"));
-            const std::string err_msg = std::get<std::string>(stmt->column_variant("message"));
-            const std::string err_origin_module_id = std::get<std::string>(stmt->column_variant("origin_module"));
-            const std::string err_origin_impl_id = std::get<std::string>(stmt->column_variant("origin_implementation"));
-            const ImplementationIdentifier err_origin(err_origin_module_id, err_origin_impl_id);
-            const Everest::error::Error::time_point err_timestamp =
-                Everest::Date::from_rfc3339(std::get<std::string>(stmt->column_variant("timestamp")));
-            const Everest::error::Severity err_severity =
-                Everest::error::string_to_severity(std::get<std::string>(stmt->column_variant("severity")));
-            const Everest::error::State err_state =
-                Everest::error::string_to_state(std::get<std::string>(stmt->column_variant("state")));
-            const Everest::error::ErrorHandle err_handle(
-                Everest::error::ErrorHandle(std::get<std::string>(stmt->column_variant("uuid"))));
-            const Everest::error::ErrorSubType err_sub_type(std::get<std::string>(stmt->column_variant("sub_type")));
-            const std::string err_vendor_id = std::get<std::string>(stmt->column_variant("vendor_id"));
-            Everest::error::ErrorPtr error = std::make_shared<Everest::error::Error>(
-                err_type, err_sub_type, err_msg, err_description, err_origin, err_vendor_id, err_severity,
-                err_timestamp, err_handle, err_state);
+    this->visit_errors(
+        filters,
+        [&result](const Everest::error::ErrorPtr& error) {
             result.push_back(error);
-        }
-        if (status != SQLITE_DONE) {
-            throw everest::db::QueryExecutionException(db.get_error_message());
-        }
+            return true;
+        },
+        page);
+    return result;
+}
+
+void ErrorDatabaseSqlite::visit_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                                       const ErrorVisitor& visitor, const std::optional<ErrorPage>& page) const {
+    std::lock_guard<std::mutex> lock(this->db_mutex);
+    try {
+        this->visit_errors_without_mutex(ErrorDatabaseSqlite::filters_to_sql_condition(filters), page, visitor);
     } catch (const std::exception& e) {
         EVLOG_error << "Error getting errors from database: " << e.what();
     }
-    return result;
+}
+
+void ErrorDatabaseSqlite::visit_errors_without_mutex(const std::optional<SqlCondition>& condition,
+                                                     const std::optional<ErrorPage>& page,
+                                                     const ErrorVisitor& visitor) const {
+    BOOST_LOG_FUNCTION();
+    auto& db = this->get_connection();
+    std::string sql = "SELECT " + ERROR_COLUMNS + " FROM errors";
+    if (condition.has_value()) {
+        sql += " WHERE " + condition->sql;
+    }
+    sql += " ORDER BY timestamp, uuid";
+    if (page.has_value()) {
+        // sqlite limits are signed 64 bit integers
+        const auto limit = std::min<std::size_t>(page->limit, std::numeric_limits<int64_t>::max());
+        sql += " LIMIT " + std::to_string(limit) + " OFFSET " + std::to_string(page->offset);
+    }
+    EVLOG_debug << "Executing SQL statement: " << sql;
+    auto stmt = db.new_statement(sql);
+    if (condition.has_value()) {
+        bind_condition_values(*stmt, condition->values);
+    }
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        if (!visitor(read_error(*stmt))) {
+            return;
+        }
+    }
+    if (status != SQLITE_DONE) {
+        throw everest::db::QueryExecutionException(db.get_error_message());
+    }
 }
 
 std::list<Everest::error::ErrorPtr>
 ErrorDatabaseSqlite::edit_errors(const std::list<Everest::error::ErrorFilter>& filters, EditErrorFunc edit_func) {
     std::lock_guard<std::mutex> lock(this->db_mutex);
-    std::list<Everest::error::ErrorPtr> result = this->remove_errors_without_mutex(filters);
-    for (Everest::error::ErrorPtr& error : result) {
-        edit_func(error);
-        this->add_error_without_mutex(error);
+    std::list<Everest::error::ErrorPtr> result;
+    try {
+        // a single transaction, so that the errors are not missing if the edit fails half way
+        auto transaction = this->get_connection().begin_transaction();
+        result = this->remove_errors_without_mutex(ErrorDatabaseSqlite::filters_to_sql_condition(filters));
+        for (Everest::error::ErrorPtr& error : result) {
+            edit_func(error);
+            this->add_error_without_mutex(error);
+        }
+        transaction->commit();
+    } catch (const std::exception& e) {
+        EVLOG_error << "Error editing errors in database: " << e.what();
+        result.clear();
     }
     return result;
 }
@@ -292,27 +387,34 @@ ErrorDatabaseSqlite::edit_errors(const std::list<Everest::error::ErrorFilter>& f
 std::list<Everest::error::ErrorPtr>
 ErrorDatabaseSqlite::remove_errors(const std::list<Everest::error::ErrorFilter>& filters) {
     std::lock_guard<std::mutex> lock(this->db_mutex);
-    return this->remove_errors_without_mutex(filters);
+    std::list<Everest::error::ErrorPtr> result;
+    try {
+        result = this->remove_errors_without_mutex(ErrorDatabaseSqlite::filters_to_sql_condition(filters));
+    } catch (const std::exception& e) {
+        EVLOG_error << "Error removing errors from database: " << e.what();
+    }
+    return result;
 }
 
 std::list<Everest::error::ErrorPtr>
-ErrorDatabaseSqlite::remove_errors_without_mutex(const std::list<Everest::error::ErrorFilter>& filters) {
+ErrorDatabaseSqlite::remove_errors_without_mutex(const std::optional<SqlCondition>& condition) {
     BOOST_LOG_FUNCTION();
-    std::optional<std::string> condition = ErrorDatabaseSqlite::filters_to_sql_condition(filters);
-    std::list<Everest::error::ErrorPtr> result = this->get_errors(condition);
-    try {
-        everest::db::sqlite::Connection db(this->db_path);
-        if (!db.open_connection()) {
-            EVLOG_error << "Error opening database";
-            throw everest::db::ConnectionException(db.get_error_message());
-        }
-        std::string sql = "DELETE FROM errors";
-        if (condition.has_value()) {
-            sql += " WHERE " + condition.value();
-        }
-        db.execute_statement(sql);
-    } catch (const std::exception& e) {
-        EVLOG_error << "Error removing errors from database: " << e.what();
+    std::list<Everest::error::ErrorPtr> result;
+    this->visit_errors_without_mutex(condition, std::nullopt, [&result](const Everest::error::ErrorPtr& error) {
+        result.push_back(error);
+        return true;
+    });
+    auto& db = this->get_connection();
+    std::string sql = "DELETE FROM errors";
+    if (condition.has_value()) {
+        sql += " WHERE " + condition->sql;
+    }
+    auto stmt = db.new_statement(sql);
+    if (condition.has_value()) {
+        bind_condition_values(*stmt, condition->values);
+    }
+    if (stmt->step() != SQLITE_DONE) {
+        throw everest::db::QueryExecutionException(db.get_error_message());
     }
     return result;
 }
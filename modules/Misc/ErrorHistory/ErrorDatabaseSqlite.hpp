@@ -6,18 +6,46 @@
 
 #include <utils/error/error_database.hpp>
 
+#include <everest/database/sqlite/connection.hpp>
+
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 
 namespace module {
 
+///
+/// \brief A page of a query result, errors are ordered by timestamp
+///
+struct ErrorPage {
+    std::size_t limit;     ///< maximum number of errors in the page
+    std::size_t offset{0}; ///< number of errors skipped before the page
+};
+
 class ErrorDatabaseSqlite : public Everest::error::ErrorDatabase {
 public:
+    ///
+    /// \brief Called for each error of a query, returns false to stop the query
+    ///
+    using ErrorVisitor = std::function<bool(const Everest::error::ErrorPtr&)>;
+
     explicit ErrorDatabaseSqlite(const fs::path& db_path_, const bool reset_ = false);
 
     std::list<Everest::error::ErrorPtr>
     get_errors(const std::list<Everest::error::ErrorFilter>& filters) const override;
+    std::list<Everest::error::ErrorPtr> get_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                                                   const ErrorPage& page) const;
+    ///
+    /// \brief Streams the errors matching \p filters to \p visitor without collecting them first
+    /// \note The database is locked while \p visitor runs, so it must not call back into the database
+    ///
+    void visit_errors(const std::list<Everest::error::ErrorFilter>& filters, const ErrorVisitor& visitor,
+                      const std::optional<ErrorPage>& page = std::nullopt) const;
 
     void add_error(Everest::error::ErrorPtr error) override;
     std::list<Everest::error::ErrorPtr> edit_errors(const std::list<Everest::error::ErrorFilter>& filters,
@@ -25,17 +53,29 @@ public:
     std::list<Everest::error::ErrorPtr> remove_errors(const std::list<Everest::error::ErrorFilter>& filters) override;
 
 private:
+    ///
+    /// \brief WHERE clause with its values, which are bound to the ? parameters in order
+    ///
+    struct SqlCondition {
+        std::string sql;
+        std::vector<std::string> values;
+    };
+
     void add_error_without_mutex(Everest::error::ErrorPtr error);
-    std::list<Everest::error::ErrorPtr>
-    remove_errors_without_mutex(const std::list<Everest::error::ErrorFilter>& filters);
-    std::list<Everest::error::ErrorPtr> get_errors(const std::optional<std::string>& condition) const;
-    static std::string filter_to_sql_condition(const Everest::error::ErrorFilter& filter);
-    static std::optional<std::string> filters_to_sql_condition(const std::list<Everest::error::ErrorFilter>& filters);
+    std::list<Everest::error::ErrorPtr> remove_errors_without_mutex(const std::optional<SqlCondition>& condition);
+    void visit_errors_without_mutex(const std::optional<SqlCondition>& condition, const std::optional<ErrorPage>& page,
+                                    const ErrorVisitor& visitor) const;
+    static void append_filter_condition(const Everest::error::ErrorFilter& filter, SqlCondition& condition);
+    static std::optional<SqlCondition> filters_to_sql_condition(const std::list<Everest::error::ErrorFilter>& filters);
 
     void reset_database();
     void check_database();
+    void open_database();
+    everest::db::sqlite::Connection& get_connection() const;
     const fs::path db_path;
     mutable std::mutex db_mutex;
+    // kept open for the lifetime of the object, protected by db_mutex
+    std::unique_ptr<everest::db::sqlite::Connection> db;
 };
 
 } // namespace module
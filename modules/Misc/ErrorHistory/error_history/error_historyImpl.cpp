@@ -6,6 +6,7 @@
 #include "../ErrorDatabaseSqlite.hpp"
 
 #include <filesystem>
+#include <limits>
 
 namespace fs = std::filesystem;
 namespace module {
@@ -82,24 +83,34 @@ error_historyImpl::handle_get_errors(types::error_history::FilterArguments& filt
         Everest::error::HandleFilter handle_filter(filters.handle_filter.value());
         error_filters.push_back(Everest::error::ErrorFilter(handle_filter));
     }
-    std::list<Everest::error::ErrorPtr> errors = this->db->get_errors(error_filters);
+    std::optional<ErrorPage> page;
+    if (filters.limit.has_value() || filters.offset.has_value()) {
+        page = ErrorPage{filters.limit.has_value() ? static_cast<std::size_t>(filters.limit.value())
+                                                   : std::numeric_limits<std::size_t>::max(),
+                         static_cast<std::size_t>(filters.offset.value_or(0))};
+    }
     std::vector<types::error_history::ErrorObject> result;
-    std::transform(errors.begin(), errors.end(), std::back_inserter(result), [](Everest::error::ErrorPtr error) {
-        types::error_history::ErrorObject error_object;
-        error_object.uuid = error->uuid.to_string();
-        error_object.timestamp = Everest::Date::to_rfc3339(error->timestamp);
-        std::string string_state = Everest::error::state_to_string(error->state);
-        error_object.state = types::error_history::string_to_state(string_state);
-        std::string string_severity = Everest::error::severity_to_string(error->severity);
-        error_object.severity = types::error_history::string_to_severity(string_severity);
-        error_object.type = error->type;
-        error_object.sub_type = error->sub_type;
-        error_object.origin.module_id = error->origin.module_id;
-        error_object.origin.implementation_id = error->origin.implementation_id;
-        error_object.message = error->message;
-        error_object.description = error->description;
-        return error_object;
-    });
+    // convert the errors while they are read, instead of collecting them first
+    this->db->visit_errors(
+        error_filters,
+        [&result](const Everest::error::ErrorPtr& error) {
+            types::error_history::ErrorObject error_object;
+            error_object.uuid = error->uuid.to_string();
+            error_object.timestamp = Everest::Date::to_rfc3339(error->timestamp);
+            std::string string_state = Everest::error::state_to_string(error->state);
+            error_object.state = types::error_history::string_to_state(string_state);
+            std::string string_severity = Everest::error::severity_to_string(error->severity);
+            error_object.severity = types::error_history::string_to_severity(string_severity);
+            error_object.type = error->type;
+            error_object.sub_type = error->sub_type;
+            error_object.origin.module_id = error->origin.module_id;
+            error_object.origin.implementation_id = error->origin.implementation_id;
+            error_object.message = error->message;
+            error_object.description = error->description;
+            result.push_back(std::move(error_object));
+            return true;
+        },
+        page);
     return result;
 }
 
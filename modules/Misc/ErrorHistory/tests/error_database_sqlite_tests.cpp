@@ -275,6 +275,37 @@ SCENARIO("Check ErrorDatabaseSqlite class", "[!throws]") {
                 REQUIRE(errors.size() == 0);
             }
         }
+        WHEN("Getting a page of errors") {
+            auto errors = db.get_errors({}, module::ErrorPage{4, 3});
+            THEN("The result should contain the errors of the page ordered by timestamp") {
+                REQUIRE(errors.size() == 4);
+                auto it = errors.begin();
+                for (std::size_t i = 3; i < 7; ++i, ++it) {
+                    REQUIRE((*it)->uuid == test_errors[i]->uuid);
+                }
+            }
+        }
+        WHEN("Getting a filtered page of errors") {
+            auto errors = db.get_errors({Everest::error::ErrorFilter(Everest::error::SeverityFilter::HIGH_GE)},
+                                        module::ErrorPage{10, 2});
+            THEN("The page should be applied after filtering") {
+                std::vector<Everest::error::ErrorPtr> expected_errors({test_errors[10], test_errors[11]});
+                REQUIRE(errors.size() == 2);
+                check_expected_errors_in_list(expected_errors, errors);
+            }
+        }
+        WHEN("Stopping a streamed query early") {
+            std::vector<Everest::error::ErrorPtr> visited;
+            db.visit_errors({}, [&visited](const Everest::error::ErrorPtr& error) {
+                visited.push_back(error);
+                return visited.size() < 2;
+            });
+            THEN("Only the visited errors should be read") {
+                REQUIRE(visited.size() == 2);
+                REQUIRE(visited[0]->uuid == test_errors[0]->uuid);
+                REQUIRE(visited[1]->uuid == test_errors[1]->uuid);
+            }
+        }
         WHEN("Remove all errors") {
             std::list<Everest::error::ErrorFilter> filters = {};
             REQUIRE(db.get_errors(filters).size() > 0);
@@ -112,6 +112,8 @@ TestDatabase::TestDatabase(const fs::path& db_path_, const bool reset_) :
 }
 
 TestDatabase::~TestDatabase() {
+    // close the connection first, so that the write-ahead log is merged into the database file
+    db.reset();
     fs::remove(db_path);
 }
 
@@ -124,6 +126,16 @@ TestDatabase::get_errors(const std::list<Everest::error::ErrorFilter>& filters)
     return db->get_errors(filters);
 }
 
+std::list<Everest::error::ErrorPtr> TestDatabase::get_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                                                             const module::ErrorPage& page) const {
+    return db->get_errors(filters, page);
+}
+
+void TestDatabase::visit_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                                const module::ErrorDatabaseSqlite::ErrorVisitor& visitor) const {
+    db->visit_errors(filters, visitor);
+}
+
 std::list<Everest::error::ErrorPtr> TestDatabase::edit_errors(const std::list<Everest::error::ErrorFilter>& filters,
                                                               Everest::error::ErrorDatabase::EditErrorFunc edit_func) {
     return db->edit_errors(filters, edit_func);
@@ -48,6 +48,10 @@ public:
     ~TestDatabase();
     void add_error(Everest::error::ErrorPtr error);
     std::list<Everest::error::ErrorPtr> get_errors(const std::list<Everest::error::ErrorFilter>& filters) const;
+    std::list<Everest::error::ErrorPtr> get_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                                                   const module::ErrorPage& page) const;
+    void visit_errors(const std::list<Everest::error::ErrorFilter>& filters,
+                      const module::ErrorDatabaseSqlite::ErrorVisitor& visitor) const;
     std::list<Everest::error::ErrorPtr> edit_errors(const std::list<Everest::error::ErrorFilter>& filters,
                                                     Everest::error::ErrorDatabase::EditErrorFunc edit_func);
     std::list<Everest::error::ErrorPtr> remove_errors(const std::list<Everest::error::ErrorFilter>& filters);
@@ -6,108 +6,312 @@
 
 #include <fmt/chrono.h>
 
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+
 namespace module {
 
 const bool PROMISC_MODE = true;
 const int PACKET_BUFFER_TIMEOUT_MS = 1000;
 const int ALL_PACKETS_PROCESSED = -1;
-const int WAIT_FOR_MS = 10;
+const int POLL_TIMEOUT_MS = 100;
 const int BUFFERSIZE = 8192;
+const std::string CAPTURE_MODE_RING = "ring";
+
+namespace {
+std::vector<std::string> split_devices(const std::string& devices) {
+    std::vector<std::string> result;
+    std::size_t start = 0;
+    while (start <= devices.size()) {
+        auto end = devices.find(',', start);
+        if (end == std::string::npos) {
+            end = devices.size();
+        }
+        auto device = devices.substr(start, end - start);
+        device.erase(0, device.find_first_not_of(' '));
+        device.erase(device.find_last_not_of(' ') + 1);
+        result.push_back(device);
+        start = end + 1;
+    }
+    return result;
+}
+} // namespace
 
 void PacketSniffer::init() {
-    p_handle = pcap_open_live(config.device.c_str(), BUFFERSIZE, PROMISC_MODE, PACKET_BUFFER_TIMEOUT_MS, errbuf);
+    use_ring = (config.capture_mode == CAPTURE_MODE_RING);
+
+    auto devices = std::vector<std::string>(r_evse_manager.size(), config.device);
+    if (not config.evse_devices.empty()) {
+        devices = split_devices(config.evse_devices);
+        if (devices.size() != r_evse_manager.size()) {
+            EVLOG_error << fmt::format("evse_devices lists {} devices for {} evse managers, Sniffing disabled.",
+                                       devices.size(), r_evse_manager.size());
+            return;
+        }
+    }
+
+    // evse managers on the same device share one capture
+    std::map<std::string, CaptureSource*> sources_by_device;
+    for (const auto& device : devices) {
+        auto it = sources_by_device.find(device);
+        if (it == sources_by_device.end()) {
+            auto source = std::make_unique<CaptureSource>();
+            source->device = device;
+            if (not(use_ring ? open_ring(*source) : open_pcap(*source))) {
+                return;
+            }
+            EVLOG_info << fmt::format("Sniffing on device \"{}\"{}", device,
+                                      use_ring ? " using a TPACKET_V3 ring" : "");
+            it = sources_by_device.emplace(device, source.get()).first;
+            sources.push_back(std::move(source));
+        }
+        evse_sources.push_back(it->second);
+    }
+
+    if (config.compress_finished_files) {
+        compressor = std::make_unique<FileCompressor>();
+    }
+
+    for (std::size_t evse_index = 0; evse_index < r_evse_manager.size(); ++evse_index) {
+        r_evse_manager[evse_index]->subscribe_session_event(
+            [this, evse_index](types::evse_manager::SessionEvent session_event) {
+                if (session_event.event == types::evse_manager::SessionEventEnum::SessionStarted) {
+                    start_session(evse_index, session_event);
+                } else if (session_event.event == types::evse_manager::SessionEventEnum::SessionFinished) {
+                    stop_session(evse_index);
+                }
+            });
+    }
+
+    // one capture thread per device serves all sessions on it
+    for (auto& source : sources) {
+        std::thread(&PacketSniffer::capture_loop, this, std::ref(*source)).detach();
+    }
+}
+
+void PacketSniffer::ready() {
+}
+
+bool PacketSniffer::open_pcap(CaptureSource& source) {
+    char errbuf[PCAP_ERRBUF_SIZE]{""};
+    source.p_handle = pcap_open_live(source.device.c_str(), BUFFERSIZE, PROMISC_MODE, PACKET_BUFFER_TIMEOUT_MS, errbuf);
     std::string errb{errbuf};
-    if (p_handle == nullptr) {
-        EVLOG_error << fmt::format("Could not open device \"{}\", Sniffing disabled.{}", config.device,
+    if (source.p_handle == nullptr) {
+        EVLOG_error << fmt::format("Could not open device \"{}\", Sniffing disabled.{}", source.device,
                                    errb.size() > 0 ? (std::string(" Error: ") + errb) : "");
-        return;
+        return false;
     }
 
-    if (config.device != "any" && pcap_datalink(p_handle) != DLT_EN10MB) {
+    if (source.device != "any" && pcap_datalink(source.p_handle) != DLT_EN10MB) {
         EVLOG_error << fmt::format("Device \"{}\" doesn't provide Ethernet headers - not supported. Sniffing disabled.",
-                                   config.device);
-        pcap_close(p_handle);
-        return;
+                                   source.device);
+        pcap_close(source.p_handle);
+        return false;
     }
 
-    EVLOG_info << fmt::format("Sniffing on device \"{}\"", config.device);
+    if (pcap_setnonblock(source.p_handle, 1, errbuf) == PCAP_ERROR) {
+        EVLOG_error << fmt::format("Could not set device \"{}\" to non-blocking mode, Sniffing disabled. Error: {}",
+                                   source.device, errbuf);
+        pcap_close(source.p_handle);
+        return false;
+    }
 
-    r_evse_manager->subscribe_session_event([this](types::evse_manager::SessionEvent session_event) {
-        if (session_event.event == types::evse_manager::SessionEventEnum::SessionStarted) {
-            if (!already_started) {
+    source.link_type = pcap_datalink(source.p_handle);
+    return true;
+}
 
-                if (!session_event.session_started.has_value()) {
-                    EVLOG_warning
-                        << "SessionStarted event type doesn't contain session_started data. Ignoring this event.";
-                    return;
-                }
+bool PacketSniffer::open_ring(CaptureSource& source) {
+    RingCaptureConfig ring_config;
+    ring_config.block_size = static_cast<std::size_t>(config.ring_block_size_kb) * 1024;
+    ring_config.block_count = static_cast<std::size_t>(config.ring_block_count);
+    ring_config.block_timeout_ms = config.ring_block_timeout_ms;
+    ring_config.snap_length = BUFFERSIZE;
+    ring_config.promiscuous = PROMISC_MODE;
 
-                std::string logging_path;
-                if (!config.session_logging_path.empty()) {
-                    logging_path = config.session_logging_path;
-                } else if (session_event.session_started->logging_path.has_value()) {
-                    logging_path = session_event.session_started->logging_path.value();
-                } else {
-                    EVLOG_warning << "No logging path configured and none provided in SessionStarted event. "
-                                     "Skipping capture.";
-                    return;
-                }
+    if (not source.ring_capture.open(source.device, ring_config)) {
+        EVLOG_error << fmt::format("Could not open capture ring on device \"{}\", Sniffing disabled. Error: {}",
+                                   source.device, source.ring_capture.get_error());
+        return false;
+    }
 
-                capturing_stopped = false;
-                std::thread(&PacketSniffer::capture, this, logging_path, session_event.uuid).detach();
-            } else {
-                EVLOG_warning << fmt::format("Capturing already started. Ignoring this SessionStarted event");
-            }
-        } else if (session_event.event == types::evse_manager::SessionEventEnum::SessionFinished) {
-            capturing_stopped = true;
-            pcap_breakloop(p_handle);
+    source.link_type = DLT_EN10MB;
+    return true;
+}
+
+int PacketSniffer::poll_packets(CaptureSource& source, int timeout_ms) {
+    if (use_ring) {
+        return source.ring_capture.poll(timeout_ms);
+    }
+
+    struct pollfd poll_fd {};
+    poll_fd.fd = pcap_get_selectable_fd(source.p_handle);
+    poll_fd.events = POLLIN;
+    const auto ret = poll(&poll_fd, 1, timeout_ms);
+    if (ret == -1 and errno == EINTR) {
+        return 0;
+    }
+    return ret;
+}
+
+int PacketSniffer::dispatch_packets(CaptureSource& source, const RingCapture::PacketHandler& handler) {
+    if (use_ring) {
+        return source.ring_capture.dispatch(handler);
+    }
+
+    const auto pcap_handler = [](u_char* user, const struct pcap_pkthdr* header, const u_char* data) {
+        const CapturedPacket packet{static_cast<uint32_t>(header->ts.tv_sec), static_cast<uint32_t>(header->ts.tv_usec),
+                                    header->caplen, header->len, data};
+        (*reinterpret_cast<const RingCapture::PacketHandler*>(user))(packet);
+    };
+    return pcap_dispatch(source.p_handle, ALL_PACKETS_PROCESSED, pcap_handler,
+                         reinterpret_cast<u_char*>(const_cast<RingCapture::PacketHandler*>(&handler)));
+}
+
+std::vector<std::shared_ptr<PacketSniffer::CaptureSession>>
+PacketSniffer::get_sessions(const CaptureSource& source) {
+    std::vector<std::shared_ptr<CaptureSession>> result;
+    const std::lock_guard<std::mutex> lock(sessions_mutex);
+    for (const auto& session : sessions) {
+        if (session.second->source == &source) {
+            result.push_back(session.second);
         }
-    });
+    }
+    return result;
 }
 
-void PacketSniffer::ready() {
+void PacketSniffer::capture_loop(CaptureSource& source) {
+    std::vector<std::shared_ptr<CaptureSession>> active_sessions;
+    const RingCapture::PacketHandler write_to_sessions = [&active_sessions](const CapturedPacket& packet) {
+        for (auto& session : active_sessions) {
+            session->writer->write(packet);
+        }
+    };
+
+    while (true) {
+        const auto ready = poll_packets(source, POLL_TIMEOUT_MS);
+        if (ready < 0) {
+            EVLOG_error << fmt::format("Error waiting for packets on interface \"{}\": {}", source.device,
+                                       use_ring ? source.ring_capture.get_error() : strerror(errno));
+            break;
+        }
+
+        // frames of this device only go to the sessions of the evse managers on it. The files are written while
+        // holding the lock of each session, sessions on other devices and session events are not blocked by it
+        active_sessions = get_sessions(source);
+        std::vector<std::unique_lock<std::mutex>> session_locks;
+        for (auto& session : active_sessions) {
+            session_locks.emplace_back(session->mutex);
+        }
+
+        // packets are consumed even without an active session, so they don't pile up in the kernel
+        if (ready > 0) {
+            const auto ret = dispatch_packets(source, write_to_sessions);
+            if (ret < 0) {
+                EVLOG_error << fmt::format("Error reading packets from interface \"{}\", error: {}", source.device,
+                                           use_ring ? source.ring_capture.get_error() : pcap_geterr(source.p_handle));
+                break;
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& session : active_sessions) {
+            session->writer->poll(now);
+        }
+    }
 }
 
-void PacketSniffer::capture(const std::string& logpath, const std::string& session_id) {
-    already_started = true;
+void PacketSniffer::start_session(std::size_t evse_index, const types::evse_manager::SessionEvent& session_event) {
+    if (!session_event.session_started.has_value()) {
+        EVLOG_warning << "SessionStarted event type doesn't contain session_started data. Ignoring this event.";
+        return;
+    }
+
+    {
+        // session events of one evse are delivered in order, so no other capture can be started in between
+        const std::lock_guard<std::mutex> lock(sessions_mutex);
+        if (sessions.count(evse_index) != 0) {
+            EVLOG_warning << fmt::format("Capturing already started. Ignoring this SessionStarted event");
+            return;
+        }
+    }
+
+    std::string logging_path;
+    if (!config.session_logging_path.empty()) {
+        logging_path = config.session_logging_path;
+    } else if (session_event.session_started->logging_path.has_value()) {
+        logging_path = session_event.session_started->logging_path.value();
+    } else {
+        EVLOG_warning << "No logging path configured and none provided in SessionStarted event. "
+                         "Skipping capture.";
+        return;
+    }
 
-    std::string fn = fmt::format("{}/ethernet-traffic.pcap", logpath);
+    std::string base_path = fmt::format("{}/ethernet-traffic", logging_path);
     if (not config.session_logging_path.empty()) {
         const auto now = std::chrono::system_clock::now();
         const auto time_t_now = std::chrono::system_clock::to_time_t(now);
         std::tm local_tm{};
         localtime_r(&time_t_now, &local_tm);
         const auto timestamp = fmt::format("{:%Y-%m-%d_%H-%M-%S%z}", local_tm);
-        fn = fmt::format("{}/{}_{}.pcap", logpath, timestamp, session_id);
+        base_path = fmt::format("{}/{}_{}", logging_path, timestamp, session_event.uuid);
     }
 
-    EVLOG_info << fmt::format("Starting capturing to {}", fn);
+    CaptureFileLimits limits;
+    limits.max_file_size = static_cast<std::size_t>(config.max_file_size_kb) * 1024;
+    limits.max_file_duration = std::chrono::seconds(config.max_file_duration_s);
+    limits.max_files = static_cast<std::size_t>(config.max_files_per_session);
+    limits.flush_interval = std::chrono::seconds(config.flush_interval_s);
 
-    if ((pdumpfile = pcap_dump_open(p_handle, fn.c_str())) == nullptr) {
-        EVLOG_error << fmt::format("Error opening savefile {} for writing: {}", fn, pcap_geterr(p_handle));
+    CaptureWriter::FileFinishedCallback on_file_finished;
+    CaptureWriter::FileBusyCallback is_file_busy;
+    if (compressor) {
+        on_file_finished = [this](const std::string& path) { compressor->add(path); };
+        is_file_busy = [this](const std::string& path) { return compressor->is_pending(path); };
+    }
+
+    auto session = std::make_shared<CaptureSession>();
+    session->source = evse_sources.at(evse_index);
+    session->writer = std::make_unique<CaptureWriter>(base_path, session->source->link_type, BUFFERSIZE,
+                                                      static_cast<std::size_t>(config.write_buffer_kb) * 1024, limits,
+                                                      on_file_finished, is_file_busy);
+    if (not session->writer->open()) {
+        EVLOG_error << session->writer->get_error();
         return;
     }
 
-    while (!capturing_stopped) {
-        const int ret =
-            pcap_dispatch(p_handle, ALL_PACKETS_PROCESSED, &pcap_dump, reinterpret_cast<u_char*>(pdumpfile));
-        if (ret <= PCAP_ERROR) {
-            const std::string base_msg = fmt::format("Error reading packets from interface \"{}\"", config.device);
-            if (ret == PCAP_ERROR) {
-                EVLOG_error << fmt::format("{}, error: {}", base_msg, pcap_geterr(p_handle));
-            } else if (ret == PCAP_ERROR_BREAK) {
-                EVLOG_warning << fmt::format("{}, interrupted but no packets received", base_msg);
-            } else {
-                EVLOG_error << fmt::format("{}, unexpected error: {}", base_msg, ret);
-            }
-            break;
+    EVLOG_info << fmt::format("Starting capturing to {}", session->writer->get_current_path());
+    const std::lock_guard<std::mutex> lock(sessions_mutex);
+    sessions.emplace(evse_index, std::move(session));
+}
+
+void PacketSniffer::stop_session(std::size_t evse_index) {
+    std::shared_ptr<CaptureSession> session;
+    {
+        const std::lock_guard<std::mutex> lock(sessions_mutex);
+        const auto it = sessions.find(evse_index);
+        if (it == sessions.end()) {
+            return;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_FOR_MS));
+        session = std::move(it->second);
+        sessions.erase(it);
     }
 
-    pcap_dump_close(pdumpfile);
-    EVLOG_info << fmt::format("Stopped capturing to {}", fn);
-    already_started = false;
+    {
+        // the capture thread might still be writing frames it dispatched before the session was removed
+        const std::lock_guard<std::mutex> lock(session->mutex);
+        session->writer->close();
+    }
+    EVLOG_info << fmt::format("Stopped capturing to {}", session->writer->get_current_path());
+
+    if (use_ring) {
+        const auto dropped = session->source->ring_capture.get_dropped_packets();
+        if (dropped > 0) {
+            EVLOG_warning << fmt::format("{} packets dropped on device \"{}\" since the last session", dropped,
+                                         session->source->device);
+        }
+    }
 }
 
 } // namespace module
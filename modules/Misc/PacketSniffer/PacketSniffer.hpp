@@ -15,7 +15,16 @@
 
 // ev@4bf81b14-a215-475c-a1d3-0a484ae48918:v1
 // insert your custom include headers here
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <pcap.h>
+
+#include "capture_writer.hpp"
+#include "file_compressor.hpp"
+#include "ring_capture.hpp"
 // ev@4bf81b14-a215-475c-a1d3-0a484ae48918:v1
 
 namespace module {
@@ -23,15 +32,27 @@ namespace module {
 struct Conf {
     std::string device;
     std::string session_logging_path;
+    std::string capture_mode;
+    int ring_block_size_kb;
+    int ring_block_count;
+    int ring_block_timeout_ms;
+    int write_buffer_kb;
+    int max_file_size_kb;
+    int max_file_duration_s;
+    int max_files_per_session;
+    int flush_interval_s;
+    bool compress_finished_files;
+    std::string evse_devices;
 };
 
 class PacketSniffer : public Everest::ModuleBase {
 public:
     PacketSniffer() = delete;
-    PacketSniffer(const ModuleInfo& info, std::unique_ptr<evse_managerIntf> r_evse_manager, Conf& config) :
+    PacketSniffer(const ModuleInfo& info, std::vector<std::unique_ptr<evse_managerIntf>> r_evse_manager,
+                  Conf& config) :
         ModuleBase(info), r_evse_manager(std::move(r_evse_manager)), config(config){};
 
-    const std::unique_ptr<evse_managerIntf> r_evse_manager;
+    const std::vector<std::unique_ptr<evse_managerIntf>> r_evse_manager;
     const Conf& config;
 
     // ev@1fce4c5e-0ab8-41bb-90f7-14277703d2ac:v1
@@ -50,12 +71,39 @@ private:
 
     // ev@211cfdbe-f69a-4cd6-a4ec-f8aaa3d1b6c8:v1
     // insert your private definitions here
-    void capture(const std::string& logpath, const std::string& session_id);
-    pcap_t* p_handle{nullptr};
-    pcap_dumper_t* pdumpfile{nullptr};
-    char errbuf[PCAP_ERRBUF_SIZE]{""};
-    std::atomic_bool capturing_stopped{false};
-    std::atomic_bool already_started{false};
+    // one capture per device, serves the sessions of all evse managers on that device
+    struct CaptureSource {
+        std::string device;
+        pcap_t* p_handle{nullptr};
+        RingCapture ring_capture;
+        uint32_t link_type{DLT_EN10MB};
+    };
+
+    struct CaptureSession {
+        // held while frames are written, so the writer is not closed meanwhile
+        std::mutex mutex;
+        std::unique_ptr<CaptureWriter> writer;
+        // cppcheck-suppress unusedStructMember
+        CaptureSource* source{nullptr};
+    };
+
+    bool open_pcap(CaptureSource& source);
+    bool open_ring(CaptureSource& source);
+    int poll_packets(CaptureSource& source, int timeout_ms);
+    int dispatch_packets(CaptureSource& source, const RingCapture::PacketHandler& handler);
+    void capture_loop(CaptureSource& source);
+    std::vector<std::shared_ptr<CaptureSession>> get_sessions(const CaptureSource& source);
+    void start_session(std::size_t evse_index, const types::evse_manager::SessionEvent& session_event);
+    void stop_session(std::size_t evse_index);
+
+    bool use_ring{false};
+    std::vector<std::unique_ptr<CaptureSource>> sources;
+    // capture source of every evse manager connection
+    std::vector<CaptureSource*> evse_sources;
+    std::unique_ptr<FileCompressor> compressor;
+    // active capture per evse, the capture threads only hold this lock to look up the sessions of their device
+    std::mutex sessions_mutex;
+    std::map<std::size_t, std::shared_ptr<CaptureSession>> sessions;
     // ev@211cfdbe-f69a-4cd6-a4ec-f8aaa3d1b6c8:v1
 };
 
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include "capture_writer.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+#include <fmt/core.h>
+
+namespace module {
+
+namespace {
+const std::size_t WRITE_ALIGNMENT = 4096;
+const uint32_t PCAP_MAGIC = 0xA1B2C3D4;
+const uint16_t PCAP_VERSION_MAJOR = 2;
+const uint16_t PCAP_VERSION_MINOR = 4;
+
+struct PcapFileHeader {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct PcapRecordHeader {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+std::size_t align_up(std::size_t value) {
+    return ((value + WRITE_ALIGNMENT - 1) / WRITE_ALIGNMENT) * WRITE_ALIGNMENT;
+}
+} // namespace
+
+CaptureWriter::CaptureWriter(std::string base_path, uint32_t link_type, uint32_t snap_length,
+                             std::size_t write_buffer_size, const CaptureFileLimits& limits,
+                             FileFinishedCallback on_file_finished, FileBusyCallback is_file_busy) :
+    base_path(std::move(base_path)),
+    link_type(link_type),
+    snap_length(snap_length),
+    limits(limits),
+    on_file_finished(std::move(on_file_finished)),
+    is_file_busy(std::move(is_file_busy)) {
+    buffer_capacity = align_up(std::max<std::size_t>(write_buffer_size, WRITE_ALIGNMENT));
+    buffer.reset(static_cast<uint8_t*>(std::aligned_alloc(WRITE_ALIGNMENT, buffer_capacity)));
+}
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+bool CaptureWriter::open() {
+    if (buffer == nullptr) {
+        error = "Could not allocate the write buffer";
+        return false;
+    }
+    file_index = 0;
+    return open_file();
+}
+
+bool CaptureWriter::open_file() {
+    current_path = (file_index == 0) ? fmt::format("{}.pcap", base_path)
+                                     : fmt::format("{}.{}.pcap", base_path, file_index);
+
+    fd = ::open(current_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+        error = fmt::format("Could not open {} for writing: {}", current_path, strerror(errno));
+        return false;
+    }
+
+    file_size = 0;
+    file_offset = 0;
+    file_opened = std::chrono::steady_clock::now();
+    last_flush = file_opened;
+
+    const PcapFileHeader header{
+        PCAP_MAGIC, PCAP_VERSION_MAJOR, PCAP_VERSION_MINOR, 0, 0, snap_length, link_type,
+    };
+    append(&header, sizeof(header));
+    return true;
+}
+
+void CaptureWriter::write(const CapturedPacket& packet) {
+    if (fd == -1) {
+        return;
+    }
+
+    const auto captured_length = std::min(packet.captured_length, snap_length);
+    const auto record_size = sizeof(PcapRecordHeader) + captured_length;
+    if (limits.max_file_size != 0 and file_size > sizeof(PcapFileHeader) and
+        file_size + record_size > limits.max_file_size) {
+        rotate();
+        if (fd == -1) {
+            return;
+        }
+    }
+
+    const PcapRecordHeader header{packet.ts_sec, packet.ts_usec, captured_length, packet.original_length};
+    append(&header, sizeof(header));
+    append(packet.data, captured_length);
+}
+
+void CaptureWriter::poll(std::chrono::steady_clock::time_point now) {
+    if (fd == -1) {
+        return;
+    }
+
+    if (limits.max_file_duration.count() != 0 and now - file_opened >= limits.max_file_duration) {
+        rotate();
+        return;
+    }
+
+    if (now - last_flush >= limits.flush_interval) {
+        write_out(buffer_fill, true);
+        last_flush = now;
+    }
+}
+
+void CaptureWriter::close() {
+    if (fd == -1) {
+        return;
+    }
+    finish_file();
+}
+
+void CaptureWriter::rotate() {
+    finish_file();
+    ++file_index;
+    if (not open_file()) {
+        EVLOG_error << error;
+    }
+}
+
+void CaptureWriter::finish_file() {
+    write_out(buffer_fill, false);
+    ::close(fd);
+    fd = -1;
+
+    finished_files.push_back(current_path);
+    if (on_file_finished) {
+        on_file_finished(current_path);
+    }
+
+    remove_old_files();
+}
+
+void CaptureWriter::remove_old_files() {
+    auto it = finished_files.begin();
+    while (limits.max_files != 0 and finished_files.size() > limits.max_files and it != finished_files.end()) {
+        if (is_file_busy and is_file_busy(*it)) {
+            // e.g. still being compressed, removed on one of the next rotations
+            ++it;
+            continue;
+        }
+        // the file might have been compressed in the meantime
+        std::error_code ec;
+        std::filesystem::remove(*it, ec);
+        std::filesystem::remove(*it + ".gz", ec);
+        it = finished_files.erase(it);
+    }
+}
+
+void CaptureWriter::append(const void* data, std::size_t length) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    file_size += length;
+    while (length > 0) {
+        const auto chunk = std::min(length, buffer_capacity - buffer_fill);
+        memcpy(buffer.get() + buffer_fill, bytes, chunk);
+        buffer_fill += chunk;
+        bytes += chunk;
+        length -= chunk;
+        if (buffer_fill == buffer_capacity) {
+            write_out(buffer_capacity, false);
+        }
+    }
+}
+
+void CaptureWriter::write_out(std::size_t length, bool keep_tail) {
+    if (length == 0 or fd == -1) {
+        return;
+    }
+
+    std::size_t written = 0;
+    while (written < length) {
+        const auto ret = ::pwrite(fd, buffer.get() + written, length - written, file_offset + written);
+        if (ret == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            EVLOG_error << fmt::format("Could not write to {}: {}", current_path, strerror(errno));
+            break;
+        }
+        written += static_cast<std::size_t>(ret);
+    }
+
+    // only whole pages are dropped from the buffer, the tail of the last page is written again at the same offset
+    // together with the data that follows it, so that every write starts page aligned
+    const auto consumed = keep_tail ? (length / WRITE_ALIGNMENT) * WRITE_ALIGNMENT : length;
+    file_offset += consumed;
+    buffer_fill -= consumed;
+    memmove(buffer.get(), buffer.get() + consumed, buffer_fill);
+}
+
+} // namespace module
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef PACKET_SNIFFER_CAPTURE_WRITER_HPP
+#define PACKET_SNIFFER_CAPTURE_WRITER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "ring_capture.hpp"
+
+namespace module {
+
+struct CaptureFileLimits {
+    std::size_t max_file_size{0};               ///< rotate once a file would exceed this size in bytes, 0: unlimited
+    std::chrono::seconds max_file_duration{0};  ///< rotate once a file is older than this, 0: unlimited
+    std::size_t max_files{0};                   ///< number of finished files kept per session, 0: unlimited
+    std::chrono::seconds flush_interval{10};    ///< write out buffered data at least this often
+};
+
+///
+/// \brief Writes captured frames of one session into pcap files
+///
+/// Frames are collected in a page aligned buffer which is written out in multiples of the page size, so the file
+/// system sees few large, aligned writes instead of one small write per frame. The whole buffer is written out every
+/// flush interval, so a capture is never more than this interval behind. The unaligned tail of such a flush stays in
+/// the buffer and is written again with the next write, which starts at the same aligned file offset, so every write
+/// starts on a page boundary. Files are rotated according to the configured
+/// limits; every finished file is reported through the file finished callback, e.g. for compression. Old files that
+/// are still in use according to the file busy callback are kept until a later rotation.
+///
+class CaptureWriter {
+public:
+    using FileFinishedCallback = std::function<void(const std::string& path)>;
+    using FileBusyCallback = std::function<bool(const std::string& path)>;
+
+    ///
+    /// \brief Creates a writer for files named \p base_path.pcap, rotated files are named \p base_path.N.pcap
+    ///
+    CaptureWriter(std::string base_path, uint32_t link_type, uint32_t snap_length, std::size_t write_buffer_size,
+                  const CaptureFileLimits& limits, FileFinishedCallback on_file_finished,
+                  FileBusyCallback is_file_busy = nullptr);
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+    ~CaptureWriter();
+
+    ///
+    /// \brief Opens the first file
+    ///
+    /// \returns false on failure, get_error() describes the reason
+    bool open();
+
+    void write(const CapturedPacket& packet);
+
+    ///
+    /// \brief Applies the time based limits and the flush interval, needs to be called regularly
+    ///
+    void poll(std::chrono::steady_clock::time_point now);
+
+    ///
+    /// \brief Writes out all buffered data and finishes the current file
+    ///
+    void close();
+
+    const std::string& get_current_path() const {
+        return current_path;
+    }
+
+    const std::string& get_error() const {
+        return error;
+    }
+
+private:
+    bool open_file();
+    void finish_file();
+    void rotate();
+    void append(const void* data, std::size_t length);
+    void write_out(std::size_t length, bool keep_tail);
+    void remove_old_files();
+
+    const std::string base_path;
+    const uint32_t link_type;
+    const uint32_t snap_length;
+    const CaptureFileLimits limits;
+    const FileFinishedCallback on_file_finished;
+    const FileBusyCallback is_file_busy;
+
+    std::unique_ptr<uint8_t, decltype(&std::free)> buffer{nullptr, &std::free};
+    std::size_t buffer_capacity{0};
+    std::size_t buffer_fill{0};
+
+    int fd{-1};
+    std::size_t file_index{0};
+    std::size_t file_size{0};
+    std::size_t file_offset{0}; // offset of the start of the buffer in the file, always page aligned
+    std::string current_path;
+    std::chrono::steady_clock::time_point file_opened;
+    std::chrono::steady_clock::time_point last_flush;
+    std::deque<std::string> finished_files;
+    std::string error;
+};
+
+} // namespace module
+
+#endif // PACKET_SNIFFER_CAPTURE_WRITER_HPP
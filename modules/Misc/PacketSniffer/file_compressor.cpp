@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include "file_compressor.hpp"
+
+#include <algorithm>
+
+#include <everest/logging.hpp>
+#include <everest/run_application/run_application.hpp>
+#include <fmt/core.h>
+
+namespace module {
+
+FileCompressor::FileCompressor() : worker(&FileCompressor::run, this) {
+}
+
+FileCompressor::~FileCompressor() {
+    {
+        const std::lock_guard<std::mutex> lock(queue_mutex);
+        running = false;
+    }
+    queue_cv.notify_one();
+    worker.join();
+}
+
+void FileCompressor::add(const std::string& path) {
+    {
+        const std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back(path);
+    }
+    queue_cv.notify_one();
+}
+
+bool FileCompressor::is_pending(const std::string& path) {
+    const std::lock_guard<std::mutex> lock(queue_mutex);
+    return path == compressing or std::find(queue.begin(), queue.end(), path) != queue.end();
+}
+
+void FileCompressor::run() {
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this]() { return not queue.empty() or not running; });
+            if (queue.empty()) {
+                return;
+            }
+            path = std::move(queue.front());
+            queue.pop_front();
+            compressing = path;
+        }
+
+        const auto result = everest::run_application::run_application("gzip", {"-f", path});
+        if (result.exit_code != 0) {
+            EVLOG_warning << fmt::format("Could not compress {}, gzip exited with {}", path, result.exit_code);
+        } else {
+            EVLOG_debug << fmt::format("Compressed {}", path);
+        }
+
+        const std::lock_guard<std::mutex> lock(queue_mutex);
+        compressing.clear();
+    }
+}
+
+} // namespace module
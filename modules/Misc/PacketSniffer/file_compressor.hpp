@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef PACKET_SNIFFER_FILE_COMPRESSOR_HPP
+#define PACKET_SNIFFER_FILE_COMPRESSOR_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace module {
+
+///
+/// \brief Compresses finished capture files with gzip in a background thread, so that neither the capture thread
+/// nor the session event handlers are blocked by it
+///
+class FileCompressor {
+public:
+    FileCompressor();
+    FileCompressor(const FileCompressor&) = delete;
+    FileCompressor& operator=(const FileCompressor&) = delete;
+    ///
+    /// \brief Compresses all files that are still queued before returning
+    ///
+    ~FileCompressor();
+
+    ///
+    /// \brief Queues \p path for compression, it is replaced by \p path.gz once done
+    ///
+    void add(const std::string& path);
+
+    ///
+    /// \brief Checks whether \p path is queued or currently being compressed
+    ///
+    bool is_pending(const std::string& path);
+
+private:
+    void run();
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<std::string> queue;
+    std::string compressing;
+    bool running{true};
+    std::thread worker;
+};
+
+} // namespace module
+
+#endif // PACKET_SNIFFER_FILE_COMPRESSOR_HPP
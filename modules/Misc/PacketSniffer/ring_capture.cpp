@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include "ring_capture.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace module {
+
+namespace {
+const unsigned int RING_FRAME_SIZE = TPACKET_ALIGNMENT << 7;
+
+std::string errno_message(const std::string& what) {
+    return what + ": " + strerror(errno);
+}
+
+bool is_owned_by_user(const struct tpacket_block_desc* block) {
+    return (__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) != 0;
+}
+} // namespace
+
+RingCapture::~RingCapture() {
+    close();
+}
+
+void RingCapture::close() {
+    if (ring != nullptr) {
+        munmap(ring, ring_size);
+        ring = nullptr;
+    }
+    if (socket_fd != -1) {
+        ::close(socket_fd);
+        socket_fd = -1;
+    }
+}
+
+bool RingCapture::open(const std::string& device, const RingCaptureConfig& config) {
+    close();
+
+    const auto if_index = if_nametoindex(device.c_str());
+    if (if_index == 0) {
+        error = errno_message("Unknown interface " + device);
+        return false;
+    }
+
+    socket_fd = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+    if (socket_fd == -1) {
+        error = errno_message("Could not create packet socket");
+        return false;
+    }
+
+    int version = TPACKET_V3;
+    if (-1 == setsockopt(socket_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version))) {
+        error = errno_message("TPACKET_V3 not supported");
+        close();
+        return false;
+    }
+
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto block_size = ((config.block_size + page_size - 1) / page_size) * page_size;
+
+    request = {};
+    request.tp_block_size = static_cast<unsigned int>(block_size);
+    request.tp_block_nr = static_cast<unsigned int>(config.block_count);
+    request.tp_frame_size = RING_FRAME_SIZE;
+    request.tp_frame_nr = static_cast<unsigned int>((block_size * config.block_count) / RING_FRAME_SIZE);
+    request.tp_retire_blk_tov = static_cast<unsigned int>(config.block_timeout_ms);
+
+    if (-1 == setsockopt(socket_fd, SOL_PACKET, PACKET_RX_RING, &request, sizeof(request))) {
+        error = errno_message("Could not set up PACKET_RX_RING");
+        close();
+        return false;
+    }
+
+    ring_size = block_size * config.block_count;
+    void* mapped = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, socket_fd, 0);
+    if (mapped == MAP_FAILED) {
+        // locking the ring might exceed RLIMIT_MEMLOCK, it works without locking as well
+        mapped = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, socket_fd, 0);
+    }
+    if (mapped == MAP_FAILED) {
+        error = errno_message("Could not map the capture ring");
+        ring_size = 0;
+        close();
+        return false;
+    }
+    ring = static_cast<uint8_t*>(mapped);
+    current_block = 0;
+
+    struct sockaddr_ll sock_addr {};
+    sock_addr.sll_family = AF_PACKET;
+    sock_addr.sll_protocol = htons(ETH_P_ALL);
+    sock_addr.sll_ifindex = static_cast<int>(if_index);
+    if (-1 == bind(socket_fd, reinterpret_cast<struct sockaddr*>(&sock_addr), sizeof(sock_addr))) {
+        error = errno_message("Could not bind to " + device);
+        close();
+        return false;
+    }
+
+    if (config.promiscuous) {
+        struct packet_mreq membership {};
+        membership.mr_ifindex = static_cast<int>(if_index);
+        membership.mr_type = PACKET_MR_PROMISC;
+        if (-1 == setsockopt(socket_fd, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &membership, sizeof(membership))) {
+            error = errno_message("Could not enable promiscuous mode on " + device);
+            close();
+            return false;
+        }
+    }
+
+    snap_length = config.snap_length;
+    return true;
+}
+
+int RingCapture::poll(int timeout_ms) {
+    if (ring == nullptr) {
+        error = "Capture ring is not open";
+        return -1;
+    }
+
+    const auto* block = reinterpret_cast<struct tpacket_block_desc*>(ring + current_block * request.tp_block_size);
+    if (is_owned_by_user(block)) {
+        return 1;
+    }
+
+    struct pollfd poll_fd {};
+    poll_fd.fd = socket_fd;
+    poll_fd.events = POLLIN | POLLERR;
+    if (-1 == ::poll(&poll_fd, 1, timeout_ms)) {
+        if (errno == EINTR) {
+            return 0;
+        }
+        error = errno_message("poll() failed");
+        return -1;
+    }
+
+    return is_owned_by_user(block) ? 1 : 0;
+}
+
+int RingCapture::dispatch(const PacketHandler& handler) {
+    if (ring == nullptr) {
+        error = "Capture ring is not open";
+        return -1;
+    }
+
+    auto* block = reinterpret_cast<struct tpacket_block_desc*>(ring + current_block * request.tp_block_size);
+    int handled = 0;
+    // process the blocks that are ready in ring order, but at most one round so that callers get back control
+    for (std::size_t processed_blocks = 0; processed_blocks < request.tp_block_nr and is_owned_by_user(block);
+         ++processed_blocks) {
+        const auto num_packets = block->hdr.bh1.num_pkts;
+        auto* header = reinterpret_cast<struct tpacket3_hdr*>(reinterpret_cast<uint8_t*>(block) +
+                                                               block->hdr.bh1.offset_to_first_pkt);
+        for (uint32_t i = 0; i < num_packets; ++i) {
+            CapturedPacket packet{};
+            packet.ts_sec = header->tp_sec;
+            packet.ts_usec = header->tp_nsec / 1000;
+            packet.captured_length = std::min(header->tp_snaplen, snap_length);
+            packet.original_length = header->tp_len;
+            packet.data = reinterpret_cast<const uint8_t*>(header) + header->tp_mac;
+            handler(packet);
+            ++handled;
+            header = reinterpret_cast<struct tpacket3_hdr*>(reinterpret_cast<uint8_t*>(header) +
+                                                            header->tp_next_offset);
+        }
+
+        // give the block back to the kernel
+        __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+        current_block = (current_block + 1) % request.tp_block_nr;
+        block = reinterpret_cast<struct tpacket_block_desc*>(ring + current_block * request.tp_block_size);
+    }
+
+    return handled;
+}
+
+uint32_t RingCapture::get_dropped_packets() {
+    struct tpacket_stats_v3 stats {};
+    socklen_t length = sizeof(stats);
+    if (socket_fd == -1 or -1 == getsockopt(socket_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &length)) {
+        return 0;
+    }
+    return stats.tp_drops;
+}
+
+} // namespace module
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef PACKET_SNIFFER_RING_CAPTURE_HPP
+#define PACKET_SNIFFER_RING_CAPTURE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <linux/if_packet.h>
+
+namespace module {
+
+struct CapturedPacket {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t captured_length;
+    uint32_t original_length;
+    const uint8_t* data;
+};
+
+struct RingCaptureConfig {
+    std::size_t block_size{128 * 1024}; // must be a multiple of the page size
+    std::size_t block_count{16};
+    int block_timeout_ms{100}; // a partially filled block is handed over to user space after this timeout
+    uint32_t snap_length{8192};
+    bool promiscuous{true};
+};
+
+///
+/// \brief Captures all frames of an interface through a memory mapped TPACKET_V3 ring
+///
+/// The kernel fills whole blocks of frames, so user space only wakes up once per block (or block timeout) instead
+/// of once per frame and frames are not copied by a read system call.
+///
+class RingCapture {
+public:
+    using PacketHandler = std::function<void(const CapturedPacket&)>;
+
+    RingCapture() = default;
+    RingCapture(const RingCapture&) = delete;
+    RingCapture& operator=(const RingCapture&) = delete;
+    ~RingCapture();
+
+    ///
+    /// \brief Opens the ring on \p device
+    ///
+    /// \returns false on failure, get_error() describes the reason
+    bool open(const std::string& device, const RingCaptureConfig& config);
+
+    ///
+    /// \brief Waits up to \p timeout_ms for a filled block
+    ///
+    /// \returns 1 if a block is ready, 0 on timeout and -1 on failure
+    int poll(int timeout_ms);
+
+    ///
+    /// \brief Calls \p handler for every frame in the blocks that are ready and hands them back to the kernel
+    ///
+    /// \returns the number of frames handled or -1 on failure
+    int dispatch(const PacketHandler& handler);
+
+    ///
+    /// \returns the number of frames the kernel dropped because the ring was full since the last call
+    uint32_t get_dropped_packets();
+
+    const std::string& get_error() const {
+        return error;
+    }
+
+private:
+    void close();
+
+    int socket_fd{-1};
+    uint8_t* ring{nullptr};
+    std::size_t ring_size{0};
+    struct tpacket_req3 request {};
+    std::size_t current_block{0};
+    uint32_t snap_length{0};
+    std::string error;
+};
+
+} // namespace module
+
+#endif // PACKET_SNIFFER_RING_CAPTURE_HPP
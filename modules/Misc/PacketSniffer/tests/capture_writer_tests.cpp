@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include "capture_writer.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+using namespace module;
+
+const std::size_t PAGE_SIZE = 4096;
+const std::size_t FILE_HEADER_SIZE = 24;
+const std::size_t RECORD_HEADER_SIZE = 16;
+const uint32_t LINK_TYPE_ETHERNET = 1;
+const uint32_t SNAP_LENGTH = 65535;
+
+class CaptureWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+                    ("capture_writer_tests_" + std::to_string(getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        base_path = (directory / "session").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    void write_packet(CaptureWriter& writer, std::size_t payload_size) {
+        payload.assign(payload_size, 0xAB);
+        const CapturedPacket packet{1, 2, static_cast<uint32_t>(payload_size), static_cast<uint32_t>(payload_size),
+                                    payload.data()};
+        writer.write(packet);
+    }
+
+    std::string path(std::size_t index) const {
+        return (index == 0) ? base_path + ".pcap" : base_path + "." + std::to_string(index) + ".pcap";
+    }
+
+    std::filesystem::path directory;
+    std::string base_path;
+    std::vector<uint8_t> payload;
+};
+
+TEST_F(CaptureWriterTest, WritesWholePagesOnly) {
+    CaptureWriter writer(base_path, LINK_TYPE_ETHERNET, SNAP_LENGTH, 2 * PAGE_SIZE, {}, nullptr);
+    ASSERT_TRUE(writer.open());
+
+    // 24 + 10 * (16 + 1000) bytes, more than the buffer of two pages
+    for (int i = 0; i < 10; ++i) {
+        write_packet(writer, 1000);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path(0)), 2 * PAGE_SIZE);
+
+    writer.close();
+    EXPECT_EQ(std::filesystem::file_size(path(0)), FILE_HEADER_SIZE + 10 * (RECORD_HEADER_SIZE + 1000));
+}
+
+TEST_F(CaptureWriterTest, FlushIntervalWritesAllBufferedData) {
+    CaptureFileLimits limits;
+    limits.flush_interval = std::chrono::seconds(10);
+    CaptureWriter writer(base_path, LINK_TYPE_ETHERNET, SNAP_LENGTH, 2 * PAGE_SIZE, limits, nullptr);
+    ASSERT_TRUE(writer.open());
+
+    write_packet(writer, 100);
+    const auto buffered = FILE_HEADER_SIZE + RECORD_HEADER_SIZE + 100;
+
+    writer.poll(std::chrono::steady_clock::now());
+    EXPECT_EQ(std::filesystem::file_size(path(0)), 0);
+
+    writer.poll(std::chrono::steady_clock::now() + std::chrono::seconds(11));
+    EXPECT_EQ(std::filesystem::file_size(path(0)), buffered);
+
+    // data after an unaligned flush is still appended in order
+    write_packet(writer, 100);
+    writer.close();
+    EXPECT_EQ(std::filesystem::file_size(path(0)), buffered + RECORD_HEADER_SIZE + 100);
+}
+
+TEST_F(CaptureWriterTest, FlushIntervalKeepsLaterWritesAligned) {
+    CaptureFileLimits limits;
+    limits.flush_interval = std::chrono::seconds(10);
+    CaptureWriter writer(base_path, LINK_TYPE_ETHERNET, SNAP_LENGTH, 2 * PAGE_SIZE, limits, nullptr);
+    ASSERT_TRUE(writer.open());
+
+    write_packet(writer, 100);
+    writer.poll(std::chrono::steady_clock::now() + std::chrono::seconds(11));
+    const auto flushed = FILE_HEADER_SIZE + RECORD_HEADER_SIZE + 100;
+    EXPECT_EQ(std::filesystem::file_size(path(0)), flushed);
+
+    // the flushed tail is written again with the next full buffer, which starts at offset 0 again
+    for (int i = 0; i < 10; ++i) {
+        write_packet(writer, 1000);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path(0)), 2 * PAGE_SIZE);
+
+    writer.close();
+    const auto total = flushed + 10 * (RECORD_HEADER_SIZE + 1000);
+    ASSERT_EQ(std::filesystem::file_size(path(0)), total);
+
+    // all records are intact
+    std::ifstream file(path(0), std::ios::binary);
+    std::vector<uint8_t> content(total);
+    file.read(reinterpret_cast<char*>(content.data()), total);
+    std::size_t offset = FILE_HEADER_SIZE;
+    std::vector<uint32_t> lengths;
+    while (offset < total) {
+        uint32_t length = 0;
+        memcpy(&length, content.data() + offset + 8, sizeof(length));
+        lengths.push_back(length);
+        EXPECT_EQ(content[offset + RECORD_HEADER_SIZE], 0xAB);
+        offset += RECORD_HEADER_SIZE + length;
+    }
+    EXPECT_EQ(offset, total);
+    EXPECT_EQ(lengths.size(), 11);
+    EXPECT_EQ(lengths.front(), 100);
+}
+
+TEST_F(CaptureWriterTest, RotationKeepsMaxFiles) {
+    CaptureFileLimits limits;
+    limits.max_file_size = 1024;
+    limits.max_files = 2;
+    std::vector<std::string> finished;
+    CaptureWriter writer(base_path, LINK_TYPE_ETHERNET, SNAP_LENGTH, PAGE_SIZE, limits,
+                         [&finished](const std::string& path) { finished.push_back(path); });
+    ASSERT_TRUE(writer.open());
+
+    // every packet exceeds the file size limit together with the previous one, so each gets its own file
+    for (int i = 0; i < 5; ++i) {
+        write_packet(writer, 600);
+    }
+    EXPECT_EQ(writer.get_current_path(), path(4));
+    EXPECT_EQ(finished, (std::vector<std::string>{path(0), path(1), path(2), path(3)}));
+
+    EXPECT_FALSE(std::filesystem::exists(path(0)));
+    EXPECT_FALSE(std::filesystem::exists(path(1)));
+    EXPECT_TRUE(std::filesystem::exists(path(2)));
+    EXPECT_TRUE(std::filesystem::exists(path(3)));
+    EXPECT_TRUE(std::filesystem::exists(path(4)));
+}
+
+TEST_F(CaptureWriterTest, RotationSkipsBusyFiles) {
+    CaptureFileLimits limits;
+    limits.max_file_size = 1024;
+    limits.max_files = 1;
+    bool first_busy = true;
+    CaptureWriter writer(
+        base_path, LINK_TYPE_ETHERNET, SNAP_LENGTH, PAGE_SIZE, limits, nullptr,
+        [this, &first_busy](const std::string& path) { return first_busy and path == this->path(0); });
+    ASSERT_TRUE(writer.open());
+
+    for (int i = 0; i < 3; ++i) {
+        write_packet(writer, 600);
+    }
+    // the first file is still busy, so the next older one is removed instead
+    EXPECT_TRUE(std::filesystem::exists(path(0)));
+    EXPECT_FALSE(std::filesystem::exists(path(1)));
+    EXPECT_TRUE(std::filesystem::exists(path(2)));
+
+    // once it is not busy anymore, it is removed on the next rotation
+    first_busy = false;
+    write_packet(writer, 600);
+    EXPECT_FALSE(std::filesystem::exists(path(0)));
+    EXPECT_TRUE(std::filesystem::exists(path(2)));
+    EXPECT_TRUE(std::filesystem::exists(path(3)));
+}
+
+} // namespace
@@ -21,6 +21,7 @@ namespace module {
 
 struct Conf {
     std::string sqlite_db_file_path;
+    int write_back_interval_ms;
 };
 
 class PersistentStore : public Everest::ModuleBase {
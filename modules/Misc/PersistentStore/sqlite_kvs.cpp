@@ -0,0 +1,381 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include "sqlite_kvs.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <everest/logging.hpp>
+
+namespace fs = std::filesystem;
+
+namespace module {
+
+namespace {
+
+const std::chrono::milliseconds SHUTDOWN_RETRY_INTERVAL{100};
+const std::chrono::milliseconds DESTRUCTOR_SHUTDOWN_TIMEOUT{1000};
+
+/**
+ * Wrapper class around a sqlite3_stmt pointer to ensure it is always
+ * finalised via sqlite3_finalize()
+ */
+class Sqlite3_Stmt {
+private:
+    sqlite3_stmt* m_statement_ptr = nullptr;
+
+public:
+    void finalize(const char* error_message = nullptr) {
+        const auto res = sqlite3_finalize(m_statement_ptr);
+        m_statement_ptr = nullptr; // prevent double free
+        if (res != SQLITE_OK) {
+            if (error_message != nullptr) {
+                EVLOG_error << error_message;
+            }
+            throw std::runtime_error("PersistentStore db access error");
+        }
+    }
+
+    ~Sqlite3_Stmt() {
+        (void)sqlite3_finalize(m_statement_ptr);
+    }
+
+    constexpr operator sqlite3_stmt*() {
+        return m_statement_ptr;
+    }
+
+    constexpr operator sqlite3_stmt**() {
+        return &m_statement_ptr;
+    }
+
+    constexpr sqlite3_stmt** operator&() {
+        return &m_statement_ptr;
+    }
+};
+
+void execute(sqlite3* db, const char* sql) {
+    char* error = nullptr;
+    if (sqlite3_exec(db, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+        EVLOG_error << "Could not execute '" << sql << "': " << (error != nullptr ? error : sqlite3_errmsg(db));
+        sqlite3_free(error);
+        throw std::runtime_error("PersistentStore db access error");
+    }
+}
+
+class TypeNameVisitor {
+public:
+    std::string operator()(std::nullptr_t t) const {
+        return "nullptr_t";
+    }
+
+    std::string operator()(const Array& t) const {
+        return "Array";
+    }
+
+    std::string operator()(const Object& t) const {
+        return "Object";
+    }
+
+    std::string operator()(const bool& t) const {
+        return "bool";
+    }
+
+    std::string operator()(const double& t) const {
+        return "double";
+    }
+
+    std::string operator()(const int& t) const {
+        return "int";
+    }
+
+    std::string operator()(const std::string& t) const {
+        return "std::string";
+    }
+};
+
+/**
+ * Values are stored as CBOR blobs, the TYPE column selects the alternative of the variant
+ */
+std::vector<std::uint8_t> encode_value(const KvsValue& value) {
+    return json::to_cbor(std::visit([](const auto& v) { return json(v); }, value));
+}
+
+KvsValue decode_value(const std::string& type, const json& value) {
+    if (type == "Array") {
+        return value.get<Array>();
+    } else if (type == "Object") {
+        return value.get<Object>();
+    } else if (type == "bool") {
+        return value.get<bool>();
+    } else if (type == "double") {
+        return value.get<double>();
+    } else if (type == "int") {
+        return value.get<int>();
+    } else if (type == "std::string") {
+        return value.get<std::string>();
+    }
+    return nullptr;
+}
+
+/**
+ * Values written before the CBOR encoding are text
+ */
+KvsValue decode_text_value(const std::string& type, const std::string& value) {
+    if (type == "Array" or type == "Object") {
+        return decode_value(type, json::parse(value));
+    } else if (type == "bool") {
+        return value == "true";
+    } else if (type == "double") {
+        return std::stod(value);
+    } else if (type == "int") {
+        return std::stoi(value);
+    } else if (type == "std::string") {
+        return value;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+SqliteKvs::SqliteKvs(const fs::path& db_path, std::chrono::milliseconds write_back_interval) :
+    write_back_interval(write_back_interval) {
+    // open and initialize database
+    const fs::path sqlite_db_path = fs::absolute(db_path);
+    const fs::path database_directory = sqlite_db_path.parent_path();
+    if (!fs::exists(database_directory)) {
+        fs::create_directories(database_directory);
+    }
+
+    if (sqlite3_open(sqlite_db_path.c_str(), &this->db) != SQLITE_OK) {
+        EVLOG_error << "Error opening PersistentStore database '" << sqlite_db_path << "': " << sqlite3_errmsg(db);
+        sqlite3_close(db);
+        throw std::runtime_error("Could not open PersistentStore database at provided path.");
+    }
+
+    EVLOG_debug << "Using SQLite version " << sqlite3_libversion();
+
+    try {
+        // prepare the database
+        std::string create_sql = "CREATE TABLE IF NOT EXISTS KVS ("
+                                 "KEY   TEXT UNIQUE,"
+                                 "VALUE TEXT,"
+                                 "TYPE  TEXT);";
+
+        Sqlite3_Stmt create_statement;
+        sqlite3_prepare_v2(this->db, create_sql.c_str(), create_sql.size(), &create_statement, NULL);
+        int res = sqlite3_step(create_statement);
+        if (res != SQLITE_DONE) {
+            EVLOG_error << "Could not create KVS table: " << res << sqlite3_errmsg(this->db);
+            throw std::runtime_error("PersistentStore db access error");
+        }
+
+        create_statement.finalize("Error creating KVS table");
+
+        load_cache();
+    } catch (...) {
+        sqlite3_close(db);
+        throw;
+    }
+
+    if (write_back_interval.count() > 0) {
+        flush_thread = std::thread(&SqliteKvs::flush_loop, this);
+    }
+}
+
+SqliteKvs::~SqliteKvs() {
+    shutdown(DESTRUCTOR_SHUTDOWN_TIMEOUT);
+    sqlite3_close(db);
+}
+
+void SqliteKvs::load_cache() {
+    std::string select_sql_str = "SELECT KEY, VALUE, TYPE FROM KVS";
+    Sqlite3_Stmt select_statement;
+    sqlite3_prepare_v2(db, select_sql_str.c_str(), select_sql_str.size(), &select_statement, NULL);
+
+    int res;
+    while ((res = sqlite3_step(select_statement)) == SQLITE_ROW) {
+        auto key_ptr = sqlite3_column_text(select_statement, 0);
+        auto type_ptr = sqlite3_column_text(select_statement, 2);
+        if (key_ptr == nullptr) {
+            continue;
+        }
+        std::string key = reinterpret_cast<const char*>(key_ptr);
+        std::string type = type_ptr != nullptr ? reinterpret_cast<const char*>(type_ptr) : "";
+
+        KvsValue value;
+        try {
+            if (sqlite3_column_type(select_statement, 1) == SQLITE_BLOB) {
+                auto data = static_cast<const std::uint8_t*>(sqlite3_column_blob(select_statement, 1));
+                auto size = static_cast<std::size_t>(sqlite3_column_bytes(select_statement, 1));
+                value = decode_value(type, json::from_cbor(data, data + size));
+            } else if (auto value_ptr = sqlite3_column_text(select_statement, 1); value_ptr != nullptr) {
+                value = decode_text_value(type, reinterpret_cast<const char*>(value_ptr));
+            }
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not decode value of key '" << key << "' in KVS table, ignoring it: " << e.what();
+            continue;
+        }
+        cache[key] = std::move(value);
+    }
+
+    if (res != SQLITE_DONE) {
+        EVLOG_error << "Could not select from KVS table: " << res << sqlite3_errmsg(db);
+        throw std::runtime_error("PersistentStore db access error");
+    }
+
+    select_statement.finalize("Error selecting from KVS table");
+}
+
+void SqliteKvs::flush() {
+    std::lock_guard<std::mutex> db_lock(db_mutex);
+    // taken while holding db_mutex, so batches are written in the order they were taken
+    std::unordered_map<std::string, std::optional<KvsValue>> changes;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        changes.swap(dirty);
+    }
+    if (changes.empty()) {
+        return;
+    }
+
+    try {
+        execute(db, "BEGIN TRANSACTION");
+
+        std::string insert_sql_str = "INSERT OR REPLACE INTO KVS (KEY, VALUE, TYPE) VALUES "
+                                     "(@key, @value, @type)";
+        Sqlite3_Stmt insert_statement;
+        sqlite3_prepare_v2(db, insert_sql_str.c_str(), insert_sql_str.size(), &insert_statement, NULL);
+
+        std::string delete_sql_str = "DELETE FROM KVS WHERE KEY = @key";
+        Sqlite3_Stmt delete_statement;
+        sqlite3_prepare_v2(db, delete_sql_str.c_str(), delete_sql_str.size(), &delete_statement, NULL);
+
+        for (const auto& [key, value] : changes) {
+            int res;
+            if (value.has_value()) {
+                const auto type = std::visit(TypeNameVisitor(), value.value());
+                const auto encoded = encode_value(value.value());
+                sqlite3_bind_text(insert_statement, 1, key.c_str(), -1, NULL);
+                sqlite3_bind_blob(insert_statement, 2, encoded.data(), encoded.size(), NULL);
+                sqlite3_bind_text(insert_statement, 3, type.c_str(), -1, NULL);
+                res = sqlite3_step(insert_statement);
+                sqlite3_reset(insert_statement);
+            } else {
+                sqlite3_bind_text(delete_statement, 1, key.c_str(), -1, NULL);
+                res = sqlite3_step(delete_statement);
+                sqlite3_reset(delete_statement);
+            }
+            if (res != SQLITE_DONE) {
+                EVLOG_error << "Could not write key '" << key << "' to KVS table: " << res << sqlite3_errmsg(db);
+                throw std::runtime_error("PersistentStore db access error");
+            }
+        }
+
+        insert_statement.finalize("Error inserting into KVS table");
+        delete_statement.finalize("Error deleting from KVS table");
+        execute(db, "COMMIT");
+    } catch (const std::exception&) {
+        (void)sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+        // retry with the next flush, unless a key was changed again in the meantime
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        for (auto& [key, value] : changes) {
+            dirty.emplace(key, std::move(value));
+        }
+        throw;
+    }
+}
+
+void SqliteKvs::flush_loop() {
+    std::unique_lock<std::mutex> lock(cache_mutex);
+    while (not stop_flushing) {
+        flush_cv.wait_for(lock, write_back_interval, [this] { return stop_flushing; });
+        if (stop_flushing) {
+            // the final flush is done by shutdown()
+            return;
+        }
+        lock.unlock();
+        try {
+            flush();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not write changes to PersistentStore database, retrying: " << e.what();
+        }
+        lock.lock();
+    }
+}
+
+bool SqliteKvs::shutdown(std::chrono::milliseconds timeout) {
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (shut_down) {
+            return dirty.empty();
+        }
+        shut_down = true;
+        stop_flushing = true;
+    }
+    flush_cv.notify_all();
+    if (flush_thread.joinable()) {
+        flush_thread.join();
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        try {
+            flush();
+            EVLOG_debug << "Wrote pending changes to PersistentStore database";
+            return true;
+        } catch (const std::exception& e) {
+            if (std::chrono::steady_clock::now() + SHUTDOWN_RETRY_INTERVAL > deadline) {
+                EVLOG_error << "Could not write " << pending_changes()
+                            << " pending change(s) to PersistentStore database, they are lost: " << e.what();
+                return false;
+            }
+            EVLOG_warning << "Could not write pending changes to PersistentStore database, retrying: " << e.what();
+        }
+        std::this_thread::sleep_for(SHUTDOWN_RETRY_INTERVAL);
+    }
+}
+
+std::size_t SqliteKvs::pending_changes() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return dirty.size();
+}
+
+void SqliteKvs::store(const std::string& key, const KvsValue& value) {
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache[key] = value;
+        dirty[key] = value;
+    }
+    if (write_back_interval.count() == 0) {
+        flush();
+    }
+}
+
+KvsValue SqliteKvs::load(const std::string& key) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    const auto it = cache.find(key);
+    if (it == cache.end()) {
+        // no key with that name exists in the database
+        return {};
+    }
+    return it->second;
+}
+
+void SqliteKvs::erase(const std::string& key) {
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache.erase(key);
+        dirty[key] = std::nullopt;
+    }
+    if (write_back_interval.count() == 0) {
+        flush();
+    }
+}
+
+bool SqliteKvs::exists(const std::string& key) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache.count(key) != 0;
+}
+
+} // namespace module
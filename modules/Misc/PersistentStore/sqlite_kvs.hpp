@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#ifndef PERSISTENT_STORE_SQLITE_KVS_HPP
+#define PERSISTENT_STORE_SQLITE_KVS_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+#include <sqlite3.h>
+#include <utils/types.hpp>
+
+namespace module {
+
+using KvsValue = std::variant<std::nullptr_t, Array, Object, bool, double, int, std::string>;
+
+///
+/// \brief SQLite backed key-value store with an in-memory cache of all keys
+///
+/// Loads are served from the cache. Stores and deletes update the cache and are written to the database in one
+/// transaction every write back interval, or before returning if the interval is 0. Values are stored as CBOR blobs,
+/// values written as text by earlier versions are still read.
+///
+class SqliteKvs {
+public:
+    ///
+    /// \brief Opens or creates the database at \p db_path and loads all keys into the cache
+    ///
+    /// \throws std::runtime_error if the database can not be opened
+    SqliteKvs(const std::filesystem::path& db_path, std::chrono::milliseconds write_back_interval);
+    SqliteKvs(const SqliteKvs&) = delete;
+    SqliteKvs& operator=(const SqliteKvs&) = delete;
+    ///
+    /// \brief Calls shutdown() with a short timeout
+    ///
+    ~SqliteKvs();
+
+    void store(const std::string& key, const KvsValue& value);
+    ///
+    /// \returns the value of \p key, nullptr if it does not exist
+    KvsValue load(const std::string& key);
+    void erase(const std::string& key);
+    bool exists(const std::string& key);
+
+    ///
+    /// \brief Writes all pending changes to the database
+    ///
+    /// \throws std::runtime_error if the transaction failed, the changes stay pending then
+    void flush();
+
+    ///
+    /// \brief Stops the write back thread and writes the pending changes, retrying until \p timeout expired
+    ///
+    /// \returns true if all pending changes were written, false if they are lost
+    bool shutdown(std::chrono::milliseconds timeout);
+
+    ///
+    /// \returns the number of changes not yet written to the database
+    std::size_t pending_changes();
+
+private:
+    void load_cache();
+    void flush_loop();
+
+    const std::chrono::milliseconds write_back_interval;
+
+    sqlite3* db{nullptr};
+    // serializes database access, taken before cache_mutex
+    std::mutex db_mutex;
+
+    // every key of the database, loads are served from here
+    std::unordered_map<std::string, KvsValue> cache;
+    // changes not yet written to the database, std::nullopt marks a deleted key
+    std::unordered_map<std::string, std::optional<KvsValue>> dirty;
+    std::mutex cache_mutex;
+
+    std::thread flush_thread;
+    std::condition_variable flush_cv;
+    bool stop_flushing{false};
+    bool shut_down{false};
+};
+
+} // namespace module
+
+#endif // PERSISTENT_STORE_SQLITE_KVS_HPP
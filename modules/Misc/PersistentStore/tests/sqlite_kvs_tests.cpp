@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include "sqlite_kvs.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <thread>
+
+#include <unistd.h>
+
+namespace {
+using namespace module;
+using namespace std::chrono_literals;
+
+class SqliteKvsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+                    ("sqlite_kvs_tests_" + std::to_string(getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(directory);
+        db_path = directory / "kvs.db";
+    }
+
+    void TearDown() override {
+        close_raw();
+        std::filesystem::remove_all(directory);
+    }
+
+    // second connection to the database, to inspect and lock it behind the back of the store
+    sqlite3* raw() {
+        if (raw_db == nullptr) {
+            EXPECT_EQ(sqlite3_open(db_path.c_str(), &raw_db), SQLITE_OK);
+        }
+        return raw_db;
+    }
+
+    void close_raw() {
+        if (raw_db != nullptr) {
+            sqlite3_close(raw_db);
+            raw_db = nullptr;
+        }
+    }
+
+    void exec(const std::string& sql) {
+        ASSERT_EQ(sqlite3_exec(raw(), sql.c_str(), nullptr, nullptr, nullptr), SQLITE_OK) << sqlite3_errmsg(raw());
+    }
+
+    // type of the stored VALUE column, std::nullopt if the key is not in the database
+    std::optional<int> column_type(const std::string& key) {
+        sqlite3_stmt* statement = nullptr;
+        const std::string sql = "SELECT VALUE FROM KVS WHERE KEY = '" + key + "'";
+        EXPECT_EQ(sqlite3_prepare_v2(raw(), sql.c_str(), -1, &statement, nullptr), SQLITE_OK);
+        std::optional<int> type;
+        if (sqlite3_step(statement) == SQLITE_ROW) {
+            type = sqlite3_column_type(statement, 0);
+        }
+        sqlite3_finalize(statement);
+        return type;
+    }
+
+    std::filesystem::path directory;
+    std::filesystem::path db_path;
+    sqlite3* raw_db{nullptr};
+};
+
+TEST_F(SqliteKvsTest, WritesThroughWithoutInterval) {
+    SqliteKvs kvs(db_path, 0ms);
+    kvs.store("key", 42);
+    EXPECT_EQ(column_type("key"), SQLITE_BLOB);
+
+    kvs.erase("key");
+    EXPECT_EQ(column_type("key"), std::nullopt);
+    EXPECT_FALSE(kvs.exists("key"));
+}
+
+TEST_F(SqliteKvsTest, WriteBackCacheServesLoadsBeforeFlush) {
+    SqliteKvs kvs(db_path, 1h);
+    kvs.store("key", std::string("value"));
+    kvs.store("other", true);
+    kvs.erase("other");
+
+    EXPECT_EQ(column_type("key"), std::nullopt);
+    EXPECT_EQ(std::get<std::string>(kvs.load("key")), "value");
+    EXPECT_TRUE(kvs.exists("key"));
+    EXPECT_FALSE(kvs.exists("other"));
+    EXPECT_EQ(kvs.pending_changes(), 2);
+
+    EXPECT_TRUE(kvs.shutdown(1s));
+    EXPECT_EQ(column_type("key"), SQLITE_BLOB);
+    EXPECT_EQ(column_type("other"), std::nullopt);
+    EXPECT_EQ(kvs.pending_changes(), 0);
+}
+
+TEST_F(SqliteKvsTest, FlushesOnInterval) {
+    SqliteKvs kvs(db_path, 10ms);
+    kvs.store("key", 1.5);
+    for (int i = 0; i < 200 and not column_type("key").has_value(); ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(column_type("key"), SQLITE_BLOB);
+}
+
+TEST_F(SqliteKvsTest, FailedFlushKeepsChanges) {
+    SqliteKvs kvs(db_path, 1h);
+    kvs.store("key", 1);
+
+    exec("BEGIN EXCLUSIVE");
+    EXPECT_THROW(kvs.flush(), std::runtime_error);
+    EXPECT_EQ(kvs.pending_changes(), 1);
+
+    // a newer value stored after the failed flush wins over the retried one
+    kvs.store("key", 2);
+    exec("COMMIT");
+    kvs.flush();
+    EXPECT_EQ(kvs.pending_changes(), 0);
+    close_raw();
+
+    EXPECT_TRUE(kvs.shutdown(1s));
+    SqliteKvs reopened(db_path, 0ms);
+    EXPECT_EQ(std::get<int>(reopened.load("key")), 2);
+}
+
+TEST_F(SqliteKvsTest, ShutdownRetriesUntilDatabaseIsUnlocked) {
+    SqliteKvs kvs(db_path, 1h);
+    kvs.store("key", 1);
+
+    exec("BEGIN EXCLUSIVE");
+    std::thread unlock([this]() {
+        std::this_thread::sleep_for(300ms);
+        exec("COMMIT");
+    });
+    EXPECT_TRUE(kvs.shutdown(5s));
+    unlock.join();
+    EXPECT_EQ(column_type("key"), SQLITE_BLOB);
+}
+
+TEST_F(SqliteKvsTest, ShutdownReportsLostChanges) {
+    SqliteKvs kvs(db_path, 1h);
+    kvs.store("key", 1);
+
+    exec("BEGIN EXCLUSIVE");
+    EXPECT_FALSE(kvs.shutdown(300ms));
+    EXPECT_EQ(kvs.pending_changes(), 1);
+    exec("COMMIT");
+    EXPECT_EQ(column_type("key"), std::nullopt);
+}
+
+TEST_F(SqliteKvsTest, RoundTripsAllTypesAsCbor) {
+    const Array array = json::array({1, "two", 3.0});
+    const Object object = json::object({{"a", 1}, {"b", json::array({true, nullptr})}});
+    {
+        SqliteKvs kvs(db_path, 0ms);
+        kvs.store("array", array);
+        kvs.store("object", object);
+        kvs.store("bool", false);
+        kvs.store("double", 0.1);
+        kvs.store("int", -7);
+        kvs.store("string", std::string("text"));
+    }
+    EXPECT_EQ(column_type("object"), SQLITE_BLOB);
+
+    SqliteKvs kvs(db_path, 0ms);
+    EXPECT_EQ(std::get<Array>(kvs.load("array")), array);
+    EXPECT_EQ(std::get<Object>(kvs.load("object")), object);
+    EXPECT_EQ(std::get<bool>(kvs.load("bool")), false);
+    EXPECT_EQ(std::get<double>(kvs.load("double")), 0.1);
+    EXPECT_EQ(std::get<int>(kvs.load("int")), -7);
+    EXPECT_EQ(std::get<std::string>(kvs.load("string")), "text");
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(kvs.load("missing")));
+}
+
+TEST_F(SqliteKvsTest, ReadsLegacyTextValues) {
+    {
+        // creates the table
+        SqliteKvs kvs(db_path, 0ms);
+    }
+    exec("INSERT INTO KVS (KEY, VALUE, TYPE) VALUES "
+         "('array', '[1,\"two\"]', 'Array'),"
+         "('object', '{\"a\":{\"b\":2}}', 'Object'),"
+         "('bool', 'true', 'bool'),"
+         "('double', '2.5', 'double'),"
+         "('int', '12', 'int'),"
+         "('string', 'text', 'std::string'),"
+         "('broken', '{', 'Object')");
+    close_raw();
+
+    SqliteKvs kvs(db_path, 0ms);
+    EXPECT_EQ(std::get<Array>(kvs.load("array")), json::array({1, "two"}));
+    EXPECT_EQ(std::get<Object>(kvs.load("object")), json::parse(R"({"a":{"b":2}})"));
+    EXPECT_EQ(std::get<bool>(kvs.load("bool")), true);
+    EXPECT_EQ(std::get<double>(kvs.load("double")), 2.5);
+    EXPECT_EQ(std::get<int>(kvs.load("int")), 12);
+    EXPECT_EQ(std::get<std::string>(kvs.load("string")), "text");
+    // values that can not be decoded are skipped instead of failing the whole load
+    EXPECT_FALSE(kvs.exists("broken"));
+
+    // rewriting a legacy value stores it as CBOR
+    kvs.store("int", 13);
+    EXPECT_EQ(column_type("int"), SQLITE_BLOB);
+}
+
+} // namespace
@@ -6,6 +6,7 @@
 
 #include <framework/ModuleAdapter.hpp>
 
+#include <memory>
 #include <optional>
 #include <utils/error/error_database_map.hpp>
 #include <utils/error/error_factory.hpp>
@@ -23,10 +24,17 @@ struct ModuleAdapterStub : public Everest::ModuleAdapter {
         call = [this](const Requirement& req, const std::string& str, Parameters p) {
             return this->call_fn(req, str, p);
         };
+        call_async = [this](const Requirement& req, const std::string& str, Parameters p,
+                            const Everest::AsyncCmdResultHandler& handler) {
+            this->call_async_fn(req, str, p, handler);
+        };
         publish = [this](const std::string& s1, const std::string& s2, Value v) { this->publish_fn(s1, s2, v); };
         subscribe = [this](const Requirement& req, const std::string& str, ValueCallback cb) {
             this->subscribe_fn(req, str, cb);
         };
+        subscribe_async = [this](const Requirement& req, const std::string& str, ValueCallback cb) {
+            this->subscribe_fn(req, str, cb);
+        };
         get_error_manager_impl = [this](const std::string& str) { return this->get_error_manager_impl_fn(str); };
         get_error_state_monitor_impl = [this](const std::string& str) {
             return this->get_error_state_monitor_impl_fn(str);
@@ -48,12 +56,20 @@ struct ModuleAdapterStub : public Everest::ModuleAdapter {
         telemetry_publish = [this](const std::string& s1, const std::string& s2, const std::string& s3,
                                    const Everest::TelemetryMap& tm) { this->telemetry_publish_fn(s1, s2, s3, tm); };
         get_mapping = [this]() { return this->get_mapping_fn(); };
+        get_executor = [this]() -> Everest::ModuleExecutor& { return this->get_executor_fn(); };
+        set_var_policy = [this](const Requirement& req, const std::string& str, const TopicPolicy& policy) {
+            this->set_var_policy_fn(req, str, policy);
+        };
     }
 
     virtual Result call_fn(const Requirement&, const std::string&, Parameters) {
         std::printf("call_fn\n");
         return std::nullopt;
     }
+    virtual void call_async_fn(const Requirement& req, const std::string& str, Parameters p,
+                               const Everest::AsyncCmdResultHandler& handler) {
+        handler(Everest::AsyncResult<Value>(this->call_fn(req, str, p).value_or(nullptr)));
+    }
     virtual void publish_fn(const std::string&, const std::string&, Value) {
         std::printf("publish_fn\n");
     }
@@ -118,6 +134,16 @@ struct ModuleAdapterStub : public Everest::ModuleAdapter {
         std::printf("get_mapping_fn\n");
         return {};
     }
+    virtual Everest::ModuleExecutor& get_executor_fn() {
+        if (not executor) {
+            executor = std::make_unique<Everest::ModuleExecutor>();
+        }
+        return *executor;
+    }
+    virtual void set_var_policy_fn(const Requirement&, const std::string&, const TopicPolicy&) {
+    }
+
+    std::unique_ptr<Everest::ModuleExecutor> executor;
 };
 
 struct QuietModuleAdapterStub : public ModuleAdapterStub {